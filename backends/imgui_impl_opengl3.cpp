@@ -6,6 +6,7 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Large meshes support (64k+ vertices) with 16-bit indices (Desktop OpenGL only).
+//  [x] Renderer: Analytic anti-aliased shapes (filled circles, ellipses, rounded rectangles as a single quad). GLSL 130+ only.
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -22,6 +23,10 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2024-11-27: OpenGL: Added support for analytic shapes (GLSL 130+), enable ImGuiBackendFlags_RendererHasAnalyticShapes flag.
+//  2024-11-22: OpenGL: Added support for ImDrawData::DamageRects (only draw within damaged areas), enable ImGuiBackendFlags_RendererHasDamageRects flag.
+//  2024-11-21: OpenGL: Added support for compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT), enable ImGuiBackendFlags_RendererHasCompactVtx flag.
+//  2024-11-20: OpenGL: Added support for ImDrawList::IdxSize (mixed 16/32-bit indices, large draw lists are not split with VtxOffset), enable ImGuiBackendFlags_RendererHasIdxSize flag.
 //  2024-10-07: OpenGL: Changed default texture sampler to Clamp instead of Repeat/Wrap.
 //  2024-06-28: OpenGL: ImGui_ImplOpenGL3_NewFrame() recreates font texture if it has been destroyed by ImGui_ImplOpenGL3_DestroyFontsTexture(). (#7748)
 //  2024-05-07: OpenGL: Update loader for Linux to support EGL/GLVND. (#7562)
@@ -230,6 +235,7 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
+    GLint           AttribLocationAnalyticShapes;
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
@@ -238,6 +244,7 @@ struct ImGui_ImplOpenGL3_Data
     GLsizeiptr      IndexBufferSize;
     bool            HasPolygonMode;
     bool            HasClipOrigin;
+    bool            HasAnalyticShapes;
     bool            UseBufferSubData;
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
@@ -342,6 +349,9 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     if (bd->GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasIdxSize;        // We can honor the ImDrawList::IdxSize field, allowing each draw list to use 16-bit or 32-bit indices.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasCompactVtx;     // We can render the compact ImDrawVert layout when compiled with IMGUI_USE_COMPACT_DRAWVERT.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasDamageRects;    // We can honor the ImDrawData::DamageRects field, only drawing within damaged areas.
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to nullptr if unsure.
@@ -361,6 +371,13 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     strcpy(bd->GlslVersionString, glsl_version);
     strcat(bd->GlslVersionString, "\n");
 
+    // Analytic shapes need flat varyings and derivatives in our shaders
+    int glsl_version_num = 130;
+    sscanf(bd->GlslVersionString, "#version %d", &glsl_version_num);
+    bd->HasAnalyticShapes = (glsl_version_num >= 130);
+    if (bd->HasAnalyticShapes)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasAnalyticShapes; // We can decode analytic shapes (filled circles, ellipses, rounded rectangles output as a single quad).
+
     // Make an arbitrary GL call (we don't actually need the result)
     // IF YOU GET A CRASH HERE: it probably means the OpenGL function loader didn't do its job. Let us know!
     GLint current_texture;
@@ -394,7 +411,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasIdxSize | ImGuiBackendFlags_RendererHasCompactVtx | ImGuiBackendFlags_RendererHasDamageRects | ImGuiBackendFlags_RendererHasAnalyticShapes);
     IM_DELETE(bd);
 }
 
@@ -450,17 +467,24 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
 #if defined(GL_CLIP_ORIGIN)
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
+#endif
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float S = 1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS); // Vertex positions are fixed-point
+#else
+    const float S = 1.0f;
 #endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
+        { 2.0f*S/(R-L), 0.0f,         0.0f,   0.0f },
+        { 0.0f,         2.0f*S/(T-B), 0.0f,   0.0f },
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    if (bd->HasAnalyticShapes)
+        glUniform1i(bd->AttribLocationAnalyticShapes, 0);
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
@@ -478,11 +502,25 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,          GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#else
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#endif
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
+// Intersect a clipping rectangle with one of ImDrawData::DamageRects[]
+static void ImGui_ImplOpenGL3_ClipWithDamageRect(ImVec4* clip_rect, const ImVec4& damage_rect)
+{
+    clip_rect->x = (clip_rect->x > damage_rect.x) ? clip_rect->x : damage_rect.x;
+    clip_rect->y = (clip_rect->y > damage_rect.y) ? clip_rect->y : damage_rect.y;
+    clip_rect->z = (clip_rect->z < damage_rect.z) ? clip_rect->z : damage_rect.z;
+    clip_rect->w = (clip_rect->w < damage_rect.w) ? clip_rect->w : damage_rect.w;
+}
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -494,6 +532,10 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     if (fb_width <= 0 || fb_height <= 0)
         return;
 
+    // Nothing changed in the back buffer. With io.ConfigDrawDataDamageRects, the application is expected to only clear within DamageRects[], so there is nothing to clear either.
+    if (draw_data->DamageRectsValid && draw_data->DamageRects.Size == 0)
+        return;
+
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
     // Backup GL state
@@ -548,10 +590,14 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
+    // Analytic shapes are only decoded while the font texture is bound (other textures may legitimately use UV > 1.0f)
+    int analytic_shapes_state = 0; // Value of our uniform, -1 if unknown
+
     // Render command lists
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* draw_list = draw_data->CmdLists[n];
+        const int idx_size = draw_list->IdxSize;
 
         // Upload vertex/index buffers
         // - OpenGL drivers are in a very sorry state nowadays....
@@ -595,26 +641,44 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
                 else
                     pcmd->UserCallback(draw_list, pcmd);
+                analytic_shapes_state = (pcmd->UserCallback == ImDrawCallback_ResetRenderState) ? 0 : -1;
             }
             else
             {
-                // Project scissor/clipping rectangles into framebuffer space
-                ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
-                ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
-                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
-                    continue;
-
-                // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
-                GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
-
-                // Bind texture, Draw
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                const GLuint texture = (GLuint)(intptr_t)pcmd->GetTexID();
+                const int analytic_shapes = (texture == bd->FontTexture) ? 1 : 0;
+                if (bd->HasAnalyticShapes && analytic_shapes_state != analytic_shapes)
+                {
+                    analytic_shapes_state = analytic_shapes;
+                    GL_CALL(glUniform1i(bd->AttribLocationAnalyticShapes, analytic_shapes));
+                }
+
+                // When ImDrawData::DamageRects are provided, draw once within each of them (they are disjoint)
+                const int damage_count = draw_data->DamageRectsValid ? draw_data->DamageRects.Size : 1;
+                for (int damage_n = 0; damage_n < damage_count; damage_n++)
+                {
+                    ImVec4 clip_rect = pcmd->ClipRect;
+                    if (draw_data->DamageRectsValid)
+                        ImGui_ImplOpenGL3_ClipWithDamageRect(&clip_rect, draw_data->DamageRects[damage_n]);
+
+                    // Project scissor/clipping rectangles into framebuffer space
+                    ImVec2 clip_min((clip_rect.x - clip_off.x) * clip_scale.x, (clip_rect.y - clip_off.y) * clip_scale.y);
+                    ImVec2 clip_max((clip_rect.z - clip_off.x) * clip_scale.x, (clip_rect.w - clip_off.y) * clip_scale.y);
+                    if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                        continue;
+
+                    // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
+                    GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
+
+                    // Bind texture, Draw
+                    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
-                if (bd->GlVersion >= 320)
-                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
-                else
+                    if (bd->GlVersion >= 320)
+                        GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_size == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * idx_size), (GLint)pcmd->VtxOffset));
+                    else
 #endif
-                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
+                    GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_size == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * idx_size)));
+                }
             }
         }
     }
@@ -748,6 +812,30 @@ static bool CheckProgram(GLuint handle, const char* desc)
     return (GLboolean)status == GL_TRUE;
 }
 
+// Coverage of analytic shapes from their signed distance (see "Analytic shapes" in imgui.h), used by GLSL 130+ fragment shaders.
+// - 'q' is the position in shape normalized space (-1..+1 between opposite edges), 'shape' holds the UV integer parts minus 2.
+// - Shape size in framebuffer pixels is recovered from the screen-space derivatives of 'q', which the caller computes in uniform control flow.
+#define IMGUI_IMPL_OPENGL_SHAPE_COVERAGE_GLSL \
+    "highp float ShapeCoverage(highp vec2 q, highp vec2 q_dx, highp vec2 q_dy, highp vec2 shape)\n" \
+    "{\n" \
+    "    highp float dist;\n" \
+    "    if (shape.x >= 16.0)\n" \
+    "    {\n" \
+    "        highp vec2 half_size = 1.0 / abs(vec2(q_dx.x, q_dy.y));\n" \
+    "        highp float corner_bit = exp2(step(0.0, q.x) + 2.0 * step(0.0, q.y));\n" \
+    "        highp float rounding = mod(floor((shape.x - 16.0) / corner_bit), 2.0) * (shape.y * shape.y * 0.000001) * min(half_size.x, half_size.y);\n" \
+    "        highp vec2 d = (abs(q) - 1.0) * half_size + rounding;\n" \
+    "        dist = length(max(d, 0.0)) + min(max(d.x, d.y), 0.0) - rounding;\n" \
+    "    }\n" \
+    "    else\n" \
+    "    {\n" \
+    "        highp float len = max(length(q), 0.0001);\n" \
+    "        highp vec2 n = q / len;\n" \
+    "        dist = (len - 1.0) / length(vec2(dot(n, q_dx), dot(n, q_dy)));\n" \
+    "    }\n" \
+    "    return clamp(0.5 - dist, 0.0, 1.0);\n" \
+    "}\n"
+
 bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
@@ -785,14 +873,23 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     const GLchar* vertex_shader_glsl_130 =
         "uniform mat4 ProjMtx;\n"
+        "uniform int AnalyticShapes;\n"
         "in vec2 Position;\n"
         "in vec2 UV;\n"
         "in vec4 Color;\n"
         "out vec2 Frag_UV;\n"
         "out vec4 Frag_Color;\n"
+        "flat out vec2 Frag_Shape;\n"
         "void main()\n"
         "{\n"
         "    Frag_UV = UV;\n"
+        "    Frag_Shape = vec2(-1.0);\n"
+        "    if (AnalyticShapes != 0 && UV.x >= 2.0)\n"
+        "    {\n"
+        "        vec2 code = floor(UV);\n"
+        "        Frag_UV = (UV - code - 0.5) * 4.0;\n"
+        "        Frag_Shape = code - 2.0;\n"
+        "    }\n"
         "    Frag_Color = Color;\n"
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
         "}\n";
@@ -803,11 +900,20 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "layout (location = 1) in vec2 UV;\n"
         "layout (location = 2) in vec4 Color;\n"
         "uniform mat4 ProjMtx;\n"
+        "uniform int AnalyticShapes;\n"
         "out vec2 Frag_UV;\n"
         "out vec4 Frag_Color;\n"
+        "flat out vec2 Frag_Shape;\n"
         "void main()\n"
         "{\n"
         "    Frag_UV = UV;\n"
+        "    Frag_Shape = vec2(-1.0);\n"
+        "    if (AnalyticShapes != 0 && UV.x >= 2.0)\n"
+        "    {\n"
+        "        vec2 code = floor(UV);\n"
+        "        Frag_UV = (UV - code - 0.5) * 4.0;\n"
+        "        Frag_Shape = code - 2.0;\n"
+        "    }\n"
         "    Frag_Color = Color;\n"
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
         "}\n";
@@ -817,11 +923,20 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "layout (location = 1) in vec2 UV;\n"
         "layout (location = 2) in vec4 Color;\n"
         "uniform mat4 ProjMtx;\n"
+        "uniform int AnalyticShapes;\n"
         "out vec2 Frag_UV;\n"
         "out vec4 Frag_Color;\n"
+        "flat out vec2 Frag_Shape;\n"
         "void main()\n"
         "{\n"
         "    Frag_UV = UV;\n"
+        "    Frag_Shape = vec2(-1.0);\n"
+        "    if (AnalyticShapes != 0 && UV.x >= 2.0)\n"
+        "    {\n"
+        "        vec2 code = floor(UV);\n"
+        "        Frag_UV = (UV - code - 0.5) * 4.0;\n"
+        "        Frag_Shape = code - 2.0;\n"
+        "    }\n"
         "    Frag_Color = Color;\n"
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
         "}\n";
@@ -842,31 +957,46 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "uniform sampler2D Texture;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
+        "flat in vec2 Frag_Shape;\n"
         "out vec4 Out_Color;\n"
+        IMGUI_IMPL_OPENGL_SHAPE_COVERAGE_GLSL
         "void main()\n"
         "{\n"
+        "    vec2 q_dx = dFdx(Frag_UV), q_dy = dFdy(Frag_UV);\n"
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    if (Frag_Shape.x >= 0.0)\n"
+        "        Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * ShapeCoverage(Frag_UV, q_dx, q_dy, Frag_Shape));\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_300_es =
         "precision mediump float;\n"
         "uniform sampler2D Texture;\n"
-        "in vec2 Frag_UV;\n"
+        "in highp vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
+        "flat in highp vec2 Frag_Shape;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
+        IMGUI_IMPL_OPENGL_SHAPE_COVERAGE_GLSL
         "void main()\n"
         "{\n"
+        "    highp vec2 q_dx = dFdx(Frag_UV), q_dy = dFdy(Frag_UV);\n"
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    if (Frag_Shape.x >= 0.0)\n"
+        "        Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * ShapeCoverage(Frag_UV, q_dx, q_dy, Frag_Shape));\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_410_core =
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
+        "flat in vec2 Frag_Shape;\n"
         "uniform sampler2D Texture;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
+        IMGUI_IMPL_OPENGL_SHAPE_COVERAGE_GLSL
         "void main()\n"
         "{\n"
+        "    vec2 q_dx = dFdx(Frag_UV), q_dy = dFdy(Frag_UV);\n"
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    if (Frag_Shape.x >= 0.0)\n"
+        "        Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * ShapeCoverage(Frag_UV, q_dx, q_dy, Frag_Shape));\n"
         "}\n";
 
     // Select shaders matching our GLSL versions
@@ -922,6 +1052,7 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
     bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
+    bd->AttribLocationAnalyticShapes = glGetUniformLocation(bd->ShaderHandle, "AnalyticShapes");
     bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Position");
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
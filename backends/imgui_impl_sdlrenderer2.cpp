@@ -21,6 +21,7 @@
 // - Introduction, links and more at the top of imgui.cpp
 
 // CHANGELOG
+//  2024-11-22: Added support for ImDrawData::DamageRects (only draw within damaged areas), enable ImGuiBackendFlags_RendererHasDamageRects flag.
 //  2024-10-09: Expose selected render state in ImGui_ImplSDLRenderer2_RenderState, which you can access in 'void* platform_io.Renderer_RenderState' during draw callbacks.
 //  2024-05-14: *BREAKING CHANGE* ImGui_ImplSDLRenderer3_RenderDrawData() requires SDL_Renderer* passed as parameter.
 //  2023-05-30: Renamed imgui_impl_sdlrenderer.h/.cpp to imgui_impl_sdlrenderer2.h/.cpp to accommodate for upcoming SDL3.
@@ -75,6 +76,7 @@ bool ImGui_ImplSDLRenderer2_Init(SDL_Renderer* renderer)
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_sdlrenderer2";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasDamageRects; // We can honor the ImDrawData::DamageRects field, only drawing within damaged areas.
 
     bd->Renderer = renderer;
 
@@ -91,7 +93,7 @@ void ImGui_ImplSDLRenderer2_Shutdown()
 
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasDamageRects);
     IM_DELETE(bd);
 }
 
@@ -112,6 +114,15 @@ void ImGui_ImplSDLRenderer2_NewFrame()
         ImGui_ImplSDLRenderer2_CreateDeviceObjects();
 }
 
+// Intersect a clipping rectangle with one of ImDrawData::DamageRects[]
+static void ImGui_ImplSDLRenderer2_ClipWithDamageRect(ImVec4* clip_rect, const ImVec4& damage_rect)
+{
+    clip_rect->x = (clip_rect->x > damage_rect.x) ? clip_rect->x : damage_rect.x;
+    clip_rect->y = (clip_rect->y > damage_rect.y) ? clip_rect->y : damage_rect.y;
+    clip_rect->z = (clip_rect->z < damage_rect.z) ? clip_rect->z : damage_rect.z;
+    clip_rect->w = (clip_rect->w < damage_rect.w) ? clip_rect->w : damage_rect.w;
+}
+
 void ImGui_ImplSDLRenderer2_RenderDrawData(ImDrawData* draw_data, SDL_Renderer* renderer)
 {
 	// If there's a scale factor set by the user, use that instead
@@ -130,6 +141,10 @@ void ImGui_ImplSDLRenderer2_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
 	if (fb_width == 0 || fb_height == 0)
 		return;
 
+    // Nothing changed in the back buffer. With io.ConfigDrawDataDamageRects, the application is expected to only clear within DamageRects[], so there is nothing to clear either.
+    if (draw_data->DamageRectsValid && draw_data->DamageRects.Size == 0)
+        return;
+
     // Backup SDL_Renderer state that will be modified to restore it afterwards
     struct BackupSDLRendererState
     {
@@ -176,35 +191,44 @@ void ImGui_ImplSDLRenderer2_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
             }
             else
             {
-                // Project scissor/clipping rectangles into framebuffer space
-                ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
-                ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
-                if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
-                if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
-                if (clip_max.x > (float)fb_width) { clip_max.x = (float)fb_width; }
-                if (clip_max.y > (float)fb_height) { clip_max.y = (float)fb_height; }
-                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
-                    continue;
-
-                SDL_Rect r = { (int)(clip_min.x), (int)(clip_min.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y) };
-                SDL_RenderSetClipRect(renderer, &r);
-
-                const float* xy = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, pos));
-                const float* uv = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, uv));
+                // When ImDrawData::DamageRects are provided, draw once within each of them (they are disjoint)
+                const int damage_count = draw_data->DamageRectsValid ? draw_data->DamageRects.Size : 1;
+                for (int damage_n = 0; damage_n < damage_count; damage_n++)
+                {
+                    ImVec4 clip_rect = pcmd->ClipRect;
+                    if (draw_data->DamageRectsValid)
+                        ImGui_ImplSDLRenderer2_ClipWithDamageRect(&clip_rect, draw_data->DamageRects[damage_n]);
+
+                    // Project scissor/clipping rectangles into framebuffer space
+                    ImVec2 clip_min((clip_rect.x - clip_off.x) * clip_scale.x, (clip_rect.y - clip_off.y) * clip_scale.y);
+                    ImVec2 clip_max((clip_rect.z - clip_off.x) * clip_scale.x, (clip_rect.w - clip_off.y) * clip_scale.y);
+                    if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
+                    if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
+                    if (clip_max.x > (float)fb_width) { clip_max.x = (float)fb_width; }
+                    if (clip_max.y > (float)fb_height) { clip_max.y = (float)fb_height; }
+                    if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                        continue;
+
+                    SDL_Rect r = { (int)(clip_min.x), (int)(clip_min.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y) };
+                    SDL_RenderSetClipRect(renderer, &r);
+
+                    const float* xy = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, pos));
+                    const float* uv = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, uv));
 #if SDL_VERSION_ATLEAST(2,0,19)
-                const SDL_Color* color = (const SDL_Color*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, col)); // SDL 2.0.19+
+                    const SDL_Color* color = (const SDL_Color*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, col)); // SDL 2.0.19+
 #else
-                const int* color = (const int*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, col)); // SDL 2.0.17 and 2.0.18
+                    const int* color = (const int*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, col)); // SDL 2.0.17 and 2.0.18
 #endif
 
-                // Bind texture, Draw
-				SDL_Texture* tex = (SDL_Texture*)pcmd->GetTexID();
-                SDL_RenderGeometryRaw(renderer, tex,
-                    xy, (int)sizeof(ImDrawVert),
-                    color, (int)sizeof(ImDrawVert),
-                    uv, (int)sizeof(ImDrawVert),
-                    draw_list->VtxBuffer.Size - pcmd->VtxOffset,
-                    idx_buffer + pcmd->IdxOffset, pcmd->ElemCount, sizeof(ImDrawIdx));
+                    // Bind texture, Draw
+                    SDL_Texture* tex = (SDL_Texture*)pcmd->GetTexID();
+                    SDL_RenderGeometryRaw(renderer, tex,
+                        xy, (int)sizeof(ImDrawVert),
+                        color, (int)sizeof(ImDrawVert),
+                        uv, (int)sizeof(ImDrawVert),
+                        draw_list->VtxBuffer.Size - pcmd->VtxOffset,
+                        idx_buffer + pcmd->IdxOffset, pcmd->ElemCount, sizeof(ImDrawIdx));
+                }
             }
         }
     }
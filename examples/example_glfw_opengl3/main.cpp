@@ -126,6 +126,14 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // To save power, when io.WantRedraw is false we block until the next event, or until io.NextRedrawDelay elapsed (e.g. text cursor blink).
+#ifndef __EMSCRIPTEN__
+        if (!io.WantRedraw && io.NextRedrawDelay < FLT_MAX)
+            glfwWaitEventsTimeout((double)io.NextRedrawDelay);
+        else if (!io.WantRedraw)
+            glfwWaitEvents();
+        else
+#endif
         glfwPollEvents();
         if (glfwGetWindowAttrib(window, GLFW_ICONIFIED) != 0)
         {
@@ -181,8 +189,24 @@ int main(int, char**)
         glfwGetFramebufferSize(window, &display_w, &display_h);
         glViewport(0, 0, display_w, display_h);
         glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
-        glClear(GL_COLOR_BUFFER_BIT);
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        if (draw_data->DamageRectsValid)
+        {
+            // With io.ConfigDrawDataDamageRects, only clear where the backend is going to draw.
+            // GLFW doesn't tell the age of the back buffer (io.DisplayBufferAge), so DamageRects cover the whole display here: this only shows how to use them.
+            glEnable(GL_SCISSOR_TEST);
+            for (const ImVec4& r : draw_data->DamageRects)
+            {
+                glScissor((int)(r.x * io.DisplayFramebufferScale.x), (int)(display_h - r.w * io.DisplayFramebufferScale.y), (int)((r.z - r.x) * io.DisplayFramebufferScale.x), (int)((r.w - r.y) * io.DisplayFramebufferScale.y));
+                glClear(GL_COLOR_BUFFER_BIT);
+            }
+            glDisable(GL_SCISSOR_TEST);
+        }
+        else
+        {
+            glClear(GL_COLOR_BUFFER_BIT);
+        }
+        ImGui_ImplOpenGL3_RenderDrawData(draw_data);
 
         glfwSwapBuffers(window);
     }
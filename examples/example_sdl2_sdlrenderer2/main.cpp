@@ -98,6 +98,11 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // To save power, when io.WantRedraw is false we block until the next event, or until io.NextRedrawDelay elapsed (e.g. text cursor blink).
+#ifndef __EMSCRIPTEN__
+        if (!io.WantRedraw)
+            SDL_WaitEventTimeout(nullptr, (io.NextRedrawDelay < FLT_MAX) ? (int)(io.NextRedrawDelay * 1000.0f) + 1 : -1);
+#endif
         SDL_Event event;
         while (SDL_PollEvent(&event))
         {
@@ -159,8 +164,22 @@ int main(int, char**)
         ImGui::Render();
         SDL_RenderSetScale(renderer, io.DisplayFramebufferScale.x, io.DisplayFramebufferScale.y);
         SDL_SetRenderDrawColor(renderer, (Uint8)(clear_color.x * 255), (Uint8)(clear_color.y * 255), (Uint8)(clear_color.z * 255), (Uint8)(clear_color.w * 255));
-        SDL_RenderClear(renderer);
-        ImGui_ImplSDLRenderer2_RenderDrawData(ImGui::GetDrawData(), renderer);
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        if (draw_data->DamageRectsValid)
+        {
+            // With io.ConfigDrawDataDamageRects, only clear where the backend is going to draw.
+            // SDL doesn't tell the age of the back buffer (io.DisplayBufferAge), so DamageRects cover the whole display here: this only shows how to use them.
+            for (const ImVec4& r : draw_data->DamageRects)
+            {
+                SDL_FRect fill_rect = { r.x, r.y, r.z - r.x, r.w - r.y };
+                SDL_RenderFillRectF(renderer, &fill_rect);
+            }
+        }
+        else
+        {
+            SDL_RenderClear(renderer);
+        }
+        ImGui_ImplSDLRenderer2_RenderDrawData(draw_data, renderer);
         SDL_RenderPresent(renderer);
     }
 
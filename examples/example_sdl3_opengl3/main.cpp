@@ -127,6 +127,11 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // To save power, when io.WantRedraw is false we block until the next event, or until io.NextRedrawDelay elapsed (e.g. text cursor blink).
+#ifndef __EMSCRIPTEN__
+        if (!io.WantRedraw)
+            SDL_WaitEventTimeout(nullptr, (io.NextRedrawDelay < FLT_MAX) ? (int)(io.NextRedrawDelay * 1000.0f) + 1 : -1);
+#endif
         SDL_Event event;
         while (SDL_PollEvent(&event))
         {
@@ -49,6 +49,8 @@
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
+//#define IMGUI_DISABLE_NEON                                // Disable use of NEON intrinsics even if available (AArch64)
+//#define IMGUI_USE_CRC32C                                  // Use hardware CRC32C (SSE4.2, ARMv8 CRC) for ImHashData()/ImHashStr() when the target supports it. CRC32C uses a different polynomial: all IDs will change and won't match builds using the default table-based CRC32.
 
 //---- Enable Test Engine / Automation features.
 //#define IMGUI_ENABLE_TEST_ENGINE                          // Enable imgui_test_engine hooks. Generally set automatically by include "imgui_te_config.h", see Test Engine for details.
@@ -109,12 +111,26 @@
 //---- ...Or use Dear ImGui's own very basic math operators.
 //#define IMGUI_DEFINE_MATH_OPERATORS
 
+//---- Define constructors to convert your string types to ImStrv (string view passed to e.g. Begin(), Button(), Text(), TreeNode()).
+/*
+#define IM_STRV_CLASS_EXTRA                                                     \
+        ImStrv(const std::string& s) : Begin(s.c_str()), End(s.c_str() + s.length()) {} \
+        ImStrv(std::string_view s) : Begin(s.data()), End(s.data() + s.size()) {}
+*/
+
 //---- Use 32-bit vertex indices (default is 16-bit) is one way to allow large meshes with more than 64K vertices.
 // Your renderer backend will need to support it (most example renderer backends support both 16/32-bit indices).
 // Another way to allow large meshes while keeping 16-bit indices is to handle ImDrawCmd::VtxOffset in your renderer.
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
+// Backends supporting ImGuiBackendFlags_RendererHasIdxSize get the index size chosen per draw list either way, so they don't need this.
 //#define ImDrawIdx unsigned int
 
+//---- Use compact 12 bytes vertices (default is 20 bytes): 16-bit fixed-point positions, 16-bit normalized UV, 32-bit color.
+// Reduces vertex memory and upload bandwidth. Your renderer backend will need to support it (see ImGuiBackendFlags_RendererHasCompactVtx).
+// Positions are limited to -8192..+8191 with 1/4 pixel precision by default (see IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS), and assert when out of range.
+// UV are limited to 0.0f..1.0f: textures can't be repeated by using UV > 1.0f.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
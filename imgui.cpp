@@ -1068,6 +1068,7 @@ CODE
 #include "imgui_internal.h"
 
 // System includes
+#include <locale.h>     // localeconv
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #include <stdint.h>     // intptr_t
 
@@ -1164,6 +1165,9 @@ static const float WINDOWS_HOVER_PADDING                    = 4.0f;     // Exten
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 0.70f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
 
+// Low-power applications (io.WantRedraw)
+static const int   REDRAW_FRAMES_AFTER_INPUT                = 3;        // Keep processing frames after input events, as some interactions take a few frames to settle.
+
 // Tooltip offset
 static const ImVec2 TOOLTIP_DEFAULT_OFFSET_MOUSE = ImVec2(16, 10);      // Multiplied by g.Style.MouseCursorScale
 static const ImVec2 TOOLTIP_DEFAULT_OFFSET_TOUCH = ImVec2(0, -20);      // Multiplied by g.Style.MouseCursorScale
@@ -1174,7 +1178,7 @@ static const ImVec2 TOOLTIP_DEFAULT_PIVOT_TOUCH = ImVec2(0.5f, 1.0f);   // Multi
 //-------------------------------------------------------------------------
 
 static void             SetCurrentWindow(ImGuiWindow* window);
-static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags);
+static ImGuiWindow*     CreateNewWindow(ImStrv name, ImGuiWindowFlags flags);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
 
 static void             AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
@@ -1236,10 +1240,12 @@ static void             UpdateKeyRoutingTable(ImGuiKeyRoutingTable* rt);
 
 // Misc
 static void             UpdateSettings();
+static void             UpdateTextSizeCache();
+static void             UpdateWantRedraw();
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, bool handle_borders_and_resize_grips, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
-static void             RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& title_bar_rect, const char* name, bool* p_open);
+static void             RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& title_bar_rect, ImStrv name, bool* p_open);
 static void             RenderDimmedBackgroundBehindWindow(ImGuiWindow* window, ImU32 col);
 static void             RenderDimmedBackgrounds();
 static void             SetLastItemDataForWindow(ImGuiWindow* window, const ImRect& rect);
@@ -1435,6 +1441,9 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigTextSizeCache = false;
+    ConfigDrawDataDamageRects = false;
+    DisplayBufferAge = 0;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugBeginReturnValueOnce = false;
@@ -1457,6 +1466,9 @@ ImGuiIO::ImGuiIO()
     BackendPlatformName = BackendRendererName = NULL;
     BackendPlatformUserData = BackendRendererUserData = BackendLanguageUserData = NULL;
 
+    // Output
+    WantRedraw = true; // Until first frame is processed
+
     // Input (NB: we already have memset zero the entire structure!)
     MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
     MousePosPrev = ImVec2(-FLT_MAX, -FLT_MAX);
@@ -2003,25 +2015,86 @@ const char* ImStrbol(const char* buf_mid_line, const char* buf_begin) // find be
     return buf_mid_line;
 }
 
+// Case insensitive compare of two ranges of same length (ASCII only, like ImToUpper())
+static inline bool ImStristr_MatchRest(const char* a, const char* b, const char* b_end)
+{
+    for (; b < b_end; a++, b++)
+        if (*a != *b && ImToUpper(*a) != ImToUpper(*b))
+            return false;
+    return true;
+}
+
+// Find a substring, case insensitive (ASCII only).
+// - Candidate positions are located by comparing both the first and last needle characters 16 bytes (SIMD) or 8 bytes (scalar) at a time,
+//   then verified. Letters are folded with 'c | 0x20' which maps exactly the upper and lower case of a letter to the same value.
+// - An empty needle never matches.
 const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
 {
     if (!needle_end)
         needle_end = needle + strlen(needle);
+    if (!haystack_end)
+        haystack_end = haystack + strlen(haystack);
+    const size_t needle_len = (size_t)(needle_end - needle);
+    if (needle_len == 0 || (size_t)(haystack_end - haystack) < needle_len)
+        return NULL;
 
-    const char un0 = (char)ImToUpper(*needle);
-    while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
+    const char* haystack_last = haystack_end - needle_len; // Last possible match position
+    const char n_first = needle[0];
+    const char n_last = needle_end[-1];
+    const unsigned char fold_first = ImCharIsAlphaA(n_first) ? 0x20 : 0x00;
+    const unsigned char fold_last = ImCharIsAlphaA(n_last) ? 0x20 : 0x00;
+    const size_t last_offset = needle_len - 1;
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128i v_fold_first = _mm_set1_epi8((char)fold_first), v_first = _mm_set1_epi8((char)(n_first | fold_first));
+    const __m128i v_fold_last = _mm_set1_epi8((char)fold_last), v_last = _mm_set1_epi8((char)(n_last | fold_last));
+    for (; haystack_last - haystack >= 15; haystack += 16)
+    {
+        const __m128i eq_first = _mm_cmpeq_epi8(_mm_or_si128(_mm_loadu_si128((const __m128i*)(const void*)haystack), v_fold_first), v_first);
+        const __m128i eq_last = _mm_cmpeq_epi8(_mm_or_si128(_mm_loadu_si128((const __m128i*)(const void*)(haystack + last_offset)), v_fold_last), v_last);
+        for (unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(eq_first, eq_last)); mask != 0; mask &= mask - 1)
+        {
+            const char* p = haystack + ImCountTrailingZeros32(mask);
+            if (ImStristr_MatchRest(p + 1, needle + 1, needle_end))
+                return p;
+        }
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const uint8x16_t v_fold_first = vdupq_n_u8(fold_first), v_first = vdupq_n_u8((uint8_t)(n_first | fold_first));
+    const uint8x16_t v_fold_last = vdupq_n_u8(fold_last), v_last = vdupq_n_u8((uint8_t)(n_last | fold_last));
+    for (; haystack_last - haystack >= 15; haystack += 16)
     {
-        if (ImToUpper(*haystack) == un0)
+        const uint8x16_t eq_first = vceqq_u8(vorrq_u8(vld1q_u8((const uint8_t*)(const void*)haystack), v_fold_first), v_first);
+        const uint8x16_t eq_last = vceqq_u8(vorrq_u8(vld1q_u8((const uint8_t*)(const void*)(haystack + last_offset)), v_fold_last), v_last);
+        // Narrow to 4 bits per byte
+        ImU64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vandq_u8(eq_first, eq_last)), 4)), 0) & 0x8888888888888888ULL;
+        for (; mask != 0; mask &= mask - 1)
         {
-            const char* b = needle + 1;
-            for (const char* a = haystack + 1; b < needle_end; a++, b++)
-                if (ImToUpper(*a) != ImToUpper(*b))
-                    break;
-            if (b == needle_end)
-                return haystack;
+            const char* p = haystack + (ImCountTrailingZeros64(mask) >> 2);
+            if (ImStristr_MatchRest(p + 1, needle + 1, needle_end))
+                return p;
         }
-        haystack++;
     }
+#else
+    // Zero bytes of (folded ^ pattern) are candidates. The bit trick may report false positives above a true zero byte, which fail verification.
+    const ImU64 k01 = 0x0101010101010101ULL, k80 = 0x8080808080808080ULL;
+    const ImU64 w_fold_first = k01 * fold_first, w_first = k01 * (unsigned char)(n_first | fold_first);
+    const ImU64 w_fold_last = k01 * fold_last, w_last = k01 * (unsigned char)(n_last | fold_last);
+    for (; haystack_last - haystack >= 7; haystack += 8)
+    {
+        ImU64 w0, w1;
+        memcpy(&w0, haystack, 8);
+        memcpy(&w1, haystack + last_offset, 8);
+        const ImU64 d = ((w0 | w_fold_first) ^ w_first) | ((w1 | w_fold_last) ^ w_last);
+        if (((d - k01) & ~d & k80) == 0)
+            continue;
+        for (int n = 0; n < 8; n++)
+            if (ImStristr_MatchRest(haystack + n, needle, needle_end))
+                return haystack + n;
+    }
+#endif
+    for (; haystack <= haystack_last; haystack++)
+        if (((unsigned char)*haystack | fold_first) == (unsigned char)(n_first | fold_first) && ImStristr_MatchRest(haystack + 1, needle + 1, needle_end))
+            return haystack;
     return NULL;
 }
 
@@ -2048,6 +2121,16 @@ const char* ImStrSkipBlank(const char* str)
     return str;
 }
 
+// On some platform vsnprintf() takes va_list by reference and modifies it.
+// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
+#ifndef va_copy
+#if defined(__GNUC__) || defined(__clang__)
+#define va_copy(dest, src) __builtin_va_copy(dest, src)
+#else
+#define va_copy(dest, src) (dest = src)
+#endif
+#endif
+
 // A) MSVC version appears to return -1 on overflow, whereas glibc appears to return total count (which may be >= buf_size).
 // Ideally we would test for only one of those limits at runtime depending on the behavior the vsnprintf(), but trying to deduct it at compile time sounds like a pandora can of worm.
 // B) When buf==NULL vsnprintf() will return the output size.
@@ -2072,21 +2155,177 @@ const char* ImStrSkipBlank(const char* str)
 #define vsnprintf _vsnprintf
 #endif
 
+#ifndef IMGUI_USE_STB_SPRINTF
+// Fast path for the common case of a format with a single "%d", "%u", "%lld", "%.3f" etc. (e.g. Text("%d"), DataTypeFormatString(), PlotEx() overlays)
+// - Supports flags '-', '+', ' ', '0', width, precision for 'f', length modifiers 'l'/'ll' and "%%" in surrounding text.
+// - Output is identical to a C99-compliant vsnprintf(). Floats are only handled when the scaled value is < 1e15 and not near a
+//   rounding tie (where the exact binary value matters), otherwise we return -1 and the caller uses vsnprintf().
+// - We don't cache parsed formats: formats are short, many are built on the fly, and parsing is cheap compared to vsnprintf().
+static char* ImFormatStringFast_WriteU64Reverse(char* out_end, ImU64 v)
+{
+    static const char digit_pairs[] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+    while (v >= 0xFFFFFFFF) // Use 32-bit divisions as soon as possible
+    {
+        const unsigned int d = (unsigned int)(v % 100);
+        v /= 100;
+        *--out_end = digit_pairs[d * 2 + 1];
+        *--out_end = digit_pairs[d * 2];
+    }
+    unsigned int v32 = (unsigned int)v;
+    while (v32 >= 100)
+    {
+        const unsigned int d = v32 % 100;
+        v32 /= 100;
+        *--out_end = digit_pairs[d * 2 + 1];
+        *--out_end = digit_pairs[d * 2];
+    }
+    if (v32 >= 10)
+    {
+        *--out_end = digit_pairs[v32 * 2 + 1];
+        *--out_end = digit_pairs[v32 * 2];
+    }
+    else
+    {
+        *--out_end = (char)('0' + v32);
+    }
+    return out_end;
+}
+
+static int ImFormatStringFastV(char* buf, size_t buf_size, const char* fmt, va_list args)
+{
+    // Parse: [text] '%' [flags] [width] ['.' precision] [length] conversion [text]
+    const char* spec = fmt;
+    while ((spec = strchr(spec, '%')) != NULL && spec[1] == '%')
+        spec += 2;
+    if (spec == NULL)
+        return -1;
+    const char* p = spec + 1;
+    bool flag_left = false, flag_plus = false, flag_space = false, flag_zero = false;
+    for (;; p++)
+    {
+        if (*p == '-')      flag_left = true;
+        else if (*p == '+') flag_plus = true;
+        else if (*p == ' ') flag_space = true;
+        else if (*p == '0') flag_zero = true;
+        else break;
+    }
+    int width = 0;
+    while (*p >= '0' && *p <= '9' && width < 100)
+        width = width * 10 + (*p++ - '0');
+    int precision = -1;
+    if (*p == '.')
+        for (precision = 0, p++; *p >= '0' && *p <= '9' && precision < 100; p++)
+            precision = precision * 10 + (*p - '0');
+    int length = 0;
+    while (*p == 'l' && length < 2)
+        length++, p++;
+    const char conv = *p++;
+    const char* suffix = p;
+    if (width >= 64 || (conv != 'd' && conv != 'i' && conv != 'u' && conv != 'f') || (conv == 'f' && (precision > 15 || length > 1)) || (conv != 'f' && precision >= 0))
+        return -1;
+    for (const char* s = suffix; (s = strchr(s, '%')) != NULL; s += 2)
+        if (s[1] != '%')
+            return -1;
+
+    // Format number right-to-left in a local buffer
+    static const ImU64 pow10_u64[] = { 1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL };
+    char num_buf[64];
+    char* num_end = num_buf + IM_ARRAYSIZE(num_buf);
+    char* num = num_end;
+    bool negative = false;
+    va_list args_copy;
+    va_copy(args_copy, args);
+    if (conv == 'f')
+    {
+        const double v = va_arg(args_copy, double);
+        if (precision < 0)
+            precision = 6;
+        ImU64 v_bits;
+        memcpy(&v_bits, &v, sizeof(v_bits));
+        negative = (v_bits >> 63) != 0;
+        const double v_abs = negative ? -v : v;
+        const double x = v_abs * (double)pow10_u64[precision];  // Exact power of ten, so 'x' is within 0.5 ULP of the exact product
+        const char* decimal_point = localeconv()->decimal_point;
+        ImU64 r = (x < 1e15) ? (ImU64)x : 0;
+        const double frac = x - (double)r;
+        if (((v_bits >> 52) & 0x7FF) == 0x7FF || !(x < 1e15) || decimal_point[1] != 0 || ImAbs(frac - 0.5) <= ImMax(x, 1.0) * 1e-15)
+        {
+            // Inf/NaN, too large, multi-byte decimal point, or too close to a tie where rounding depends on the exact binary value
+            va_end(args_copy);
+            return -1;
+        }
+        if (frac > 0.5)
+            r++;
+        if (precision > 0)
+        {
+            // Fractional digits, padded with leading zeroes
+            char* frac_end = num;
+            num = ImFormatStringFast_WriteU64Reverse(num, r % pow10_u64[precision]);
+            while (num > frac_end - precision)
+                *--num = '0';
+            *--num = decimal_point[0];
+        }
+        num = ImFormatStringFast_WriteU64Reverse(num, r / pow10_u64[precision]);
+    }
+    else
+    {
+        ImU64 v;
+        if (conv == 'u')
+            v = (length == 2) ? (ImU64)va_arg(args_copy, unsigned long long) : (length == 1) ? (ImU64)va_arg(args_copy, unsigned long) : (ImU64)va_arg(args_copy, unsigned int);
+        else
+        {
+            const ImS64 v_signed = (length == 2) ? (ImS64)va_arg(args_copy, long long) : (length == 1) ? (ImS64)va_arg(args_copy, long) : (ImS64)va_arg(args_copy, int);
+            negative = (v_signed < 0);
+            v = negative ? (ImU64)0 - (ImU64)v_signed : (ImU64)v_signed;
+        }
+        num = ImFormatStringFast_WriteU64Reverse(num, v);
+    }
+    va_end(args_copy);
+    const char sign = negative ? '-' : (conv == 'u') ? 0 : flag_plus ? '+' : flag_space ? ' ' : 0;
+    const int num_len = (int)(num_end - num) + (sign ? 1 : 0);
+    const int pad = ImMax(width - num_len, 0);
+
+    // Output with truncation, same as vsnprintf()
+    int w = 0;
+    const int w_max = (int)buf_size - 1;
+    #define IM_FORMAT_PUTC(_C)  do { if (w < w_max) buf[w] = (_C); w++; } while (0)
+    for (const char* s = fmt; s < spec; s++)
+    {
+        IM_FORMAT_PUTC(*s);
+        if (*s == '%')
+            s++;
+    }
+    if (!flag_left && !flag_zero)
+        for (int n = 0; n < pad; n++)
+            IM_FORMAT_PUTC(' ');
+    if (sign)
+        IM_FORMAT_PUTC(sign);
+    if (!flag_left && flag_zero)
+        for (int n = 0; n < pad; n++)
+            IM_FORMAT_PUTC('0');
+    for (const char* s = num; s < num_end; s++)
+        IM_FORMAT_PUTC(*s);
+    if (flag_left)
+        for (int n = 0; n < pad; n++)
+            IM_FORMAT_PUTC(' ');
+    for (const char* s = suffix; *s != 0; s++)
+    {
+        IM_FORMAT_PUTC(*s);
+        if (*s == '%')
+            s++;
+    }
+    #undef IM_FORMAT_PUTC
+    buf[ImMin(w, w_max)] = 0;
+    return ImMin(w, w_max);
+}
+#endif
+
 int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
 {
     va_list args;
     va_start(args, fmt);
-#ifdef IMGUI_USE_STB_SPRINTF
-    int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
-#else
-    int w = vsnprintf(buf, buf_size, fmt, args);
-#endif
+    int w = ImFormatStringV(buf, buf_size, fmt, args);
     va_end(args);
-    if (buf == NULL)
-        return w;
-    if (w == -1 || w >= (int)buf_size)
-        w = (int)buf_size - 1;
-    buf[w] = 0;
     return w;
 }
 
@@ -2095,6 +2334,12 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 #ifdef IMGUI_USE_STB_SPRINTF
     int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
 #else
+    if (buf != NULL && buf_size > 0)
+    {
+        int w = ImFormatStringFastV(buf, buf_size, fmt, args);
+        if (w >= 0)
+            return w;
+    }
     int w = vsnprintf(buf, buf_size, fmt, args);
 #endif
     if (buf == NULL)
@@ -2149,74 +2394,222 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
-// CRC32 needs a 1KB lookup table (not cache friendly)
+// CRC32 needs a 8KB lookup table (8 tables of 256 entries for the "slice-by-8" variant, processing 8 bytes per iteration).
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
-static const ImU32 GCrc32LookupTable[256] =
-{
-    0x00000000,0x77073096,0xEE0E612C,0x990951BA,0x076DC419,0x706AF48F,0xE963A535,0x9E6495A3,0x0EDB8832,0x79DCB8A4,0xE0D5E91E,0x97D2D988,0x09B64C2B,0x7EB17CBD,0xE7B82D07,0x90BF1D91,
-    0x1DB71064,0x6AB020F2,0xF3B97148,0x84BE41DE,0x1ADAD47D,0x6DDDE4EB,0xF4D4B551,0x83D385C7,0x136C9856,0x646BA8C0,0xFD62F97A,0x8A65C9EC,0x14015C4F,0x63066CD9,0xFA0F3D63,0x8D080DF5,
-    0x3B6E20C8,0x4C69105E,0xD56041E4,0xA2677172,0x3C03E4D1,0x4B04D447,0xD20D85FD,0xA50AB56B,0x35B5A8FA,0x42B2986C,0xDBBBC9D6,0xACBCF940,0x32D86CE3,0x45DF5C75,0xDCD60DCF,0xABD13D59,
-    0x26D930AC,0x51DE003A,0xC8D75180,0xBFD06116,0x21B4F4B5,0x56B3C423,0xCFBA9599,0xB8BDA50F,0x2802B89E,0x5F058808,0xC60CD9B2,0xB10BE924,0x2F6F7C87,0x58684C11,0xC1611DAB,0xB6662D3D,
-    0x76DC4190,0x01DB7106,0x98D220BC,0xEFD5102A,0x71B18589,0x06B6B51F,0x9FBFE4A5,0xE8B8D433,0x7807C9A2,0x0F00F934,0x9609A88E,0xE10E9818,0x7F6A0DBB,0x086D3D2D,0x91646C97,0xE6635C01,
-    0x6B6B51F4,0x1C6C6162,0x856530D8,0xF262004E,0x6C0695ED,0x1B01A57B,0x8208F4C1,0xF50FC457,0x65B0D9C6,0x12B7E950,0x8BBEB8EA,0xFCB9887C,0x62DD1DDF,0x15DA2D49,0x8CD37CF3,0xFBD44C65,
-    0x4DB26158,0x3AB551CE,0xA3BC0074,0xD4BB30E2,0x4ADFA541,0x3DD895D7,0xA4D1C46D,0xD3D6F4FB,0x4369E96A,0x346ED9FC,0xAD678846,0xDA60B8D0,0x44042D73,0x33031DE5,0xAA0A4C5F,0xDD0D7CC9,
-    0x5005713C,0x270241AA,0xBE0B1010,0xC90C2086,0x5768B525,0x206F85B3,0xB966D409,0xCE61E49F,0x5EDEF90E,0x29D9C998,0xB0D09822,0xC7D7A8B4,0x59B33D17,0x2EB40D81,0xB7BD5C3B,0xC0BA6CAD,
-    0xEDB88320,0x9ABFB3B6,0x03B6E20C,0x74B1D29A,0xEAD54739,0x9DD277AF,0x04DB2615,0x73DC1683,0xE3630B12,0x94643B84,0x0D6D6A3E,0x7A6A5AA8,0xE40ECF0B,0x9309FF9D,0x0A00AE27,0x7D079EB1,
-    0xF00F9344,0x8708A3D2,0x1E01F268,0x6906C2FE,0xF762575D,0x806567CB,0x196C3671,0x6E6B06E7,0xFED41B76,0x89D32BE0,0x10DA7A5A,0x67DD4ACC,0xF9B9DF6F,0x8EBEEFF9,0x17B7BE43,0x60B08ED5,
-    0xD6D6A3E8,0xA1D1937E,0x38D8C2C4,0x4FDFF252,0xD1BB67F1,0xA6BC5767,0x3FB506DD,0x48B2364B,0xD80D2BDA,0xAF0A1B4C,0x36034AF6,0x41047A60,0xDF60EFC3,0xA867DF55,0x316E8EEF,0x4669BE79,
-    0xCB61B38C,0xBC66831A,0x256FD2A0,0x5268E236,0xCC0C7795,0xBB0B4703,0x220216B9,0x5505262F,0xC5BA3BBE,0xB2BD0B28,0x2BB45A92,0x5CB36A04,0xC2D7FFA7,0xB5D0CF31,0x2CD99E8B,0x5BDEAE1D,
-    0x9B64C2B0,0xEC63F226,0x756AA39C,0x026D930A,0x9C0906A9,0xEB0E363F,0x72076785,0x05005713,0x95BF4A82,0xE2B87A14,0x7BB12BAE,0x0CB61B38,0x92D28E9B,0xE5D5BE0D,0x7CDCEFB7,0x0BDBDF21,
-    0x86D3D2D4,0xF1D4E242,0x68DDB3F8,0x1FDA836E,0x81BE16CD,0xF6B9265B,0x6FB077E1,0x18B74777,0x88085AE6,0xFF0F6A70,0x66063BCA,0x11010B5C,0x8F659EFF,0xF862AE69,0x616BFFD3,0x166CCF45,
-    0xA00AE278,0xD70DD2EE,0x4E048354,0x3903B3C2,0xA7672661,0xD06016F7,0x4969474D,0x3E6E77DB,0xAED16A4A,0xD9D65ADC,0x40DF0B66,0x37D83BF0,0xA9BCAE53,0xDEBB9EC5,0x47B2CF7F,0x30B5FFE9,
-    0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
+// - #define IMGUI_USE_CRC32C in imconfig.h to use hardware CRC32C instructions (SSE4.2, ARMv8 CRC) instead when the target supports them, the table is then not needed.
+//   Note that CRC32C uses a different polynomial, so IDs will differ from builds using the table (which may invalidate .ini data keyed by ID).
+#if !defined(IMGUI_ENABLE_SSE4_2_CRC) && !defined(IMGUI_ENABLE_ARM_CRC32)
+static const ImU32 GCrc32LookupTable[8][256] =
+{
+    {
+        0x00000000,0x77073096,0xEE0E612C,0x990951BA,0x076DC419,0x706AF48F,0xE963A535,0x9E6495A3,0x0EDB8832,0x79DCB8A4,0xE0D5E91E,0x97D2D988,0x09B64C2B,0x7EB17CBD,0xE7B82D07,0x90BF1D91,
+        0x1DB71064,0x6AB020F2,0xF3B97148,0x84BE41DE,0x1ADAD47D,0x6DDDE4EB,0xF4D4B551,0x83D385C7,0x136C9856,0x646BA8C0,0xFD62F97A,0x8A65C9EC,0x14015C4F,0x63066CD9,0xFA0F3D63,0x8D080DF5,
+        0x3B6E20C8,0x4C69105E,0xD56041E4,0xA2677172,0x3C03E4D1,0x4B04D447,0xD20D85FD,0xA50AB56B,0x35B5A8FA,0x42B2986C,0xDBBBC9D6,0xACBCF940,0x32D86CE3,0x45DF5C75,0xDCD60DCF,0xABD13D59,
+        0x26D930AC,0x51DE003A,0xC8D75180,0xBFD06116,0x21B4F4B5,0x56B3C423,0xCFBA9599,0xB8BDA50F,0x2802B89E,0x5F058808,0xC60CD9B2,0xB10BE924,0x2F6F7C87,0x58684C11,0xC1611DAB,0xB6662D3D,
+        0x76DC4190,0x01DB7106,0x98D220BC,0xEFD5102A,0x71B18589,0x06B6B51F,0x9FBFE4A5,0xE8B8D433,0x7807C9A2,0x0F00F934,0x9609A88E,0xE10E9818,0x7F6A0DBB,0x086D3D2D,0x91646C97,0xE6635C01,
+        0x6B6B51F4,0x1C6C6162,0x856530D8,0xF262004E,0x6C0695ED,0x1B01A57B,0x8208F4C1,0xF50FC457,0x65B0D9C6,0x12B7E950,0x8BBEB8EA,0xFCB9887C,0x62DD1DDF,0x15DA2D49,0x8CD37CF3,0xFBD44C65,
+        0x4DB26158,0x3AB551CE,0xA3BC0074,0xD4BB30E2,0x4ADFA541,0x3DD895D7,0xA4D1C46D,0xD3D6F4FB,0x4369E96A,0x346ED9FC,0xAD678846,0xDA60B8D0,0x44042D73,0x33031DE5,0xAA0A4C5F,0xDD0D7CC9,
+        0x5005713C,0x270241AA,0xBE0B1010,0xC90C2086,0x5768B525,0x206F85B3,0xB966D409,0xCE61E49F,0x5EDEF90E,0x29D9C998,0xB0D09822,0xC7D7A8B4,0x59B33D17,0x2EB40D81,0xB7BD5C3B,0xC0BA6CAD,
+        0xEDB88320,0x9ABFB3B6,0x03B6E20C,0x74B1D29A,0xEAD54739,0x9DD277AF,0x04DB2615,0x73DC1683,0xE3630B12,0x94643B84,0x0D6D6A3E,0x7A6A5AA8,0xE40ECF0B,0x9309FF9D,0x0A00AE27,0x7D079EB1,
+        0xF00F9344,0x8708A3D2,0x1E01F268,0x6906C2FE,0xF762575D,0x806567CB,0x196C3671,0x6E6B06E7,0xFED41B76,0x89D32BE0,0x10DA7A5A,0x67DD4ACC,0xF9B9DF6F,0x8EBEEFF9,0x17B7BE43,0x60B08ED5,
+        0xD6D6A3E8,0xA1D1937E,0x38D8C2C4,0x4FDFF252,0xD1BB67F1,0xA6BC5767,0x3FB506DD,0x48B2364B,0xD80D2BDA,0xAF0A1B4C,0x36034AF6,0x41047A60,0xDF60EFC3,0xA867DF55,0x316E8EEF,0x4669BE79,
+        0xCB61B38C,0xBC66831A,0x256FD2A0,0x5268E236,0xCC0C7795,0xBB0B4703,0x220216B9,0x5505262F,0xC5BA3BBE,0xB2BD0B28,0x2BB45A92,0x5CB36A04,0xC2D7FFA7,0xB5D0CF31,0x2CD99E8B,0x5BDEAE1D,
+        0x9B64C2B0,0xEC63F226,0x756AA39C,0x026D930A,0x9C0906A9,0xEB0E363F,0x72076785,0x05005713,0x95BF4A82,0xE2B87A14,0x7BB12BAE,0x0CB61B38,0x92D28E9B,0xE5D5BE0D,0x7CDCEFB7,0x0BDBDF21,
+        0x86D3D2D4,0xF1D4E242,0x68DDB3F8,0x1FDA836E,0x81BE16CD,0xF6B9265B,0x6FB077E1,0x18B74777,0x88085AE6,0xFF0F6A70,0x66063BCA,0x11010B5C,0x8F659EFF,0xF862AE69,0x616BFFD3,0x166CCF45,
+        0xA00AE278,0xD70DD2EE,0x4E048354,0x3903B3C2,0xA7672661,0xD06016F7,0x4969474D,0x3E6E77DB,0xAED16A4A,0xD9D65ADC,0x40DF0B66,0x37D83BF0,0xA9BCAE53,0xDEBB9EC5,0x47B2CF7F,0x30B5FFE9,
+        0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
+    },
+    {
+        0x00000000,0x191B3141,0x32366282,0x2B2D53C3,0x646CC504,0x7D77F445,0x565AA786,0x4F4196C7,0xC8D98A08,0xD1C2BB49,0xFAEFE88A,0xE3F4D9CB,0xACB54F0C,0xB5AE7E4D,0x9E832D8E,0x87981CCF,
+        0x4AC21251,0x53D92310,0x78F470D3,0x61EF4192,0x2EAED755,0x37B5E614,0x1C98B5D7,0x05838496,0x821B9859,0x9B00A918,0xB02DFADB,0xA936CB9A,0xE6775D5D,0xFF6C6C1C,0xD4413FDF,0xCD5A0E9E,
+        0x958424A2,0x8C9F15E3,0xA7B24620,0xBEA97761,0xF1E8E1A6,0xE8F3D0E7,0xC3DE8324,0xDAC5B265,0x5D5DAEAA,0x44469FEB,0x6F6BCC28,0x7670FD69,0x39316BAE,0x202A5AEF,0x0B07092C,0x121C386D,
+        0xDF4636F3,0xC65D07B2,0xED705471,0xF46B6530,0xBB2AF3F7,0xA231C2B6,0x891C9175,0x9007A034,0x179FBCFB,0x0E848DBA,0x25A9DE79,0x3CB2EF38,0x73F379FF,0x6AE848BE,0x41C51B7D,0x58DE2A3C,
+        0xF0794F05,0xE9627E44,0xC24F2D87,0xDB541CC6,0x94158A01,0x8D0EBB40,0xA623E883,0xBF38D9C2,0x38A0C50D,0x21BBF44C,0x0A96A78F,0x138D96CE,0x5CCC0009,0x45D73148,0x6EFA628B,0x77E153CA,
+        0xBABB5D54,0xA3A06C15,0x888D3FD6,0x91960E97,0xDED79850,0xC7CCA911,0xECE1FAD2,0xF5FACB93,0x7262D75C,0x6B79E61D,0x4054B5DE,0x594F849F,0x160E1258,0x0F152319,0x243870DA,0x3D23419B,
+        0x65FD6BA7,0x7CE65AE6,0x57CB0925,0x4ED03864,0x0191AEA3,0x188A9FE2,0x33A7CC21,0x2ABCFD60,0xAD24E1AF,0xB43FD0EE,0x9F12832D,0x8609B26C,0xC94824AB,0xD05315EA,0xFB7E4629,0xE2657768,
+        0x2F3F79F6,0x362448B7,0x1D091B74,0x04122A35,0x4B53BCF2,0x52488DB3,0x7965DE70,0x607EEF31,0xE7E6F3FE,0xFEFDC2BF,0xD5D0917C,0xCCCBA03D,0x838A36FA,0x9A9107BB,0xB1BC5478,0xA8A76539,
+        0x3B83984B,0x2298A90A,0x09B5FAC9,0x10AECB88,0x5FEF5D4F,0x46F46C0E,0x6DD93FCD,0x74C20E8C,0xF35A1243,0xEA412302,0xC16C70C1,0xD8774180,0x9736D747,0x8E2DE606,0xA500B5C5,0xBC1B8484,
+        0x71418A1A,0x685ABB5B,0x4377E898,0x5A6CD9D9,0x152D4F1E,0x0C367E5F,0x271B2D9C,0x3E001CDD,0xB9980012,0xA0833153,0x8BAE6290,0x92B553D1,0xDDF4C516,0xC4EFF457,0xEFC2A794,0xF6D996D5,
+        0xAE07BCE9,0xB71C8DA8,0x9C31DE6B,0x852AEF2A,0xCA6B79ED,0xD37048AC,0xF85D1B6F,0xE1462A2E,0x66DE36E1,0x7FC507A0,0x54E85463,0x4DF36522,0x02B2F3E5,0x1BA9C2A4,0x30849167,0x299FA026,
+        0xE4C5AEB8,0xFDDE9FF9,0xD6F3CC3A,0xCFE8FD7B,0x80A96BBC,0x99B25AFD,0xB29F093E,0xAB84387F,0x2C1C24B0,0x350715F1,0x1E2A4632,0x07317773,0x4870E1B4,0x516BD0F5,0x7A468336,0x635DB277,
+        0xCBFAD74E,0xD2E1E60F,0xF9CCB5CC,0xE0D7848D,0xAF96124A,0xB68D230B,0x9DA070C8,0x84BB4189,0x03235D46,0x1A386C07,0x31153FC4,0x280E0E85,0x674F9842,0x7E54A903,0x5579FAC0,0x4C62CB81,
+        0x8138C51F,0x9823F45E,0xB30EA79D,0xAA1596DC,0xE554001B,0xFC4F315A,0xD7626299,0xCE7953D8,0x49E14F17,0x50FA7E56,0x7BD72D95,0x62CC1CD4,0x2D8D8A13,0x3496BB52,0x1FBBE891,0x06A0D9D0,
+        0x5E7EF3EC,0x4765C2AD,0x6C48916E,0x7553A02F,0x3A1236E8,0x230907A9,0x0824546A,0x113F652B,0x96A779E4,0x8FBC48A5,0xA4911B66,0xBD8A2A27,0xF2CBBCE0,0xEBD08DA1,0xC0FDDE62,0xD9E6EF23,
+        0x14BCE1BD,0x0DA7D0FC,0x268A833F,0x3F91B27E,0x70D024B9,0x69CB15F8,0x42E6463B,0x5BFD777A,0xDC656BB5,0xC57E5AF4,0xEE530937,0xF7483876,0xB809AEB1,0xA1129FF0,0x8A3FCC33,0x9324FD72,
+    },
+    {
+        0x00000000,0x01C26A37,0x0384D46E,0x0246BE59,0x0709A8DC,0x06CBC2EB,0x048D7CB2,0x054F1685,0x0E1351B8,0x0FD13B8F,0x0D9785D6,0x0C55EFE1,0x091AF964,0x08D89353,0x0A9E2D0A,0x0B5C473D,
+        0x1C26A370,0x1DE4C947,0x1FA2771E,0x1E601D29,0x1B2F0BAC,0x1AED619B,0x18ABDFC2,0x1969B5F5,0x1235F2C8,0x13F798FF,0x11B126A6,0x10734C91,0x153C5A14,0x14FE3023,0x16B88E7A,0x177AE44D,
+        0x384D46E0,0x398F2CD7,0x3BC9928E,0x3A0BF8B9,0x3F44EE3C,0x3E86840B,0x3CC03A52,0x3D025065,0x365E1758,0x379C7D6F,0x35DAC336,0x3418A901,0x3157BF84,0x3095D5B3,0x32D36BEA,0x331101DD,
+        0x246BE590,0x25A98FA7,0x27EF31FE,0x262D5BC9,0x23624D4C,0x22A0277B,0x20E69922,0x2124F315,0x2A78B428,0x2BBADE1F,0x29FC6046,0x283E0A71,0x2D711CF4,0x2CB376C3,0x2EF5C89A,0x2F37A2AD,
+        0x709A8DC0,0x7158E7F7,0x731E59AE,0x72DC3399,0x7793251C,0x76514F2B,0x7417F172,0x75D59B45,0x7E89DC78,0x7F4BB64F,0x7D0D0816,0x7CCF6221,0x798074A4,0x78421E93,0x7A04A0CA,0x7BC6CAFD,
+        0x6CBC2EB0,0x6D7E4487,0x6F38FADE,0x6EFA90E9,0x6BB5866C,0x6A77EC5B,0x68315202,0x69F33835,0x62AF7F08,0x636D153F,0x612BAB66,0x60E9C151,0x65A6D7D4,0x6464BDE3,0x662203BA,0x67E0698D,
+        0x48D7CB20,0x4915A117,0x4B531F4E,0x4A917579,0x4FDE63FC,0x4E1C09CB,0x4C5AB792,0x4D98DDA5,0x46C49A98,0x4706F0AF,0x45404EF6,0x448224C1,0x41CD3244,0x400F5873,0x4249E62A,0x438B8C1D,
+        0x54F16850,0x55330267,0x5775BC3E,0x56B7D609,0x53F8C08C,0x523AAABB,0x507C14E2,0x51BE7ED5,0x5AE239E8,0x5B2053DF,0x5966ED86,0x58A487B1,0x5DEB9134,0x5C29FB03,0x5E6F455A,0x5FAD2F6D,
+        0xE1351B80,0xE0F771B7,0xE2B1CFEE,0xE373A5D9,0xE63CB35C,0xE7FED96B,0xE5B86732,0xE47A0D05,0xEF264A38,0xEEE4200F,0xECA29E56,0xED60F461,0xE82FE2E4,0xE9ED88D3,0xEBAB368A,0xEA695CBD,
+        0xFD13B8F0,0xFCD1D2C7,0xFE976C9E,0xFF5506A9,0xFA1A102C,0xFBD87A1B,0xF99EC442,0xF85CAE75,0xF300E948,0xF2C2837F,0xF0843D26,0xF1465711,0xF4094194,0xF5CB2BA3,0xF78D95FA,0xF64FFFCD,
+        0xD9785D60,0xD8BA3757,0xDAFC890E,0xDB3EE339,0xDE71F5BC,0xDFB39F8B,0xDDF521D2,0xDC374BE5,0xD76B0CD8,0xD6A966EF,0xD4EFD8B6,0xD52DB281,0xD062A404,0xD1A0CE33,0xD3E6706A,0xD2241A5D,
+        0xC55EFE10,0xC49C9427,0xC6DA2A7E,0xC7184049,0xC25756CC,0xC3953CFB,0xC1D382A2,0xC011E895,0xCB4DAFA8,0xCA8FC59F,0xC8C97BC6,0xC90B11F1,0xCC440774,0xCD866D43,0xCFC0D31A,0xCE02B92D,
+        0x91AF9640,0x906DFC77,0x922B422E,0x93E92819,0x96A63E9C,0x976454AB,0x9522EAF2,0x94E080C5,0x9FBCC7F8,0x9E7EADCF,0x9C381396,0x9DFA79A1,0x98B56F24,0x99770513,0x9B31BB4A,0x9AF3D17D,
+        0x8D893530,0x8C4B5F07,0x8E0DE15E,0x8FCF8B69,0x8A809DEC,0x8B42F7DB,0x89044982,0x88C623B5,0x839A6488,0x82580EBF,0x801EB0E6,0x81DCDAD1,0x8493CC54,0x8551A663,0x8717183A,0x86D5720D,
+        0xA9E2D0A0,0xA820BA97,0xAA6604CE,0xABA46EF9,0xAEEB787C,0xAF29124B,0xAD6FAC12,0xACADC625,0xA7F18118,0xA633EB2F,0xA4755576,0xA5B73F41,0xA0F829C4,0xA13A43F3,0xA37CFDAA,0xA2BE979D,
+        0xB5C473D0,0xB40619E7,0xB640A7BE,0xB782CD89,0xB2CDDB0C,0xB30FB13B,0xB1490F62,0xB08B6555,0xBBD72268,0xBA15485F,0xB853F606,0xB9919C31,0xBCDE8AB4,0xBD1CE083,0xBF5A5EDA,0xBE9834ED,
+    },
+    {
+        0x00000000,0xB8BC6765,0xAA09C88B,0x12B5AFEE,0x8F629757,0x37DEF032,0x256B5FDC,0x9DD738B9,0xC5B428EF,0x7D084F8A,0x6FBDE064,0xD7018701,0x4AD6BFB8,0xF26AD8DD,0xE0DF7733,0x58631056,
+        0x5019579F,0xE8A530FA,0xFA109F14,0x42ACF871,0xDF7BC0C8,0x67C7A7AD,0x75720843,0xCDCE6F26,0x95AD7F70,0x2D111815,0x3FA4B7FB,0x8718D09E,0x1ACFE827,0xA2738F42,0xB0C620AC,0x087A47C9,
+        0xA032AF3E,0x188EC85B,0x0A3B67B5,0xB28700D0,0x2F503869,0x97EC5F0C,0x8559F0E2,0x3DE59787,0x658687D1,0xDD3AE0B4,0xCF8F4F5A,0x7733283F,0xEAE41086,0x525877E3,0x40EDD80D,0xF851BF68,
+        0xF02BF8A1,0x48979FC4,0x5A22302A,0xE29E574F,0x7F496FF6,0xC7F50893,0xD540A77D,0x6DFCC018,0x359FD04E,0x8D23B72B,0x9F9618C5,0x272A7FA0,0xBAFD4719,0x0241207C,0x10F48F92,0xA848E8F7,
+        0x9B14583D,0x23A83F58,0x311D90B6,0x89A1F7D3,0x1476CF6A,0xACCAA80F,0xBE7F07E1,0x06C36084,0x5EA070D2,0xE61C17B7,0xF4A9B859,0x4C15DF3C,0xD1C2E785,0x697E80E0,0x7BCB2F0E,0xC377486B,
+        0xCB0D0FA2,0x73B168C7,0x6104C729,0xD9B8A04C,0x446F98F5,0xFCD3FF90,0xEE66507E,0x56DA371B,0x0EB9274D,0xB6054028,0xA4B0EFC6,0x1C0C88A3,0x81DBB01A,0x3967D77F,0x2BD27891,0x936E1FF4,
+        0x3B26F703,0x839A9066,0x912F3F88,0x299358ED,0xB4446054,0x0CF80731,0x1E4DA8DF,0xA6F1CFBA,0xFE92DFEC,0x462EB889,0x549B1767,0xEC277002,0x71F048BB,0xC94C2FDE,0xDBF98030,0x6345E755,
+        0x6B3FA09C,0xD383C7F9,0xC1366817,0x798A0F72,0xE45D37CB,0x5CE150AE,0x4E54FF40,0xF6E89825,0xAE8B8873,0x1637EF16,0x048240F8,0xBC3E279D,0x21E91F24,0x99557841,0x8BE0D7AF,0x335CB0CA,
+        0xED59B63B,0x55E5D15E,0x47507EB0,0xFFEC19D5,0x623B216C,0xDA874609,0xC832E9E7,0x708E8E82,0x28ED9ED4,0x9051F9B1,0x82E4565F,0x3A58313A,0xA78F0983,0x1F336EE6,0x0D86C108,0xB53AA66D,
+        0xBD40E1A4,0x05FC86C1,0x1749292F,0xAFF54E4A,0x322276F3,0x8A9E1196,0x982BBE78,0x2097D91D,0x78F4C94B,0xC048AE2E,0xD2FD01C0,0x6A4166A5,0xF7965E1C,0x4F2A3979,0x5D9F9697,0xE523F1F2,
+        0x4D6B1905,0xF5D77E60,0xE762D18E,0x5FDEB6EB,0xC2098E52,0x7AB5E937,0x680046D9,0xD0BC21BC,0x88DF31EA,0x3063568F,0x22D6F961,0x9A6A9E04,0x07BDA6BD,0xBF01C1D8,0xADB46E36,0x15080953,
+        0x1D724E9A,0xA5CE29FF,0xB77B8611,0x0FC7E174,0x9210D9CD,0x2AACBEA8,0x38191146,0x80A57623,0xD8C66675,0x607A0110,0x72CFAEFE,0xCA73C99B,0x57A4F122,0xEF189647,0xFDAD39A9,0x45115ECC,
+        0x764DEE06,0xCEF18963,0xDC44268D,0x64F841E8,0xF92F7951,0x41931E34,0x5326B1DA,0xEB9AD6BF,0xB3F9C6E9,0x0B45A18C,0x19F00E62,0xA14C6907,0x3C9B51BE,0x842736DB,0x96929935,0x2E2EFE50,
+        0x2654B999,0x9EE8DEFC,0x8C5D7112,0x34E11677,0xA9362ECE,0x118A49AB,0x033FE645,0xBB838120,0xE3E09176,0x5B5CF613,0x49E959FD,0xF1553E98,0x6C820621,0xD43E6144,0xC68BCEAA,0x7E37A9CF,
+        0xD67F4138,0x6EC3265D,0x7C7689B3,0xC4CAEED6,0x591DD66F,0xE1A1B10A,0xF3141EE4,0x4BA87981,0x13CB69D7,0xAB770EB2,0xB9C2A15C,0x017EC639,0x9CA9FE80,0x241599E5,0x36A0360B,0x8E1C516E,
+        0x866616A7,0x3EDA71C2,0x2C6FDE2C,0x94D3B949,0x090481F0,0xB1B8E695,0xA30D497B,0x1BB12E1E,0x43D23E48,0xFB6E592D,0xE9DBF6C3,0x516791A6,0xCCB0A91F,0x740CCE7A,0x66B96194,0xDE0506F1,
+    },
+    {
+        0x00000000,0x3D6029B0,0x7AC05360,0x47A07AD0,0xF580A6C0,0xC8E08F70,0x8F40F5A0,0xB220DC10,0x30704BC1,0x0D106271,0x4AB018A1,0x77D03111,0xC5F0ED01,0xF890C4B1,0xBF30BE61,0x825097D1,
+        0x60E09782,0x5D80BE32,0x1A20C4E2,0x2740ED52,0x95603142,0xA80018F2,0xEFA06222,0xD2C04B92,0x5090DC43,0x6DF0F5F3,0x2A508F23,0x1730A693,0xA5107A83,0x98705333,0xDFD029E3,0xE2B00053,
+        0xC1C12F04,0xFCA106B4,0xBB017C64,0x866155D4,0x344189C4,0x0921A074,0x4E81DAA4,0x73E1F314,0xF1B164C5,0xCCD14D75,0x8B7137A5,0xB6111E15,0x0431C205,0x3951EBB5,0x7EF19165,0x4391B8D5,
+        0xA121B886,0x9C419136,0xDBE1EBE6,0xE681C256,0x54A11E46,0x69C137F6,0x2E614D26,0x13016496,0x9151F347,0xAC31DAF7,0xEB91A027,0xD6F18997,0x64D15587,0x59B17C37,0x1E1106E7,0x23712F57,
+        0x58F35849,0x659371F9,0x22330B29,0x1F532299,0xAD73FE89,0x9013D739,0xD7B3ADE9,0xEAD38459,0x68831388,0x55E33A38,0x124340E8,0x2F236958,0x9D03B548,0xA0639CF8,0xE7C3E628,0xDAA3CF98,
+        0x3813CFCB,0x0573E67B,0x42D39CAB,0x7FB3B51B,0xCD93690B,0xF0F340BB,0xB7533A6B,0x8A3313DB,0x0863840A,0x3503ADBA,0x72A3D76A,0x4FC3FEDA,0xFDE322CA,0xC0830B7A,0x872371AA,0xBA43581A,
+        0x9932774D,0xA4525EFD,0xE3F2242D,0xDE920D9D,0x6CB2D18D,0x51D2F83D,0x167282ED,0x2B12AB5D,0xA9423C8C,0x9422153C,0xD3826FEC,0xEEE2465C,0x5CC29A4C,0x61A2B3FC,0x2602C92C,0x1B62E09C,
+        0xF9D2E0CF,0xC4B2C97F,0x8312B3AF,0xBE729A1F,0x0C52460F,0x31326FBF,0x7692156F,0x4BF23CDF,0xC9A2AB0E,0xF4C282BE,0xB362F86E,0x8E02D1DE,0x3C220DCE,0x0142247E,0x46E25EAE,0x7B82771E,
+        0xB1E6B092,0x8C869922,0xCB26E3F2,0xF646CA42,0x44661652,0x79063FE2,0x3EA64532,0x03C66C82,0x8196FB53,0xBCF6D2E3,0xFB56A833,0xC6368183,0x74165D93,0x49767423,0x0ED60EF3,0x33B62743,
+        0xD1062710,0xEC660EA0,0xABC67470,0x96A65DC0,0x248681D0,0x19E6A860,0x5E46D2B0,0x6326FB00,0xE1766CD1,0xDC164561,0x9BB63FB1,0xA6D61601,0x14F6CA11,0x2996E3A1,0x6E369971,0x5356B0C1,
+        0x70279F96,0x4D47B626,0x0AE7CCF6,0x3787E546,0x85A73956,0xB8C710E6,0xFF676A36,0xC2074386,0x4057D457,0x7D37FDE7,0x3A978737,0x07F7AE87,0xB5D77297,0x88B75B27,0xCF1721F7,0xF2770847,
+        0x10C70814,0x2DA721A4,0x6A075B74,0x576772C4,0xE547AED4,0xD8278764,0x9F87FDB4,0xA2E7D404,0x20B743D5,0x1DD76A65,0x5A7710B5,0x67173905,0xD537E515,0xE857CCA5,0xAFF7B675,0x92979FC5,
+        0xE915E8DB,0xD475C16B,0x93D5BBBB,0xAEB5920B,0x1C954E1B,0x21F567AB,0x66551D7B,0x5B3534CB,0xD965A31A,0xE4058AAA,0xA3A5F07A,0x9EC5D9CA,0x2CE505DA,0x11852C6A,0x562556BA,0x6B457F0A,
+        0x89F57F59,0xB49556E9,0xF3352C39,0xCE550589,0x7C75D999,0x4115F029,0x06B58AF9,0x3BD5A349,0xB9853498,0x84E51D28,0xC34567F8,0xFE254E48,0x4C059258,0x7165BBE8,0x36C5C138,0x0BA5E888,
+        0x28D4C7DF,0x15B4EE6F,0x521494BF,0x6F74BD0F,0xDD54611F,0xE03448AF,0xA794327F,0x9AF41BCF,0x18A48C1E,0x25C4A5AE,0x6264DF7E,0x5F04F6CE,0xED242ADE,0xD044036E,0x97E479BE,0xAA84500E,
+        0x4834505D,0x755479ED,0x32F4033D,0x0F942A8D,0xBDB4F69D,0x80D4DF2D,0xC774A5FD,0xFA148C4D,0x78441B9C,0x4524322C,0x028448FC,0x3FE4614C,0x8DC4BD5C,0xB0A494EC,0xF704EE3C,0xCA64C78C,
+    },
+    {
+        0x00000000,0xCB5CD3A5,0x4DC8A10B,0x869472AE,0x9B914216,0x50CD91B3,0xD659E31D,0x1D0530B8,0xEC53826D,0x270F51C8,0xA19B2366,0x6AC7F0C3,0x77C2C07B,0xBC9E13DE,0x3A0A6170,0xF156B2D5,
+        0x03D6029B,0xC88AD13E,0x4E1EA390,0x85427035,0x9847408D,0x531B9328,0xD58FE186,0x1ED33223,0xEF8580F6,0x24D95353,0xA24D21FD,0x6911F258,0x7414C2E0,0xBF481145,0x39DC63EB,0xF280B04E,
+        0x07AC0536,0xCCF0D693,0x4A64A43D,0x81387798,0x9C3D4720,0x57619485,0xD1F5E62B,0x1AA9358E,0xEBFF875B,0x20A354FE,0xA6372650,0x6D6BF5F5,0x706EC54D,0xBB3216E8,0x3DA66446,0xF6FAB7E3,
+        0x047A07AD,0xCF26D408,0x49B2A6A6,0x82EE7503,0x9FEB45BB,0x54B7961E,0xD223E4B0,0x197F3715,0xE82985C0,0x23755665,0xA5E124CB,0x6EBDF76E,0x73B8C7D6,0xB8E41473,0x3E7066DD,0xF52CB578,
+        0x0F580A6C,0xC404D9C9,0x4290AB67,0x89CC78C2,0x94C9487A,0x5F959BDF,0xD901E971,0x125D3AD4,0xE30B8801,0x28575BA4,0xAEC3290A,0x659FFAAF,0x789ACA17,0xB3C619B2,0x35526B1C,0xFE0EB8B9,
+        0x0C8E08F7,0xC7D2DB52,0x4146A9FC,0x8A1A7A59,0x971F4AE1,0x5C439944,0xDAD7EBEA,0x118B384F,0xE0DD8A9A,0x2B81593F,0xAD152B91,0x6649F834,0x7B4CC88C,0xB0101B29,0x36846987,0xFDD8BA22,
+        0x08F40F5A,0xC3A8DCFF,0x453CAE51,0x8E607DF4,0x93654D4C,0x58399EE9,0xDEADEC47,0x15F13FE2,0xE4A78D37,0x2FFB5E92,0xA96F2C3C,0x6233FF99,0x7F36CF21,0xB46A1C84,0x32FE6E2A,0xF9A2BD8F,
+        0x0B220DC1,0xC07EDE64,0x46EAACCA,0x8DB67F6F,0x90B34FD7,0x5BEF9C72,0xDD7BEEDC,0x16273D79,0xE7718FAC,0x2C2D5C09,0xAAB92EA7,0x61E5FD02,0x7CE0CDBA,0xB7BC1E1F,0x31286CB1,0xFA74BF14,
+        0x1EB014D8,0xD5ECC77D,0x5378B5D3,0x98246676,0x852156CE,0x4E7D856B,0xC8E9F7C5,0x03B52460,0xF2E396B5,0x39BF4510,0xBF2B37BE,0x7477E41B,0x6972D4A3,0xA22E0706,0x24BA75A8,0xEFE6A60D,
+        0x1D661643,0xD63AC5E6,0x50AEB748,0x9BF264ED,0x86F75455,0x4DAB87F0,0xCB3FF55E,0x006326FB,0xF135942E,0x3A69478B,0xBCFD3525,0x77A1E680,0x6AA4D638,0xA1F8059D,0x276C7733,0xEC30A496,
+        0x191C11EE,0xD240C24B,0x54D4B0E5,0x9F886340,0x828D53F8,0x49D1805D,0xCF45F2F3,0x04192156,0xF54F9383,0x3E134026,0xB8873288,0x73DBE12D,0x6EDED195,0xA5820230,0x2316709E,0xE84AA33B,
+        0x1ACA1375,0xD196C0D0,0x5702B27E,0x9C5E61DB,0x815B5163,0x4A0782C6,0xCC93F068,0x07CF23CD,0xF6999118,0x3DC542BD,0xBB513013,0x700DE3B6,0x6D08D30E,0xA65400AB,0x20C07205,0xEB9CA1A0,
+        0x11E81EB4,0xDAB4CD11,0x5C20BFBF,0x977C6C1A,0x8A795CA2,0x41258F07,0xC7B1FDA9,0x0CED2E0C,0xFDBB9CD9,0x36E74F7C,0xB0733DD2,0x7B2FEE77,0x662ADECF,0xAD760D6A,0x2BE27FC4,0xE0BEAC61,
+        0x123E1C2F,0xD962CF8A,0x5FF6BD24,0x94AA6E81,0x89AF5E39,0x42F38D9C,0xC467FF32,0x0F3B2C97,0xFE6D9E42,0x35314DE7,0xB3A53F49,0x78F9ECEC,0x65FCDC54,0xAEA00FF1,0x28347D5F,0xE368AEFA,
+        0x16441B82,0xDD18C827,0x5B8CBA89,0x90D0692C,0x8DD55994,0x46898A31,0xC01DF89F,0x0B412B3A,0xFA1799EF,0x314B4A4A,0xB7DF38E4,0x7C83EB41,0x6186DBF9,0xAADA085C,0x2C4E7AF2,0xE712A957,
+        0x15921919,0xDECECABC,0x585AB812,0x93066BB7,0x8E035B0F,0x455F88AA,0xC3CBFA04,0x089729A1,0xF9C19B74,0x329D48D1,0xB4093A7F,0x7F55E9DA,0x6250D962,0xA90C0AC7,0x2F987869,0xE4C4ABCC,
+    },
+    {
+        0x00000000,0xA6770BB4,0x979F1129,0x31E81A9D,0xF44F2413,0x52382FA7,0x63D0353A,0xC5A73E8E,0x33EF4E67,0x959845D3,0xA4705F4E,0x020754FA,0xC7A06A74,0x61D761C0,0x503F7B5D,0xF64870E9,
+        0x67DE9CCE,0xC1A9977A,0xF0418DE7,0x56368653,0x9391B8DD,0x35E6B369,0x040EA9F4,0xA279A240,0x5431D2A9,0xF246D91D,0xC3AEC380,0x65D9C834,0xA07EF6BA,0x0609FD0E,0x37E1E793,0x9196EC27,
+        0xCFBD399C,0x69CA3228,0x582228B5,0xFE552301,0x3BF21D8F,0x9D85163B,0xAC6D0CA6,0x0A1A0712,0xFC5277FB,0x5A257C4F,0x6BCD66D2,0xCDBA6D66,0x081D53E8,0xAE6A585C,0x9F8242C1,0x39F54975,
+        0xA863A552,0x0E14AEE6,0x3FFCB47B,0x998BBFCF,0x5C2C8141,0xFA5B8AF5,0xCBB39068,0x6DC49BDC,0x9B8CEB35,0x3DFBE081,0x0C13FA1C,0xAA64F1A8,0x6FC3CF26,0xC9B4C492,0xF85CDE0F,0x5E2BD5BB,
+        0x440B7579,0xE27C7ECD,0xD3946450,0x75E36FE4,0xB044516A,0x16335ADE,0x27DB4043,0x81AC4BF7,0x77E43B1E,0xD19330AA,0xE07B2A37,0x460C2183,0x83AB1F0D,0x25DC14B9,0x14340E24,0xB2430590,
+        0x23D5E9B7,0x85A2E203,0xB44AF89E,0x123DF32A,0xD79ACDA4,0x71EDC610,0x4005DC8D,0xE672D739,0x103AA7D0,0xB64DAC64,0x87A5B6F9,0x21D2BD4D,0xE47583C3,0x42028877,0x73EA92EA,0xD59D995E,
+        0x8BB64CE5,0x2DC14751,0x1C295DCC,0xBA5E5678,0x7FF968F6,0xD98E6342,0xE86679DF,0x4E11726B,0xB8590282,0x1E2E0936,0x2FC613AB,0x89B1181F,0x4C162691,0xEA612D25,0xDB8937B8,0x7DFE3C0C,
+        0xEC68D02B,0x4A1FDB9F,0x7BF7C102,0xDD80CAB6,0x1827F438,0xBE50FF8C,0x8FB8E511,0x29CFEEA5,0xDF879E4C,0x79F095F8,0x48188F65,0xEE6F84D1,0x2BC8BA5F,0x8DBFB1EB,0xBC57AB76,0x1A20A0C2,
+        0x8816EAF2,0x2E61E146,0x1F89FBDB,0xB9FEF06F,0x7C59CEE1,0xDA2EC555,0xEBC6DFC8,0x4DB1D47C,0xBBF9A495,0x1D8EAF21,0x2C66B5BC,0x8A11BE08,0x4FB68086,0xE9C18B32,0xD82991AF,0x7E5E9A1B,
+        0xEFC8763C,0x49BF7D88,0x78576715,0xDE206CA1,0x1B87522F,0xBDF0599B,0x8C184306,0x2A6F48B2,0xDC27385B,0x7A5033EF,0x4BB82972,0xEDCF22C6,0x28681C48,0x8E1F17FC,0xBFF70D61,0x198006D5,
+        0x47ABD36E,0xE1DCD8DA,0xD034C247,0x7643C9F3,0xB3E4F77D,0x1593FCC9,0x247BE654,0x820CEDE0,0x74449D09,0xD23396BD,0xE3DB8C20,0x45AC8794,0x800BB91A,0x267CB2AE,0x1794A833,0xB1E3A387,
+        0x20754FA0,0x86024414,0xB7EA5E89,0x119D553D,0xD43A6BB3,0x724D6007,0x43A57A9A,0xE5D2712E,0x139A01C7,0xB5ED0A73,0x840510EE,0x22721B5A,0xE7D525D4,0x41A22E60,0x704A34FD,0xD63D3F49,
+        0xCC1D9F8B,0x6A6A943F,0x5B828EA2,0xFDF58516,0x3852BB98,0x9E25B02C,0xAFCDAAB1,0x09BAA105,0xFFF2D1EC,0x5985DA58,0x686DC0C5,0xCE1ACB71,0x0BBDF5FF,0xADCAFE4B,0x9C22E4D6,0x3A55EF62,
+        0xABC30345,0x0DB408F1,0x3C5C126C,0x9A2B19D8,0x5F8C2756,0xF9FB2CE2,0xC813367F,0x6E643DCB,0x982C4D22,0x3E5B4696,0x0FB35C0B,0xA9C457BF,0x6C636931,0xCA146285,0xFBFC7818,0x5D8B73AC,
+        0x03A0A617,0xA5D7ADA3,0x943FB73E,0x3248BC8A,0xF7EF8204,0x519889B0,0x6070932D,0xC6079899,0x304FE870,0x9638E3C4,0xA7D0F959,0x01A7F2ED,0xC400CC63,0x6277C7D7,0x539FDD4A,0xF5E8D6FE,
+        0x647E3AD9,0xC209316D,0xF3E12BF0,0x55962044,0x90311ECA,0x3646157E,0x07AE0FE3,0xA1D90457,0x579174BE,0xF1E67F0A,0xC00E6597,0x66796E23,0xA3DE50AD,0x05A95B19,0x34414184,0x92364A30,
+    },
+    {
+        0x00000000,0xCCAA009E,0x4225077D,0x8E8F07E3,0x844A0EFA,0x48E00E64,0xC66F0987,0x0AC50919,0xD3E51BB5,0x1F4F1B2B,0x91C01CC8,0x5D6A1C56,0x57AF154F,0x9B0515D1,0x158A1232,0xD92012AC,
+        0x7CBB312B,0xB01131B5,0x3E9E3656,0xF23436C8,0xF8F13FD1,0x345B3F4F,0xBAD438AC,0x767E3832,0xAF5E2A9E,0x63F42A00,0xED7B2DE3,0x21D12D7D,0x2B142464,0xE7BE24FA,0x69312319,0xA59B2387,
+        0xF9766256,0x35DC62C8,0xBB53652B,0x77F965B5,0x7D3C6CAC,0xB1966C32,0x3F196BD1,0xF3B36B4F,0x2A9379E3,0xE639797D,0x68B67E9E,0xA41C7E00,0xAED97719,0x62737787,0xECFC7064,0x205670FA,
+        0x85CD537D,0x496753E3,0xC7E85400,0x0B42549E,0x01875D87,0xCD2D5D19,0x43A25AFA,0x8F085A64,0x562848C8,0x9A824856,0x140D4FB5,0xD8A74F2B,0xD2624632,0x1EC846AC,0x9047414F,0x5CED41D1,
+        0x299DC2ED,0xE537C273,0x6BB8C590,0xA712C50E,0xADD7CC17,0x617DCC89,0xEFF2CB6A,0x2358CBF4,0xFA78D958,0x36D2D9C6,0xB85DDE25,0x74F7DEBB,0x7E32D7A2,0xB298D73C,0x3C17D0DF,0xF0BDD041,
+        0x5526F3C6,0x998CF358,0x1703F4BB,0xDBA9F425,0xD16CFD3C,0x1DC6FDA2,0x9349FA41,0x5FE3FADF,0x86C3E873,0x4A69E8ED,0xC4E6EF0E,0x084CEF90,0x0289E689,0xCE23E617,0x40ACE1F4,0x8C06E16A,
+        0xD0EBA0BB,0x1C41A025,0x92CEA7C6,0x5E64A758,0x54A1AE41,0x980BAEDF,0x1684A93C,0xDA2EA9A2,0x030EBB0E,0xCFA4BB90,0x412BBC73,0x8D81BCED,0x8744B5F4,0x4BEEB56A,0xC561B289,0x09CBB217,
+        0xAC509190,0x60FA910E,0xEE7596ED,0x22DF9673,0x281A9F6A,0xE4B09FF4,0x6A3F9817,0xA6959889,0x7FB58A25,0xB31F8ABB,0x3D908D58,0xF13A8DC6,0xFBFF84DF,0x37558441,0xB9DA83A2,0x7570833C,
+        0x533B85DA,0x9F918544,0x111E82A7,0xDDB48239,0xD7718B20,0x1BDB8BBE,0x95548C5D,0x59FE8CC3,0x80DE9E6F,0x4C749EF1,0xC2FB9912,0x0E51998C,0x04949095,0xC83E900B,0x46B197E8,0x8A1B9776,
+        0x2F80B4F1,0xE32AB46F,0x6DA5B38C,0xA10FB312,0xABCABA0B,0x6760BA95,0xE9EFBD76,0x2545BDE8,0xFC65AF44,0x30CFAFDA,0xBE40A839,0x72EAA8A7,0x782FA1BE,0xB485A120,0x3A0AA6C3,0xF6A0A65D,
+        0xAA4DE78C,0x66E7E712,0xE868E0F1,0x24C2E06F,0x2E07E976,0xE2ADE9E8,0x6C22EE0B,0xA088EE95,0x79A8FC39,0xB502FCA7,0x3B8DFB44,0xF727FBDA,0xFDE2F2C3,0x3148F25D,0xBFC7F5BE,0x736DF520,
+        0xD6F6D6A7,0x1A5CD639,0x94D3D1DA,0x5879D144,0x52BCD85D,0x9E16D8C3,0x1099DF20,0xDC33DFBE,0x0513CD12,0xC9B9CD8C,0x4736CA6F,0x8B9CCAF1,0x8159C3E8,0x4DF3C376,0xC37CC495,0x0FD6C40B,
+        0x7AA64737,0xB60C47A9,0x3883404A,0xF42940D4,0xFEEC49CD,0x32464953,0xBCC94EB0,0x70634E2E,0xA9435C82,0x65E95C1C,0xEB665BFF,0x27CC5B61,0x2D095278,0xE1A352E6,0x6F2C5505,0xA386559B,
+        0x061D761C,0xCAB77682,0x44387161,0x889271FF,0x825778E6,0x4EFD7878,0xC0727F9B,0x0CD87F05,0xD5F86DA9,0x19526D37,0x97DD6AD4,0x5B776A4A,0x51B26353,0x9D1863CD,0x1397642E,0xDF3D64B0,
+        0x83D02561,0x4F7A25FF,0xC1F5221C,0x0D5F2282,0x079A2B9B,0xCB302B05,0x45BF2CE6,0x89152C78,0x50353ED4,0x9C9F3E4A,0x121039A9,0xDEBA3937,0xD47F302E,0x18D530B0,0x965A3753,0x5AF037CD,
+        0xFF6B144A,0x33C114D4,0xBD4E1337,0x71E413A9,0x7B211AB0,0xB78B1A2E,0x39041DCD,0xF5AE1D53,0x2C8E0FFF,0xE0240F61,0x6EAB0882,0xA201081C,0xA8C40105,0x646E019B,0xEAE10678,0x264B06E6,
+    },
 };
+#endif
+
+// Read 4/8 bytes as little-endian without requiring alignment (compilers turn this into a single load on little-endian targets)
+static inline ImU32 ImReadU32LE(const unsigned char* p) { return (ImU32)p[0] | ((ImU32)p[1] << 8) | ((ImU32)p[2] << 16) | ((ImU32)p[3] << 24); }
+#if defined(IMGUI_ENABLE_SSE4_2_CRC) || defined(IMGUI_ENABLE_ARM_CRC32)
+static inline ImU64 ImReadU64LE(const unsigned char* p) { return (ImU64)ImReadU32LE(p) | ((ImU64)ImReadU32LE(p + 4) << 32); }
+#endif
+
+// Update a (non-inverted) CRC state with 'data_size' bytes
+static inline ImU32 ImCrc32Update(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+#if defined(IMGUI_ENABLE_SSE4_2_CRC)
+#if defined(__x86_64__) || defined(_M_X64)
+    for (; data_size >= 8; data += 8, data_size -= 8)
+        crc = (ImU32)_mm_crc32_u64(crc, ImReadU64LE(data));
+#endif
+    for (; data_size >= 4; data += 4, data_size -= 4)
+        crc = _mm_crc32_u32(crc, ImReadU32LE(data));
+    while (data_size-- != 0)
+        crc = _mm_crc32_u8(crc, *data++);
+#elif defined(IMGUI_ENABLE_ARM_CRC32)
+    for (; data_size >= 8; data += 8, data_size -= 8)
+        crc = __crc32cd(crc, ImReadU64LE(data));
+    while (data_size-- != 0)
+        crc = __crc32cb(crc, *data++);
+#else
+    const ImU32 (*crc32_lut)[256] = GCrc32LookupTable;
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        const ImU32 lo = crc ^ ImReadU32LE(data);
+        const ImU32 hi = ImReadU32LE(data + 4);
+        crc = crc32_lut[7][lo & 0xFF] ^ crc32_lut[6][(lo >> 8) & 0xFF] ^ crc32_lut[5][(lo >> 16) & 0xFF] ^ crc32_lut[4][lo >> 24] ^
+              crc32_lut[3][hi & 0xFF] ^ crc32_lut[2][(hi >> 8) & 0xFF] ^ crc32_lut[1][(hi >> 16) & 0xFF] ^ crc32_lut[0][hi >> 24];
+    }
+    while (data_size-- != 0)
+        crc = (crc >> 8) ^ crc32_lut[0][(crc & 0xFF) ^ *data++];
+#endif
+    return crc;
+}
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 {
-    ImU32 crc = ~seed;
-    const unsigned char* data = (const unsigned char*)data_p;
-    const ImU32* crc32_lut = GCrc32LookupTable;
-    while (data_size-- != 0)
-        crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
-    return ~crc;
+    return ~ImCrc32Update(~seed, (const unsigned char*)data_p, data_size);
 }
 
 // Zero-terminated string hash, with support for ### to reset back to seed value
 // We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
 // Because this syntax is rarely used we are optimizing for the common case.
-// - If we reach ### in the string we discard the hash so far and reset to the seed.
-// - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// - If we reach ### in the string we discard the hash so far and reset to the seed, which is the same as
+//   only hashing the string starting from the last ### occurrence. Finding it is done with memchr() which is
+//   generally vectorized, so the hash itself can use the wide (8 bytes per iteration) path.
 ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
 {
-    seed = ~seed;
-    ImU32 crc = seed;
-    const unsigned char* data = (const unsigned char*)data_p;
-    const ImU32* crc32_lut = GCrc32LookupTable;
-    if (data_size != 0)
-    {
-        while (data_size-- != 0)
-        {
-            unsigned char c = *data++;
-            if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
-                crc = seed;
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
-        }
-    }
-    else
-    {
-        while (unsigned char c = *data++)
-        {
-            if (c == '#' && data[0] == '#' && data[1] == '#')
-                crc = seed;
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
-        }
-    }
-    return ~crc;
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const char* data_end = data_p + data_size;
+    const char* hash_begin = data_p;
+    for (const char* p = data_p; p + 2 < data_end && (p = (const char*)memchr(p, '#', (size_t)(data_end - p - 2))) != NULL; p++)
+        if (p[1] == '#' && p[2] == '#')
+            hash_begin = p;
+    return ~ImCrc32Update(~seed, (const unsigned char*)hash_begin, (size_t)(data_end - hash_begin));
 }
 
 //-----------------------------------------------------------------------------
@@ -2360,13 +2753,24 @@ int ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char*
     return wanted;
 }
 
+// ASCII runs are copied/counted in bulk using ImTextFindAsciiRunEnd(), only other characters are decoded one by one.
 int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining)
 {
     ImWchar* buf_out = buf;
     ImWchar* buf_end = buf + buf_size;
-    while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
+    if (!in_text_end)
+        in_text_end = in_text + strlen(in_text);
+    while (buf_out < buf_end - 1 && in_text < in_text_end && *in_text)
     {
-        unsigned int c;
+        unsigned int c = (unsigned char)*in_text;
+        if (c < 0x80)
+        {
+            const char* run_end = (in_text_end - in_text > buf_end - 1 - buf_out) ? in_text + (buf_end - 1 - buf_out) : in_text_end;
+            run_end = ImTextFindAsciiRunEnd(in_text, run_end, 1);
+            while (in_text < run_end)
+                *buf_out++ = (ImWchar)*in_text++;
+            continue;
+        }
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         *buf_out++ = (ImWchar)c;
     }
@@ -2379,8 +2783,17 @@ int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const cha
 int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
 {
     int char_count = 0;
-    while ((!in_text_end || in_text < in_text_end) && *in_text)
+    if (!in_text_end)
+        in_text_end = in_text + strlen(in_text);
+    while (in_text < in_text_end && *in_text)
     {
+        if ((unsigned char)*in_text < 0x80)
+        {
+            const char* run_end = ImTextFindAsciiRunEnd(in_text, in_text_end, 1);
+            char_count += (int)(run_end - in_text);
+            in_text = run_end;
+            continue;
+        }
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         char_count++;
@@ -2463,11 +2876,46 @@ int ImTextStrToUtf8(char* out_buf, int out_buf_size, const ImWchar* in_text, con
     return (int)(buf_p - out_buf);
 }
 
+// Return end of the leading run of ImWchar in [1, 0x7F] range.
+static const ImWchar* ImTextFindAsciiRunEndW(const ImWchar* in_text, const ImWchar* in_text_end)
+{
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128i v_zero = _mm_setzero_si128();
+#ifdef IMGUI_USE_WCHAR32
+    const __m128i v_non_ascii = _mm_set1_epi32(~0x7F);
+    for (; in_text_end - in_text >= 4; in_text += 4)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)in_text);
+        if (_mm_movemask_epi8(_mm_andnot_si128(_mm_cmpeq_epi32(v, v_zero), _mm_cmpeq_epi32(_mm_and_si128(v, v_non_ascii), v_zero))) != 0xFFFF)
+            break;
+    }
+#else
+    const __m128i v_non_ascii = _mm_set1_epi16((short)~0x7F);
+    for (; in_text_end - in_text >= 8; in_text += 8)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)in_text);
+        if (_mm_movemask_epi8(_mm_andnot_si128(_mm_cmpeq_epi16(v, v_zero), _mm_cmpeq_epi16(_mm_and_si128(v, v_non_ascii), v_zero))) != 0xFFFF)
+            break;
+    }
+#endif
+#endif
+    while (in_text < in_text_end && *in_text != 0 && *in_text < 0x80)
+        in_text++;
+    return in_text;
+}
+
 int ImTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end)
 {
     int bytes_count = 0;
     while ((!in_text_end || in_text < in_text_end) && *in_text)
     {
+        if (in_text_end && *in_text < 0x80)
+        {
+            const ImWchar* run_end = ImTextFindAsciiRunEndW(in_text, in_text_end);
+            bytes_count += (int)(run_end - in_text);
+            in_text = run_end;
+            continue;
+        }
         unsigned int c = (unsigned int)(*in_text++);
         if (c < 0x80)
             bytes_count++;
@@ -2624,18 +3072,102 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+// Optional hash index: open-addressing table with linear probing, kept under 50% load.
+// Slots store the key next to the index so probing doesn't need to touch 'Data'.
+// Keys may be sequential integers (e.g. ImGuiSelectionBasicStorage stores item indices by default) so we scramble them.
+static inline ImU32 ImGuiStorage_HashKey(ImGuiID key)
+{
+    ImU32 h = key * 0x9E3779B1u;
+    return h ^ (h >> 15);
+}
+
+void ImGuiStorageRebuildHashIndex(ImGuiStorage* storage)
+{
+    int index_size = 16;
+    while (index_size < (storage->Data.Size + 1) * 2)
+        index_size <<= 1;
+    storage->_HashIndex.resize(index_size);
+    memset(storage->_HashIndex.Data, 0, (size_t)storage->_HashIndex.size_in_bytes());
+    const ImU32 mask = (ImU32)index_size - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        ImU32 slot = ImGuiStorage_HashKey(storage->Data.Data[n].key) & mask;
+        while (storage->_HashIndex.Data[slot] != 0)
+            slot = (slot + 1) & mask;
+        storage->_HashIndex.Data[slot] = ((ImU64)storage->Data.Data[n].key << 32) | (ImU64)(n + 1);
+    }
+}
+
+void ImGuiStorage::SetHashIndexEnabled(bool enabled)
+{
+    if (_HashIndexEnabled == enabled)
+        return;
+    _HashIndexEnabled = enabled;
+    if (enabled)
+    {
+        ImGuiStorageRebuildHashIndex(this);
+    }
+    else
+    {
+        _HashIndex.clear();
+        BuildSortByKey();
+    }
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    if (_HashIndexEnabled)
+        ImGuiStorageRebuildHashIndex(this);
+}
+
+// Find pair, never add/allocate.
+static ImGuiStoragePair* ImGuiStorage_Find(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStoragePair* data = const_cast<ImGuiStoragePair*>(storage->Data.Data);
+    if (!storage->_HashIndexEnabled)
+    {
+        ImGuiStoragePair* it = ImLowerBound(data, data + storage->Data.Size, key);
+        return (it != data + storage->Data.Size && it->key == key) ? it : NULL;
+    }
+    if (storage->_HashIndex.Size == 0)
+        return NULL;
+    IM_ASSERT(storage->_HashIndex.Size >= storage->Data.Size * 2 && "Hash index out of date. Call BuildSortByKey() after modifying Data directly!");
+    const ImU32 mask = (ImU32)storage->_HashIndex.Size - 1;
+    for (ImU32 slot = ImGuiStorage_HashKey(key) & mask; storage->_HashIndex.Data[slot] != 0; slot = (slot + 1) & mask)
+        if ((ImGuiID)(storage->_HashIndex.Data[slot] >> 32) == key)
+            return &data[(int)(storage->_HashIndex.Data[slot] & 0xFFFFFFFF) - 1];
+    return NULL;
+}
+
+// Find pair, insert 'new_pair' on demand if missing.
+static ImGuiStoragePair* ImGuiStorage_FindOrInsert(ImGuiStorage* storage, const ImGuiStoragePair& new_pair)
+{
+    const ImGuiID key = new_pair.key;
+    if (!storage->_HashIndexEnabled)
+    {
+        ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + storage->Data.Size, key);
+        if (it == storage->Data.Data + storage->Data.Size || it->key != key)
+            it = storage->Data.insert(it, new_pair);
+        return it;
+    }
+    if (storage->_HashIndex.Size < (storage->Data.Size + 1) * 2)
+        ImGuiStorageRebuildHashIndex(storage);
+    const ImU32 mask = (ImU32)storage->_HashIndex.Size - 1;
+    ImU32 slot = ImGuiStorage_HashKey(key) & mask;
+    for (; storage->_HashIndex.Data[slot] != 0; slot = (slot + 1) & mask)
+        if ((ImGuiID)(storage->_HashIndex.Data[slot] >> 32) == key)
+            return &storage->Data.Data[(int)(storage->_HashIndex.Data[slot] & 0xFFFFFFFF) - 1];
+    storage->_HashIndex.Data[slot] = ((ImU64)key << 32) | (ImU64)(storage->Data.Size + 1);
+    storage->Data.push_back(new_pair);
+    return &storage->Data.back();
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2645,27 +3177,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2675,28 +3200,18 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_i = val;
+    ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2706,20 +3221,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_f = val;
+    ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_p = val;
+    ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2800,6 +3307,8 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 
     if (text == NULL)
         text = text_end = "";
+    else if (text_end == NULL)
+        text_end = text + strlen(text); // Measure once instead of once per filter
 
     for (const ImGuiTextRange& f : Filters)
     {
@@ -2826,20 +3335,23 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+int ImGuiTextFilter::PassFilterMultiple(const char* const* texts, int texts_count, ImVector<int>* out_indices) const
+{
+    int pass_count = 0;
+    for (int n = 0; n < texts_count; n++)
+        if (PassFilter(texts[n]))
+        {
+            if (out_indices)
+                out_indices->push_back(n);
+            pass_count++;
+        }
+    return pass_count;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
 //-----------------------------------------------------------------------------
 
-// On some platform vsnprintf() takes va_list by reference and modifies it.
-// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
-#ifndef va_copy
-#if defined(__GNUC__) || defined(__clang__)
-#define va_copy(dest, src) __builtin_va_copy(dest, src)
-#else
-#define va_copy(dest, src) (dest = src)
-#endif
-#endif
-
 char ImGuiTextBuffer::EmptyString[1] = { 0 };
 
 void ImGuiTextBuffer::append(const char* str, const char* str_end)
@@ -2874,15 +3386,40 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     va_list args_copy;
     va_copy(args_copy, args);
 
-    int len = ImFormatStringV(NULL, 0, fmt, args);         // FIXME-OPT: could do a first pass write attempt, likely successful on first pass.
+    // Add zero-terminator the first time
+    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
+
+    // First pass write attempt into remaining capacity, likely to succeed.
+    // A result filling all the available space may have been truncated: measure and format again.
+    int len;
+    const int avail = Buf.Capacity - write_off + 1;
+    if (avail > 1)
+    {
+        len = ImFormatStringV(&Buf.Data[write_off - 1], (size_t)avail, fmt, args);
+        if (len >= 0 && len < avail - 1)
+        {
+            if (len > 0)
+                Buf.resize(write_off + len);
+            va_end(args_copy);
+            return;
+        }
+        va_list args_copy2;
+        va_copy(args_copy2, args_copy);
+        len = ImFormatStringV(NULL, 0, fmt, args_copy2);
+        va_end(args_copy2);
+        if (Buf.Size != 0)
+            Buf.Data[write_off - 1] = 0;
+    }
+    else
+    {
+        len = ImFormatStringV(NULL, 0, fmt, args);
+    }
     if (len <= 0)
     {
         va_end(args_copy);
         return;
     }
 
-    // Add zero-terminator the first time
-    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
@@ -2909,6 +3446,192 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
     EndOffset = ImMax(EndOffset, new_size);
 }
 
+static ImGuiTextLog::ImGuiTextLogLine& ImGuiTextLog_GetLine(ImGuiTextLog* log, int n)
+{
+    return const_cast<ImGuiTextLog::ImGuiTextLogLine&>(log->get_line(n));
+}
+
+void ImGuiTextLog::clear()
+{
+    for (ImGuiTextLogChunk& chunk : Chunks)
+        IM_FREE(chunk.Data);
+    if (SpareChunk)
+        IM_FREE(SpareChunk);
+    Chunks.clear();
+    Lines.clear();
+    LinesHead = LinesCount = LinesDropped = ChunksDropped = ChunksTotalSize = 0;
+    TotalSize = 0;
+    LastLineOpen = false;
+    SpareChunk = NULL;
+    SpareChunkSize = 0;
+}
+
+void ImGuiTextLog::append(const char* str, const char* str_end)
+{
+    const int len = str_end ? (int)(str_end - str) : (int)strlen(str);
+    if (len <= 0)
+        return;
+    memcpy(_PrepareAppend(len), str, (size_t)len);
+    _CommitAppend(len);
+}
+
+void ImGuiTextLog::appendf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    appendfv(fmt, args);
+    va_end(args);
+}
+
+void ImGuiTextLog::appendfv(const char* fmt, va_list args)
+{
+    va_list args_copy;
+    va_copy(args_copy, args);
+
+    // Format directly into the remaining space of current chunk, which is likely to succeed.
+    // A result filling all the available space may have been truncated: measure and format again into a new chunk.
+    int len = -1;
+    if (Chunks.Size > 0 && Chunks.back().Size - Chunks.back().Used > 1)
+    {
+        ImGuiTextLogChunk& chunk = Chunks.back();
+        const int avail = chunk.Size - chunk.Used;
+        len = ImFormatStringV(chunk.Data + chunk.Used, (size_t)avail, fmt, args);
+        if (len >= 0 && len < avail - 1)
+        {
+            if (len > 0)
+                _CommitAppend(len);
+            va_end(args_copy);
+            return;
+        }
+        va_list args_copy2;
+        va_copy(args_copy2, args_copy);
+        len = ImFormatStringV(NULL, 0, fmt, args_copy2);
+        va_end(args_copy2);
+    }
+    else
+    {
+        len = ImFormatStringV(NULL, 0, fmt, args);
+    }
+    if (len > 0)
+    {
+        ImFormatStringV(_PrepareAppend(len), (size_t)len + 1, fmt, args_copy);
+        _CommitAppend(len);
+    }
+    va_end(args_copy);
+}
+
+// Append all lines, each followed by a '\n' unless it is the last line and it is still open.
+void ImGuiTextLog::copy_to(ImGuiTextBuffer* out) const
+{
+    for (int line_no = 0; line_no < LinesCount; line_no++)
+    {
+        const ImGuiTextLogLine& line = get_line(line_no);
+        out->append(line.Begin, line.Begin + line.Len + ((line_no + 1 < LinesCount || !LastLineOpen) ? 1 : 0));
+    }
+}
+
+// Return a pointer where 'len' bytes (+ zero-terminator) can be written, following current last line.
+char* ImGuiTextLog::_PrepareAppend(int len)
+{
+    if (Chunks.Size > 0 && Chunks.back().Used + len + 1 <= Chunks.back().Size)
+        return Chunks.back().Data + Chunks.back().Used;
+
+    // Allocate new chunk (or recycle the spare one), moving current line into it if it is not terminated yet,
+    // so that lines are always contiguous. This is the only case where we copy existing text.
+    ImGuiTextLogLine* open_line = (LastLineOpen && LinesCount > 0) ? &ImGuiTextLog_GetLine(this, LinesCount - 1) : NULL;
+    const int carry_len = open_line ? open_line->Len : 0;
+    ImGuiTextLogChunk new_chunk;
+    new_chunk.Size = ImMax(ChunkSize, carry_len + len + 1);
+    if (SpareChunk != NULL && new_chunk.Size == SpareChunkSize)
+    {
+        new_chunk.Data = SpareChunk;
+        SpareChunk = NULL;
+    }
+    else
+    {
+        new_chunk.Data = (char*)IM_ALLOC((size_t)new_chunk.Size);
+    }
+    new_chunk.Used = carry_len;
+    if (open_line)
+    {
+        memcpy(new_chunk.Data, open_line->Begin, (size_t)carry_len);
+        open_line->Begin = new_chunk.Data;
+        open_line->ChunkNo = ChunksDropped + Chunks.Size;
+    }
+    Chunks.push_back(new_chunk);
+    ChunksTotalSize += new_chunk.Size;
+
+    // Honor MaxSize
+    while (MaxSize > 0 && ChunksTotalSize > MaxSize && Chunks.Size > 1)
+        _DropOldestChunk();
+    return Chunks.back().Data + Chunks.back().Used;
+}
+
+// Index 'len' bytes written at the end of current chunk.
+void ImGuiTextLog::_CommitAppend(int len)
+{
+    ImGuiTextLogChunk& chunk = Chunks.back();
+    const int chunk_no = ChunksDropped + Chunks.Size - 1;
+    const char* p = chunk.Data + chunk.Used;
+    const char* p_end = p + len;
+    while (p < p_end)
+    {
+        if (!LastLineOpen)
+        {
+            if (LinesCount == Lines.Size)
+            {
+                // Grow ring buffer, unwrapping it
+                ImVector<ImGuiTextLogLine> new_lines;
+                new_lines.resize(Lines.Size ? Lines.Size * 2 : 64);
+                for (int line_no = 0; line_no < LinesCount; line_no++)
+                    new_lines.Data[line_no] = get_line(line_no);
+                Lines.swap(new_lines);
+                LinesHead = 0;
+            }
+            LinesCount++;
+            ImGuiTextLogLine& new_line = ImGuiTextLog_GetLine(this, LinesCount - 1);
+            new_line.Begin = p;
+            new_line.Len = 0;
+            new_line.ChunkNo = chunk_no;
+            LastLineOpen = true;
+        }
+        const char* line_end = (const char*)memchr(p, '\n', (size_t)(p_end - p));
+        ImGuiTextLogLine& line = ImGuiTextLog_GetLine(this, LinesCount - 1);
+        line.Len += (int)((line_end ? line_end : p_end) - p);
+        LastLineOpen = (line_end == NULL);
+        p = line_end ? line_end + 1 : p_end;
+    }
+    chunk.Used += len;
+    TotalSize += (ImU64)len;
+}
+
+// Drop oldest chunk and all lines it contains. Lines are sorted by chunk, so those are the oldest lines.
+void ImGuiTextLog::_DropOldestChunk()
+{
+    IM_ASSERT(Chunks.Size > 1);
+    while (LinesCount > 0 && get_line(0).ChunkNo == ChunksDropped)
+    {
+        LinesHead = (LinesHead + 1 < Lines.Size) ? LinesHead + 1 : 0;
+        LinesCount--;
+        LinesDropped++;
+    }
+    ImGuiTextLogChunk& chunk = Chunks[0];
+    ChunksTotalSize -= chunk.Size;
+    if (chunk.Size == ChunkSize && (SpareChunk == NULL || SpareChunkSize != ChunkSize)) // Replace spare if ChunkSize changed
+    {
+        if (SpareChunk)
+            IM_FREE(SpareChunk);
+        SpareChunk = chunk.Data;
+        SpareChunkSize = chunk.Size;
+    }
+    else
+    {
+        IM_FREE(chunk.Data);
+    }
+    Chunks.erase(Chunks.begin());
+    ChunksDropped++;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 //-----------------------------------------------------------------------------
@@ -3502,13 +4225,16 @@ const char* ImGui::GetStyleColorName(ImGuiCol idx)
 
 const char* ImGui::FindRenderedTextEnd(const char* text, const char* text_end)
 {
-    const char* text_display_end = text;
     if (!text_end)
-        text_end = (const char*)-1;
+        text_end = text + strlen(text);
+    else if (const char* text_nul = (const char*)memchr(text, 0, (size_t)(text_end - text)))
+        text_end = text_nul;
 
-    while (text_display_end < text_end && *text_display_end != '\0' && (text_display_end[0] != '#' || text_display_end[1] != '#'))
-        text_display_end++;
-    return text_display_end;
+    // Scan with memchr() for each '#' rather than testing every character
+    for (const char* p = text; (p = (const char*)memchr(p, '#', (size_t)(text_end - p))) != NULL; p++)
+        if (p + 1 < text_end && p[1] == '#')
+            return p;
+    return text_end;
 }
 
 // Internal ImGui functions to render text
@@ -4013,6 +4739,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     DebugLogFlags = ImGuiDebugLogFlags_EventError | ImGuiDebugLogFlags_OutputToTTY;
     DebugLocateId = 0;
     DebugLogSkippedErrors = 0;
+    DebugLogBuf.MaxSize = 4 * 1024 * 1024;
     DebugLogAutoDisableFlags = ImGuiDebugLogFlags_None;
     DebugLogAutoDisableFrames = 0;
     DebugLocateFrames = 0;
@@ -4034,6 +4761,8 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
     FramerateSecPerFrameAccum = 0.0f;
     WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
+    RedrawRequestDelay = FLT_MAX;
+    RedrawFramesAfterInput = 0;
     memset(TempKeychordName, 0, sizeof(TempKeychordName));
 }
 
@@ -4056,6 +4785,9 @@ void ImGui::Initialize()
     }
     TableSettingsAddSettingsHandler();
 
+    // Windows are looked up by ID many times per frame
+    g.WindowsById.SetHashIndexEnabled(true);
+
     // Setup default localization table
     LocalizeRegisterEntries(GLocalizationEntriesEnUS, IM_ARRAYSIZE(GLocalizationEntriesEnUS));
 
@@ -4146,6 +4878,10 @@ void ImGui::Shutdown()
 
     g.MultiSelectStorage.Clear();
     g.MultiSelectTempData.clear_destruct();
+    g.TextSizeCache.Clear();
+    for (ImGuiTextWrapLayout* layout : g.TextWrapLayouts)
+        IM_DELETE(layout);
+    g.TextWrapLayouts.clear();
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
@@ -4165,7 +4901,6 @@ void ImGui::Shutdown()
     }
     g.LogBuffer.clear();
     g.DebugLogBuf.clear();
-    g.DebugLogIndex.clear();
 
     g.Initialized = false;
 }
@@ -4206,13 +4941,15 @@ void ImGui::CallContextHooks(ImGuiContext* ctx, ImGuiContextHookType hook_type)
 //-----------------------------------------------------------------------------
 
 // ImGuiWindow is mostly a dumb struct. It merely has a constructor and a few helper methods
-ImGuiWindow::ImGuiWindow(ImGuiContext* ctx, const char* name) : DrawListInst(NULL)
+ImGuiWindow::ImGuiWindow(ImGuiContext* ctx, ImStrv name) : DrawListInst(NULL)
 {
     memset(this, 0, sizeof(*this));
     Ctx = ctx;
-    Name = ImStrdup(name);
-    NameBufLen = (int)strlen(name) + 1;
-    ID = ImHashStr(name);
+    NameBufLen = (int)name.size() + 1;
+    Name = (char*)IM_ALLOC((size_t)NameBufLen);
+    memcpy(Name, name.Begin, name.size());
+    Name[name.size()] = 0;
+    ID = ImHashStr(Name);
     IDStack.push_back(ID);
     MoveId = GetID("#MOVE");
     ScrollTarget = ImVec2(FLT_MAX, FLT_MAX);
@@ -4260,6 +4997,7 @@ void ImGui::GcCompactTransientMiscBuffers()
     g.GroupStack.clear();
     g.MultiSelectTempDataStacked = 0;
     g.MultiSelectTempData.clear_destruct();
+    g.TextSizeCache.Clear();
     TableGcCompactSettings();
 }
 
@@ -4664,6 +5402,47 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+// Return word-wrap layout of a text for current font, to only render its visible lines.
+// Layouts are kept across frames and rebuilt when text contents, font or wrap width changed. They are discarded when unused for a frame.
+// - Layouts are looked up by text pointer, length, font and wrap width (there are only as many layouts as long wrapped texts visible in a frame).
+// - Text contents are then compared with a copy: this is still O(text) but a memcmp() is much cheaper than measuring glyphs (see TextEx()).
+ImGuiTextWrapLayout* ImGui::GetTextWrapLayout(const char* text, const char* text_end, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    ImFont* font = g.Font;
+    if (text_end == NULL)
+        text_end = text + strlen(text);
+    const int text_len = (int)(text_end - text);
+    const int font_atlas_build_count = font->ContainerAtlas ? font->ContainerAtlas->BuildCount : 0;
+
+    for (ImGuiTextWrapLayout* layout : g.TextWrapLayouts)
+        if (layout->TextPtr == text && layout->TextLen == text_len && layout->Font == font && layout->FontAtlasBuildCount == font_atlas_build_count && layout->FontSize == g.FontSize && layout->WrapWidth == wrap_width)
+        {
+            if (memcmp(layout->Text.Data, text, (size_t)text_len) != 0)
+            {
+                // Contents changed: rebuild in place
+                memcpy(layout->Text.Data, text, (size_t)text_len);
+                layout->Size = ImFontCalcTextSizeEx(font, g.FontSize, FLT_MAX, wrap_width, text, text_end, NULL, &layout->LineOffsets);
+            }
+            layout->LastFrameUsed = g.FrameCount;
+            return layout;
+        }
+
+    ImGuiTextWrapLayout* layout = IM_NEW(ImGuiTextWrapLayout)();
+    layout->TextPtr = text;
+    layout->TextLen = text_len;
+    layout->Text.resize(text_len);
+    memcpy(layout->Text.Data, text, (size_t)text_len);
+    layout->Font = font;
+    layout->FontAtlasBuildCount = font_atlas_build_count;
+    layout->FontSize = g.FontSize;
+    layout->WrapWidth = wrap_width;
+    layout->LastFrameUsed = g.FrameCount;
+    layout->Size = ImFontCalcTextSizeEx(font, g.FontSize, FLT_MAX, wrap_width, text, text_end, NULL, &layout->LineOffsets);
+    g.TextWrapLayouts.push_back(layout);
+    return layout;
+}
+
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
@@ -4767,6 +5546,23 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+void ImGui::RequestRedraw(float delay)
+{
+    ImGuiContext& g = *GImGui;
+    g.RedrawRequestDelay = ImMin(g.RedrawRequestDelay, ImMax(delay, 0.0f));
+}
+
+void ImGui::AddDamageRect(const ImVec2& p_min, const ImVec2& p_max)
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.IO.ConfigDrawDataDamageRects)
+        return;
+    const ImRect rect(p_min, p_max);
+    for (ImGuiViewportP* viewport : g.Viewports)
+        if (rect.Overlaps(viewport->GetMainRect()))
+            viewport->Damage.UserRects.push_back(rect.ToVec4());
+}
+
 static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -4818,6 +5614,25 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+ImDrawListSharedData* ImGui::CreateDrawListSharedData()
+{
+    ImDrawListSharedData* shared_data = IM_NEW(ImDrawListSharedData)();
+    UpdateDrawListSharedData(shared_data);
+    return shared_data;
+}
+
+void ImGui::UpdateDrawListSharedData(ImDrawListSharedData* shared_data)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(shared_data != &g.DrawListSharedData);
+    shared_data->CopySettingsFrom(g.DrawListSharedData);
+}
+
+void ImGui::DestroyDrawListSharedData(ImDrawListSharedData* shared_data)
+{
+    IM_DELETE(shared_data);
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -5044,6 +5859,12 @@ static void SetupDrawListSharedData()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasIdxSize)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowIdxSize;
+#ifndef IMGUI_USE_COMPACT_DRAWVERT
+    if ((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasAnalyticShapes) && g.Style.AntiAliasedFill)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AnalyticShapes;
+#endif
 }
 
 void ImGui::NewFrame()
@@ -5256,6 +6077,15 @@ void ImGui::NewFrame()
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
 
+    // Discard unused entries of the text size cache and word-wrap layouts unused during last frame
+    UpdateTextSizeCache();
+    for (int n = g.TextWrapLayouts.Size - 1; n >= 0; n--)
+        if (g.TextWrapLayouts[n]->LastFrameUsed < g.FrameCount - 1)
+        {
+            IM_DELETE(g.TextWrapLayouts[n]);
+            g.TextWrapLayouts.erase_unsorted(&g.TextWrapLayouts[n]);
+        }
+
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
         FocusTopMostWindowUnderOne(NULL, NULL, NULL, ImGuiFocusRequestFlags_RestoreFocusedChild);
@@ -5394,10 +6224,212 @@ static void InitViewportDrawData(ImGuiViewportP* viewport)
     draw_data->Valid = true;
     draw_data->CmdListsCount = 0;
     draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->FlatLists.resize(0);
     draw_data->DisplayPos = viewport->Pos;
     draw_data->DisplaySize = viewport->Size;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
     draw_data->OwnerViewport = viewport;
+    draw_data->DamageRectsValid = false;
+    draw_data->DamageRects.resize(0);
+}
+
+// Add a damage rectangle, merging it with any overlapping one so that rectangles stay disjoint (renderers may draw a command once per rectangle).
+// When there are too many, merge the pair which adds the least area.
+#define IMGUI_DAMAGE_RECTS_MAX  16
+static void DamageRectsAdd(ImVector<ImVec4>* rects, ImRect r, const ImRect& display_rect)
+{
+    r.ClipWithFull(display_rect);
+    r.Min = ImTrunc(r.Min);
+    r.Max = ImVec2(ImCeil(r.Max.x), ImCeil(r.Max.y));
+    if (r.Min.x >= r.Max.x || r.Min.y >= r.Max.y)
+        return;
+    for (;;)
+    {
+        for (int n = 0; n < rects->Size; n++)
+        {
+            ImRect other((*rects)[n]);
+            if (!other.Overlaps(r))
+                continue;
+            r.Add(other);
+            rects->erase(rects->Data + n);
+            n = -1; // Restart as the merged rectangle may overlap previously tested ones
+        }
+        if (rects->Size < IMGUI_DAMAGE_RECTS_MAX)
+            break;
+        int best_n = 0;
+        float best_cost = FLT_MAX;
+        for (int n = 0; n < rects->Size; n++)
+        {
+            ImRect other((*rects)[n]);
+            ImRect merged = r;
+            merged.Add(other);
+            const float cost = merged.GetArea() - other.GetArea() - r.GetArea();
+            if (cost < best_cost)
+                best_cost = cost, best_n = n;
+        }
+        r.Add(ImRect((*rects)[best_n]));
+        rects->erase(rects->Data + best_n);
+    }
+    rects->push_back(r.ToVec4());
+}
+
+// Only the texture identifier is hashed: a texture whose contents changed is not detected (see AddDamageRect()).
+static void CalcDamageCmd(const ImDrawList* draw_list, const ImDrawCmd* cmd, ImGuiDamageCmd* out)
+{
+    out->Bounds = ImRect(cmd->ClipRect);
+    if (cmd->UserCallback != NULL)
+    {
+        out->Hash = 0;
+        return;
+    }
+
+    // Indices are hashed relative to the lowest vertex, so that adding/removing vertices in earlier commands doesn't affect us.
+    unsigned int vtx_min = (unsigned int)-1, vtx_max = 0;
+    for (unsigned int idx_n = cmd->IdxOffset; idx_n < cmd->IdxOffset + cmd->ElemCount; idx_n++)
+    {
+        const unsigned int idx = draw_list->_GetIdx(idx_n);
+        vtx_min = ImMin(vtx_min, idx);
+        vtx_max = ImMax(vtx_max, idx);
+    }
+    if (vtx_min > vtx_max)
+    {
+        out->Hash = 1;
+        out->Bounds = ImRect();
+        return;
+    }
+    ImU32 hash = ImHashData(&cmd->ClipRect, sizeof(cmd->ClipRect), ImHashData(&cmd->TextureId, sizeof(cmd->TextureId)));
+    for (unsigned int idx_n = cmd->IdxOffset; idx_n < cmd->IdxOffset + cmd->ElemCount; idx_n++)
+        hash = (hash ^ (draw_list->_GetIdx(idx_n) - vtx_min)) * 16777619u; // FNV-1a step
+    const ImDrawVert* vtx_begin = draw_list->VtxBuffer.Data + cmd->VtxOffset + vtx_min;
+    const ImDrawVert* vtx_end = draw_list->VtxBuffer.Data + cmd->VtxOffset + vtx_max + 1;
+    hash = ImHashData(vtx_begin, (size_t)(vtx_end - vtx_begin) * sizeof(ImDrawVert), hash);
+    out->Hash = (hash != 0) ? hash : 1;
+
+    ImRect bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (const ImDrawVert* vtx = vtx_begin; vtx < vtx_end; vtx++)
+        bounds.Add((ImVec2)vtx->pos);
+    bounds.ClipWithFull(out->Bounds);
+    out->Bounds = bounds;
+}
+
+// Compare draw lists with previous frame and output DrawDataP.DamageRects.
+// - Lists are matched by pointer. Within a list, commands are matched by hash from the start and from the end: unmatched ones in the middle are damaged (both their old and new bounds).
+// - Lists which appeared, disappeared or changed order relative to others are entirely damaged.
+// - Callbacks may output anything, their whole clipping rectangle is always damaged.
+// - Textures are only known by their identifier: changes of their contents are not detected, the application needs to call AddDamageRect().
+// - Output is the union of damage of the last io.DisplayBufferAge frames, which is what the back buffer misses. When the age is unknown (0) or too old, the whole display is damaged.
+static void UpdateViewportDamageRects(ImGuiViewportP* viewport)
+{
+    ImGuiContext& g = *GImGui;
+    ImDrawData* draw_data = &viewport->DrawDataP;
+    ImGuiViewportDamage* damage = &viewport->Damage;
+    ImVector<ImVec4>* rects = &damage->Rects;
+    rects->resize(0);
+    const ImRect display_rect(draw_data->DisplayPos, draw_data->DisplayPos + draw_data->DisplaySize);
+    const bool full_damage = !damage->Valid || damage->DisplayPos.x != draw_data->DisplayPos.x || damage->DisplayPos.y != draw_data->DisplayPos.y || damage->DisplaySize.x != draw_data->DisplaySize.x || damage->DisplaySize.y != draw_data->DisplaySize.y;
+
+    damage->ListsNext.resize(0);
+    damage->CmdsNext.resize(0);
+    for (ImGuiDamageList& prev_list : damage->Lists)
+        prev_list.Matched = false;
+
+    int prev_list_n_max = -1;
+    for (int list_n = 0; list_n < draw_data->CmdLists.Size; list_n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+        damage->ListsNext.resize(damage->ListsNext.Size + 1);
+        ImGuiDamageList* list = &damage->ListsNext.back();
+        list->DrawList = draw_list;
+        list->CmdsOffset = damage->CmdsNext.Size;
+        list->CmdsCount = draw_list->CmdBuffer.Size;
+        list->Bounds = ImRect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        list->Matched = false;
+        damage->CmdsNext.resize(damage->CmdsNext.Size + list->CmdsCount);
+        ImGuiDamageCmd* cmds = damage->CmdsNext.Data + list->CmdsOffset;
+        for (int cmd_n = 0; cmd_n < list->CmdsCount; cmd_n++)
+        {
+            CalcDamageCmd(draw_list, &draw_list->CmdBuffer[cmd_n], &cmds[cmd_n]);
+            if (cmds[cmd_n].Bounds.Min.x <= cmds[cmd_n].Bounds.Max.x)
+                list->Bounds.Add(cmds[cmd_n].Bounds);
+        }
+        if (full_damage)
+            continue;
+
+        // Find list in previous frame (generally at a similar index)
+        int prev_list_n = -1;
+        for (int n = 0; n < damage->Lists.Size && prev_list_n == -1; n++)
+        {
+            const int probe_n = (list_n + n) % damage->Lists.Size;
+            if (damage->Lists[probe_n].DrawList == draw_list && !damage->Lists[probe_n].Matched)
+                prev_list_n = probe_n;
+        }
+        if (prev_list_n == -1 || prev_list_n < prev_list_n_max)
+        {
+            DamageRectsAdd(rects, list->Bounds, display_rect);
+            if (prev_list_n != -1)
+            {
+                DamageRectsAdd(rects, damage->Lists[prev_list_n].Bounds, display_rect);
+                damage->Lists[prev_list_n].Matched = true;
+            }
+            continue;
+        }
+        ImGuiDamageList* prev_list = &damage->Lists[prev_list_n];
+        prev_list->Matched = true;
+        prev_list_n_max = prev_list_n;
+
+        // Match commands from both ends
+        const ImGuiDamageCmd* prev_cmds = damage->Cmds.Data + prev_list->CmdsOffset;
+        const int prev_count = prev_list->CmdsCount;
+        const int count = list->CmdsCount;
+        int head = 0, tail = 0;
+        while (head < prev_count && head < count && prev_cmds[head].Hash != 0 && prev_cmds[head].Hash == cmds[head].Hash)
+            head++;
+        while (tail < prev_count - head && tail < count - head && prev_cmds[prev_count - 1 - tail].Hash != 0 && prev_cmds[prev_count - 1 - tail].Hash == cmds[count - 1 - tail].Hash)
+            tail++;
+        for (int cmd_n = head; cmd_n < prev_count - tail; cmd_n++)
+            DamageRectsAdd(rects, prev_cmds[cmd_n].Bounds, display_rect);
+        for (int cmd_n = head; cmd_n < count - tail; cmd_n++)
+            DamageRectsAdd(rects, cmds[cmd_n].Bounds, display_rect);
+    }
+
+    // Lists which disappeared
+    if (!full_damage)
+        for (ImGuiDamageList& prev_list : damage->Lists)
+            if (!prev_list.Matched)
+                DamageRectsAdd(rects, prev_list.Bounds, display_rect);
+    if (full_damage)
+        DamageRectsAdd(rects, display_rect, display_rect);
+    for (const ImVec4& user_rect : damage->UserRects)
+        DamageRectsAdd(rects, ImRect(user_rect), display_rect);
+    damage->UserRects.resize(0);
+
+    // Output damage since the back buffer was last presented
+    if (!damage->Valid)
+        damage->RectsHistoryCount = 0;
+    const int buffer_age = g.IO.DisplayBufferAge;
+    draw_data->DamageRects.resize(0);
+    if (buffer_age <= 0 || buffer_age - 1 > damage->RectsHistoryCount)
+    {
+        DamageRectsAdd(&draw_data->DamageRects, display_rect, display_rect);
+    }
+    else
+    {
+        draw_data->DamageRects = *rects;
+        for (int history_n = 0; history_n < buffer_age - 1; history_n++)
+            for (const ImVec4& rect : damage->RectsHistory[history_n])
+                DamageRectsAdd(&draw_data->DamageRects, ImRect(rect), display_rect);
+    }
+    for (int history_n = IM_ARRAYSIZE(damage->RectsHistory) - 1; history_n > 0; history_n--)
+        damage->RectsHistory[history_n].swap(damage->RectsHistory[history_n - 1]);
+    damage->RectsHistory[0].swap(*rects);
+    damage->RectsHistoryCount = ImMin(damage->RectsHistoryCount + 1, IM_ARRAYSIZE(damage->RectsHistory));
+
+    damage->Lists.swap(damage->ListsNext);
+    damage->Cmds.swap(damage->CmdsNext);
+    damage->Valid = true;
+    damage->DisplayPos = draw_data->DisplayPos;
+    damage->DisplaySize = draw_data->DisplaySize;
+    draw_data->DamageRectsValid = true;
 }
 
 // Push a clipping rectangle for both ImGui logic (hit-testing etc.) and low-level ImDrawList rendering.
@@ -5504,6 +6536,90 @@ static void ImGui::RenderDimmedBackgrounds()
     }
 }
 
+// Called by EndFrame(). Decide if a new frame needs to be processed without new input events, and when.
+// This is conservative: any ongoing interaction (e.g. mouse button held, window appearing) keeps frames going.
+// Applications wanting to save power may wait for input events while io.WantRedraw is false, up to io.NextRedrawDelay.
+static void ImGui::UpdateWantRedraw()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    float delay = g.RedrawRequestDelay;
+    g.RedrawRequestDelay = FLT_MAX;
+
+    // Input events processed this frame or still pending (e.g. trickled to next frame)
+    if (g.InputEventsTrail.Size > 0 || g.InputEventsQueue.Size > 0 || g.FrameCount < REDRAW_FRAMES_AFTER_INPUT)
+        g.RedrawFramesAfterInput = REDRAW_FRAMES_AFTER_INPUT;
+    if (g.RedrawFramesAfterInput > 0)
+    {
+        g.RedrawFramesAfterInput--;
+        delay = 0.0f;
+    }
+
+    // Mouse buttons or keys held (drag, key repeat, button repeat, etc.). Modifiers alone don't count.
+    for (int n = 0; n < IM_ARRAYSIZE(io.MouseDown) && delay > 0.0f; n++)
+        if (io.MouseDown[n])
+            delay = 0.0f;
+    for (ImGuiKey key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_ReservedForModCtrl && delay > 0.0f; key = (ImGuiKey)(key + 1))
+        if (!IsLRModKey(key) && GetKeyData(key)->Down)
+            delay = 0.0f;
+    if (g.DragDropActive || io.WantSetMousePos || g.NavMoveSubmitted || g.NavInitRequest)
+        delay = 0.0f;
+
+    // Windows appearing/disappearing, auto-resizing or scrolling. Popups opened this frame.
+    for (ImGuiWindow* window : g.Windows)
+    {
+        if (delay <= 0.0f)
+            break;
+        if (window->Active != window->WasActive)
+            delay = 0.0f;
+        else if (window->Active && (window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0))
+            delay = 0.0f;
+        else if (window->ScrollTarget.x < FLT_MAX || window->ScrollTarget.y < FLT_MAX)
+            delay = 0.0f;
+    }
+    for (ImGuiPopupData& popup_data : g.OpenPopupStack)
+        if (popup_data.OpenFrameCount == g.FrameCount)
+            delay = 0.0f;
+
+    // Animations: background dimming, CTRL+Tab highlight, shortcut activation highlight
+    if ((GetTopMostPopupModal() != NULL) ? (g.DimBgRatio < 1.0f) : (g.DimBgRatio > 0.0f))
+        delay = 0.0f;
+    if (g.NavWindowingTarget != NULL || g.NavWindowingTargetAnim != NULL)
+        delay = 0.0f;
+    if (g.NavHighlightActivatedTimer > 0.0f)
+        delay = ImMin(delay, g.NavHighlightActivatedTimer);
+
+    // Text cursor blinking (see InputTextEx()). Wake up slightly after the toggle time, as it is tested with '<='.
+    ImGuiInputTextState* state = &g.InputTextState;
+    if (io.ConfigInputTextCursorBlink && state->ID != 0 && state->ID == g.ActiveId)
+    {
+        const float t = (state->CursorAnim <= 0.0f) ? state->CursorAnim : ImFmod(state->CursorAnim, 1.20f);
+        delay = ImMin(delay, ((t <= 0.80f) ? 0.80f - t : 1.20f - t) + 0.001f);
+    }
+
+    // Hover delays for IsItemHovered() and tooltips: wake up when next delay elapses
+    if (g.HoverItemDelayId != 0)
+    {
+        if (g.HoverItemDelayTimer < g.Style.HoverDelayShort)
+            delay = ImMin(delay, g.Style.HoverDelayShort - g.HoverItemDelayTimer);
+        else if (g.HoverItemDelayTimer < g.Style.HoverDelayNormal)
+            delay = ImMin(delay, g.Style.HoverDelayNormal - g.HoverItemDelayTimer);
+        if (g.MouseStationaryTimer < g.Style.HoverStationaryDelay)
+            delay = ImMin(delay, g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
+    }
+    if (g.HoveredId != 0 && g.HoveredIdTimer < WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER)
+        delay = ImMin(delay, WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER - g.HoveredIdTimer);
+
+    // Timers
+    if (g.WheelingWindowReleaseTimer > 0.0f)
+        delay = ImMin(delay, g.WheelingWindowReleaseTimer);
+    if (g.SettingsDirtyTimer > 0.0f)
+        delay = ImMin(delay, g.SettingsDirtyTimer);
+
+    io.NextRedrawDelay = ImMax(delay, 0.0f);
+    io.WantRedraw = (io.NextRedrawDelay == 0.0f);
+}
+
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
@@ -5585,6 +6701,9 @@ void ImGui::EndFrame()
     g.Windows.swap(g.WindowsTempSortBuffer);
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
+    // Tell application if next frame may be delayed until new input events
+    UpdateWantRedraw();
+
     // Unlock font atlas
     g.IO.Fonts->Locked = false;
 
@@ -5661,11 +6780,91 @@ void ImGui::Render()
 
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
+
+        if (g.IO.ConfigDrawDataDamageRects && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasDamageRects))
+        {
+            UpdateViewportDamageRects(viewport);
+        }
+        else
+        {
+            viewport->Damage.Valid = false;
+            viewport->Damage.UserRects.resize(0);
+        }
     }
 
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
+// Return slot holding 'key', or empty slot where it may be inserted.
+static ImGuiTextSizeCacheEntry* ImGuiTextSizeCache_FindSlot(ImGuiTextSizeCache* cache, ImGuiID key)
+{
+    IM_ASSERT(key != 0 && cache->EntriesCount < cache->Slots.Size);
+    const ImU32 mask = (ImU32)cache->Slots.Size - 1;
+    for (ImU32 idx = key & mask; ; idx = (idx + 1) & mask)
+    {
+        ImGuiTextSizeCacheEntry* slot = &cache->Slots.Data[idx];
+        if (slot->Key == key || slot->Key == 0)
+            return slot;
+    }
+}
+
+// Rebuild table with 'new_slots_count' slots, discarding entries last used before 'frame_min'.
+// Also compacts the text buffer, which may hold texts of discarded or overwritten entries.
+static void ImGuiTextSizeCache_Rehash(ImGuiTextSizeCache* cache, int new_slots_count, int frame_min)
+{
+    IM_ASSERT(ImIsPowerOfTwo(new_slots_count));
+    ImVector<ImGuiTextSizeCacheEntry> old_slots;
+    ImVector<char> old_text_buffer;
+    old_slots.swap(cache->Slots);
+    old_text_buffer.swap(cache->TextBuffer);
+    cache->Slots.resize(new_slots_count);
+    memset(cache->Slots.Data, 0, (size_t)cache->Slots.size_in_bytes());
+    cache->TextBuffer.reserve(old_text_buffer.Size);
+    cache->EntriesCount = 0;
+    for (const ImGuiTextSizeCacheEntry& entry : old_slots)
+        if (entry.Key != 0 && entry.LastFrameUsed >= frame_min)
+        {
+            ImGuiTextSizeCacheEntry* new_entry = ImGuiTextSizeCache_FindSlot(cache, entry.Key);
+            *new_entry = entry;
+            new_entry->TextOffset = cache->TextBuffer.Size;
+            cache->TextBuffer.resize(cache->TextBuffer.Size + entry.TextLen);
+            memcpy(cache->TextBuffer.Data + new_entry->TextOffset, old_text_buffer.Data + entry.TextOffset, (size_t)entry.TextLen);
+            cache->EntriesCount++;
+        }
+}
+
+// Called by NewFrame()
+static void ImGui::UpdateTextSizeCache()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextSizeCache& cache = g.TextSizeCache;
+    cache.HitCountLastFrame = cache.HitCount;
+    cache.MissCountLastFrame = cache.MissCount;
+    cache.HitCount = cache.MissCount = 0;
+
+    // Discard everything when disabled or when fonts have been rebuilt
+    if (!g.IO.ConfigTextSizeCache || cache.FontAtlasBuildCount != g.IO.Fonts->BuildCount)
+    {
+        if (cache.Slots.Capacity > 0)
+            cache.Clear();
+        cache.FontAtlasBuildCount = g.IO.Fonts->BuildCount;
+        return;
+    }
+
+    // Discard entries unused for MaxFrameAge frames (scanning every 16 frames, or every frame when full)
+    if (((g.FrameCount & 15) != 0 && cache.EntriesCount < cache.MaxEntries) || cache.EntriesCount == 0)
+        return;
+    const int frame_min = g.FrameCount - cache.MaxFrameAge;
+    int alive_count = 0;
+    for (const ImGuiTextSizeCacheEntry& entry : cache.Slots)
+        if (entry.Key != 0 && entry.LastFrameUsed >= frame_min)
+            alive_count++;
+    if (alive_count == 0)
+        cache.Clear();
+    else if (alive_count < cache.EntriesCount)
+        ImGuiTextSizeCache_Rehash(&cache, cache.Slots.Size, frame_min);
+}
+
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -5682,6 +6881,49 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+
+    // Lookup cross-frame cache
+    // (entries keep a copy of their text which is compared on lookup: a hash collision is a cache miss, never a wrong size)
+    ImGuiTextSizeCache& cache = g.TextSizeCache;
+    ImGuiTextSizeCacheEntry* cache_entry = NULL;
+    if (g.IO.ConfigTextSizeCache && cache.MaxEntries > 0)
+    {
+        if (text_display_end == NULL)
+            text_display_end = text + strlen(text);
+        struct { ImFont* Font; float FontSize; float WrapWidth; } key_data = { font, font_size, wrap_width };
+        const int text_len = (int)(text_display_end - text);
+        ImGuiID key = ImHashData(text, (size_t)text_len, ImHashData(&key_data, sizeof(key_data)));
+        if (key == 0)
+            key = 1;
+        if (cache.EntriesCount * 2 >= cache.Slots.Size && cache.Slots.Size < cache.MaxEntries * 2)
+            ImGuiTextSizeCache_Rehash(&cache, ImMax(cache.Slots.Size * 2, 256), INT_MIN);
+        cache_entry = ImGuiTextSizeCache_FindSlot(&cache, key);
+        if (cache_entry->Key == key && cache_entry->TextLen == text_len && cache_entry->Font == font && cache_entry->FontSize == font_size && cache_entry->WrapWidth == wrap_width &&
+            memcmp(cache.TextBuffer.Data + cache_entry->TextOffset, text, (size_t)text_len) == 0)
+        {
+            cache_entry->LastFrameUsed = g.FrameCount;
+            cache.HitCount++;
+            return cache_entry->Size;
+        }
+        if (cache_entry->Key == 0 && cache.EntriesCount >= cache.MaxEntries)
+            cache_entry = NULL;
+        else if (cache_entry->Key == 0)
+            cache.EntriesCount++;
+        if (cache_entry != NULL)
+        {
+            cache_entry->Key = key;
+            cache_entry->TextLen = text_len;
+            cache_entry->TextOffset = cache.TextBuffer.Size;
+            cache.TextBuffer.resize(cache.TextBuffer.Size + text_len);
+            memcpy(cache.TextBuffer.Data + cache_entry->TextOffset, text, (size_t)text_len);
+            cache_entry->Font = font;
+            cache_entry->FontSize = font_size;
+            cache_entry->WrapWidth = wrap_width;
+            cache_entry->LastFrameUsed = g.FrameCount;
+        }
+        cache.MissCount++;
+    }
+
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
@@ -5691,6 +6933,8 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
     text_size.x = IM_TRUNC(text_size.x + 0.99999f);
 
+    if (cache_entry != NULL)
+        cache_entry->Size = text_size;
     return text_size;
 }
 
@@ -5924,7 +7168,13 @@ bool ImGui::BeginChild(ImGuiID id, const ImVec2& size_arg, ImGuiChildFlags child
     return BeginChildEx(NULL, id, size_arg, child_flags, window_flags);
 }
 
-bool ImGui::BeginChildEx(const char* name, ImGuiID id, const ImVec2& size_arg, ImGuiChildFlags child_flags, ImGuiWindowFlags window_flags)
+bool ImGui::BeginChild(ImStrv str_id, const ImVec2& size_arg, ImGuiChildFlags child_flags, ImGuiWindowFlags window_flags)
+{
+    ImGuiID id = GetCurrentWindow()->GetID(ImGuiLabel(str_id.Begin, str_id.End));
+    return BeginChildEx(str_id, id, size_arg, child_flags, window_flags);
+}
+
+bool ImGui::BeginChildEx(ImStrv name, ImGuiID id, const ImVec2& size_arg, ImGuiChildFlags child_flags, ImGuiWindowFlags window_flags)
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* parent_window = g.CurrentWindow;
@@ -6003,13 +7253,14 @@ bool ImGui::BeginChildEx(const char* name, ImGuiID id, const ImVec2& size_arg, I
     // FIXME: 2023/11/14: commented out shorted version. We had an issue with multiple ### in child window path names, which the trailing hash helped workaround.
     // e.g. "ParentName###ParentIdentifier/ChildName###ChildIdentifier" would get hashed incorrectly by ImHashStr(), trailing _%08X somehow fixes it.
     const char* temp_window_name;
-    /*if (name && parent_window->IDStack.back() == parent_window->ID)
-        ImFormatStringToTempBuffer(&temp_window_name, NULL, "%s/%s", parent_window->Name, name); // May omit ID if in root of ID stack
+    const char* temp_window_name_end;
+    /*if (name.Begin && parent_window->IDStack.back() == parent_window->ID)
+        ImFormatStringToTempBuffer(&temp_window_name, &temp_window_name_end, "%s/%.*s", parent_window->Name, (int)name.size(), name.Begin); // May omit ID if in root of ID stack
     else*/
-    if (name)
-        ImFormatStringToTempBuffer(&temp_window_name, NULL, "%s/%s_%08X", parent_window->Name, name, id);
+    if (name.Begin)
+        ImFormatStringToTempBuffer(&temp_window_name, &temp_window_name_end, "%s/%.*s_%08X", parent_window->Name, (int)name.size(), name.Begin, id);
     else
-        ImFormatStringToTempBuffer(&temp_window_name, NULL, "%s/%08X", parent_window->Name, id);
+        ImFormatStringToTempBuffer(&temp_window_name, &temp_window_name_end, "%s/%08X", parent_window->Name, id);
 
     // Set style
     const float backup_border_size = g.Style.ChildBorderSize;
@@ -6017,7 +7268,7 @@ bool ImGui::BeginChildEx(const char* name, ImGuiID id, const ImVec2& size_arg, I
         g.Style.ChildBorderSize = 0.0f;
 
     // Begin into window
-    const bool ret = Begin(temp_window_name, NULL, window_flags);
+    const bool ret = Begin(ImStrv(temp_window_name, temp_window_name_end), NULL, window_flags);
 
     // Restore style
     g.Style.ChildBorderSize = backup_border_size;
@@ -6175,10 +7426,10 @@ static void InitOrLoadWindowSettings(ImGuiWindow* window, ImGuiWindowSettings* s
     }
 }
 
-static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
+static ImGuiWindow* CreateNewWindow(ImStrv name, ImGuiWindowFlags flags)
 {
     // Create window the first time
-    //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
+    //IMGUI_DEBUG_LOG("CreateNewWindow '%.*s', flags = 0x%08X\n", (int)name.size(), name.Begin, flags);
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = IM_NEW(ImGuiWindow)(&g, name);
     window->Flags = flags;
@@ -6761,7 +8012,7 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
 }
 
 // Render title text, collapse button, close button
-void ImGui::RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& title_bar_rect, const char* name, bool* p_open)
+void ImGui::RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& title_bar_rect, ImStrv name, bool* p_open)
 {
     ImGuiContext& g = *GImGui;
     ImGuiStyle& style = g.Style;
@@ -6815,7 +8066,7 @@ void ImGui::RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& titl
     // Title bar text (with: horizontal alignment, avoiding collapse/close button, optional "unsaved document" marker)
     // FIXME: Refactor text alignment facilities along with RenderText helpers, this is WAY too much messy code..
     const float marker_size_x = (flags & ImGuiWindowFlags_UnsavedDocument) ? button_sz * 0.80f : 0.0f;
-    const ImVec2 text_size = CalcTextSize(name, NULL, true) + ImVec2(marker_size_x, 0.0f);
+    const ImVec2 text_size = CalcTextSize(name.Begin, name.End, true) + ImVec2(marker_size_x, 0.0f);
 
     // As a nice touch we try to ensure that centered title text doesn't get affected by visibility of Close/Collapse button,
     // while uncentered title text will still reach edges correctly.
@@ -6846,7 +8097,7 @@ void ImGui::RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& titl
     }
     //if (g.IO.KeyShift) window->DrawList->AddRect(layout_r.Min, layout_r.Max, IM_COL32(255, 128, 0, 255)); // [DEBUG]
     //if (g.IO.KeyCtrl) window->DrawList->AddRect(clip_r.Min, clip_r.Max, IM_COL32(255, 128, 0, 255)); // [DEBUG]
-    RenderTextClipped(layout_r.Min, layout_r.Max, name, NULL, &text_size, style.WindowTitleAlign, &clip_r);
+    RenderTextClipped(layout_r.Min, layout_r.Max, name.Begin, name.End, &text_size, style.WindowTitleAlign, &clip_r);
 }
 
 void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags flags, ImGuiWindow* parent_window)
@@ -6947,15 +8198,21 @@ ImGuiWindow* ImGui::FindBlockingModal(ImGuiWindow* window)
 // - Return false when window is collapsed, so you can early out in your code. You always need to call ImGui::End() even if false is returned.
 // - Passing 'bool* p_open' displays a Close button on the upper-right corner of the window, the pointed value will be set to false when the button is pressed.
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
+{
+    IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
+    return Begin(ImStrv(name), p_open, flags);
+}
+
+bool ImGui::Begin(ImStrv name, bool* p_open, ImGuiWindowFlags flags)
 {
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
-    IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
+    IM_ASSERT(name.Begin != NULL && !name.empty()); // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
 
     // Find or create
-    ImGuiWindow* window = FindWindowByName(name);
+    ImGuiWindow* window = FindWindowByID(ImHashStr(name.Begin, name.size()));
     const bool window_just_created = (window == NULL);
     if (window_just_created)
         window = CreateNewWindow(name, flags);
@@ -7132,11 +8389,16 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         bool window_title_visible_elsewhere = false;
         if (g.NavWindowingListWindow != NULL && (window->Flags & ImGuiWindowFlags_NoNavFocus) == 0)   // Window titles visible when using CTRL+TAB
             window_title_visible_elsewhere = true;
-        if (window_title_visible_elsewhere && !window_just_created && strcmp(name, window->Name) != 0)
+        if (window_title_visible_elsewhere && !window_just_created && (strncmp(name.Begin, window->Name, name.size()) != 0 || window->Name[name.size()] != 0))
         {
-            size_t buf_len = (size_t)window->NameBufLen;
-            window->Name = ImStrdupcpy(window->Name, &buf_len, name);
-            window->NameBufLen = (int)buf_len;
+            if ((size_t)window->NameBufLen < name.size() + 1)
+            {
+                IM_FREE(window->Name);
+                window->NameBufLen = (int)name.size() + 1;
+                window->Name = (char*)IM_ALLOC((size_t)window->NameBufLen);
+            }
+            memcpy(window->Name, name.Begin, name.size());
+            window->Name[name.size()] = 0;
         }
 
         // UPDATE CONTENTS SIZE, UPDATE HIDDEN STATUS
@@ -8653,6 +9915,24 @@ bool ImGui::IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max)
 // [SECTION] ID STACK
 //-----------------------------------------------------------------------------
 
+// Parse a label once so its users don't need to scan it for "##" and "###" again.
+// Note that "###" always starts at or after the first "##" occurrence.
+ImGuiLabel::ImGuiLabel(const char* str, const char* str_end)
+{
+    if (str_end == NULL)
+        str_end = str + strlen(str);
+    Begin = IdBegin = str;
+    End = DisplayEnd = str_end;
+    for (const char* p = str; p + 1 < str_end && (p = (const char*)memchr(p, '#', (size_t)(str_end - p - 1))) != NULL; p++)
+        if (p[1] == '#')
+        {
+            if (DisplayEnd == str_end)
+                DisplayEnd = p;
+            if (p + 2 < str_end && p[2] == '#')
+                IdBegin = p;
+        }
+}
+
 // This is one of the very rare legacy case where we use ImGuiWindow methods,
 // it should ideally be flattened at some point but it's been used a lots by widgets.
 IM_MSVC_RUNTIME_CHECKS_OFF
@@ -8668,6 +9948,18 @@ ImGuiID ImGuiWindow::GetID(const char* str, const char* str_end)
     return id;
 }
 
+ImGuiID ImGuiWindow::GetID(const ImGuiLabel& label)
+{
+    ImGuiID seed = IDStack.back();
+    ImGuiID id = ImHashData(label.IdBegin, (size_t)(label.End - label.IdBegin), seed); // Same as ImHashStr() on the whole label
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    ImGuiContext& g = *Ctx;
+    if (g.DebugHookIdInfo == id)
+        ImGui::DebugHookIdInfo(id, ImGuiDataType_String, label.Begin, label.End);
+#endif
+    return id;
+}
+
 ImGuiID ImGuiWindow::GetID(const void* ptr)
 {
     ImGuiID seed = IDStack.back();
@@ -8743,6 +10035,22 @@ void ImGui::PushID(int int_id)
     window->IDStack.push_back(id);
 }
 
+void ImGui::PushID(const ImGuiLabel& str_id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiID id = window->GetID(str_id);
+    window->IDStack.push_back(id);
+}
+
+void ImGui::PushID(ImStrv str_id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiID id = window->GetID(ImGuiLabel(str_id.Begin, str_id.End));
+    window->IDStack.push_back(id);
+}
+
 // Push a given id value ignoring the ID stack as a seed.
 void ImGui::PushOverrideID(ImGuiID id)
 {
@@ -8803,6 +10111,18 @@ ImGuiID ImGui::GetID(const char* str_id_begin, const char* str_id_end)
     return window->GetID(str_id_begin, str_id_end);
 }
 
+ImGuiID ImGui::GetID(const ImGuiLabel& str_id)
+{
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    return window->GetID(str_id);
+}
+
+ImGuiID ImGui::GetID(ImStrv str_id)
+{
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    return window->GetID(ImGuiLabel(str_id.Begin, str_id.End));
+}
+
 ImGuiID ImGui::GetID(const void* ptr_id)
 {
     ImGuiWindow* window = GImGui->CurrentWindow;
@@ -10342,6 +11662,9 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     IM_ASSERT((g.FrameCount == 0 || g.FrameCountEnded == g.FrameCount)  && "Forgot to call Render() or EndFrame() at the end of the previous frame?");
     IM_ASSERT(g.IO.DisplaySize.x >= 0.0f && g.IO.DisplaySize.y >= 0.0f  && "Invalid DisplaySize value!");
     IM_ASSERT(g.IO.Fonts->IsBuilt()                                     && "Font Atlas not built! Make sure you called ImGui_ImplXXXX_NewFrame() function for renderer backend, which should call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8()");
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    IM_ASSERT((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasCompactVtx) && "Compiled with IMGUI_USE_COMPACT_DRAWVERT but renderer backend doesn't support it!");
+#endif
     IM_ASSERT(g.Style.CurveTessellationTol > 0.0f                       && "Invalid style setting!");
     IM_ASSERT(g.Style.CircleTessellationMaxError > 0.0f                 && "Invalid style setting!");
     IM_ASSERT(g.Style.Alpha >= 0.0f && g.Style.Alpha <= 1.0f            && "Invalid style setting!"); // Allows us to avoid a few clamps in color computations
@@ -15431,6 +16754,13 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     {
         Checkbox("Show ImDrawCmd mesh when hovering", &cfg->ShowDrawCmdMesh);
         Checkbox("Show ImDrawCmd bounding boxes when hovering", &cfg->ShowDrawCmdBoundingBoxes);
+        Checkbox("io.ConfigDrawDataDamageRects", &io.ConfigDrawDataDamageRects);
+        SameLine();
+        BeginDisabled(!io.ConfigDrawDataDamageRects);
+        Checkbox("Show damage rectangles", &cfg->ShowDamageRects);
+        EndDisabled();
+        if (io.ConfigDrawDataDamageRects && !(io.BackendFlags & ImGuiBackendFlags_RendererHasDamageRects))
+            TextDisabled("(renderer backend doesn't support ImGuiBackendFlags_RendererHasDamageRects)");
         for (ImGuiViewportP* viewport : g.Viewports)
             for (ImDrawList* draw_list : viewport->DrawDataP.CmdLists)
                 DebugNodeDrawList(NULL, viewport, draw_list, "DrawList");
@@ -15497,6 +16827,20 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Details for TextSizeCache
+    ImGuiTextSizeCache* text_size_cache = &g.TextSizeCache;
+    if (TreeNode("TextSizeCache", "TextSizeCache (%d)", text_size_cache->EntriesCount))
+    {
+        Checkbox("io.ConfigTextSizeCache", &io.ConfigTextSizeCache);
+        const int lookup_count = text_size_cache->HitCountLastFrame + text_size_cache->MissCountLastFrame;
+        Text("Entries: %d/%d, %d slots, %d bytes (+ %d bytes of text)", text_size_cache->EntriesCount, text_size_cache->MaxEntries, text_size_cache->Slots.Size, text_size_cache->Slots.size_in_bytes(), text_size_cache->TextBuffer.size_in_bytes());
+        Text("Last frame: %d hits, %d misses (%.1f%% hit rate)", text_size_cache->HitCountLastFrame, text_size_cache->MissCountLastFrame,
+            lookup_count > 0 ? text_size_cache->HitCountLastFrame * 100.0f / lookup_count : 0.0f);
+        if (SmallButton("Clear"))
+            text_size_cache->Clear();
+        TreePop();
+    }
+
     // Details for InputText
     if (TreeNode("InputText"))
     {
@@ -15629,6 +16973,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             Text("Mouse released:"); for (int i = 0; i < count; i++) if (IsMouseReleased(i)) { SameLine(); Text("b%d", i); }
             Text("Mouse wheel: %.1f", io.MouseWheel);
             Text("MouseStationaryTimer: %.2f", g.MouseStationaryTimer);
+            Text("WantRedraw: %d, NextRedrawDelay: %.2f", io.WantRedraw, (io.NextRedrawDelay < FLT_MAX) ? io.NextRedrawDelay : -1.0f);
             Text("Mouse source: %s", GetMouseSourceName(io.MouseSource));
             Text("Pen Pressure: %.1f", io.PenPressure); // Note: currently unused
             Unindent();
@@ -15789,6 +17134,18 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         }
     }
 
+    // Overlay: Display damage rectangles output by last Render()
+    if (cfg->ShowDamageRects)
+    {
+        for (ImGuiViewportP* viewport : g.Viewports)
+        {
+            ImDrawList* draw_list = GetForegroundDrawList(viewport);
+            if (viewport->DrawDataP.DamageRectsValid)
+                for (const ImVec4& rect : viewport->DrawDataP.DamageRects)
+                    draw_list->AddRect(ImVec2(rect.x, rect.y), ImVec2(rect.z, rect.w), IM_COL32(255, 64, 64, 255));
+        }
+    }
+
 #ifdef IMGUI_HAS_DOCK
     // Overlay: Display Docking info
     if (show_docking_nodes && g.IO.KeyCtrl)
@@ -15934,7 +17291,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         {
             ImVec2 triangle[3];
             for (int n = 0; n < 3; n++, idx_n++)
-                triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
+                triangle[n] = vtx_buffer[idx_buffer ? draw_list->_GetIdx(idx_n) : idx_n].pos;
             total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
         }
 
@@ -15954,10 +17311,11 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 ImVec2 triangle[3];
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
-                    const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
-                    triangle[n] = v.pos;
+                    const ImDrawVert& v = vtx_buffer[idx_buffer ? draw_list->_GetIdx(idx_i) : idx_i];
+                    const ImVec2 v_pos = v.pos, v_uv = v.uv; // May be quantized (IMGUI_USE_COMPACT_DRAWVERT)
+                    triangle[n] = v_pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, v_pos.x, v_pos.y, v_uv.x, v_uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -15991,7 +17349,7 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
 
         ImVec2 triangle[3];
         for (int n = 0; n < 3; n++, idx_n++)
-            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
+            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? draw_list->_GetIdx(idx_n) : idx_n].pos));
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
@@ -16108,7 +17466,7 @@ void ImGui::DebugNodeFontGlyph(ImFont*, const ImFontGlyph* glyph)
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
-    if (!TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+    if (!TreeNode(label, "%s: %d entries, %d bytes%s", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->_HashIndex.size_in_bytes(), storage->IsHashIndexEnabled() ? " (hash index)" : ""))
         return;
     for (const ImGuiStoragePair& p : storage->Data)
     {
@@ -16176,6 +17534,14 @@ void ImGui::DebugNodeViewport(ImGuiViewportP* viewport)
             (flags & ImGuiViewportFlags_IsPlatformWindow)  ? " IsPlatformWindow"  : "",
             (flags & ImGuiViewportFlags_IsPlatformMonitor) ? " IsPlatformMonitor" : "",
             (flags & ImGuiViewportFlags_OwnedByApp)        ? " OwnedByApp"        : "");
+        if (viewport->DrawDataP.DamageRectsValid)
+        {
+            float damage_area = 0.0f;
+            for (const ImVec4& rect : viewport->DrawDataP.DamageRects)
+                damage_area += (rect.z - rect.x) * (rect.w - rect.y);
+            const float display_area = viewport->DrawDataP.DisplaySize.x * viewport->DrawDataP.DisplaySize.y;
+            BulletText("DamageRects: %d (%.1f%% of display), back buffer age: %d%s", viewport->DrawDataP.DamageRects.Size, display_area > 0.0f ? damage_area * 100.0f / display_area : 0.0f, g.IO.DisplayBufferAge, g.IO.DisplayBufferAge <= 0 ? " (unknown)" : "");
+        }
         for (ImDrawList* draw_list : viewport->DrawDataP.CmdLists)
             DebugNodeDrawList(NULL, viewport, draw_list, "DrawList");
         TreePop();
@@ -16306,21 +17672,24 @@ void ImGui::DebugLog(const char* fmt, ...)
 void ImGui::DebugLogV(const char* fmt, va_list args)
 {
     ImGuiContext& g = *GImGui;
-    const int old_size = g.DebugLogBuf.size();
+    const ImU64 old_size = g.DebugLogBuf.TotalSize;
     if (g.ContextName[0] != 0)
         g.DebugLogBuf.appendf("[%s] [%05d] ", g.ContextName, g.FrameCount);
     else
         g.DebugLogBuf.appendf("[%05d] ", g.FrameCount);
     g.DebugLogBuf.appendfv(fmt, args);
-    g.DebugLogIndex.append(g.DebugLogBuf.c_str(), old_size, g.DebugLogBuf.size());
+
+    // The entry is contiguous at the end of the log: it starts with our prefix which doesn't contain a '\n',
+    // so if a new chunk was needed while appending the message, the entry was moved along with the current line.
+    const char* entry_end = g.DebugLogBuf.end();
+    const char* entry_begin = entry_end - (int)(g.DebugLogBuf.TotalSize - old_size);
     if (g.DebugLogFlags & ImGuiDebugLogFlags_OutputToTTY)
-        IMGUI_DEBUG_PRINTF("%s", g.DebugLogBuf.begin() + old_size);
+        IMGUI_DEBUG_PRINTF("%.*s", (int)(entry_end - entry_begin), entry_begin);
 #ifdef IMGUI_ENABLE_TEST_ENGINE
     // IMGUI_TEST_ENGINE_LOG() adds a trailing \n automatically
-    const int new_size = g.DebugLogBuf.size();
-    const bool trailing_carriage_return = (g.DebugLogBuf[new_size - 1] == '\n');
+    const bool trailing_carriage_return = (entry_end[-1] == '\n');
     if (g.DebugLogFlags & ImGuiDebugLogFlags_OutputToTestEngine)
-        IMGUI_TEST_ENGINE_LOG("%.*s", new_size - old_size - (trailing_carriage_return ? 1 : 0), g.DebugLogBuf.begin() + old_size);
+        IMGUI_TEST_ENGINE_LOG("%.*s", (int)(entry_end - entry_begin) - (trailing_carriage_return ? 1 : 0), entry_begin);
 #endif
 }
 
@@ -16387,12 +17756,15 @@ void ImGui::ShowDebugLogWindow(bool* p_open)
     if (SmallButton("Clear"))
     {
         g.DebugLogBuf.clear();
-        g.DebugLogIndex.clear();
         g.DebugLogSkippedErrors = 0;
     }
     SameLine();
     if (SmallButton("Copy"))
-        SetClipboardText(g.DebugLogBuf.c_str());
+    {
+        ImGuiTextBuffer buf;
+        g.DebugLogBuf.copy_to(&buf);
+        SetClipboardText(buf.c_str());
+    }
     SameLine();
     if (SmallButton("Configure Outputs.."))
         OpenPopup("Outputs");
@@ -16415,10 +17787,10 @@ void ImGui::ShowDebugLogWindow(bool* p_open)
     g.DebugLogFlags &= ~ImGuiDebugLogFlags_EventClipper;
 
     ImGuiListClipper clipper;
-    clipper.Begin(g.DebugLogIndex.size());
+    clipper.Begin(g.DebugLogBuf.size());
     while (clipper.Step())
         for (int line_no = clipper.DisplayStart; line_no < clipper.DisplayEnd; line_no++)
-            DebugTextUnformattedWithLocateItem(g.DebugLogIndex.get_line_begin(g.DebugLogBuf.c_str(), line_no), g.DebugLogIndex.get_line_end(g.DebugLogBuf.c_str(), line_no));
+            DebugTextUnformattedWithLocateItem(g.DebugLogBuf.get_line_begin(line_no), g.DebugLogBuf.get_line_end(line_no));
     g.DebugLogFlags = backup_log_flags;
     if (GetScrollY() >= GetScrollMaxY())
         SetScrollHereY(1.0f);
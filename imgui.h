@@ -44,7 +44,7 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiLabel, ImGuiTextFilter, ImGuiTextBuffer, ImGuiTextLog, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
 // [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
@@ -161,10 +161,11 @@ typedef unsigned long long  ImU64;  // 64-bit unsigned integer
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
+struct ImDrawDataFlatList;          // Location of a draw list within the flattened buffers output by ImDrawData::Flatten()
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
@@ -176,6 +177,7 @@ struct ImGuiContext;                // Dear ImGui context (opaque structure, unl
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui (also see: ImGuiPlatformIO)
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
+struct ImGuiLabel;                  // Helper holding a label with precomputed '##'/'###' split (computed at compile-time for string literals)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
@@ -186,13 +188,14 @@ struct ImGuiSelectionBasicStorage;  // Optional helper to store multi-selection
 struct ImGuiSelectionExternalStorage;//Optional helper to apply multi-selection requests to existing randomly accessible storage.
 struct ImGuiSelectionRequest;       // A selection request (stored in ImGuiMultiSelectIO)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
-struct ImGuiStorage;                // Helper for key->value storage (container sorted by key)
+struct ImGuiStorage;                // Helper for key->value storage (container sorted by key, or optionally hash indexed)
 struct ImGuiStoragePair;            // Helper for key->value storage (pair)
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTextLog;                // Helper to store lines of text for log windows, optionally bounded in size (drop oldest lines)
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
 
 // Enumerations
@@ -259,6 +262,9 @@ typedef ImU64 ImTextureID;          // Default: store a pointer or an integer fi
 // ImDrawIdx: vertex index. [Compile-time configurable type]
 // - To use 16-bit indices + allow large meshes: backend need to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset' and handle ImDrawCmd::VtxOffset (recommended).
 // - To use 32-bit indices: override with '#define ImDrawIdx unsigned int' in your imconfig.h file.
+// - To use 32-bit indices only where needed: backend needs to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasIdxSize' and handle ImDrawList::IdxSize.
+//   Render() then gives each draw list its own index size: with 16-bit ImDrawIdx, lists with more than 64K vertices are promoted to 32-bit indices
+//   (merging the draw commands which were split by VtxOffset), with 32-bit ImDrawIdx, lists with up to 64K vertices are packed to 16-bit indices.
 #ifndef ImDrawIdx
 typedef unsigned short ImDrawIdx;   // Default: 16-bit (for maximum compatibility with renderer backends)
 #endif
@@ -310,6 +316,24 @@ struct ImVec4
     IM_VEC4_CLASS_EXTRA     // Define additional constructors and implicit cast operators in imconfig.h to convert back and forth between your math types and ImVec4.
 #endif
 };
+
+// ImStrv: String view (begin/end pair) [Compile-time configurable type]
+// - Functions taking a ImStrv don't need to call strlen(), and label parsing/hashing/rendering all use the known length.
+// - The main functions taking a 'const char*' have a ImStrv overload. Existing code and string literals keep using the 'const char*' versions.
+// - Consider using IM_STRV_CLASS_EXTRA to create implicit cast from your string types (e.g. std::string, std::string_view).
+struct ImStrv
+{
+    const char*                             Begin;
+    const char*                             End;
+    constexpr ImStrv()                      : Begin(NULL), End(NULL) { }
+    constexpr ImStrv(const char* b, const char* e) : Begin(b), End(e) { }
+    ImStrv(const char* b)                   : Begin(b), End(b ? b + strlen(b) : NULL) { }
+    size_t  size() const                    { return (size_t)(End - Begin); }
+    bool    empty() const                   { return Begin == End; }
+#ifdef IM_STRV_CLASS_EXTRA
+    IM_STRV_CLASS_EXTRA     // Define additional constructors in imconfig.h to convert your string types to ImStrv.
+#endif
+};
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 //-----------------------------------------------------------------------------
@@ -367,6 +391,7 @@ namespace ImGui
     //    BeginXXX function returned true. Begin and BeginChild are the only odd ones out. Will be fixed in a future update.]
     // - Note that the bottom of window stack always contains a window called "Debug".
     IMGUI_API bool          Begin(const char* name, bool* p_open = NULL, ImGuiWindowFlags flags = 0);
+    IMGUI_API bool          Begin(ImStrv name, bool* p_open = NULL, ImGuiWindowFlags flags = 0);
     IMGUI_API void          End();
 
     // Child Windows
@@ -389,6 +414,7 @@ namespace ImGui
     //    BeginXXX function returned true. Begin and BeginChild are the only odd ones out. Will be fixed in a future update.]
     IMGUI_API bool          BeginChild(const char* str_id, const ImVec2& size = ImVec2(0, 0), ImGuiChildFlags child_flags = 0, ImGuiWindowFlags window_flags = 0);
     IMGUI_API bool          BeginChild(ImGuiID id, const ImVec2& size = ImVec2(0, 0), ImGuiChildFlags child_flags = 0, ImGuiWindowFlags window_flags = 0);
+    IMGUI_API bool          BeginChild(ImStrv str_id, const ImVec2& size = ImVec2(0, 0), ImGuiChildFlags child_flags = 0, ImGuiWindowFlags window_flags = 0);
     IMGUI_API void          EndChild();
 
     // Windows Utilities
@@ -521,14 +547,19 @@ namespace ImGui
     IMGUI_API void          PushID(const char* str_id_begin, const char* str_id_end);       // push string into the ID stack (will hash string).
     IMGUI_API void          PushID(const void* ptr_id);                                     // push pointer into the ID stack (will hash pointer).
     IMGUI_API void          PushID(int int_id);                                             // push integer into the ID stack (will hash integer).
+    IMGUI_API void          PushID(const ImGuiLabel& str_id);                               // push precomputed label into the ID stack (see ImGuiLabel).
+    IMGUI_API void          PushID(ImStrv str_id);                                          // push string view into the ID stack (will hash string).
     IMGUI_API void          PopID();                                                        // pop from the ID stack.
     IMGUI_API ImGuiID       GetID(const char* str_id);                                      // calculate unique ID (hash of whole ID stack + given parameter). e.g. if you want to query into ImGuiStorage yourself
     IMGUI_API ImGuiID       GetID(const char* str_id_begin, const char* str_id_end);
     IMGUI_API ImGuiID       GetID(const void* ptr_id);
     IMGUI_API ImGuiID       GetID(int int_id);
+    IMGUI_API ImGuiID       GetID(const ImGuiLabel& str_id);
+    IMGUI_API ImGuiID       GetID(ImStrv str_id);
 
     // Widgets: Text
     IMGUI_API void          TextUnformatted(const char* text, const char* text_end = NULL); // raw text without formatting. Roughly equivalent to Text("%s", text) but: A) doesn't require null terminated string if 'text_end' is specified, B) it's faster, no memory copy is done, no buffer size limits, recommended for long chunks of text.
+    IMGUI_API void          TextUnformatted(ImStrv text);                                   // raw text without formatting.
     IMGUI_API void          Text(const char* fmt, ...)                                      IM_FMTARGS(1); // formatted text
     IMGUI_API void          TextV(const char* fmt, va_list args)                            IM_FMTLIST(1);
     IMGUI_API void          TextColored(const ImVec4& col, const char* fmt, ...)            IM_FMTARGS(2); // shortcut for PushStyleColor(ImGuiCol_Text, col); Text(fmt, ...); PopStyleColor();
@@ -547,10 +578,14 @@ namespace ImGui
     // - Most widgets return true when the value has been changed or when pressed/selected
     // - You may also use one of the many IsItemXXX functions (e.g. IsItemActive, IsItemHovered, etc.) to query widget state.
     IMGUI_API bool          Button(const char* label, const ImVec2& size = ImVec2(0, 0));   // button
+    IMGUI_API bool          Button(const ImGuiLabel& label, const ImVec2& size = ImVec2(0, 0));
+    IMGUI_API bool          Button(ImStrv label, const ImVec2& size = ImVec2(0, 0));
     IMGUI_API bool          SmallButton(const char* label);                                 // button with (FramePadding.y == 0) to easily embed within text
     IMGUI_API bool          InvisibleButton(const char* str_id, const ImVec2& size, ImGuiButtonFlags flags = 0); // flexible button behavior without the visuals, frequently useful to build custom behaviors using the public api (along with IsItemActive, IsItemHovered, etc.)
     IMGUI_API bool          ArrowButton(const char* str_id, ImGuiDir dir);                  // square button with an arrow shape
     IMGUI_API bool          Checkbox(const char* label, bool* v);
+    IMGUI_API bool          Checkbox(const ImGuiLabel& label, bool* v);
+    IMGUI_API bool          Checkbox(ImStrv label, bool* v);
     IMGUI_API bool          CheckboxFlags(const char* label, int* flags, int flags_value);
     IMGUI_API bool          CheckboxFlags(const char* label, unsigned int* flags, unsigned int flags_value);
     IMGUI_API bool          RadioButton(const char* label, bool active);                    // use with e.g. if (RadioButton("one", my_value==1)) { my_value = 1; }
@@ -653,6 +688,8 @@ namespace ImGui
     // Widgets: Trees
     // - TreeNode functions return true when the node is open, in which case you need to also call TreePop() when you are finished displaying the tree node contents.
     IMGUI_API bool          TreeNode(const char* label);
+    IMGUI_API bool          TreeNode(const ImGuiLabel& label);
+    IMGUI_API bool          TreeNode(ImStrv label);
     IMGUI_API bool          TreeNode(const char* str_id, const char* fmt, ...) IM_FMTARGS(2);   // helper variation to easily decorelate the id from the displayed string. Read the FAQ about why and how to use ID. to align arbitrary text at the same level as a TreeNode() you can use Bullet().
     IMGUI_API bool          TreeNode(const void* ptr_id, const char* fmt, ...) IM_FMTARGS(2);   // "
     IMGUI_API bool          TreeNodeV(const char* str_id, const char* fmt, va_list args) IM_FMTLIST(2);
@@ -668,6 +705,7 @@ namespace ImGui
     IMGUI_API float         GetTreeNodeToLabelSpacing();                                        // horizontal distance preceding label when using TreeNode*() or Bullet() == (g.FontSize + style.FramePadding.x*2) for a regular unframed TreeNode
     IMGUI_API bool          CollapsingHeader(const char* label, ImGuiTreeNodeFlags flags = 0);  // if returning 'true' the header is open. doesn't indent nor push on ID stack. user doesn't have to call TreePop().
     IMGUI_API bool          CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFlags flags = 0); // when 'p_visible != NULL': if '*p_visible==true' display an additional small close button on upper right of the header which will set the bool to false when clicked, if '*p_visible==false' don't display the header.
+    IMGUI_API bool          CollapsingHeader(ImStrv label, ImGuiTreeNodeFlags flags = 0);
     IMGUI_API void          SetNextItemOpen(bool is_open, ImGuiCond cond = 0);                  // set next TreeNode/CollapsingHeader open state.
     IMGUI_API void          SetNextItemStorageID(ImGuiID storage_id);                           // set id to use for open/close storage (default to same as item id).
 
@@ -676,6 +714,8 @@ namespace ImGui
     // - Neighbors selectable extend their highlight bounds in order to leave no gap between them. This is so a series of selected Selectable appear contiguous.
     IMGUI_API bool          Selectable(const char* label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0)); // "bool selected" carry the selection state (read-only). Selectable() is clicked is returns true so you can modify your selection state. size.x==0.0: use remaining width, size.x>0.0: specify width. size.y==0.0: use label height, size.y>0.0: specify height
     IMGUI_API bool          Selectable(const char* label, bool* p_selected, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));      // "bool* p_selected" point to the selection state (read-write), as a convenient helper.
+    IMGUI_API bool          Selectable(const ImGuiLabel& label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));
+    IMGUI_API bool          Selectable(ImStrv label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));
 
     // Multi-selection system for Selectable(), Checkbox(), TreeNode() functions [BETA]
     // - This enables standard multi-selection/range-selection idioms (CTRL+Mouse/Keyboard, SHIFT+Mouse/Keyboard, etc.) in a way that also allow a clipper to be used.
@@ -823,6 +863,7 @@ namespace ImGui
     //   some advanced use cases (e.g. adding custom widgets in header row).
     // - Use TableSetupScrollFreeze() to lock columns/rows so they stay visible when scrolled.
     IMGUI_API void          TableSetupColumn(const char* label, ImGuiTableColumnFlags flags = 0, float init_width_or_weight = 0.0f, ImGuiID user_id = 0);
+    IMGUI_API void          TableSetupColumn(ImStrv label, ImGuiTableColumnFlags flags = 0, float init_width_or_weight = 0.0f, ImGuiID user_id = 0);
     IMGUI_API void          TableSetupScrollFreeze(int cols, int rows);         // lock columns/rows so they stay visible when scrolled.
     IMGUI_API void          TableHeader(const char* label);                     // submit one header cell manually (rarely used)
     IMGUI_API void          TableHeadersRow();                                  // submit a row with headers cells based on data provided to TableSetupColumn() + submit context menu
@@ -946,7 +987,12 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API void          RequestRedraw(float delay = 0.0f);                                  // request another frame to be processed within 'delay' seconds, even without new input events (for your own animations, when your application uses io.WantRedraw to save power). Call every frame while needed.
+    IMGUI_API void          AddDamageRect(const ImVec2& p_min, const ImVec2& p_max);            // [EXPERIMENTAL] mark a rectangle (in screen space) as changed in next ImDrawData::DamageRects, when using io.ConfigDrawDataDamageRects. Draw lists are compared by vertices and texture identifiers only: call this where displaying a texture whose contents changed.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
+    IMGUI_API ImDrawListSharedData* CreateDrawListSharedData();                                 // create a copy of the above, for ImDrawList instances filled from another thread (one per thread: it owns a scratch buffer). See ImDrawList::AddDrawList().
+    IMGUI_API void          UpdateDrawListSharedData(ImDrawListSharedData* shared_data);       // refresh a copy made by CreateDrawListSharedData() from current settings (atlas UV, tessellation, flags). Call from main thread during the frame, while no other thread uses it.
+    IMGUI_API void          DestroyDrawListSharedData(ImDrawListSharedData* shared_data);
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
     IMGUI_API ImGuiStorage* GetStateStorage();
@@ -1598,6 +1644,10 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasIdxSize    = 1 << 4,   // Backend Renderer supports ImDrawList::IdxSize (2 or 4, per draw list). Draw lists with more than 64K vertices use 32-bit indices instead of being split with VtxOffset, others use 16-bit indices.
+    ImGuiBackendFlags_RendererHasCompactVtx = 1 << 5,   // Backend Renderer supports the compact 12 bytes ImDrawVert layout (required when compiling with '#define IMGUI_USE_COMPACT_DRAWVERT').
+    ImGuiBackendFlags_RendererHasDamageRects = 1 << 6,  // Backend Renderer supports ImDrawData::DamageRects: only draws within them. Required for io.ConfigDrawDataDamageRects.
+    ImGuiBackendFlags_RendererHasAnalyticShapes = 1 << 7, // Backend Renderer supports analytic anti-aliased shapes: filled circles, ellipses and rounded rectangles may be output as a single quad (see "Analytic shapes" near ImDrawVert). Only supported by imgui_impl_opengl3 (GLSL 130+).
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2245,6 +2295,9 @@ struct ImGuiIO
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigTextSizeCache;            // = false          // [EXPERIMENTAL] Cache CalcTextSize() results across frames, keyed by font, font size, wrap width and a hash of the text contents. Entries unused for a few frames are discarded. Hit/miss counters are displayed in Metrics/Debugger.
+    bool        ConfigDrawDataDamageRects;      // = false          // [EXPERIMENTAL] Compute ImDrawData::DamageRects in Render() by comparing each ImDrawList with previous frames. Requires renderer backend support (ImGuiBackendFlags_RendererHasDamageRects), and the application to clear only within DamageRects. Texture contents are not compared: see AddDamageRect().
+    int         DisplayBufferAge;               // = 0              // [EXPERIMENTAL] For io.ConfigDrawDataDamageRects: age of the back buffer the next Render() output will be drawn into, in frames (e.g. from EGL_EXT_buffer_age). 1 = it holds previous frame, as with a persistent render target. 0 = unknown: DamageRects cover the whole display. Set before each Render().
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2354,6 +2407,8 @@ struct ImGuiIO
     bool        WantSaveIniSettings;                // When manual .ini load/save is active (io.IniFilename == NULL), this will be set to notify your application that you can call SaveIniSettingsToMemory() and save yourself. Important: clear io.WantSaveIniSettings yourself after saving!
     bool        NavActive;                          // Keyboard/Gamepad navigation is currently allowed (will handle ImGuiKey_NavXXX events) = a window is focused and it doesn't use the ImGuiWindowFlags_NoNavInputs flag.
     bool        NavVisible;                         // Keyboard/Gamepad navigation highlight is visible and allowed (will handle ImGuiKey_NavXXX events).
+    bool        WantRedraw;                         // Set by EndFrame(): another frame needs to be processed even without new input events (pending input events, animations, windows appearing, RequestRedraw() calls, etc.). When false, your application may save power by waiting for new input events, for up to io.NextRedrawDelay seconds.
+    float       NextRedrawDelay;                    // Set by EndFrame(): delay in seconds until a new frame needs to be processed without new input events (e.g. text cursor blink, hover delay for tooltips). 0.0f when io.WantRedraw is set, FLT_MAX when waiting indefinitely is fine.
     float       Framerate;                          // Estimate of application framerate (rolling average over 60 frames, based on io.DeltaTime), in frame per second. Solely for convenience. Slow applications may not want to use a moving average or may want to reset underlying buffers occasionally.
     int         MetricsRenderVertices;              // Vertices output during last call to Render()
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
@@ -2504,7 +2559,7 @@ struct ImGuiPayload
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiLabel, ImGuiTextFilter, ImGuiTextBuffer, ImGuiTextLog, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2524,12 +2579,40 @@ struct ImGuiOnceUponAFrame
     operator bool() const { int current_frame = ImGui::GetFrameCount(); if (RefFrame == current_frame) return false; RefFrame = current_frame; return true; }
 };
 
+// Helper: Label with precomputed length, display end ('##') and hashed part ('###'). See "About the ID Stack system" in imgui.cpp.
+// - Constructing from a string literal computes all fields at compile-time when evaluated as a constant expression.
+//   Constructing from a mutable char array parses it at runtime, as its contents may change after construction.
+//   Use e.g. 'static constexpr ImGuiLabel label("Apply");' to guarantee it, then 'ImGui::Button(label);'
+// - Widgets taking a 'const char* label' parse it once at runtime into a ImGuiLabel, so hashing/measuring/rendering don't need to rescan it.
+// - Only the combine with the ID stack seed is left at runtime: a CRC needs the seed first so the hash itself can't be precomputed.
+struct ImGuiLabel
+{
+    const char*     Begin;          // Start of label
+    const char*     End;            // End of label
+    const char*     DisplayEnd;     // End of displayed text: first "##" occurrence, or End
+    const char*     IdBegin;        // Start of hashed text: last "###" occurrence, or Begin
+
+    ImGuiLabel()                    { Begin = End = DisplayEnd = IdBegin = NULL; }
+    IMGUI_API explicit ImGuiLabel(const char* str, const char* str_end); // Parse at runtime. str_end == NULL: zero-terminated string. Explicit to avoid ambiguity with ImStrv.
+    template<size_t N> explicit constexpr ImGuiLabel(const char (&str)[N]) : ImGuiLabel(str, _Len(str, 0, N), 0) {} // Parse at compile-time when possible (string literals, constexpr arrays).
+    template<size_t N> explicit ImGuiLabel(char (&str)[N]) : ImGuiLabel(str, NULL) {}                                 // Mutable buffers: parse at runtime, contents may change.
+
+    // [Internal] Compile-time helpers. Single-expression C++11 constexpr functions, recursing by halves to keep the evaluation depth at log2(N).
+    constexpr ImGuiLabel(const char* str, size_t len, int) : Begin(str), End(str + len), DisplayEnd(str + _Pick(_FindFirst(str, 0, len, len, 2), (size_t)-1, len)), IdBegin(str + _Pick(_FindLast(str, 0, len, len, 3), (size_t)-1, 0)) {}
+    static constexpr size_t _Pick(size_t r, size_t none, size_t alt) { return r != none ? r : alt; }
+    static constexpr bool   _IsHashes(const char* s, size_t i, size_t len, int n) { return i + n <= len && s[i] == '#' && s[i + 1] == '#' && (n < 3 || s[i + 2] == '#'); }
+    static constexpr size_t _Len(const char* s, size_t b, size_t e) { return (e - b <= 1) ? ((b < e && s[b] != 0) ? e : b) : _Pick(_Len(s, b, (b + e) / 2), (b + e) / 2, _Len(s, (b + e) / 2, e)); }
+    static constexpr size_t _FindFirst(const char* s, size_t b, size_t e, size_t len, int n) { return (e - b <= 1) ? ((b < e && _IsHashes(s, b, len, n)) ? b : (size_t)-1) : _Pick(_FindFirst(s, b, (b + e) / 2, len, n), (size_t)-1, _FindFirst(s, (b + e) / 2, e, len, n)); }
+    static constexpr size_t _FindLast(const char* s, size_t b, size_t e, size_t len, int n) { return (e - b <= 1) ? ((b < e && _IsHashes(s, b, len, n)) ? b : (size_t)-1) : _Pick(_FindLast(s, (b + e) / 2, e, len, n), (size_t)-1, _FindLast(s, b, (b + e) / 2, len, n)); }
+};
+
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
 struct ImGuiTextFilter
 {
     IMGUI_API           ImGuiTextFilter(const char* default_filter = "");
     IMGUI_API bool      Draw(const char* label = "Filter (inc,-exc)", float width = 0.0f);  // Helper calling InputText+Build
     IMGUI_API bool      PassFilter(const char* text, const char* text_end = NULL) const;
+    IMGUI_API int       PassFilterMultiple(const char* const* texts, int texts_count, ImVector<int>* out_indices = NULL) const; // Append indices of passing texts to 'out_indices', return count. For large lists: filter once when changed, then clip over indices.
     IMGUI_API void      Build();
     void                Clear()          { InputBuf[0] = 0; Build(); }
     bool                IsActive() const { return !Filters.empty(); }
@@ -2571,6 +2654,55 @@ struct ImGuiTextBuffer
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Lines of text for log windows (~ ImGuiTextBuffer + index of line offsets)
+// - Text is stored in chunks which are never reallocated: appending doesn't copy existing text. A line never straddles two chunks.
+// - Set MaxSize to bound memory usage: when exceeded, the oldest chunk is recycled and its lines are dropped.
+// - Lines are numbered from the oldest line still stored, use with ImGuiListClipper: clipper.Begin(log.size()) + log.get_line_begin(n), log.get_line_end(n).
+// - Line pointers stay valid until the line is dropped or clear() is called, except the last line while it is open (not terminated
+//   by '\n'): it may be moved to a new chunk by next append. Not copyable.
+struct ImGuiTextLog
+{
+    struct ImGuiTextLogChunk { char* Data; int Size; int Used; };
+    struct ImGuiTextLogLine  { const char* Begin; int Len; int ChunkNo; };  // Len excludes the '\n'. ChunkNo = ChunksDropped + index in Chunks[].
+
+    int                         ChunkSize;          // = 64 KB  // Size of each text chunk. Larger lines get a chunk of their own.
+    int                         MaxSize;            // = 0      // Max size of stored text, in bytes (rounded down to a multiple of ChunkSize, at least one chunk is kept). Applied on next new chunk. 0: unbounded.
+    ImVector<ImGuiTextLogChunk> Chunks;
+    ImVector<ImGuiTextLogLine>  Lines;              // Ring buffer, starting at LinesHead
+    int                         LinesHead;
+    int                         LinesCount;
+    int                         LinesDropped;       // Number of lines dropped to honor MaxSize since last clear()
+    int                         ChunksDropped;
+    int                         ChunksTotalSize;
+    ImU64                       TotalSize;          // Number of bytes appended since last clear(), including dropped lines
+    bool                        LastLineOpen;       // Last line is not terminated by '\n' yet: next append will continue it.
+    char*                       SpareChunk;         // One recycled chunk of SpareChunkSize bytes
+    int                         SpareChunkSize;
+
+    ImGuiTextLog()              { ChunkSize = 64 * 1024; MaxSize = 0; LinesHead = LinesCount = LinesDropped = ChunksDropped = ChunksTotalSize = 0; TotalSize = 0; LastLineOpen = false; SpareChunk = NULL; SpareChunkSize = 0; }
+    ~ImGuiTextLog()             { clear(); }
+    int                 size() const                    { return LinesCount; }     // Number of lines
+    bool                empty() const                   { return LinesCount == 0; }
+    const char*         get_line_begin(int n) const     { return get_line(n).Begin; }
+    const char*         get_line_end(int n) const       { const ImGuiTextLogLine& line = get_line(n); return line.Begin + line.Len; }
+    const ImGuiTextLogLine& get_line(int n) const       { IM_ASSERT(n >= 0 && n < LinesCount); int idx = LinesHead + n; if (idx >= Lines.Size) idx -= Lines.Size; return Lines.Data[idx]; }
+    const char*         end() const                     { return Chunks.Size ? Chunks.back().Data + Chunks.back().Used : NULL; } // End of last appended text
+    IMGUI_API void      clear();
+    IMGUI_API void      append(const char* str, const char* str_end = NULL);
+    IMGUI_API void      appendf(const char* fmt, ...) IM_FMTARGS(2);
+    IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
+    IMGUI_API void      copy_to(ImGuiTextBuffer* out) const;    // Append all stored lines to a contiguous buffer (e.g. for clipboard)
+
+    // [Internal]
+    IMGUI_API char*     _PrepareAppend(int len);
+    IMGUI_API void      _CommitAppend(int len);
+    IMGUI_API void      _DropOldestChunk();
+
+private:
+    ImGuiTextLog(const ImGuiTextLog&);                  // Not copyable: owns chunks and SpareChunk
+    ImGuiTextLog& operator=(const ImGuiTextLog&);
+};
+
 // [Internal] Key+Value for ImGuiStorage
 struct ImGuiStoragePair
 {
@@ -2593,11 +2725,14 @@ struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImU64>                 _HashIndex;         // Open-addressing table when _HashIndexEnabled: each slot is (key << 32 | (index in Data + 1)), 0 when empty.
+    bool                            _HashIndexEnabled;
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    ImGuiStorage()      { _HashIndexEnabled = false; }
+    void                Clear() { Data.clear(); _HashIndex.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2618,6 +2753,13 @@ struct ImGuiStorage
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
     IMGUI_API void      BuildSortByKey();
+
+    // Advanced: hash index mode, for very large storages with frequent insertions (e.g. 100k+ tree node states in a window, or in a selection).
+    // - Pairs are kept unsorted (in insertion order) and indexed by an open-addressing table: O(1) average query and insertion
+    //   instead of O(log N) query and O(N) insertion. This costs ~16 bytes more per pair (table is kept under 50% load).
+    // - If you modify 'Data' directly, call BuildSortByKey() afterwards: it also rebuilds the index.
+    IMGUI_API void      SetHashIndexEnabled(bool enabled);
+    bool                IsHashIndexEnabled() const { return _HashIndexEnabled; }
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
@@ -2877,7 +3019,7 @@ struct ImGuiSelectionBasicStorage
     void*           UserData;       // = NULL   // User data for use by adapter function        // e.g. selection.UserData = (void*)my_items;
     ImGuiID         (*AdapterIndexToStorageId)(ImGuiSelectionBasicStorage* self, int idx);      // e.g. selection.AdapterIndexToStorageId = [](ImGuiSelectionBasicStorage* self, int idx) { return ((MyItems**)self->UserData)[idx]->ID; };
     int             _SelectionOrder;// [Internal] Increasing counter to store selection order
-    ImGuiStorage    _Storage;       // [Internal] Selection set. Think of this as similar to e.g. std::set<ImGuiID>. Prefer not accessing directly: iterate with GetNextSelectedItem().
+    ImGuiStorage    _Storage;       // [Internal] Selection set. Think of this as similar to e.g. std::set<ImGuiID>. Prefer not accessing directly: iterate with GetNextSelectedItem(). For very large selections you may call _Storage.SetHashIndexEnabled(true).
 
     // Methods
     IMGUI_API ImGuiSelectionBasicStorage();
@@ -2954,7 +3096,61 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Compact vertex layout (12 bytes), enabled with '#define IMGUI_USE_COMPACT_DRAWVERT' in imconfig.h. Renderer backend needs to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasCompactVtx'.
+// - pos: 2x signed 16-bit fixed-point with IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS bits of sub-pixel fraction. Default: 2 bits = 1/4 pixel steps, -8192..+8191 pixels range.
+// - uv:  2x unsigned 16-bit normalized (0..65535 maps to 0.0f..1.0f). UV outside of the 0.0f..1.0f range are not representable: they are clamped,
+//        so e.g. a texture can't be repeated or mirrored by passing uv_max = (2,2) or uv_min > uv_max... to Image()/AddImage(). Use a dedicated draw callback/shader for that.
+// - col: ImU32.
+// Fields can be written and read as float/ImVec2 like the default layout: values are quantized (rounded and clamped) when written, without branches.
+// Positions out of range are clamped. This is exact for axis-aligned rectangles (e.g. a tall child window scrolled out of view: the part
+// beyond the range is clipped anyway), other shapes crossing the limit are distorted. Reduce IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS to extend the range.
+#ifndef IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS
+#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS    2
+#endif
+struct ImDrawVertFixed16
+{
+    signed short    v;
+    ImDrawVertFixed16& operator=(float f)
+    {
+        f *= (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS);
+        f = (f < -32768.0f) ? -32768.0f : f;            // Compiles to minss/maxss, or equivalent
+        f = (f > 32767.0f) ? 32767.0f : f;
+        v = (signed short)((int)(f + 32768.5f) - 32768); // Round to nearest: biased to be positive, so truncation is floor()
+        return *this;
+    }
+    ImDrawVertFixed16& operator+=(float f)  { return *this = (float)*this + f; }
+    ImDrawVertFixed16& operator-=(float f)  { return *this = (float)*this - f; }
+    ImDrawVertFixed16& operator*=(float f)  { return *this = (float)*this * f; }
+    operator float() const                  { return (float)v * (1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS)); }
+};
+struct ImDrawVertUnorm16
+{
+    unsigned short  v;
+    ImDrawVertUnorm16& operator=(float f)   { f = (f < 0.0f) ? 0.0f : f; f = (f > 1.0f) ? 1.0f : f; v = (unsigned short)(int)(f * 65535.0f + 0.5f); return *this; }
+    operator float() const                  { return (float)v * (1.0f / 65535.0f); }
+};
+struct ImDrawVertPos16
+{
+    ImDrawVertFixed16 x, y;
+    ImDrawVertPos16& operator=(const ImVec2& p)     { x = p.x; y = p.y; return *this; }
+    ImDrawVertPos16& operator+=(const ImVec2& p)    { x += p.x; y += p.y; return *this; }
+    ImDrawVertPos16& operator-=(const ImVec2& p)    { x -= p.x; y -= p.y; return *this; }
+    operator ImVec2() const                         { return ImVec2(x, y); }
+};
+struct ImDrawVertUV16
+{
+    ImDrawVertUnorm16 x, y;
+    ImDrawVertUV16& operator=(const ImVec2& uv)     { x = uv.x; y = uv.y; return *this; }
+    operator ImVec2() const                         { return ImVec2(x, y); }
+};
+struct ImDrawVert
+{
+    ImDrawVertPos16 pos;
+    ImDrawVertUV16  uv;
+    ImU32           col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -2969,6 +3165,18 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// Analytic shapes
+// When 'io.BackendFlags & ImGuiBackendFlags_RendererHasAnalyticShapes' is enabled, AddCircleFilled() and AddEllipseFilled() with automatic
+// segment count and AddRectFilled() with rounding are output as a single quad (4 vertices, 6 indices) using the font atlas texture, instead
+// of a tessellated polygon with an anti-aliased fringe. The renderer computes their coverage from a signed distance in the fragment shader.
+// The UV of those vertices encode the shape instead of texture coordinates (valid font atlas UV are always <= 1.0f):
+// - fract(uv) = 0.5 + 0.25 * q, where 'q' is the position in the shape normalized space: -1..+1 between opposite edges of the shape
+//   (the quad extends beyond them to fit anti-aliasing). Local axes may be rotated for ellipses, never for rectangles.
+// - floor(uv.x) - 2 == 0: ellipse (or circle). == 16 + N: rounded rectangle, with corners mask N (1: top-left, 2: top-right, 4: bottom-left, 8: bottom-right).
+// - floor(uv.y) - 2 == K: rounded rectangle corner radius is (K / 1000)^2 * min(half width, half height). Unused for ellipses.
+// Shapes are never output with other textures, and not supported with IMGUI_USE_COMPACT_DRAWVERT. See imgui_impl_opengl3.cpp for reference shaders:
+// it is the only backend supporting them. Other backends (including Vulkan, whose SPIR-V shaders would need to be regenerated) keep tessellating.
+
 // [Internal] For use by ImDrawList
 struct ImDrawCmdHeader
 {
@@ -3008,6 +3216,7 @@ enum ImDrawFlags_
 {
     ImDrawFlags_None                        = 0,
     ImDrawFlags_Closed                      = 1 << 0, // PathStroke(), AddPolyline(): specify that shape should be closed (Important: this is always == 1 for legacy reason)
+    ImDrawFlags_JoinMiter                   = 1 << 1, // PathStroke(), AddPolyline(): non anti-aliased lines: share vertices between segments and join them with miters (bevels on sharp angles), instead of drawing separate overlapping quads. Uses about half the vertices.
     ImDrawFlags_RoundCornersTopLeft         = 1 << 4, // AddRect(), AddRectFilled(), PathRect(): enable rounding top-left corner only (when rounding > 0.0f, we default to all corners). Was 0x01.
     ImDrawFlags_RoundCornersTopRight        = 1 << 5, // AddRect(), AddRectFilled(), PathRect(): enable rounding top-right corner only (when rounding > 0.0f, we default to all corners). Was 0x02.
     ImDrawFlags_RoundCornersBottomLeft      = 1 << 6, // AddRect(), AddRectFilled(), PathRect(): enable rounding bottom-left corner only (when rounding > 0.0f, we default to all corners). Was 0x04.
@@ -3031,6 +3240,8 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowIdxSize            = 1 << 4,  // Can change IdxSize when adding to ImDrawData: 16-bit indices if there are at most 64K vertices, 32-bit indices otherwise. Set when 'ImGuiBackendFlags_RendererHasIdxSize' is enabled.
+    ImDrawListFlags_AnalyticShapes          = 1 << 5,  // Can output filled circles, ellipses and rounded rectangles as a single quad (only with ImDrawListFlags_AntiAliasedFill). Set when 'ImGuiBackendFlags_RendererHasAnalyticShapes' is enabled.
 };
 
 // Draw command list
@@ -3048,6 +3259,7 @@ struct ImDrawList
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    int                     IdxSize;            // Size of one index in IdxBuffer, in bytes. == sizeof(ImDrawIdx) unless changed by Render() (see ImGuiBackendFlags_RendererHasIdxSize). ImDrawCmd::IdxOffset and ElemCount are always counted in indices, IdxBuffer.Size in ImDrawIdx units.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
     // [Internal, used while building lists]
@@ -3065,7 +3277,7 @@ struct ImDrawList
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
-    ImDrawList(ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); _Data = shared_data; }
+    ImDrawList(ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); IdxSize = (int)sizeof(ImDrawIdx); _Data = shared_data; }
 
     ~ImDrawList() { _ClearFreeMemory(); }
     IMGUI_API void  PushClipRect(const ImVec2& clip_rect_min, const ImVec2& clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
@@ -3117,6 +3329,18 @@ struct ImDrawList
     IMGUI_API void  AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& uv1 = ImVec2(0, 0), const ImVec2& uv2 = ImVec2(1, 0), const ImVec2& uv3 = ImVec2(1, 1), const ImVec2& uv4 = ImVec2(0, 1), ImU32 col = IM_COL32_WHITE);
     IMGUI_API void  AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col, float rounding, ImDrawFlags flags = 0);
 
+    // Batched primitives
+    // - Same output as calling AddRectFilled() (without rounding), AddLine(), AddCircleFilled(), AddImage() for each shape, with less overhead:
+    //   space is reserved once for many shapes, and shapes fully outside of the current clipping rectangle are skipped.
+    // - 'cols' is optional. When provided it holds one color per shape and 'col' is ignored.
+    // - AddCirclesFilled(): all circles share the same radius and tessellation. Use 'num_segments > 0' for polygons, like AddNgonFilled().
+    //   Anti-aliased fringes are computed once for all circles: they may differ from AddCircleFilled() by float rounding. Never uses analytic shapes.
+    // - AddImages(): 'uv_min'/'uv_max' are optional and default to (0,0)->(1,1).
+    IMGUI_API void  AddRectsFilled(const ImVec2* p_min, const ImVec2* p_max, int count, ImU32 col, const ImU32* cols = NULL);
+    IMGUI_API void  AddLines(const ImVec2* p1, const ImVec2* p2, int count, ImU32 col, float thickness = 1.0f, const ImU32* cols = NULL);
+    IMGUI_API void  AddCirclesFilled(const ImVec2* centers, int count, float radius, ImU32 col, int num_segments = 0, const ImU32* cols = NULL);
+    IMGUI_API void  AddImages(ImTextureID user_texture_id, const ImVec2* p_min, const ImVec2* p_max, const ImVec2* uv_min, const ImVec2* uv_max, int count, ImU32 col = IM_COL32_WHITE, const ImU32* cols = NULL);
+
     // Stateful path API, add points then finish with PathFillConvex() or PathStroke()
     // - Important: filled shapes must always use clockwise winding order! The anti-aliasing fringe depends on it. Counter-clockwise shapes will have "inward" anti-aliasing.
     //   so e.g. 'PathArcTo(center, radius, PI * -0.5f, PI)' is ok, whereas 'PathArcTo(center, radius, PI, PI * -0.5f)' won't have correct anti-aliasing when followed by PathFillConvex().
@@ -3147,6 +3371,15 @@ struct ImDrawList
     // Advanced: Miscellaneous
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API void  AddDrawList(const ImDrawList* src, const ImVec2& offset = ImVec2(0, 0)); // Append contents of another draw list, translated by 'offset' and clipped by current clip rectangle. Indices are rebased and commands merged with ours when possible. See below.
+    IMGUI_API void  ResetForThread();                                           // Clear contents before filling from another thread, then set font atlas texture and a full-screen clipping rectangle. See below.
+
+    // Filling draw lists from other threads
+    // - ImDrawList doesn't use the context, only its ImDrawListSharedData, which holds a scratch buffer. Each thread needs its own copy:
+    //   create with ImGui::CreateDrawListSharedData() and call ImGui::UpdateDrawListSharedData() every frame before starting your threads.
+    // - In the thread: 'draw_list->ResetForThread();' then draw as usual. Push your own texture and clipping rectangle if needed.
+    //   Prefer the AddText() overload taking an explicit ImFont*. Fonts can be read from other threads as the atlas is locked during the frame.
+    // - Once the thread is done, in the main thread: 'ImGui::GetWindowDrawList()->AddDrawList(worker_draw_list, ImGui::GetCursorScreenPos());'.
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -3189,6 +3422,18 @@ struct ImDrawList
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
+    IMGUI_API bool  _AddAnalyticShape(const ImVec2& center, const ImVec2& half_size, float rot_cos, float rot_sin, int shape_code, int rounding_code, ImU32 col);
+    IMGUI_API void  _PackIdx16();
+    IMGUI_API void  _PromoteIdx32();
+    inline unsigned int _GetIdx(unsigned int idx_n) const { return (IdxSize == 2) ? (unsigned int)((const ImU16*)(const void*)IdxBuffer.Data)[idx_n] : (unsigned int)((const ImU32*)(const void*)IdxBuffer.Data)[idx_n]; } // Read index regardless of IdxSize
+};
+
+// Location of a draw list within the single vertex/index buffers output by ImDrawData::Flatten()
+struct ImDrawDataFlatList
+{
+    int             CmdOffset;          // Index of first command of the list in ImDrawData::FlatCmdBuffer[]
+    int             VtxOffset;          // Index of first vertex of the list in flattened vertex buffer
+    int             IdxOffset;          // Offset of the list in flattened index buffer, in ImDrawIdx units (== byte offset / sizeof(ImDrawIdx))
 };
 
 // All draw data to render a Dear ImGui frame
@@ -3198,20 +3443,43 @@ struct ImDrawData
 {
     bool                Valid;              // Only valid after Render() is called and before the next NewFrame() is called.
     int                 CmdListsCount;      // Number of ImDrawList* to render (should always be == CmdLists.size)
-    int                 TotalIdxCount;      // For convenience, sum of all ImDrawList's IdxBuffer.Size
+    int                 TotalIdxCount;      // For convenience, sum of all ImDrawList's IdxBuffer.Size (in ImDrawIdx units, so 'TotalIdxCount * sizeof(ImDrawIdx)' is the total size in bytes even when some lists are packed to 16-bit indices)
     int                 TotalVtxCount;      // For convenience, sum of all ImDrawList's VtxBuffer.Size
     ImVector<ImDrawList*> CmdLists;         // Array of ImDrawList* to render. The ImDrawLists are owned by ImGuiContext and only pointed to from here.
     ImVec2              DisplayPos;         // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
     ImVec2              DisplaySize;        // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
     ImVec2              FramebufferScale;   // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
     ImGuiViewport*      OwnerViewport;      // Viewport carrying the ImDrawData instance, might be of use to the renderer (generally not).
+    bool                DamageRectsValid;   // DamageRects[] were computed for this frame (requires io.ConfigDrawDataDamageRects and ImGuiBackendFlags_RendererHasDamageRects). When false, everything needs to be redrawn.
+    ImVector<ImVec4>    DamageRects;        // Disjoint rectangles (x1,y1,x2,y2) which changed since the back buffer was last drawn (see io.DisplayBufferAge), in ClipRect coordinates. The application must clear only pixels inside them, the renderer backend only draws inside them. Empty: nothing changed, rendering may be skipped.
+
+    // Flattened output (see Flatten())
+    int                 FlatVtxCount;       // Number of vertices in flattened vertex buffer (== TotalVtxCount)
+    int                 FlatIdxCount;       // Size of flattened index buffer in ImDrawIdx units (>= TotalIdxCount, as lists with 32-bit indices are aligned to 4 bytes)
+    ImVector<ImDrawCmd> FlatCmdBuffer;      // Copy of all commands of all CmdLists[], with VtxOffset/IdxOffset relative to the start of flattened buffers (IdxOffset in units of their list's IdxSize).
+    ImVector<ImDrawDataFlatList> FlatLists; // [CmdListsCount + 1] Location of each list in FlatCmdBuffer[] and flattened buffers. Last entry holds the totals.
+    ImVector<ImDrawVert> FlatVtxBuffer;     // Flattened vertex buffer, when Flatten() was called without a destination.
+    ImVector<ImDrawIdx> FlatIdxBuffer;      // Flattened index buffer, when Flatten() was called without a destination.
 
     // Functions
     ImDrawData()    { Clear(); }
     IMGUI_API void  Clear();
-    IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
+    IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData. Invalidates DamageRects[].
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+
+    // Flattening all lists into one vertex buffer and one index buffer, to upload them at once
+    // - Flatten() outputs all vertices, then all indices (copied as stored, never rebased or widened), and FlatCmdBuffer[] with global offsets.
+    //   Backend draws each command with 'pcmd->ElemCount' indices of CmdLists[n]->IdxSize bytes starting at byte 'pcmd->IdxOffset * CmdLists[n]->IdxSize',
+    //   adding 'pcmd->VtxOffset' to them (base vertex). This requires ImGuiBackendFlags_RendererHasVtxOffset support.
+    //   Iterate lists with 'for (n) for (cmd_i = FlatLists[n].CmdOffset; cmd_i < FlatLists[n + 1].CmdOffset; cmd_i++)'.
+    //   User callbacks should be passed CmdLists[n] and their original command '&CmdLists[n]->CmdBuffer[cmd_i - FlatLists[n].CmdOffset]'.
+    // - Pass NULL to output into FlatVtxBuffer/FlatIdxBuffer, or your own pointers (e.g. mapped GPU memory) sized with FlatVtxCount/FlatIdxCount:
+    //   call FlattenCmds() first, allocate, then Flatten(). FlattenCopyList() may also be called from multiple threads to copy lists in parallel.
+    // - Call after all draw lists have been added. AddDrawList() discards flattened data, ScaleClipRects() also scales FlatCmdBuffer[].
+    IMGUI_API void  FlattenCmds();                                                          // Compute FlatCmdBuffer[], FlatLists[], FlatVtxCount, FlatIdxCount. Doesn't copy vertices/indices.
+    IMGUI_API void  FlattenCopyList(int list_n, ImDrawVert* vtx_dst, ImDrawIdx* idx_dst) const; // Copy vertices/indices of CmdLists[list_n] to their location in vtx_dst[]/idx_dst[] (start of flattened buffers). Thread-safe.
+    IMGUI_API void  Flatten(ImDrawVert* vtx_dst = NULL, ImDrawIdx* idx_dst = NULL);         // Call FlattenCmds() if not done yet, then copy all lists. NULL destination: use FlatVtxBuffer/FlatIdxBuffer.
 };
 
 //-----------------------------------------------------------------------------
@@ -3410,6 +3678,7 @@ struct ImFontAtlas
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    int                         BuildCount;         // Incremented every time font lookup tables are (re)built or modified. Used to invalidate cached text measurements.
 
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -507,6 +507,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
             // The "NoMouse" option can get us stuck with a disabled mouse! Let's provide an alternative way to fix it:
             if (io.ConfigFlags & ImGuiConfigFlags_NoMouse)
             {
+                ImGui::RequestRedraw(0.20f - fmodf((float)ImGui::GetTime(), 0.20f)); // Keep blinking when the application uses io.WantRedraw to save power
                 if (fmodf((float)ImGui::GetTime(), 0.40f) < 0.20f)
                 {
                     ImGui::SameLine();
@@ -559,6 +560,10 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::SameLine(); HelpMarker("Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving).");
             ImGui::Checkbox("io.ConfigMacOSXBehaviors", &io.ConfigMacOSXBehaviors);
             ImGui::SameLine(); HelpMarker("Swap Cmd<>Ctrl keys, enable various MacOS style behaviors.");
+            ImGui::Checkbox("io.ConfigTextSizeCache", &io.ConfigTextSizeCache); // [EXPERIMENTAL]
+            ImGui::SameLine(); HelpMarker("*EXPERIMENTAL* Cache CalcTextSize() results across frames.\nHit/miss counters are displayed in Metrics/Debugger->TextSizeCache.");
+            ImGui::Checkbox("io.ConfigDrawDataDamageRects", &io.ConfigDrawDataDamageRects); // [EXPERIMENTAL]
+            ImGui::SameLine(); HelpMarker("*EXPERIMENTAL* Compute ImDrawData::DamageRects by comparing draw lists with previous frames.\nRequires renderer backend support (ImGuiBackendFlags_RendererHasDamageRects), and the application to only clear within damage rectangles.\nDamage covers the whole display unless the application sets io.DisplayBufferAge.\nCan be visualized in Metrics/Debugger->DrawLists.");
             ImGui::Text("Also see Style->Rendering for rendering options.");
 
             // Also read: https://github.com/ocornut/imgui/wiki/Error-Handling
@@ -612,6 +617,9 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasMouseCursors",      &io.BackendFlags, ImGuiBackendFlags_HasMouseCursors);
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasIdxSize",   &io.BackendFlags, ImGuiBackendFlags_RendererHasIdxSize);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasDamageRects", &io.BackendFlags, ImGuiBackendFlags_RendererHasDamageRects);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasAnalyticShapes", &io.BackendFlags, ImGuiBackendFlags_RendererHasAnalyticShapes);
             ImGui::EndDisabled();
 
             ImGui::TreePop();
@@ -990,6 +998,7 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
             static float arr[] = { 0.6f, 0.1f, 1.0f, 0.5f, 0.92f, 0.1f, 0.2f };
             ImGui::PlotLines("Curve", arr, IM_ARRAYSIZE(arr));
             ImGui::Text("Sin(time) = %f", sinf((float)ImGui::GetTime()));
+            ImGui::RequestRedraw(); // Animated
             ImGui::EndTooltip();
         }
 
@@ -1008,6 +1017,7 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
         else if (always_on == 2 && ImGui::BeginTooltip())
         {
             ImGui::ProgressBar(sinf((float)ImGui::GetTime()) * 0.5f + 0.5f, ImVec2(ImGui::GetFontSize() * 25, 0.0f));
+            ImGui::RequestRedraw(); // Animated
             ImGui::EndTooltip();
         }
 
@@ -1589,7 +1599,10 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
             const float time = (float)ImGui::GetTime();
             const bool winning_state = memchr(selected, 0, sizeof(selected)) == NULL; // If all cells are selected...
             if (winning_state)
+            {
                 ImGui::PushStyleVar(ImGuiStyleVar_SelectableTextAlign, ImVec2(0.5f + 0.5f * cosf(time * 2.0f), 0.5f + 0.5f * sinf(time * 3.0f)));
+                ImGui::RequestRedraw(); // Animated
+            }
 
             for (int y = 0; y < 4; y++)
                 for (int x = 0; x < 4; x++)
@@ -2006,6 +2019,8 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
         static double refresh_time = 0.0;
         if (!animate || refresh_time == 0.0)
             refresh_time = ImGui::GetTime();
+        if (animate)
+            ImGui::RequestRedraw(); // Keep animating when the application uses io.WantRedraw to save power
         while (refresh_time < ImGui::GetTime()) // Create data at fixed 60 Hz rate for the demo
         {
             static float phase = 0.0f;
@@ -2059,6 +2074,7 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
         // Animate a simple progress bar
         static float progress = 0.0f, progress_dir = 1.0f;
         progress += progress_dir * 0.4f * ImGui::GetIO().DeltaTime;
+        ImGui::RequestRedraw(); // Animated
         if (progress >= +1.1f) { progress = +1.1f; progress_dir *= -1.0f; }
         if (progress <= -0.1f) { progress = -0.1f; progress_dir *= -1.0f; }
 
@@ -7772,11 +7788,16 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigMemoryCompactTimer >= 0.0f)                        ImGui::Text("io.ConfigMemoryCompactTimer = %.1f", io.ConfigMemoryCompactTimer);
+        if (io.ConfigTextSizeCache)                                     ImGui::Text("io.ConfigTextSizeCache");
+        if (io.ConfigDrawDataDamageRects)                               ImGui::Text("io.ConfigDrawDataDamageRects");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasIdxSize)     ImGui::Text(" RendererHasIdxSize");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasDamageRects) ImGui::Text(" RendererHasDamageRects");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasAnalyticShapes) ImGui::Text(" RendererHasAnalyticShapes");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight);
         ImGui::Text("io.DisplaySize: %.2f,%.2f", io.DisplaySize.x, io.DisplaySize.y);
@@ -8664,34 +8685,27 @@ static void ShowExampleAppConsole(bool* p_open)
 //  my_log.Draw("title");
 struct ExampleAppLog
 {
-    ImGuiTextBuffer     Buf;
+    ImGuiTextLog        Buf;         // Text + index of lines. We could also use a ImGuiTextBuffer + maintain our own ImVector<int> of line offsets.
     ImGuiTextFilter     Filter;
-    ImVector<int>       LineOffsets; // Index to lines offset. We maintain this with AddLog() calls.
     bool                AutoScroll;  // Keep scrolling if already at the bottom.
 
     ExampleAppLog()
     {
         AutoScroll = true;
-        Clear();
+        Buf.MaxSize = 1024 * 1024;   // Keep the last ~1 MB of text, dropping oldest lines
     }
 
     void    Clear()
     {
         Buf.clear();
-        LineOffsets.clear();
-        LineOffsets.push_back(0);
     }
 
     void    AddLog(const char* fmt, ...) IM_FMTARGS(2)
     {
-        int old_size = Buf.size();
         va_list args;
         va_start(args, fmt);
         Buf.appendfv(fmt, args);
         va_end(args);
-        for (int new_size = Buf.size(); old_size < new_size; old_size++)
-            if (Buf[old_size] == '\n')
-                LineOffsets.push_back(old_size + 1);
     }
 
     void    Draw(const char* title, bool* p_open = NULL)
@@ -8729,25 +8743,23 @@ struct ExampleAppLog
                 ImGui::LogToClipboard();
 
             ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
-            const char* buf = Buf.begin();
-            const char* buf_end = Buf.end();
             if (Filter.IsActive())
             {
                 // In this example we don't use the clipper when Filter is enabled.
                 // This is because we don't have random access to the result of our filter.
                 // A real application processing logs with ten of thousands of entries may want to store the result of
                 // search/filter.. especially if the filtering function is not trivial (e.g. reg-exp).
-                for (int line_no = 0; line_no < LineOffsets.Size; line_no++)
+                for (int line_no = 0; line_no < Buf.size(); line_no++)
                 {
-                    const char* line_start = buf + LineOffsets[line_no];
-                    const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
+                    const char* line_start = Buf.get_line_begin(line_no);
+                    const char* line_end = Buf.get_line_end(line_no);
                     if (Filter.PassFilter(line_start, line_end))
                         ImGui::TextUnformatted(line_start, line_end);
                 }
             }
             else
             {
-                // The simplest and easy way to display the entire buffer:
+                // With a contiguous ImGuiTextBuffer, the simplest and easy way to display the entire buffer would be:
                 //   ImGui::TextUnformatted(buf_begin, buf_end);
                 // And it'll just work. TextUnformatted() has specialization for large blob of text and will fast-forward
                 // to skip non-visible lines. Here we instead demonstrate using the clipper to only process lines that are
@@ -8761,13 +8773,13 @@ struct ExampleAppLog
                 // anymore, which is why we don't use the clipper. Storing or skimming through the search result would make
                 // it possible (and would be recommended if you want to search through tens of thousands of entries).
                 ImGuiListClipper clipper;
-                clipper.Begin(LineOffsets.Size);
+                clipper.Begin(Buf.size());
                 while (clipper.Step())
                 {
                     for (int line_no = clipper.DisplayStart; line_no < clipper.DisplayEnd; line_no++)
                     {
-                        const char* line_start = buf + LineOffsets[line_no];
-                        const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
+                        const char* line_start = Buf.get_line_begin(line_no);
+                        const char* line_end = Buf.get_line_end(line_no);
                         ImGui::TextUnformatted(line_start, line_end);
                     }
                 }
@@ -9336,6 +9348,7 @@ static void ShowExampleAppWindowTitles(bool*)
     // Using "###" to display a changing title but keep a static identifier "AnimatedTitle"
     char buf[128];
     sprintf(buf, "Animated title %c %d###AnimatedTitle", "|/-\\"[(int)(ImGui::GetTime() / 0.25f) & 3], ImGui::GetFrameCount());
+    ImGui::RequestRedraw(0.25f - fmodf((float)ImGui::GetTime(), 0.25f));
     ImGui::SetNextWindowPos(ImVec2(base_pos.x + 100, base_pos.y + 300), ImGuiCond_FirstUseEver);
     ImGui::Begin(buf);
     ImGui::Text("This window has a changing title.");
@@ -9417,6 +9430,9 @@ static void ShowExampleAppCustomRendering(bool* p_open)
             ImGui::Checkbox("##curvessegmentoverride", &curve_segments_override);
             ImGui::SameLine(0.0f, ImGui::GetStyle().ItemInnerSpacing.x);
             curve_segments_override |= ImGui::SliderInt("Curves segments override", &curve_segments_override_v, 3, 40);
+            static bool path_join_miter = false;
+            ImGui::Checkbox("Paths: ImDrawFlags_JoinMiter", &path_join_miter);
+            ImGui::SameLine(); HelpMarker("Share vertices between segments of non anti-aliased lines (see Style->Rendering->Anti-aliased lines).");
             ImGui::ColorEdit4("Color", &colf.x);
 
             const ImVec2 p = ImGui::GetCursorScreenPos();
@@ -9426,6 +9442,7 @@ static void ShowExampleAppCustomRendering(bool* p_open)
             const float rounding = sz / 5.0f;
             const int circle_segments = circle_segments_override ? circle_segments_override_v : 0;
             const int curve_segments = curve_segments_override ? curve_segments_override_v : 0;
+            const ImDrawFlags path_flags = path_join_miter ? ImDrawFlags_JoinMiter : ImDrawFlags_None;
             const ImVec2 cp3[3] = { ImVec2(0.0f, sz * 0.6f), ImVec2(sz * 0.5f, -sz * 0.4f), ImVec2(sz, sz) }; // Control points for curves
             const ImVec2 cp4[4] = { ImVec2(0.0f, 0.0f), ImVec2(sz * 1.3f, sz * 0.3f), ImVec2(sz - sz * 1.3f, sz - sz * 0.3f), ImVec2(sz, sz) };
 
@@ -9443,7 +9460,7 @@ static void ShowExampleAppCustomRendering(bool* p_open)
                 draw_list->AddRect(ImVec2(x, y), ImVec2(x + sz, y + sz), col, rounding, corners_tl_br, th);         x += sz + spacing;  // Square with two rounded corners
                 draw_list->AddTriangle(ImVec2(x+sz*0.5f,y), ImVec2(x+sz, y+sz-0.5f), ImVec2(x, y+sz-0.5f), col, th);x += sz + spacing;  // Triangle
                 //draw_list->AddTriangle(ImVec2(x+sz*0.2f,y), ImVec2(x, y+sz-0.5f), ImVec2(x+sz*0.4f, y+sz-0.5f), col, th);x+= sz*0.4f + spacing; // Thin triangle
-                PathConcaveShape(draw_list, x, y, sz); draw_list->PathStroke(col, ImDrawFlags_Closed, th);          x += sz + spacing;  // Concave Shape
+                PathConcaveShape(draw_list, x, y, sz); draw_list->PathStroke(col, ImDrawFlags_Closed | path_flags, th); x += sz + spacing; // Concave Shape
                 //draw_list->AddPolyline(concave_shape, IM_ARRAYSIZE(concave_shape), col, ImDrawFlags_Closed, th);
                 draw_list->AddLine(ImVec2(x, y), ImVec2(x + sz, y), col, th);                                       x += sz + spacing;  // Horizontal line (note: drawing a filled rectangle will be faster!)
                 draw_list->AddLine(ImVec2(x, y), ImVec2(x, y + sz), col, th);                                       x += spacing;       // Vertical line (note: drawing a filled rectangle will be faster!)
@@ -9451,7 +9468,7 @@ static void ShowExampleAppCustomRendering(bool* p_open)
 
                 // Path
                 draw_list->PathArcTo(ImVec2(x + sz*0.5f, y + sz*0.5f), sz*0.5f, 3.141592f, 3.141592f * -0.5f);
-                draw_list->PathStroke(col, ImDrawFlags_None, th);
+                draw_list->PathStroke(col, path_flags, th);
                 x += sz + spacing;
 
                 // Quadratic Bezier Curve (3 control points)
@@ -394,6 +394,20 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
 }
 
+// Used by ImGui::UpdateDrawListSharedData(). Each instance keeps its own TempBuffer, so they can be used from different threads.
+void ImDrawListSharedData::CopySettingsFrom(const ImDrawListSharedData& src)
+{
+    TexUvWhitePixel = src.TexUvWhitePixel;
+    Font = src.Font;
+    FontSize = src.FontSize;
+    FontScale = src.FontScale;
+    CurveTessellationTol = src.CurveTessellationTol;
+    ClipRectFullscreen = src.ClipRectFullscreen;
+    InitialFlags = src.InitialFlags;
+    TexUvLines = src.TexUvLines;
+    SetCircleTessellationMaxError(src.CircleSegmentMaxError);
+}
+
 // Initialize before use in a new frame. We always have a command ready in the buffer.
 // In the majority of cases, you would want to call PushClipRect() and PushTextureID() after this.
 void ImDrawList::_ResetForNewFrame()
@@ -408,6 +422,7 @@ void ImDrawList::_ResetForNewFrame()
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
+    IdxSize = (int)sizeof(ImDrawIdx);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
@@ -422,11 +437,21 @@ void ImDrawList::_ResetForNewFrame()
     _FringeScale = 1.0f;
 }
 
+// Prepare a standalone draw list for a new frame, like Begin() does for window draw lists (see "Filling draw lists from other threads" in imgui.h).
+void ImDrawList::ResetForThread()
+{
+    IM_ASSERT(_Data->Font != NULL && "Call ImGui::UpdateDrawListSharedData() during the frame before using the shared data from another thread!");
+    _ResetForNewFrame();
+    PushTextureID(_Data->Font->ContainerAtlas->TexID);
+    PushClipRectFullScreen();
+}
+
 void ImDrawList::_ClearFreeMemory()
 {
     CmdBuffer.clear();
     IdxBuffer.clear();
     VtxBuffer.clear();
+    IdxSize = (int)sizeof(ImDrawIdx);
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
@@ -444,10 +469,105 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
+    dst->IdxSize = IdxSize;
     dst->Flags = Flags;
     return dst;
 }
 
+// Append contents of 'src', e.g. a draw list filled by another thread (see "Filling draw lists from other threads" in imgui.h).
+// - Vertices are copied once, translated by 'offset'.
+// - Indices are rebased. With 16-bit indices, when they wouldn't fit we rather use new VtxOffset values (if allowed) and copy them as-is.
+// - Clipping rectangles are translated by 'offset' and intersected with our current clipping rectangle. Fully clipped commands are skipped.
+// - Commands are merged with our current command when clipping rectangle and texture match.
+void ImDrawList::AddDrawList(const ImDrawList* src, const ImVec2& offset)
+{
+    IM_ASSERT(src != this);
+    IM_ASSERT(src->_Splitter._Count <= 1 && "Call ChannelsMerge() on source draw list first!");
+    IM_ASSERT(src->IdxSize == (int)sizeof(ImDrawIdx));
+    const ImVec4 backup_clip_rect = _CmdHeader.ClipRect;
+    const ImTextureID backup_texture_id = _CmdHeader.TextureId;
+
+    // Copy vertices
+    const int vtx_base = VtxBuffer.Size;
+    VtxBuffer.resize(vtx_base + src->VtxBuffer.Size);
+    ImDrawVert* vtx_write = VtxBuffer.Data + vtx_base;
+    if (offset.x == 0.0f && offset.y == 0.0f)
+    {
+        memcpy(vtx_write, src->VtxBuffer.Data, (size_t)src->VtxBuffer.size_in_bytes());
+    }
+    else
+    {
+        for (const ImDrawVert* vtx_read = src->VtxBuffer.begin(); vtx_read < src->VtxBuffer.end(); vtx_read++, vtx_write++)
+        {
+            *vtx_write = *vtx_read;
+            vtx_write->pos.x += offset.x;
+            vtx_write->pos.y += offset.y;
+        }
+    }
+    const bool idx_overflow = (sizeof(ImDrawIdx) == 2) && (vtx_base - (int)_CmdHeader.VtxOffset + src->VtxBuffer.Size > (1 << 16));
+    const bool use_vtx_offset = idx_overflow && (Flags & ImDrawListFlags_AllowVtxOffset);
+    IM_ASSERT((!idx_overflow || use_vtx_offset) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
+
+    // Copy commands and indices
+    for (const ImDrawCmd& src_cmd : src->CmdBuffer)
+    {
+        if (src_cmd.UserCallback == NULL && src_cmd.ElemCount == 0)
+            continue;
+        ImVec4 clip_rect(src_cmd.ClipRect.x + offset.x, src_cmd.ClipRect.y + offset.y, src_cmd.ClipRect.z + offset.x, src_cmd.ClipRect.w + offset.y);
+        clip_rect.x = ImMax(clip_rect.x, backup_clip_rect.x);
+        clip_rect.y = ImMax(clip_rect.y, backup_clip_rect.y);
+        clip_rect.z = ImMax(ImMin(clip_rect.z, backup_clip_rect.z), clip_rect.x);
+        clip_rect.w = ImMax(ImMin(clip_rect.w, backup_clip_rect.w), clip_rect.y);
+        if (src_cmd.UserCallback != NULL)
+        {
+            _CmdHeader.ClipRect = clip_rect;
+            _OnChangedClipRect();
+            if (src_cmd.UserCallbackDataSize > 0)
+                AddCallback(src_cmd.UserCallback, src->_CallbacksDataBuf.Data + src_cmd.UserCallbackDataOffset, (size_t)src_cmd.UserCallbackDataSize);
+            else
+                AddCallback(src_cmd.UserCallback, src_cmd.UserCallbackData);
+            continue;
+        }
+        if (clip_rect.x >= clip_rect.z || clip_rect.y >= clip_rect.w)
+            continue;
+
+        if (use_vtx_offset && _CmdHeader.VtxOffset != (unsigned int)vtx_base + src_cmd.VtxOffset)
+        {
+            _CmdHeader.VtxOffset = (unsigned int)vtx_base + src_cmd.VtxOffset;
+            _OnChangedVtxOffset();
+        }
+        _CmdHeader.ClipRect = clip_rect;
+        _OnChangedClipRect();
+        _CmdHeader.TextureId = src_cmd.TextureId;
+        _OnChangedTextureID();
+
+        const int idx_base = IdxBuffer.Size;
+        IdxBuffer.resize(idx_base + (int)src_cmd.ElemCount);
+        const ImDrawIdx* idx_read = src->IdxBuffer.Data + src_cmd.IdxOffset;
+        ImDrawIdx* idx_write = IdxBuffer.Data + idx_base;
+        if (use_vtx_offset)
+        {
+            memcpy(idx_write, idx_read, (size_t)src_cmd.ElemCount * sizeof(ImDrawIdx));
+        }
+        else
+        {
+            const unsigned int idx_offset = (unsigned int)vtx_base - _CmdHeader.VtxOffset + src_cmd.VtxOffset;
+            for (unsigned int n = 0; n < src_cmd.ElemCount; n++)
+                idx_write[n] = (ImDrawIdx)(idx_read[n] + idx_offset);
+        }
+        CmdBuffer.Data[CmdBuffer.Size - 1].ElemCount += src_cmd.ElemCount;
+    }
+
+    // Restore our state
+    _CmdHeader.ClipRect = backup_clip_rect;
+    _OnChangedClipRect();
+    _CmdHeader.TextureId = backup_texture_id;
+    _OnChangedTextureID();
+    _VtxCurrentIdx = (unsigned int)VtxBuffer.Size - _CmdHeader.VtxOffset;
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+}
+
 void ImDrawList::AddDrawCmd()
 {
     ImDrawCmd draw_cmd;
@@ -588,6 +708,59 @@ void ImDrawList::_OnChangedVtxOffset()
     curr_cmd->VtxOffset = _CmdHeader.VtxOffset;
 }
 
+// Convert IdxBuffer contents to 16-bit indices in place, for a draw list with 32-bit ImDrawIdx and at most 64K vertices.
+// IdxBuffer.Size becomes the number of ImDrawIdx needed to hold the packed indices (rounded up), ImDrawCmd::IdxOffset/ElemCount are unchanged.
+void ImDrawList::_PackIdx16()
+{
+    IM_ASSERT(sizeof(ImDrawIdx) == 4 && IdxSize == 4 && VtxBuffer.Size <= (1 << 16));
+    const int idx_count = IdxBuffer.Size;
+    char* dst = (char*)IdxBuffer.Data;
+    for (int n = 0; n < idx_count; n++)
+    {
+        const ImU16 idx = (ImU16)IdxBuffer.Data[n]; // Each write lands on bytes already read
+        memcpy(dst + n * 2, &idx, 2);
+    }
+    if (idx_count & 1)
+        memset(dst + idx_count * 2, 0, 2);
+    IdxBuffer.Size = (idx_count + 1) / 2;
+    IdxSize = 2;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+}
+
+// Convert IdxBuffer contents to 32-bit indices in place, for a draw list with 16-bit ImDrawIdx which was split with VtxOffset.
+// VtxOffset is added to each index and reset to 0, then consecutive commands which only differed by VtxOffset are merged.
+// IdxBuffer.Size becomes twice the number of indices, ImDrawCmd::IdxOffset is unchanged.
+void ImDrawList::_PromoteIdx32()
+{
+    IM_ASSERT(sizeof(ImDrawIdx) == 2 && IdxSize == 2);
+    IdxBuffer.resize(IdxBuffer.Size * 2);
+    char* dst = (char*)IdxBuffer.Data;
+    for (int cmd_n = CmdBuffer.Size - 1; cmd_n >= 0; cmd_n--)
+    {
+        ImDrawCmd* cmd = &CmdBuffer.Data[cmd_n];
+        for (int n = (int)(cmd->IdxOffset + cmd->ElemCount) - 1; n >= (int)cmd->IdxOffset; n--)
+        {
+            const ImU32 idx = (ImU32)IdxBuffer.Data[n] + cmd->VtxOffset; // Going backward, each write lands on bytes already read
+            memcpy(dst + n * 4, &idx, 4);
+        }
+        cmd->VtxOffset = 0;
+    }
+    IdxSize = 4;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+
+    ImDrawCmd* cmd_write = CmdBuffer.Data;
+    for (int cmd_n = 1; cmd_n < CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd* cmd = &CmdBuffer.Data[cmd_n];
+        if (cmd->UserCallback == NULL && cmd_write->UserCallback == NULL && ImDrawCmd_HeaderCompare(cmd, cmd_write) == 0 && ImDrawCmd_AreSequentialIdxOffset(cmd_write, cmd))
+            cmd_write->ElemCount += cmd->ElemCount;
+        else
+            *++cmd_write = *cmd;
+    }
+    CmdBuffer.Size = (int)(cmd_write - CmdBuffer.Data) + 1;
+    _CmdHeader.VtxOffset = 0;
+}
+
 int ImDrawList::_CalcCircleAutoSegmentCount(float radius) const
 {
     // Automatic segment count
@@ -743,6 +916,76 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = ImRsqrt(d2); VX *= inv_len; VY *= inv_len; } } (void)0
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
+#define IM_NORMALIZE2F_PRECISE_OVER_ZERO(VX,VY) { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = 1.0f / ImSqrt(d2); VX *= inv_len; VY *= inv_len; } } (void)0 // ImDrawFlags_JoinMiter: joins divide by the length of averaged normals, ImRsqrt() is not precise enough on sharp turns
+#define IM_POLYLINE_MITER_LIMIT             4.0f   // ImDrawFlags_JoinMiter: use a bevel join when the miter is longer than this times the half thickness (same as SVG default)
+
+#if defined(IMGUI_ENABLE_SSE2) || defined(IMGUI_ENABLE_NEON)
+// Same as the scalar code in AddPolyline() for 4 points: normalize segments points[0]->points[1] ... points[3]->points[4],
+// average each normal with the previous one (starting with *io_prev_nx, *io_prev_ny) and fix it up. Results are identical to the scalar code.
+static inline void PolylineOffsetDirs4(const ImVec2* points, float* io_prev_nx, float* io_prev_ny, float* out_dm_x, float* out_dm_y)
+{
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128 p0a = _mm_loadu_ps(&points[0].x), p0b = _mm_loadu_ps(&points[2].x);
+    const __m128 p1a = _mm_loadu_ps(&points[1].x), p1b = _mm_loadu_ps(&points[3].x);
+    __m128 dx = _mm_sub_ps(_mm_shuffle_ps(p1a, p1b, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(p0a, p0b, _MM_SHUFFLE(2, 0, 2, 0)));
+    __m128 dy = _mm_sub_ps(_mm_shuffle_ps(p1a, p1b, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(p0a, p0b, _MM_SHUFFLE(3, 1, 3, 1)));
+
+    // IM_NORMALIZE2F_OVER_ZERO()
+    __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+    __m128 mask = _mm_cmpgt_ps(d2, _mm_setzero_ps());
+    __m128 inv_len = _mm_rsqrt_ps(d2);
+    dx = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(dx, inv_len)), _mm_andnot_ps(mask, dx));
+    dy = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(dy, inv_len)), _mm_andnot_ps(mask, dy));
+    const __m128 nx = dy;
+    const __m128 ny = _mm_xor_ps(dx, _mm_set1_ps(-0.0f));
+    const __m128 prev_nx = _mm_move_ss(_mm_shuffle_ps(nx, nx, _MM_SHUFFLE(2, 1, 0, 0)), _mm_set_ss(*io_prev_nx));
+    const __m128 prev_ny = _mm_move_ss(_mm_shuffle_ps(ny, ny, _MM_SHUFFLE(2, 1, 0, 0)), _mm_set_ss(*io_prev_ny));
+
+    // Average normals, IM_FIXNORMAL2F()
+    const __m128 half = _mm_set1_ps(0.5f);
+    __m128 dm_x = _mm_mul_ps(_mm_add_ps(prev_nx, nx), half);
+    __m128 dm_y = _mm_mul_ps(_mm_add_ps(prev_ny, ny), half);
+    d2 = _mm_add_ps(_mm_mul_ps(dm_x, dm_x), _mm_mul_ps(dm_y, dm_y));
+    mask = _mm_cmpgt_ps(d2, _mm_set1_ps(0.000001f));
+    const __m128 inv_len2 = _mm_min_ps(_mm_div_ps(_mm_set1_ps(1.0f), d2), _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2));
+    dm_x = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(dm_x, inv_len2)), _mm_andnot_ps(mask, dm_x));
+    dm_y = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(dm_y, inv_len2)), _mm_andnot_ps(mask, dm_y));
+    _mm_storeu_ps(out_dm_x, dm_x);
+    _mm_storeu_ps(out_dm_y, dm_y);
+    *io_prev_nx = _mm_cvtss_f32(_mm_shuffle_ps(nx, nx, _MM_SHUFFLE(3, 3, 3, 3)));
+    *io_prev_ny = _mm_cvtss_f32(_mm_shuffle_ps(ny, ny, _MM_SHUFFLE(3, 3, 3, 3)));
+#else
+    const float32x4x2_t p0 = vld2q_f32(&points[0].x);
+    const float32x4x2_t p1 = vld2q_f32(&points[1].x);
+    float32x4_t dx = vsubq_f32(p1.val[0], p0.val[0]);
+    float32x4_t dy = vsubq_f32(p1.val[1], p0.val[1]);
+
+    // IM_NORMALIZE2F_OVER_ZERO() (ImRsqrt() is 1.0f / sqrtf() on this platform)
+    float32x4_t d2 = vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy));
+    uint32x4_t mask = vcgtq_f32(d2, vdupq_n_f32(0.0f));
+    const float32x4_t inv_len = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(d2));
+    dx = vbslq_f32(mask, vmulq_f32(dx, inv_len), dx);
+    dy = vbslq_f32(mask, vmulq_f32(dy, inv_len), dy);
+    const float32x4_t nx = dy;
+    const float32x4_t ny = vnegq_f32(dx);
+    const float32x4_t prev_nx = vextq_f32(vdupq_n_f32(*io_prev_nx), nx, 3);
+    const float32x4_t prev_ny = vextq_f32(vdupq_n_f32(*io_prev_ny), ny, 3);
+
+    // Average normals, IM_FIXNORMAL2F()
+    float32x4_t dm_x = vmulq_n_f32(vaddq_f32(prev_nx, nx), 0.5f);
+    float32x4_t dm_y = vmulq_n_f32(vaddq_f32(prev_ny, ny), 0.5f);
+    d2 = vaddq_f32(vmulq_f32(dm_x, dm_x), vmulq_f32(dm_y, dm_y));
+    mask = vcgtq_f32(d2, vdupq_n_f32(0.000001f));
+    const float32x4_t inv_len2 = vminq_f32(vdivq_f32(vdupq_n_f32(1.0f), d2), vdupq_n_f32(IM_FIXNORMAL2F_MAX_INVLEN2));
+    dm_x = vbslq_f32(mask, vmulq_f32(dm_x, inv_len2), dm_x);
+    dm_y = vbslq_f32(mask, vmulq_f32(dm_y, inv_len2), dm_y);
+    vst1q_f32(out_dm_x, dm_x);
+    vst1q_f32(out_dm_y, dm_y);
+    *io_prev_nx = vgetq_lane_f32(nx, 3);
+    *io_prev_ny = vgetq_lane_f32(ny, 3);
+#endif
+}
+#endif
 
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
@@ -779,195 +1022,304 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
         PrimReserve(idx_count, vtx_count);
 
-        // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
-        ImVec2* temp_points = temp_normals + points_count;
+        // [PATH 1] Texture-based lines (thick or non-thick): 2 vertices per point (outer edges)
+        // [PATH 2] Non texture-based lines (non-thick): 3 vertices per point (center + outer edges)
+        // [PATH 3] Non texture-based lines (thick): 4 vertices per point (outer edges of AA fringe + solid core)
+        // The width of the geometry we need to draw - this is essentially <thickness> pixels for the line itself, plus "one pixel" for AA.
+        // - In the texture-based path, we don't use AA_SIZE here because the +1 is tied to the generated texture
+        //   (see ImFontAtlasBuildRenderLinesTexData() function), and so alternate values won't work without changes to that code.
+        // - In the non texture-based paths, we would allow AA_SIZE to potentially be != 1.0f with a patch (e.g. fringe_scale patch to
+        //   allow scaling geometry while preserving one-screen-pixel AA fringe).
+        const int vtx_stride = use_texture ? 2 : thick_line ? 4 : 3;
+        const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
+        const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+        const float half_outer_thickness = half_inner_thickness + AA_SIZE;
+        ImVec2 tex_uv0 = opaque_uv, tex_uv1 = opaque_uv;
+        if (use_texture)
+        {
+            const ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness]; // Fractional thickness is currently always zero when use_texture==true
+            tex_uv0 = ImVec2(tex_uvs.x, tex_uvs.y);
+            tex_uv1 = ImVec2(tex_uvs.z, tex_uvs.w);
+        }
 
-        // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
+        // Single pass: for each point, compute the normal of the segment starting on it, average it with the normal of the previous segment,
+        // then write the vertices of the point and the indices of that segment. No temporary buffer is needed.
+        // - The first point of a closed line uses the normal of the closing segment. The first point of an open line isn't averaged.
+        // - The last point of an open line has no next segment and uses the normal of the previous segment.
+        float prev_nx = 0.0f, prev_ny = 0.0f;
+        if (closed)
         {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
+            float dx = points[0].x - points[points_count - 1].x;
+            float dy = points[0].y - points[points_count - 1].y;
             IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
+            prev_nx = dy;
+            prev_ny = -dx;
         }
-        if (!closed)
-            temp_normals[points_count - 1] = temp_normals[points_count - 2];
-
-        // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
-        if (use_texture || !thick_line)
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        const unsigned int idx_base = _VtxCurrentIdx;
+        float block_dm_x[4], block_dm_y[4];
+        int block_n = 0;
+        for (int i = 0; i < points_count; i++)
         {
-            // [PATH 1] Texture-based lines (thick or non-thick)
-            // [PATH 2] Non texture-based lines (non-thick)
-
-            // The width of the geometry we need to draw - this is essentially <thickness> pixels for the line itself, plus "one pixel" for AA.
-            // - In the texture-based path, we don't use AA_SIZE here because the +1 is tied to the generated texture
-            //   (see ImFontAtlasBuildRenderLinesTexData() function), and so alternate values won't work without changes to that code.
-            // - In the non texture-based paths, we would allow AA_SIZE to potentially be != 1.0f with a patch (e.g. fringe_scale patch to
-            //   allow scaling geometry while preserving one-screen-pixel AA fringe).
-            const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
-
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
+            const float px = points[i].x;
+            const float py = points[i].y;
+#if defined(IMGUI_ENABLE_SSE2) || defined(IMGUI_ENABLE_NEON)
+            // Compute 4 points at a time when their segments don't wrap around
+            if (block_n == 0 && i > 0 && i + 4 < points_count)
             {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
+                PolylineOffsetDirs4(&points[i], &prev_nx, &prev_ny, block_dm_x, block_dm_y);
+                block_n = 4;
             }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+#endif
+            // Average normals (dm_x, dm_y are then scaled to offsets to the edges)
+            float dm_x, dm_y;
+            if (block_n > 0)
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
-                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
-                if (use_texture)
+                dm_x = block_dm_x[4 - block_n];
+                dm_y = block_dm_y[4 - block_n];
+                block_n--;
+            }
+            else
+            {
+                float nx = prev_nx, ny = prev_ny;
+                if (i < count)
                 {
-                    // Add indices for two triangles
-                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 1); // Right tri
-                    _IdxWritePtr[3] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[4] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Left tri
-                    _IdxWritePtr += 6;
+                    const int i2 = (i + 1) == points_count ? 0 : i + 1;
+                    float dx = points[i2].x - px;
+                    float dy = points[i2].y - py;
+                    IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+                    nx = dy;
+                    ny = -dx;
                 }
-                else
+                dm_x = nx;
+                dm_y = ny;
+                if (closed || i > 0)
                 {
-                    // Add indexes for four triangles
-                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
-                    _IdxWritePtr[3] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
-                    _IdxWritePtr[6] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
-                    _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
-                    _IdxWritePtr += 12;
+                    dm_x = (prev_nx + nx) * 0.5f;
+                    dm_y = (prev_ny + ny) * 0.5f;
+                    IM_FIXNORMAL2F(dm_x, dm_y);
                 }
-
-                idx1 = idx2;
+                prev_nx = nx;
+                prev_ny = ny;
             }
 
-            // Add vertexes for each point on the line
+            // Add vertices for this point
             if (use_texture)
             {
-                // If we're using textures we only need to emit the left/right edge vertices
-                ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness];
-                /*if (fractional_thickness != 0.0f) // Currently always zero when use_texture==false!
-                {
-                    const ImVec4 tex_uvs_1 = _Data->TexUvLines[integer_thickness + 1];
-                    tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
-                    tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
-                    tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
-                    tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
-                }*/
-                ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
-                ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
-                for (int i = 0; i < points_count; i++)
-                {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
-                    _VtxWritePtr += 2;
-                }
+                dm_x *= half_draw_size;
+                dm_y *= half_draw_size;
+                vtx_write[0].pos.x = px + dm_x; vtx_write[0].pos.y = py + dm_y; vtx_write[0].uv = tex_uv0; vtx_write[0].col = col; // Left-side outer edge
+                vtx_write[1].pos.x = px - dm_x; vtx_write[1].pos.y = py - dm_y; vtx_write[1].uv = tex_uv1; vtx_write[1].col = col; // Right-side outer edge
+                vtx_write += 2;
+            }
+            else if (!thick_line)
+            {
+                dm_x *= half_draw_size;
+                dm_y *= half_draw_size;
+                vtx_write[0].pos.x = px;        vtx_write[0].pos.y = py;        vtx_write[0].uv = opaque_uv; vtx_write[0].col = col;       // Center of line
+                vtx_write[1].pos.x = px + dm_x; vtx_write[1].pos.y = py + dm_y; vtx_write[1].uv = opaque_uv; vtx_write[1].col = col_trans; // Left-side outer edge
+                vtx_write[2].pos.x = px - dm_x; vtx_write[2].pos.y = py - dm_y; vtx_write[2].uv = opaque_uv; vtx_write[2].col = col_trans; // Right-side outer edge
+                vtx_write += 3;
             }
             else
             {
-                // If we're not using a texture, we need the center vertex as well
-                for (int i = 0; i < points_count; i++)
+                const float dm_out_x = dm_x * half_outer_thickness;
+                const float dm_out_y = dm_y * half_outer_thickness;
+                const float dm_in_x = dm_x * half_inner_thickness;
+                const float dm_in_y = dm_y * half_inner_thickness;
+                vtx_write[0].pos.x = px + dm_out_x; vtx_write[0].pos.y = py + dm_out_y; vtx_write[0].uv = opaque_uv; vtx_write[0].col = col_trans;
+                vtx_write[1].pos.x = px + dm_in_x;  vtx_write[1].pos.y = py + dm_in_y;  vtx_write[1].uv = opaque_uv; vtx_write[1].col = col;
+                vtx_write[2].pos.x = px - dm_in_x;  vtx_write[2].pos.y = py - dm_in_y;  vtx_write[2].uv = opaque_uv; vtx_write[2].col = col;
+                vtx_write[3].pos.x = px - dm_out_x; vtx_write[3].pos.y = py - dm_out_y; vtx_write[3].uv = opaque_uv; vtx_write[3].col = col_trans;
+                vtx_write += 4;
+            }
+
+            // Add indices for the segment starting on this point (the closing segment ends on the first point)
+            if (i < count)
+            {
+                const unsigned int idx1 = idx_base + i * vtx_stride;                                // Vertex index for start of line segment
+                const unsigned int idx2 = (i + 1) == points_count ? idx_base : (idx1 + vtx_stride); // Vertex index for end of line segment
+                if (use_texture)
+                {
+                    // Add indices for two triangles
+                    idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 1); // Right tri
+                    idx_write[3] = (ImDrawIdx)(idx2 + 1); idx_write[4] = (ImDrawIdx)(idx1 + 1); idx_write[5] = (ImDrawIdx)(idx2 + 0); // Left tri
+                    idx_write += 6;
+                }
+                else if (!thick_line)
+                {
+                    // Add indexes for four triangles
+                    idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
+                    idx_write[3] = (ImDrawIdx)(idx1 + 2); idx_write[4] = (ImDrawIdx)(idx2 + 2); idx_write[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
+                    idx_write[6] = (ImDrawIdx)(idx2 + 1); idx_write[7] = (ImDrawIdx)(idx1 + 1); idx_write[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
+                    idx_write[9] = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
+                    idx_write += 12;
+                }
+                else
                 {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
-                    _VtxWritePtr += 3;
+                    // Add indexes for six triangles
+                    idx_write[0]  = (ImDrawIdx)(idx2 + 1); idx_write[1]  = (ImDrawIdx)(idx1 + 1); idx_write[2]  = (ImDrawIdx)(idx1 + 2);
+                    idx_write[3]  = (ImDrawIdx)(idx1 + 2); idx_write[4]  = (ImDrawIdx)(idx2 + 2); idx_write[5]  = (ImDrawIdx)(idx2 + 1);
+                    idx_write[6]  = (ImDrawIdx)(idx2 + 1); idx_write[7]  = (ImDrawIdx)(idx1 + 1); idx_write[8]  = (ImDrawIdx)(idx1 + 0);
+                    idx_write[9]  = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1);
+                    idx_write[12] = (ImDrawIdx)(idx2 + 2); idx_write[13] = (ImDrawIdx)(idx1 + 2); idx_write[14] = (ImDrawIdx)(idx1 + 3);
+                    idx_write[15] = (ImDrawIdx)(idx1 + 3); idx_write[16] = (ImDrawIdx)(idx2 + 3); idx_write[17] = (ImDrawIdx)(idx2 + 2);
+                    idx_write += 18;
                 }
             }
         }
-        else
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+    else if (flags & ImDrawFlags_JoinMiter)
+    {
+        // [PATH 5] Non texture-based, Non anti-aliased lines, sharing vertices between segments
+        // - Points are offset along their averaged normals (miter join): 2 vertices per point.
+        // - When the miter would be longer than IM_POLYLINE_MITER_LIMIT times the half thickness, the outer side uses one vertex for each
+        //   segment and a triangle fills the gap between them (bevel join), the inner side still shares a vertex: 3 vertices per point
+        //   (5 when the line nearly reverses direction and the inner side cannot be shared).
+        const float half_thickness = thickness * 0.5f;
+        const int idx_count_max = count * 6 + points_count * 3;
+        const int vtx_count_max = points_count * 5;
+        PrimReserve(idx_count_max, vtx_count_max);
+
+        // Consecutive duplicate points are skipped: a zero-length segment has no direction to join with.
+        int points_end = points_count;
+        if (closed)
+            while (points_end > 1 && points[points_end - 1].x == points[0].x && points[points_end - 1].y == points[0].y)
+                points_end--;
+        float prev_nx = 0.0f, prev_ny = 0.0f, prev_len2 = 0.0f;
+        if (closed)
         {
-            // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
-            const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
-
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
+            float dx = points[0].x - points[points_end - 1].x;
+            float dy = points[0].y - points[points_end - 1].y;
+            prev_len2 = dx * dx + dy * dy;
+            IM_NORMALIZE2F_PRECISE_OVER_ZERO(dx, dy);
+            prev_nx = dy;
+            prev_ny = -dx;
+        }
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int vtx_idx = _VtxCurrentIdx;
+        unsigned int first_in_l = 0, first_in_r = 0;    // Vertices the closing segment ends on
+        unsigned int prev_out_l = 0, prev_out_r = 0;    // Vertices the previous segment starts on
+        for (int i = 0, i_next = 0; i < points_end; i = i_next)
+        {
+            const float px = points[i].x;
+            const float py = points[i].y;
+            for (i_next = i + 1; i_next < points_end && points[i_next].x == px && points[i_next].y == py; )
+                i_next++;
+            const bool is_last = (i_next == points_end);
+            float nx = prev_nx, ny = prev_ny, len2 = prev_len2;
+            if (!is_last || closed)
             {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
+                const int i2 = is_last ? 0 : i_next;
+                float dx = points[i2].x - px;
+                float dy = points[i2].y - py;
+                len2 = dx * dx + dy * dy;
+                IM_NORMALIZE2F_PRECISE_OVER_ZERO(dx, dy);
+                nx = dy;
+                ny = -dx;
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            unsigned int in_l, in_r, out_l, out_r; // Vertices the segment ending on this point ends on, vertices the next segment starts on
+            float dm_x = (prev_nx + nx) * 0.5f;
+            float dm_y = (prev_ny + ny) * 0.5f;
+            const float d2 = dm_x * dm_x + dm_y * dm_y;
+            if (!closed && (i == 0 || is_last))
+            {
+                // End points of an open line
+                dm_x = nx * half_thickness;
+                dm_y = ny * half_thickness;
+                vtx_write[0].pos.x = px + dm_x; vtx_write[0].pos.y = py + dm_y; vtx_write[0].uv = opaque_uv; vtx_write[0].col = col;
+                vtx_write[1].pos.x = px - dm_x; vtx_write[1].pos.y = py - dm_y; vtx_write[1].uv = opaque_uv; vtx_write[1].col = col;
+                in_l = out_l = vtx_idx;
+                in_r = out_r = vtx_idx + 1;
+                vtx_write += 2;
+                vtx_idx += 2;
+            }
+            else if (d2 * (IM_POLYLINE_MITER_LIMIT * IM_POLYLINE_MITER_LIMIT) >= 1.0f)
+            {
+                // Miter join
+                const float inv_len2 = half_thickness / d2;
+                dm_x *= inv_len2;
+                dm_y *= inv_len2;
+                vtx_write[0].pos.x = px + dm_x; vtx_write[0].pos.y = py + dm_y; vtx_write[0].uv = opaque_uv; vtx_write[0].col = col;
+                vtx_write[1].pos.x = px - dm_x; vtx_write[1].pos.y = py - dm_y; vtx_write[1].uv = opaque_uv; vtx_write[1].col = col;
+                in_l = out_l = vtx_idx;
+                in_r = out_r = vtx_idx + 1;
+                vtx_write += 2;
+                vtx_idx += 2;
+            }
+            else
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
-                const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
-                // Add indexes
-                _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
-                _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
-                _IdxWritePtr[6]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1 + 0);
-                _IdxWritePtr[9]  = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1);
-                _IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
-                _IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); _IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); _IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
-                _IdxWritePtr += 18;
-
-                idx1 = idx2;
+                // Bevel join. The outer side is the one the line turns away from, a triangle fills the gap between the two segments.
+                // The inner side shares the vertex where the inner edges intersect, unless it is further than the end of the shortest segment
+                // (nearly reversing direction, or reversing exactly: no intersection), in which case each segment uses its own inner vertex and they overlap.
+                const float side = (prev_ny * nx - prev_nx * ny < 0.0f) ? half_thickness : -half_thickness;
+                const float inv_len2 = (d2 > 0.000001f) ? 1.0f / d2 : 0.0f;
+                const float inner_dist2 = (1.0f - d2) * inv_len2 * (half_thickness * half_thickness); // Squared distance from the point to the intersection, along the segments
+                const bool inner_shared = (inv_len2 > 0.0f) && inner_dist2 <= ImMin(prev_len2, len2);
+                if (inner_shared)
+                {
+                    dm_x *= inv_len2;
+                    dm_y *= inv_len2;
+                    vtx_write[0].pos.x = px - dm_x * side;     vtx_write[0].pos.y = py - dm_y * side;     // Inner side
+                }
+                else
+                {
+                    vtx_write[0].pos.x = px;                   vtx_write[0].pos.y = py;                   // Center
+                    vtx_write[3].pos.x = px - prev_nx * side;  vtx_write[3].pos.y = py - prev_ny * side;  // Inner side, previous segment
+                    vtx_write[4].pos.x = px - nx * side;       vtx_write[4].pos.y = py - ny * side;       // Inner side, next segment
+                }
+                vtx_write[1].pos.x = px + prev_nx * side;  vtx_write[1].pos.y = py + prev_ny * side;  // Outer side, previous segment
+                vtx_write[2].pos.x = px + nx * side;       vtx_write[2].pos.y = py + ny * side;       // Outer side, next segment
+                const int vtx_n = inner_shared ? 3 : 5;
+                for (int n = 0; n < vtx_n; n++)
+                {
+                    vtx_write[n].uv = opaque_uv;
+                    vtx_write[n].col = col;
+                }
+                idx_write[0] = (ImDrawIdx)(vtx_idx); idx_write[1] = (ImDrawIdx)(vtx_idx + 1); idx_write[2] = (ImDrawIdx)(vtx_idx + 2);
+                idx_write += 3;
+                const unsigned int in_inner = inner_shared ? vtx_idx : vtx_idx + 3;
+                const unsigned int out_inner = inner_shared ? vtx_idx : vtx_idx + 4;
+                if (side > 0.0f) { in_l = vtx_idx + 1; out_l = vtx_idx + 2; in_r = in_inner; out_r = out_inner; }
+                else             { in_r = vtx_idx + 1; out_r = vtx_idx + 2; in_l = in_inner; out_l = out_inner; }
+                vtx_write += vtx_n;
+                vtx_idx += vtx_n;
             }
+            prev_nx = nx;
+            prev_ny = ny;
+            prev_len2 = len2;
 
-            // Add vertices
-            for (int i = 0; i < points_count; i++)
+            // Add indices for the segment ending on this point
+            if (i == 0)
+            {
+                first_in_l = in_l;
+                first_in_r = in_r;
+            }
+            else
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
-                _VtxWritePtr += 4;
+                idx_write[0] = (ImDrawIdx)(prev_out_l); idx_write[1] = (ImDrawIdx)(in_l); idx_write[2] = (ImDrawIdx)(in_r);
+                idx_write[3] = (ImDrawIdx)(prev_out_l); idx_write[4] = (ImDrawIdx)(in_r); idx_write[5] = (ImDrawIdx)(prev_out_r);
+                idx_write += 6;
             }
+            prev_out_l = out_l;
+            prev_out_r = out_r;
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+        if (closed)
+        {
+            idx_write[0] = (ImDrawIdx)(prev_out_l); idx_write[1] = (ImDrawIdx)(first_in_l); idx_write[2] = (ImDrawIdx)(first_in_r);
+            idx_write[3] = (ImDrawIdx)(prev_out_l); idx_write[4] = (ImDrawIdx)(first_in_r); idx_write[5] = (ImDrawIdx)(prev_out_r);
+            idx_write += 6;
+        }
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = vtx_idx;
+        PrimUnreserve((int)(IdxBuffer.Data + IdxBuffer.Size - idx_write), (int)(VtxBuffer.Data + VtxBuffer.Size - vtx_write));
     }
     else
     {
@@ -1178,6 +1530,28 @@ void ImDrawList::_PathArcToFastEx(const ImVec2& center, float radius, int a_min_
     IM_ASSERT_PARANOID(_Path.Data + _Path.Size == out_ptr);
 }
 
+// Append points 'center + cos(a) * axis_x + sin(a) * axis_y' for a = a_min ... a_max (both included) in 'num_segments' steps.
+// - Rotates the unit vector by a constant step angle instead of calling cos()/sin() per point, so it works for any radius/segment count.
+// - The recurrence is carried in double precision: drift stays well below 1e-3 pixels for the largest circles.
+static void PathArcRotateN(ImVector<ImVec2>* path, const ImVec2& center, const ImVec2& axis_x, const ImVec2& axis_y, float a_min, float a_max, int num_segments)
+{
+    if (num_segments < 1)
+        num_segments = 1;
+    path->resize(path->Size + num_segments + 1);
+    ImVec2* out_ptr = path->Data + path->Size - (num_segments + 1);
+    const double a_step = ((double)a_max - (double)a_min) / (double)num_segments;
+    const double step_cos = cos(a_step), step_sin = sin(a_step);
+    double c = cos((double)a_min), s = sin((double)a_min);
+    for (int i = 0; i <= num_segments; i++, out_ptr++)
+    {
+        out_ptr->x = center.x + (float)c * axis_x.x + (float)s * axis_y.x;
+        out_ptr->y = center.y + (float)c * axis_x.y + (float)s * axis_y.y;
+        const double next_c = c * step_cos - s * step_sin;
+        s = s * step_cos + c * step_sin;
+        c = next_c;
+    }
+}
+
 void ImDrawList::_PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
 {
     if (radius < 0.5f)
@@ -1188,12 +1562,7 @@ void ImDrawList::_PathArcToN(const ImVec2& center, float radius, float a_min, fl
 
     // Note that we are adding a point at both a_min and a_max.
     // If you are trying to draw a full closed circle you don't want the overlapping points!
-    _Path.reserve(_Path.Size + (num_segments + 1));
-    for (int i = 0; i <= num_segments; i++)
-    {
-        const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
-        _Path.push_back(ImVec2(center.x + ImCos(a) * radius, center.y + ImSin(a) * radius));
-    }
+    PathArcRotateN(&_Path, center, ImVec2(radius, 0.0f), ImVec2(0.0f, radius), a_min, a_max, num_segments);
 }
 
 // 0: East, 3: South, 6: West, 9: North, 12: East
@@ -1262,19 +1631,10 @@ void ImDrawList::PathEllipticalArcTo(const ImVec2& center, const ImVec2& radius,
     if (num_segments <= 0)
         num_segments = _CalcCircleAutoSegmentCount(ImMax(radius.x, radius.y)); // A bit pessimistic, maybe there's a better computation to do here.
 
-    _Path.reserve(_Path.Size + (num_segments + 1));
-
+    // Rotated ellipse axes, see PathArcRotateN()
     const float cos_rot = ImCos(rot);
     const float sin_rot = ImSin(rot);
-    for (int i = 0; i <= num_segments; i++)
-    {
-        const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
-        ImVec2 point(ImCos(a) * radius.x, ImSin(a) * radius.y);
-        const ImVec2 rel((point.x * cos_rot) - (point.y * sin_rot), (point.x * sin_rot) + (point.y * cos_rot));
-        point.x = rel.x + center.x;
-        point.y = rel.y + center.y;
-        _Path.push_back(point);
-    }
+    PathArcRotateN(&_Path, center, ImVec2(cos_rot * radius.x, sin_rot * radius.x), ImVec2(-sin_rot * radius.y, cos_rot * radius.y), a_min, a_max, num_segments);
 }
 
 ImVec2 ImBezierCubicCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, float t)
@@ -1296,48 +1656,58 @@ ImVec2 ImBezierQuadraticCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p
     return ImVec2(w1 * p1.x + w2 * p2.x + w3 * p3.x, w1 * p1.y + w2 * p2.y + w3 * p3.y);
 }
 
-// Closely mimics ImBezierCubicClosestPointCasteljau() in imgui.cpp
-static void PathBezierCubicCurveToCasteljau(ImVector<ImVec2>* path, float x1, float y1, float x2, float y2, float x3, float y3, float x4, float y4, float tess_tol, int level)
+// Append points at t = 1/num_segments, 2/num_segments ... 1 of the polynomial curve 'c0 + c1*t + c2*t^2 + c3*t^3', using Horner's scheme.
+// - Evaluates 4 points at a time with SIMD. Unlike forward differencing there is no error accumulation across points.
+// - The last point is written as 'p_end' so curves join exactly with the next path element.
+static void PathPolynomialCurveTo(ImVector<ImVec2>* path, const ImVec2& c0, const ImVec2& c1, const ImVec2& c2, const ImVec2& c3, const ImVec2& p_end, int num_segments)
 {
-    float dx = x4 - x1;
-    float dy = y4 - y1;
-    float d2 = (x2 - x4) * dy - (y2 - y4) * dx;
-    float d3 = (x3 - x4) * dy - (y3 - y4) * dx;
-    d2 = (d2 >= 0) ? d2 : -d2;
-    d3 = (d3 >= 0) ? d3 : -d3;
-    if ((d2 + d3) * (d2 + d3) < tess_tol * (dx * dx + dy * dy))
+    if (num_segments <= 0) // Negative counts add no points (as with the former per-point loop)
+        return;
+    path->resize(path->Size + num_segments);
+    ImVec2* out_ptr = path->Data + path->Size - num_segments;
+    const float t_step = 1.0f / (float)num_segments;
+    int i = 1;
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128 c0x = _mm_set1_ps(c0.x), c1x = _mm_set1_ps(c1.x), c2x = _mm_set1_ps(c2.x), c3x = _mm_set1_ps(c3.x);
+    const __m128 c0y = _mm_set1_ps(c0.y), c1y = _mm_set1_ps(c1.y), c2y = _mm_set1_ps(c2.y), c3y = _mm_set1_ps(c3.y);
+    for (; i + 4 <= num_segments; i += 4, out_ptr += 4)
+    {
+        const __m128 t = _mm_mul_ps(_mm_add_ps(_mm_set1_ps((float)i), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f)), _mm_set1_ps(t_step));
+        const __m128 x = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(c3x, t), c2x), t), c1x), t), c0x);
+        const __m128 y = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(c3y, t), c2y), t), c1y), t), c0y);
+        _mm_storeu_ps(&out_ptr[0].x, _mm_unpacklo_ps(x, y));
+        _mm_storeu_ps(&out_ptr[2].x, _mm_unpackhi_ps(x, y));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t c0x = vdupq_n_f32(c0.x), c1x = vdupq_n_f32(c1.x), c2x = vdupq_n_f32(c2.x), c3x = vdupq_n_f32(c3.x);
+    const float32x4_t c0y = vdupq_n_f32(c0.y), c1y = vdupq_n_f32(c1.y), c2y = vdupq_n_f32(c2.y), c3y = vdupq_n_f32(c3.y);
+    static const float t_offsets[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    const float32x4_t t_offsets_v = vld1q_f32(t_offsets);
+    for (; i + 4 <= num_segments; i += 4, out_ptr += 4)
     {
-        path->push_back(ImVec2(x4, y4));
+        const float32x4_t t = vmulq_n_f32(vaddq_f32(vdupq_n_f32((float)i), t_offsets_v), t_step);
+        float32x4x2_t xy;
+        xy.val[0] = vaddq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vaddq_f32(vmulq_f32(c3x, t), c2x), t), c1x), t), c0x);
+        xy.val[1] = vaddq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vaddq_f32(vmulq_f32(c3y, t), c2y), t), c1y), t), c0y);
+        vst2q_f32(&out_ptr->x, xy);
     }
-    else if (level < 10)
+#endif
+    for (; i < num_segments; i++, out_ptr++)
     {
-        float x12 = (x1 + x2) * 0.5f, y12 = (y1 + y2) * 0.5f;
-        float x23 = (x2 + x3) * 0.5f, y23 = (y2 + y3) * 0.5f;
-        float x34 = (x3 + x4) * 0.5f, y34 = (y3 + y4) * 0.5f;
-        float x123 = (x12 + x23) * 0.5f, y123 = (y12 + y23) * 0.5f;
-        float x234 = (x23 + x34) * 0.5f, y234 = (y23 + y34) * 0.5f;
-        float x1234 = (x123 + x234) * 0.5f, y1234 = (y123 + y234) * 0.5f;
-        PathBezierCubicCurveToCasteljau(path, x1, y1, x12, y12, x123, y123, x1234, y1234, tess_tol, level + 1);
-        PathBezierCubicCurveToCasteljau(path, x1234, y1234, x234, y234, x34, y34, x4, y4, tess_tol, level + 1);
+        const float t = (float)i * t_step;
+        out_ptr->x = ((c3.x * t + c2.x) * t + c1.x) * t + c0.x;
+        out_ptr->y = ((c3.y * t + c2.y) * t + c1.y) * t + c0.y;
     }
+    *out_ptr = p_end;
 }
 
-static void PathBezierQuadraticCurveToCasteljau(ImVector<ImVec2>* path, float x1, float y1, float x2, float y2, float x3, float y3, float tess_tol, int level)
+// Auto-tessellated curves use a uniform segment count derived from the curve second differences (Wang's formula).
+// This guarantees a maximum distance of 'sqrt(tess_tol)' between the curve and its polyline, which is the same bound the former
+// recursive subdivision was aiming at, without recursion and without its failure cases on looping curves.
+static int PathBezierCalcAutoSegmentCount(float second_diff_len, float degree_factor, float tess_tol)
 {
-    float dx = x3 - x1, dy = y3 - y1;
-    float det = (x2 - x3) * dy - (y2 - y3) * dx;
-    if (det * det * 4.0f < tess_tol * (dx * dx + dy * dy))
-    {
-        path->push_back(ImVec2(x3, y3));
-    }
-    else if (level < 10)
-    {
-        float x12 = (x1 + x2) * 0.5f, y12 = (y1 + y2) * 0.5f;
-        float x23 = (x2 + x3) * 0.5f, y23 = (y2 + y3) * 0.5f;
-        float x123 = (x12 + x23) * 0.5f, y123 = (y12 + y23) * 0.5f;
-        PathBezierQuadraticCurveToCasteljau(path, x1, y1, x12, y12, x123, y123, tess_tol, level + 1);
-        PathBezierQuadraticCurveToCasteljau(path, x123, y123, x23, y23, x3, y3, tess_tol, level + 1);
-    }
+    const int num_segments = (int)ImCeil(ImSqrt(degree_factor * second_diff_len / ImSqrt(tess_tol)));
+    return ImClamp(num_segments, 1, IM_DRAWLIST_CURVE_AUTO_SEGMENT_MAX);
 }
 
 void ImDrawList::PathBezierCubicCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments)
@@ -1346,14 +1716,18 @@ void ImDrawList::PathBezierCubicCurveTo(const ImVec2& p2, const ImVec2& p3, cons
     if (num_segments == 0)
     {
         IM_ASSERT(_Data->CurveTessellationTol > 0.0f);
-        PathBezierCubicCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, p4.x, p4.y, _Data->CurveTessellationTol, 0); // Auto-tessellated
-    }
-    else
-    {
-        float t_step = 1.0f / (float)num_segments;
-        for (int i_step = 1; i_step <= num_segments; i_step++)
-            _Path.push_back(ImBezierCubicCalc(p1, p2, p3, p4, t_step * i_step));
+        const ImVec2 dd1 = p1 - p2 * 2.0f + p3;
+        const ImVec2 dd2 = p2 - p3 * 2.0f + p4;
+        const float second_diff_len = ImSqrt(ImMax(ImLengthSqr(dd1), ImLengthSqr(dd2)));
+        num_segments = PathBezierCalcAutoSegmentCount(second_diff_len, 3.0f * 2.0f / 8.0f, _Data->CurveTessellationTol); // Auto-tessellated
     }
+
+    // Power basis relative to p1: B(t) = p1 + 3(p2-p1)t + 3(p1-2p2+p3)t^2 + (p4-p1+3(p2-p3))t^3
+    const ImVec2 d21 = p2 - p1;
+    const ImVec2 c1 = d21 * 3.0f;
+    const ImVec2 c2 = (p3 - p2 - d21) * 3.0f;
+    const ImVec2 c3 = p4 - p1 + (p2 - p3) * 3.0f;
+    PathPolynomialCurveTo(&_Path, p1, c1, c2, c3, p4, num_segments);
 }
 
 void ImDrawList::PathBezierQuadraticCurveTo(const ImVec2& p2, const ImVec2& p3, int num_segments)
@@ -1362,14 +1736,13 @@ void ImDrawList::PathBezierQuadraticCurveTo(const ImVec2& p2, const ImVec2& p3,
     if (num_segments == 0)
     {
         IM_ASSERT(_Data->CurveTessellationTol > 0.0f);
-        PathBezierQuadraticCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, _Data->CurveTessellationTol, 0);// Auto-tessellated
-    }
-    else
-    {
-        float t_step = 1.0f / (float)num_segments;
-        for (int i_step = 1; i_step <= num_segments; i_step++)
-            _Path.push_back(ImBezierQuadraticCalc(p1, p2, p3, t_step * i_step));
+        const float second_diff_len = ImSqrt(ImLengthSqr(p1 - p2 * 2.0f + p3));
+        num_segments = PathBezierCalcAutoSegmentCount(second_diff_len, 2.0f * 1.0f / 8.0f, _Data->CurveTessellationTol); // Auto-tessellated
     }
+
+    // Power basis relative to p1: B(t) = p1 + 2(p2-p1)t + (p1-2p2+p3)t^2
+    const ImVec2 d21 = p2 - p1;
+    PathPolynomialCurveTo(&_Path, p1, d21 * 2.0f, p3 - p2 - d21, ImVec2(0.0f, 0.0f), p3, num_segments);
 }
 
 static inline ImDrawFlags FixRectCornerFlags(ImDrawFlags flags)
@@ -1396,13 +1769,19 @@ static inline ImDrawFlags FixRectCornerFlags(ImDrawFlags flags)
     return flags;
 }
 
+static inline float ClampRectRounding(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
+{
+    rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
+    rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
+    return rounding;
+}
+
 void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
 {
     if (rounding >= 0.5f)
     {
         flags = FixRectCornerFlags(flags);
-        rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
-        rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
+        rounding = ClampRectRounding(a, b, rounding, flags);
     }
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
@@ -1457,6 +1836,25 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
     }
     else
     {
+        if (Flags & ImDrawListFlags_AnalyticShapes)
+        {
+            // Corner radius is encoded relative to the smallest half size, which PathRect() allows to exceed when only one corner is rounded.
+            flags = FixRectCornerFlags(flags);
+            const float rounding_clamped = ClampRectRounding(p_min, p_max, rounding, flags);
+            const ImVec2 half_size = (p_max - p_min) * 0.5f;
+            const float rounding_ratio = rounding_clamped / ImMin(half_size.x, half_size.y);
+            if (rounding_clamped >= 0.5f && rounding_ratio <= 1.0f)
+            {
+                int corners = 0;
+                if (flags & ImDrawFlags_RoundCornersTopLeft)     corners |= 1;
+                if (flags & ImDrawFlags_RoundCornersTopRight)    corners |= 2;
+                if (flags & ImDrawFlags_RoundCornersBottomLeft)  corners |= 4;
+                if (flags & ImDrawFlags_RoundCornersBottomRight) corners |= 8;
+                const int rounding_code = (int)(ImSqrt(rounding_ratio) * IM_DRAWLIST_SHAPE_ROUNDING_STEPS + 0.5f);
+                if (_AddAnalyticShape((p_min + p_max) * 0.5f, half_size, 1.0f, 0.0f, IM_DRAWLIST_SHAPE_RECT_ROUNDED + corners, rounding_code, col))
+                    return;
+            }
+        }
         PathRect(p_min, p_max, rounding, flags);
         PathFillConvex(col);
     }
@@ -1555,6 +1953,9 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
 
     if (num_segments <= 0)
     {
+        if ((Flags & ImDrawListFlags_AnalyticShapes) && _AddAnalyticShape(center, ImVec2(radius, radius), 1.0f, 0.0f, IM_DRAWLIST_SHAPE_ELLIPSE, 0, col))
+            return;
+
         // Use arc with automatic segment count
         _PathArcToFastEx(center, radius, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, 0);
         _Path.Size--;
@@ -1596,6 +1997,31 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
     PathFillConvex(col);
 }
 
+// Output a filled shape as a single quad, to be shaded by the renderer (see "Analytic shapes" in imgui.h). Return false if it can't be.
+// - 'half_size' is along local axes, rotated by the angle given by 'rot_cos'/'rot_sin'.
+// - Only available with the font atlas texture, which has all valid UV <= 1.0f and lets the renderer use a different shader for it.
+// - The quad extends by one fringe width beyond the shape edges, shapes too small for this to be encoded are tessellated.
+bool ImDrawList::_AddAnalyticShape(const ImVec2& center, const ImVec2& half_size, float rot_cos, float rot_sin, int shape_code, int rounding_code, ImU32 col)
+{
+    IM_ASSERT_PARANOID(shape_code >= 0 && rounding_code >= 0 && rounding_code <= IM_DRAWLIST_SHAPE_ROUNDING_STEPS);
+    if (!(Flags & ImDrawListFlags_AntiAliasedFill) || _Data->Font == NULL || _CmdHeader.TextureId != _Data->Font->ContainerAtlas->TexID)
+        return false;
+    const float aa_size = _FringeScale;
+    const ImVec2 extent(half_size.x + aa_size, half_size.y + aa_size);
+    if (extent.x > half_size.x * IM_DRAWLIST_SHAPE_MAX_EXTENT || extent.y > half_size.y * IM_DRAWLIST_SHAPE_MAX_EXTENT)
+        return false;
+
+    // Quad corners and their position in normalized space, encoded in UV fractional part
+    const ImVec2 ax(rot_cos * extent.x, rot_sin * extent.x);
+    const ImVec2 ay(-rot_sin * extent.y, rot_cos * extent.y);
+    const float u0 = (float)(IM_DRAWLIST_SHAPE_UV_BASE + shape_code) + 0.5f, du = 0.25f * extent.x / half_size.x;
+    const float v0 = (float)(IM_DRAWLIST_SHAPE_UV_BASE + rounding_code) + 0.5f, dv = 0.25f * extent.y / half_size.y;
+    PrimReserve(6, 4);
+    PrimQuadUV(center - ax - ay, center + ax - ay, center + ax + ay, center - ax + ay,
+        ImVec2(u0 - du, v0 - dv), ImVec2(u0 + du, v0 - dv), ImVec2(u0 + du, v0 + dv), ImVec2(u0 - du, v0 + dv), col);
+    return true;
+}
+
 // Ellipse
 void ImDrawList::AddEllipse(const ImVec2& center, const ImVec2& radius, ImU32 col, float rot, int num_segments, float thickness)
 {
@@ -1617,7 +2043,11 @@ void ImDrawList::AddEllipseFilled(const ImVec2& center, const ImVec2& radius, Im
         return;
 
     if (num_segments <= 0)
+    {
+        if ((Flags & ImDrawListFlags_AnalyticShapes) && _AddAnalyticShape(center, ImVec2(ImFabs(radius.x), ImFabs(radius.y)), ImCos(rot), ImSin(rot), IM_DRAWLIST_SHAPE_ELLIPSE, 0, col))
+            return;
         num_segments = _CalcCircleAutoSegmentCount(ImMax(radius.x, radius.y)); // A bit pessimistic, maybe there's a better computation to do here.
+    }
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = IM_PI * 2.0f * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1741,219 +2171,1097 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
 }
 
 //-----------------------------------------------------------------------------
-// [SECTION] ImTriangulator, ImDrawList concave polygon fill
-//-----------------------------------------------------------------------------
-// Triangulate concave polygons. Based on "Triangulation by Ear Clipping" paper, O(N^2) complexity.
-// Reference: https://www.geometrictools.com/Documentation/TriangulationByEarClipping.pdf
-// Provided as a convenience for user but not used by main library.
+// Batched primitives
 //-----------------------------------------------------------------------------
-// - ImTriangulator [Internal]
-// - AddConcavePolyFilled()
+// - Output the same geometry as calling AddRectFilled(), AddLine(), AddCircleFilled()/AddNgonFilled(), AddImage() in a loop,
+//   but reserve once per chunk of shapes and skip shapes which are fully outside of the current clipping rectangle.
+// - Chunks are limited to IM_DRAWLIST_BATCH_VTX_MAX vertices so they can always be indexed with 16-bit indices.
 //-----------------------------------------------------------------------------
 
-enum ImTriangulatorNodeType
-{
-    ImTriangulatorNodeType_Convex,
-    ImTriangulatorNodeType_Ear,
-    ImTriangulatorNodeType_Reflex
-};
+#define IM_DRAWLIST_BATCH_VTX_MAX   16384
 
-struct ImTriangulatorNode
+// Release what wasn't used from the last PrimReserve() call.
+static inline void ImDrawList_BatchCommit(ImDrawList* draw_list, ImDrawVert* vtx_write, ImDrawIdx* idx_write, unsigned int vtx_current_idx)
 {
-    ImTriangulatorNodeType  Type;
-    int                     Index;
-    ImVec2                  Pos;
-    ImTriangulatorNode*     Next;
-    ImTriangulatorNode*     Prev;
+    draw_list->PrimUnreserve((int)(draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - idx_write), (int)(draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size - vtx_write));
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_current_idx;
+}
 
-    void    Unlink()        { Next->Prev = Prev; Prev->Next = Next; }
-};
+static inline bool ImDrawList_BatchIsClipped(const ImVec4& clip_rect, float x1, float y1, float x2, float y2, float pad)
+{
+    return ImMax(x1, x2) + pad <= clip_rect.x || ImMax(y1, y2) + pad <= clip_rect.y || ImMin(x1, x2) - pad >= clip_rect.z || ImMin(y1, y2) - pad >= clip_rect.w;
+}
 
-struct ImTriangulatorNodeSpan
+void ImDrawList::AddRectsFilled(const ImVec2* p_min, const ImVec2* p_max, int count, ImU32 col, const ImU32* cols)
 {
-    ImTriangulatorNode**    Data = NULL;
-    int                     Size = 0;
+    if (cols == NULL && (col & IM_COL32_A_MASK) == 0)
+        return;
 
-    void    push_back(ImTriangulatorNode* node) { Data[Size++] = node; }
-    void    find_erase_unsorted(int idx)        { for (int i = Size - 1; i >= 0; i--) if (Data[i]->Index == idx) { Data[i] = Data[Size - 1]; Size--; return; } }
-};
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    const int batch_max = IM_DRAWLIST_BATCH_VTX_MAX / 4;
+    for (int batch_begin = 0; batch_begin < count; batch_begin += batch_max)
+    {
+        const int batch_end = ImMin(batch_begin + batch_max, count);
+        PrimReserve((batch_end - batch_begin) * 6, (batch_end - batch_begin) * 4);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = batch_begin; n < batch_end; n++)
+        {
+            const ImVec2 a = p_min[n];
+            const ImVec2 c = p_max[n];
+            const ImU32 shape_col = cols ? cols[n] : col;
+            if ((shape_col & IM_COL32_A_MASK) == 0 || ImDrawList_BatchIsClipped(clip_rect, a.x, a.y, c.x, c.y, 0.0f))
+                continue;
+            idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+            idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            vtx_write[0].pos.x = a.x; vtx_write[0].pos.y = a.y; vtx_write[0].uv = uv; vtx_write[0].col = shape_col;
+            vtx_write[1].pos.x = c.x; vtx_write[1].pos.y = a.y; vtx_write[1].uv = uv; vtx_write[1].col = shape_col;
+            vtx_write[2].pos.x = c.x; vtx_write[2].pos.y = c.y; vtx_write[2].uv = uv; vtx_write[2].col = shape_col;
+            vtx_write[3].pos.x = a.x; vtx_write[3].pos.y = c.y; vtx_write[3].uv = uv; vtx_write[3].col = shape_col;
+            vtx_write += 4;
+            idx_write += 6;
+            idx += 4;
+        }
+        ImDrawList_BatchCommit(this, vtx_write, idx_write, idx);
+    }
+}
 
-struct ImTriangulator
+// Same geometry as AddPolyline() with two points, see comments there.
+void ImDrawList::AddLines(const ImVec2* p1, const ImVec2* p2, int count, ImU32 col, float thickness, const ImU32* cols)
 {
-    static int EstimateTriangleCount(int points_count)      { return (points_count < 3) ? 0 : points_count - 2; }
-    static int EstimateScratchBufferSize(int points_count)  { return sizeof(ImTriangulatorNode) * points_count + sizeof(ImTriangulatorNode*) * points_count * 2; }
+    if (cols == NULL && (col & IM_COL32_A_MASK) == 0)
+        return;
 
-    void    Init(const ImVec2* points, int points_count, void* scratch_buffer);
-    void    GetNextTriangle(unsigned int out_triangle[3]);     // Return relative indexes for next triangle
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    const bool thick_line = (thickness > _FringeScale);
+    const float AA_SIZE = _FringeScale;
+    if (anti_aliased)
+        thickness = ImMax(thickness, 1.0f);
+    const int integer_thickness = (int)thickness;
+    const float fractional_thickness = thickness - integer_thickness;
+    const bool use_texture = anti_aliased && (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+    ImVec2 tex_uv0 = opaque_uv, tex_uv1 = opaque_uv;
+    if (use_texture)
+    {
+        const ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness];
+        tex_uv0 = ImVec2(tex_uvs.x, tex_uvs.y);
+        tex_uv1 = ImVec2(tex_uvs.z, tex_uvs.w);
+    }
 
-    // Internal functions
-    void    BuildNodes(const ImVec2* points, int points_count);
-    void    BuildReflexes();
-    void    BuildEars();
-    void    FlipNodeList();
-    bool    IsEar(int i0, int i1, int i2, const ImVec2& v0, const ImVec2& v1, const ImVec2& v2) const;
-    void    ReclassifyNode(ImTriangulatorNode* node);
+    // Vertices per line end (or per line when not anti-aliased), indices per line
+    const int vtx_stride = !anti_aliased ? 4 : use_texture ? 2 : thick_line ? 4 : 3;
+    const int vtx_per_line = anti_aliased ? vtx_stride * 2 : 4;
+    const int idx_per_line = !anti_aliased ? 6 : use_texture ? 6 : thick_line ? 18 : 12;
+    const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
+    const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+    const float half_outer_thickness = half_inner_thickness + AA_SIZE;
+    const float clip_pad = thickness * 0.5f + AA_SIZE + 1.0f;
+
+    const int batch_max = IM_DRAWLIST_BATCH_VTX_MAX / vtx_per_line;
+    for (int batch_begin = 0; batch_begin < count; batch_begin += batch_max)
+    {
+        const int batch_end = ImMin(batch_begin + batch_max, count);
+        PrimReserve((batch_end - batch_begin) * idx_per_line, (batch_end - batch_begin) * vtx_per_line);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx1 = _VtxCurrentIdx;
+        for (int n = batch_begin; n < batch_end; n++)
+        {
+            // Same as AddLine()
+            const float x1 = p1[n].x + 0.5f, y1 = p1[n].y + 0.5f;
+            const float x2 = p2[n].x + 0.5f, y2 = p2[n].y + 0.5f;
+            const ImU32 shape_col = cols ? cols[n] : col;
+            if ((shape_col & IM_COL32_A_MASK) == 0 || ImDrawList_BatchIsClipped(clip_rect, x1, y1, x2, y2, clip_pad))
+                continue;
+            float dx = x2 - x1;
+            float dy = y2 - y1;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
 
-    // Internal members
-    int                     _TrianglesLeft = 0;
-    ImTriangulatorNode*     _Nodes = NULL;
-    ImTriangulatorNodeSpan  _Ears;
-    ImTriangulatorNodeSpan  _Reflexes;
-};
+            if (!anti_aliased)
+            {
+                // [PATH 4] Non texture-based, Non anti-aliased lines
+                dx *= (thickness * 0.5f);
+                dy *= (thickness * 0.5f);
+                vtx_write[0].pos.x = x1 + dy; vtx_write[0].pos.y = y1 - dx; vtx_write[0].uv = opaque_uv; vtx_write[0].col = shape_col;
+                vtx_write[1].pos.x = x2 + dy; vtx_write[1].pos.y = y2 - dx; vtx_write[1].uv = opaque_uv; vtx_write[1].col = shape_col;
+                vtx_write[2].pos.x = x2 - dy; vtx_write[2].pos.y = y2 + dx; vtx_write[2].uv = opaque_uv; vtx_write[2].col = shape_col;
+                vtx_write[3].pos.x = x1 - dy; vtx_write[3].pos.y = y1 + dx; vtx_write[3].uv = opaque_uv; vtx_write[3].col = shape_col;
+                vtx_write += 4;
+                idx_write[0] = (ImDrawIdx)(idx1); idx_write[1] = (ImDrawIdx)(idx1 + 1); idx_write[2] = (ImDrawIdx)(idx1 + 2);
+                idx_write[3] = (ImDrawIdx)(idx1); idx_write[4] = (ImDrawIdx)(idx1 + 2); idx_write[5] = (ImDrawIdx)(idx1 + 3);
+                idx_write += 6;
+                idx1 += 4;
+                continue;
+            }
 
-// Distribute storage for nodes, ears and reflexes.
-// FIXME-OPT: if everything is convex, we could report it to caller and let it switch to an convex renderer
-// (this would require first building reflexes to bail to convex if empty, without even building nodes)
-void ImTriangulator::Init(const ImVec2* points, int points_count, void* scratch_buffer)
-{
-    IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
-    _TrianglesLeft = EstimateTriangleCount(points_count);
-    _Nodes         = (ImTriangulatorNode*)scratch_buffer;                          // points_count x Node
-    _Ears.Data     = (ImTriangulatorNode**)(_Nodes + points_count);                // points_count x Node*
-    _Reflexes.Data = (ImTriangulatorNode**)(_Nodes + points_count) + points_count; // points_count x Node*
-    BuildNodes(points, points_count);
-    BuildReflexes();
-    BuildEars();
+            // Normal at each end: the first point uses the segment normal, the last point the fixed-up average of the segment normal with itself.
+            const float nx = dy, ny = -dx;
+            float dm_x = (nx + nx) * 0.5f;
+            float dm_y = (ny + ny) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            const float end_nx[2] = { nx, dm_x };
+            const float end_ny[2] = { ny, dm_y };
+            const float end_px[2] = { x1, x2 };
+            const float end_py[2] = { y1, y2 };
+            const ImU32 col_trans = shape_col & ~IM_COL32_A_MASK;
+            for (int e = 0; e < 2; e++)
+            {
+                const float px = end_px[e], py = end_py[e];
+                if (use_texture || !thick_line)
+                {
+                    const float ox = end_nx[e] * half_draw_size;
+                    const float oy = end_ny[e] * half_draw_size;
+                    if (use_texture)
+                    {
+                        vtx_write[0].pos.x = px + ox; vtx_write[0].pos.y = py + oy; vtx_write[0].uv = tex_uv0; vtx_write[0].col = shape_col;
+                        vtx_write[1].pos.x = px - ox; vtx_write[1].pos.y = py - oy; vtx_write[1].uv = tex_uv1; vtx_write[1].col = shape_col;
+                    }
+                    else
+                    {
+                        vtx_write[0].pos.x = px;      vtx_write[0].pos.y = py;      vtx_write[0].uv = opaque_uv; vtx_write[0].col = shape_col;
+                        vtx_write[1].pos.x = px + ox; vtx_write[1].pos.y = py + oy; vtx_write[1].uv = opaque_uv; vtx_write[1].col = col_trans;
+                        vtx_write[2].pos.x = px - ox; vtx_write[2].pos.y = py - oy; vtx_write[2].uv = opaque_uv; vtx_write[2].col = col_trans;
+                    }
+                }
+                else
+                {
+                    const float out_x = end_nx[e] * half_outer_thickness, out_y = end_ny[e] * half_outer_thickness;
+                    const float in_x = end_nx[e] * half_inner_thickness, in_y = end_ny[e] * half_inner_thickness;
+                    vtx_write[0].pos.x = px + out_x; vtx_write[0].pos.y = py + out_y; vtx_write[0].uv = opaque_uv; vtx_write[0].col = col_trans;
+                    vtx_write[1].pos.x = px + in_x;  vtx_write[1].pos.y = py + in_y;  vtx_write[1].uv = opaque_uv; vtx_write[1].col = shape_col;
+                    vtx_write[2].pos.x = px - in_x;  vtx_write[2].pos.y = py - in_y;  vtx_write[2].uv = opaque_uv; vtx_write[2].col = shape_col;
+                    vtx_write[3].pos.x = px - out_x; vtx_write[3].pos.y = py - out_y; vtx_write[3].uv = opaque_uv; vtx_write[3].col = col_trans;
+                }
+                vtx_write += vtx_stride;
+            }
+
+            const unsigned int idx2 = idx1 + vtx_stride;
+            if (use_texture)
+            {
+                idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 1);
+                idx_write[3] = (ImDrawIdx)(idx2 + 1); idx_write[4] = (ImDrawIdx)(idx1 + 1); idx_write[5] = (ImDrawIdx)(idx2 + 0);
+            }
+            else if (!thick_line)
+            {
+                idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 2);
+                idx_write[3] = (ImDrawIdx)(idx1 + 2); idx_write[4] = (ImDrawIdx)(idx2 + 2); idx_write[5] = (ImDrawIdx)(idx2 + 0);
+                idx_write[6] = (ImDrawIdx)(idx2 + 1); idx_write[7] = (ImDrawIdx)(idx1 + 1); idx_write[8] = (ImDrawIdx)(idx1 + 0);
+                idx_write[9] = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1);
+            }
+            else
+            {
+                idx_write[0]  = (ImDrawIdx)(idx2 + 1); idx_write[1]  = (ImDrawIdx)(idx1 + 1); idx_write[2]  = (ImDrawIdx)(idx1 + 2);
+                idx_write[3]  = (ImDrawIdx)(idx1 + 2); idx_write[4]  = (ImDrawIdx)(idx2 + 2); idx_write[5]  = (ImDrawIdx)(idx2 + 1);
+                idx_write[6]  = (ImDrawIdx)(idx2 + 1); idx_write[7]  = (ImDrawIdx)(idx1 + 1); idx_write[8]  = (ImDrawIdx)(idx1 + 0);
+                idx_write[9]  = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1);
+                idx_write[12] = (ImDrawIdx)(idx2 + 2); idx_write[13] = (ImDrawIdx)(idx1 + 2); idx_write[14] = (ImDrawIdx)(idx1 + 3);
+                idx_write[15] = (ImDrawIdx)(idx1 + 3); idx_write[16] = (ImDrawIdx)(idx2 + 3); idx_write[17] = (ImDrawIdx)(idx2 + 2);
+            }
+            idx_write += idx_per_line;
+            idx1 += vtx_per_line;
+        }
+        ImDrawList_BatchCommit(this, vtx_write, idx_write, idx1);
+    }
+}
+
+// The shape is tessellated once, with the same points and anti-aliasing fringe as AddCircleFilled()/AddConvexPolyFilled(), then translated to each center.
+void ImDrawList::AddCirclesFilled(const ImVec2* centers, int count, float radius, ImU32 col, int num_segments, const ImU32* cols)
+{
+    if ((cols == NULL && (col & IM_COL32_A_MASK) == 0) || radius < 0.5f)
+        return;
+
+    // Build shape at origin in a temporary path (preserving the current path contents)
+    const int path_begin = _Path.Size;
+    if (num_segments <= 0)
+    {
+        _PathArcToFastEx(ImVec2(0.0f, 0.0f), radius, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, 0);
+        _Path.Size--;
+    }
+    else
+    {
+        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
+        PathArcTo(ImVec2(0.0f, 0.0f), radius, 0.0f, a_max, num_segments - 1);
+    }
+    const int points_count = _Path.Size - path_begin;
+    if (points_count < 3)
+    {
+        _Path.Size = path_begin;
+        return;
+    }
+
+    // Anti-aliased fill: compute inner and outer fringe offsets once
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    const int vtx_per_shape = anti_aliased ? points_count * 2 : points_count;
+    const int idx_per_shape = anti_aliased ? (points_count - 2) * 3 + points_count * 6 : (points_count - 2) * 3;
+    _Data->TempBuffer.reserve_discard(vtx_per_shape);
+    ImVec2* shape_offsets = _Data->TempBuffer.Data;
+    const ImVec2* points = _Path.Data + path_begin;
+    if (anti_aliased)
+    {
+        const float AA_SIZE = _FringeScale;
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            float dx = points[i1].x - points[i0].x;
+            float dy = points[i1].y - points[i0].y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            shape_offsets[i0 * 2 + 1].x = dy; // Temporarily store normal of edge i0->i1
+            shape_offsets[i0 * 2 + 1].y = -dx;
+        }
+        ImVec2 n0 = shape_offsets[(points_count - 1) * 2 + 1];
+        for (int i1 = 0; i1 < points_count; i1++)
+        {
+            const ImVec2 n1 = shape_offsets[i1 * 2 + 1];
+            float dm_x = (n0.x + n1.x) * 0.5f;
+            float dm_y = (n0.y + n1.y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            dm_x *= AA_SIZE * 0.5f;
+            dm_y *= AA_SIZE * 0.5f;
+            shape_offsets[i1 * 2 + 0] = ImVec2(points[i1].x - dm_x, points[i1].y - dm_y); // Inner
+            shape_offsets[i1 * 2 + 1] = ImVec2(points[i1].x + dm_x, points[i1].y + dm_y); // Outer
+            n0 = n1;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < points_count; i++)
+            shape_offsets[i] = points[i];
+    }
+    _Path.Size = path_begin;
+
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    const float clip_pad = radius + _FringeScale;
+    const int batch_max = ImMax(IM_DRAWLIST_BATCH_VTX_MAX / vtx_per_shape, 1);
+    for (int batch_begin = 0; batch_begin < count; batch_begin += batch_max)
+    {
+        const int batch_end = ImMin(batch_begin + batch_max, count);
+        PrimReserve((batch_end - batch_begin) * idx_per_shape, (batch_end - batch_begin) * vtx_per_shape);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = batch_begin; n < batch_end; n++)
+        {
+            const float cx = centers[n].x, cy = centers[n].y;
+            const ImU32 shape_col = cols ? cols[n] : col;
+            if ((shape_col & IM_COL32_A_MASK) == 0 || ImDrawList_BatchIsClipped(clip_rect, cx, cy, cx, cy, clip_pad))
+                continue;
+            if (anti_aliased)
+            {
+                // Same as AddConvexPolyFilled(): fill, then fringes
+                const ImU32 col_trans = shape_col & ~IM_COL32_A_MASK;
+                for (int i = 0; i < vtx_per_shape; i += 2)
+                {
+                    vtx_write[i + 0].pos.x = cx + shape_offsets[i + 0].x; vtx_write[i + 0].pos.y = cy + shape_offsets[i + 0].y; vtx_write[i + 0].uv = uv; vtx_write[i + 0].col = shape_col; // Inner
+                    vtx_write[i + 1].pos.x = cx + shape_offsets[i + 1].x; vtx_write[i + 1].pos.y = cy + shape_offsets[i + 1].y; vtx_write[i + 1].uv = uv; vtx_write[i + 1].col = col_trans; // Outer
+                }
+                for (int i = 2; i < points_count; i++)
+                {
+                    idx_write[0] = (ImDrawIdx)(idx); idx_write[1] = (ImDrawIdx)(idx + ((i - 1) << 1)); idx_write[2] = (ImDrawIdx)(idx + (i << 1));
+                    idx_write += 3;
+                }
+                for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+                {
+                    const unsigned int inner0 = idx + (i0 << 1), inner1 = idx + (i1 << 1);
+                    idx_write[0] = (ImDrawIdx)(inner1);     idx_write[1] = (ImDrawIdx)(inner0);     idx_write[2] = (ImDrawIdx)(inner0 + 1);
+                    idx_write[3] = (ImDrawIdx)(inner0 + 1); idx_write[4] = (ImDrawIdx)(inner1 + 1); idx_write[5] = (ImDrawIdx)(inner1);
+                    idx_write += 6;
+                }
+            }
+            else
+            {
+                for (int i = 0; i < vtx_per_shape; i++)
+                {
+                    vtx_write[i].pos.x = cx + shape_offsets[i].x; vtx_write[i].pos.y = cy + shape_offsets[i].y; vtx_write[i].uv = uv; vtx_write[i].col = shape_col;
+                }
+                for (int i = 2; i < points_count; i++)
+                {
+                    idx_write[0] = (ImDrawIdx)(idx); idx_write[1] = (ImDrawIdx)(idx + i - 1); idx_write[2] = (ImDrawIdx)(idx + i);
+                    idx_write += 3;
+                }
+            }
+            vtx_write += vtx_per_shape;
+            idx += vtx_per_shape;
+        }
+        ImDrawList_BatchCommit(this, vtx_write, idx_write, idx);
+    }
+}
+
+void ImDrawList::AddImages(ImTextureID user_texture_id, const ImVec2* p_min, const ImVec2* p_max, const ImVec2* uv_min, const ImVec2* uv_max, int count, ImU32 col, const ImU32* cols)
+{
+    if (cols == NULL && (col & IM_COL32_A_MASK) == 0)
+        return;
+
+    const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
+    if (push_texture_id)
+        PushTextureID(user_texture_id);
+
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const int batch_max = IM_DRAWLIST_BATCH_VTX_MAX / 4;
+    for (int batch_begin = 0; batch_begin < count; batch_begin += batch_max)
+    {
+        const int batch_end = ImMin(batch_begin + batch_max, count);
+        PrimReserve((batch_end - batch_begin) * 6, (batch_end - batch_begin) * 4);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = batch_begin; n < batch_end; n++)
+        {
+            const ImVec2 a = p_min[n];
+            const ImVec2 c = p_max[n];
+            const ImU32 shape_col = cols ? cols[n] : col;
+            if ((shape_col & IM_COL32_A_MASK) == 0 || ImDrawList_BatchIsClipped(clip_rect, a.x, a.y, c.x, c.y, 0.0f))
+                continue;
+            const ImVec2 uv_a = uv_min ? uv_min[n] : ImVec2(0.0f, 0.0f);
+            const ImVec2 uv_c = uv_max ? uv_max[n] : ImVec2(1.0f, 1.0f);
+            idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+            idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            vtx_write[0].pos.x = a.x; vtx_write[0].pos.y = a.y; vtx_write[0].uv.x = uv_a.x; vtx_write[0].uv.y = uv_a.y; vtx_write[0].col = shape_col;
+            vtx_write[1].pos.x = c.x; vtx_write[1].pos.y = a.y; vtx_write[1].uv.x = uv_c.x; vtx_write[1].uv.y = uv_a.y; vtx_write[1].col = shape_col;
+            vtx_write[2].pos.x = c.x; vtx_write[2].pos.y = c.y; vtx_write[2].uv.x = uv_c.x; vtx_write[2].uv.y = uv_c.y; vtx_write[2].col = shape_col;
+            vtx_write[3].pos.x = a.x; vtx_write[3].pos.y = c.y; vtx_write[3].uv.x = uv_a.x; vtx_write[3].uv.y = uv_c.y; vtx_write[3].col = shape_col;
+            vtx_write += 4;
+            idx_write += 6;
+            idx += 4;
+        }
+        ImDrawList_BatchCommit(this, vtx_write, idx_write, idx);
+    }
+
+    if (push_texture_id)
+        PopTextureID();
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImTriangulator, ImDrawList concave polygon fill
+//-----------------------------------------------------------------------------
+// Triangulate concave polygons. Based on "Triangulation by Ear Clipping" paper, O(N^2) complexity.
+// Reference: https://www.geometrictools.com/Documentation/TriangulationByEarClipping.pdf
+// Provided as a convenience for user but not used by main library.
+//-----------------------------------------------------------------------------
+// - ImTriangulator [Internal]
+// - ImTriangulatorMonotone [Internal]
+// - AddConcavePolyFilled()
+//-----------------------------------------------------------------------------
+
+enum ImTriangulatorNodeType
+{
+    ImTriangulatorNodeType_Convex,
+    ImTriangulatorNodeType_Ear,
+    ImTriangulatorNodeType_Reflex
+};
+
+struct ImTriangulatorNode
+{
+    ImTriangulatorNodeType  Type;
+    int                     Index;
+    ImVec2                  Pos;
+    ImTriangulatorNode*     Next;
+    ImTriangulatorNode*     Prev;
+
+    void    Unlink()        { Next->Prev = Prev; Prev->Next = Next; }
+};
+
+struct ImTriangulatorNodeSpan
+{
+    ImTriangulatorNode**    Data = NULL;
+    int                     Size = 0;
+
+    void    push_back(ImTriangulatorNode* node) { Data[Size++] = node; }
+    void    find_erase_unsorted(int idx)        { for (int i = Size - 1; i >= 0; i--) if (Data[i]->Index == idx) { Data[i] = Data[Size - 1]; Size--; return; } }
+};
+
+struct ImTriangulator
+{
+    static int EstimateTriangleCount(int points_count)      { return (points_count < 3) ? 0 : points_count - 2; }
+    static int EstimateScratchBufferSize(int points_count)  { return sizeof(ImTriangulatorNode) * points_count + sizeof(ImTriangulatorNode*) * points_count * 2; }
+
+    void    Init(const ImVec2* points, int points_count, void* scratch_buffer);
+    void    GetNextTriangle(unsigned int out_triangle[3]);     // Return relative indexes for next triangle
+
+    // Internal functions
+    void    BuildNodes(const ImVec2* points, int points_count);
+    void    BuildReflexes();
+    void    BuildEars();
+    void    FlipNodeList();
+    bool    IsEar(int i0, int i1, int i2, const ImVec2& v0, const ImVec2& v1, const ImVec2& v2) const;
+    void    ReclassifyNode(ImTriangulatorNode* node);
+
+    // Internal members
+    int                     _TrianglesLeft = 0;
+    ImTriangulatorNode*     _Nodes = NULL;
+    ImTriangulatorNodeSpan  _Ears;
+    ImTriangulatorNodeSpan  _Reflexes;
+};
+
+// Distribute storage for nodes, ears and reflexes.
+void ImTriangulator::Init(const ImVec2* points, int points_count, void* scratch_buffer)
+{
+    IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
+    _TrianglesLeft = EstimateTriangleCount(points_count);
+    _Nodes         = (ImTriangulatorNode*)scratch_buffer;                          // points_count x Node
+    _Ears.Data     = (ImTriangulatorNode**)(_Nodes + points_count);                // points_count x Node*
+    _Reflexes.Data = (ImTriangulatorNode**)(_Nodes + points_count) + points_count; // points_count x Node*
+    BuildNodes(points, points_count);
+
+    // Ears are found by looking for clockwise turns (with Y pointing down). Flip counter-clockwise polygons first, else ears would be taken outside of them.
+    float area2 = 0.0f;
+    for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        area2 += points[i0].x * points[i1].y - points[i1].x * points[i0].y;
+    if (area2 < 0.0f)
+        FlipNodeList();
+    BuildReflexes();
+    BuildEars();
+}
+
+void ImTriangulator::BuildNodes(const ImVec2* points, int points_count)
+{
+    for (int i = 0; i < points_count; i++)
+    {
+        _Nodes[i].Type = ImTriangulatorNodeType_Convex;
+        _Nodes[i].Index = i;
+        _Nodes[i].Pos = points[i];
+        _Nodes[i].Next = _Nodes + i + 1;
+        _Nodes[i].Prev = _Nodes + i - 1;
+    }
+    _Nodes[0].Prev = _Nodes + points_count - 1;
+    _Nodes[points_count - 1].Next = _Nodes;
+}
+
+void ImTriangulator::BuildReflexes()
+{
+    ImTriangulatorNode* n1 = _Nodes;
+    for (int i = _TrianglesLeft; i >= 0; i--, n1 = n1->Next)
+    {
+        if (ImTriangleIsClockwise(n1->Prev->Pos, n1->Pos, n1->Next->Pos))
+            continue;
+        n1->Type = ImTriangulatorNodeType_Reflex;
+        _Reflexes.push_back(n1);
+    }
+}
+
+void ImTriangulator::BuildEars()
+{
+    ImTriangulatorNode* n1 = _Nodes;
+    for (int i = _TrianglesLeft; i >= 0; i--, n1 = n1->Next)
+    {
+        if (n1->Type != ImTriangulatorNodeType_Convex)
+            continue;
+        if (!IsEar(n1->Prev->Index, n1->Index, n1->Next->Index, n1->Prev->Pos, n1->Pos, n1->Next->Pos))
+            continue;
+        n1->Type = ImTriangulatorNodeType_Ear;
+        _Ears.push_back(n1);
+    }
+}
+
+void ImTriangulator::GetNextTriangle(unsigned int out_triangle[3])
+{
+    if (_Ears.Size == 0)
+    {
+        FlipNodeList();
+
+        ImTriangulatorNode* node = _Nodes;
+        for (int i = _TrianglesLeft; i >= 0; i--, node = node->Next)
+            node->Type = ImTriangulatorNodeType_Convex;
+        _Reflexes.Size = 0;
+        BuildReflexes();
+        BuildEars();
+
+        // If we still don't have ears, it means geometry is degenerated.
+        if (_Ears.Size == 0)
+        {
+            // Return first triangle available, mimicking the behavior of convex fill.
+            IM_ASSERT(_TrianglesLeft > 0); // Geometry is degenerated
+            _Ears.Data[0] = _Nodes;
+            _Ears.Size    = 1;
+        }
+    }
+
+    ImTriangulatorNode* ear = _Ears.Data[--_Ears.Size];
+    out_triangle[0] = ear->Prev->Index;
+    out_triangle[1] = ear->Index;
+    out_triangle[2] = ear->Next->Index;
+
+    ear->Unlink();
+    if (ear == _Nodes)
+        _Nodes = ear->Next;
+
+    ReclassifyNode(ear->Prev);
+    ReclassifyNode(ear->Next);
+    _TrianglesLeft--;
+}
+
+void ImTriangulator::FlipNodeList()
+{
+    ImTriangulatorNode* prev = _Nodes;
+    ImTriangulatorNode* temp = _Nodes;
+    ImTriangulatorNode* current = _Nodes->Next;
+    prev->Next = prev;
+    prev->Prev = prev;
+    while (current != _Nodes)
+    {
+        temp = current->Next;
+
+        current->Next = prev;
+        prev->Prev = current;
+        _Nodes->Next = current;
+        current->Prev = _Nodes;
+
+        prev = current;
+        current = temp;
+    }
+    _Nodes = prev;
+}
+
+// A triangle is an ear is no other vertex is inside it. We can test reflexes vertices only (see reference algorithm)
+bool ImTriangulator::IsEar(int i0, int i1, int i2, const ImVec2& v0, const ImVec2& v1, const ImVec2& v2) const
+{
+    ImTriangulatorNode** p_end = _Reflexes.Data + _Reflexes.Size;
+    for (ImTriangulatorNode** p = _Reflexes.Data; p < p_end; p++)
+    {
+        ImTriangulatorNode* reflex = *p;
+        if (reflex->Index != i0 && reflex->Index != i1 && reflex->Index != i2)
+            if (ImTriangleContainsPoint(v0, v1, v2, reflex->Pos))
+                return false;
+    }
+    return true;
+}
+
+void ImTriangulator::ReclassifyNode(ImTriangulatorNode* n1)
+{
+    // Classify node
+    ImTriangulatorNodeType type;
+    const ImTriangulatorNode* n0 = n1->Prev;
+    const ImTriangulatorNode* n2 = n1->Next;
+    if (!ImTriangleIsClockwise(n0->Pos, n1->Pos, n2->Pos))
+        type = ImTriangulatorNodeType_Reflex;
+    else if (IsEar(n0->Index, n1->Index, n2->Index, n0->Pos, n1->Pos, n2->Pos))
+        type = ImTriangulatorNodeType_Ear;
+    else
+        type = ImTriangulatorNodeType_Convex;
+
+    // Update lists when a type changes
+    if (type == n1->Type)
+        return;
+    if (n1->Type == ImTriangulatorNodeType_Reflex)
+        _Reflexes.find_erase_unsorted(n1->Index);
+    else if (n1->Type == ImTriangulatorNodeType_Ear)
+        _Ears.find_erase_unsorted(n1->Index);
+    if (type == ImTriangulatorNodeType_Reflex)
+        _Reflexes.push_back(n1);
+    else if (type == ImTriangulatorNodeType_Ear)
+        _Ears.push_back(n1);
+    n1->Type = type;
+}
+
+//-----------------------------------------------------------------------------
+// Triangulate concave polygons by decomposing them into y-monotone pieces, O(N log N) complexity.
+// Reference: de Berg et al. "Computational Geometry: Algorithms and Applications", chapter 3.
+// - Sweep vertices from top to bottom, adding diagonals at split/merge vertices. Edges crossed by the sweep line are kept in a sorted array.
+// - Walk the faces of the resulting subdivision (half-edges sorted around each vertex).
+// - Triangulate each y-monotone face in linear time with a stack.
+// Works on a simple polygon with either winding. Degenerate input (e.g. self-intersecting) is reported so caller can use ImTriangulator.
+//-----------------------------------------------------------------------------
+
+enum ImTriangulatorMonotoneVtxType
+{
+    ImTriangulatorMonotoneVtxType_Regular,
+    ImTriangulatorMonotoneVtxType_Start,
+    ImTriangulatorMonotoneVtxType_End,
+    ImTriangulatorMonotoneVtxType_Split,
+    ImTriangulatorMonotoneVtxType_Merge,
+};
+
+struct ImTriangulatorMonotoneSweepItem
+{
+    float   Y, X;
+    int     Index;
+};
+
+struct ImTriangulatorMonotoneHalfEdge
+{
+    int     Origin;
+    int     Dest;
+    int     Slot;       // Position in list of half-edges sorted around Origin
+    float   Angle;      // Pseudo-angle of Dest-Origin, in [0,4)
+};
+
+struct ImTriangulatorMonotone
+{
+    static int EstimateScratchBufferSize(int points_count)  { return (int)(sizeof(ImVec2) + sizeof(ImTriangulatorMonotoneSweepItem) + sizeof(int) * 13 + sizeof(ImTriangulatorMonotoneHalfEdge) * 4) * points_count + (int)sizeof(int) * 5; }
+
+    // Write (points_count - 2) triangles to out_idx, vertex 'i' being written as 'idx_base + (i << idx_shift)'.
+    // Return false if polygon is degenerate, in which case out_idx contents are undefined.
+    bool    Triangulate(const ImVec2* points, int points_count, void* scratch_buffer, ImDrawIdx* out_idx, unsigned int idx_base, int idx_shift);
+
+    // Internal functions
+    float   EdgeXAt(int edge, float y) const;
+    int     StatusFindLeftOf(int vtx) const;
+    void    StatusInsert(int edge);
+    void    StatusErase(int edge);
+    void    AddDiagonal(int a, int b);
+    bool    BuildDiagonals();
+    bool    BuildHalfEdges();
+    bool    TriangulateFace(int* face, int face_size);
+    void    EmitTriangle(int a, int b, int c)   { _IdxWrite[0] = (ImDrawIdx)(_IdxBase + (_Order[a] << _IdxShift)); _IdxWrite[1] = (ImDrawIdx)(_IdxBase + (_Order[b] << _IdxShift)); _IdxWrite[2] = (ImDrawIdx)(_IdxBase + (_Order[c] << _IdxShift)); _IdxWrite += 3; }
+
+    // Internal members
+    int                     _Count = 0;
+    const int*              _Order = NULL;      // [_Count] Original point index of each vertex. Vertices are in counter-clockwise order (with Y pointing up).
+    ImVec2*                 _Pos = NULL;        // [_Count] Position, with Y pointing up
+    int*                    _Rank = NULL;       // [_Count] Position in sweep order (0 == top)
+    int*                    _Sorted = NULL;     // [_Count] Vertices in sweep order
+    int*                    _Type = NULL;       // [_Count] ImTriangulatorMonotoneVtxType
+    int*                    _Helper = NULL;     // [_Count] Helper vertex of each edge (edge 'i' goes from vertex 'i' to vertex 'i + 1')
+    int*                    _Status = NULL;     // [_Count] Edges crossed by sweep line, with interior on their right, sorted left to right
+    int                     _StatusSize = 0;
+    int*                    _Diagonals = NULL;  // [(_Count + 2) * 2]
+    int                     _DiagonalsCount = 0;
+    ImTriangulatorMonotoneHalfEdge* _HalfEdges = NULL;  // [(_Count + _DiagonalsCount) * 2] Half-edge 'h' twin is 'h ^ 1'. Interior of polygon is on the left of even ones of first _Count * 2.
+    int*                    _VtxHalfEdges = NULL;       // [(_Count + _DiagonalsCount) * 2] Half-edges sorted by origin, then by angle
+    int*                    _VtxHalfEdgesOffset = NULL; // [_Count + 1]
+    ImDrawIdx*              _IdxWrite = NULL;
+    unsigned int            _IdxBase = 0;
+    int                     _IdxShift = 0;
+};
+
+static int IMGUI_CDECL ImTriangulatorMonotoneSweepItemComparer(const void* lhs, const void* rhs)
+{
+    const ImTriangulatorMonotoneSweepItem* a = (const ImTriangulatorMonotoneSweepItem*)lhs;
+    const ImTriangulatorMonotoneSweepItem* b = (const ImTriangulatorMonotoneSweepItem*)rhs;
+    if (a->Y != b->Y)
+        return (a->Y > b->Y) ? -1 : +1;
+    if (a->X != b->X)
+        return (a->X < b->X) ? -1 : +1;
+    return a->Index - b->Index;
+}
+
+// Cross product of (b - a) and (c - b): > 0 when a, b, c turn left (with Y pointing up)
+static inline float ImTriangleCross(const ImVec2& a, const ImVec2& b, const ImVec2& c)
+{
+    return (b.x - a.x) * (c.y - b.y) - (b.y - a.y) * (c.x - b.x);
+}
+
+// Monotonic with atan2(dy, dx) but cheaper
+static inline float ImTriangulatorMonotonePseudoAngle(float dx, float dy)
+{
+    const float d = ImFabs(dx) + ImFabs(dy);
+    if (d == 0.0f)
+        return 0.0f;
+    const float p = dx / d;
+    return (dy < 0.0f) ? 3.0f + p : 1.0f - p;
+}
+
+bool ImTriangulatorMonotone::Triangulate(const ImVec2* points, int points_count, void* scratch_buffer, ImDrawIdx* out_idx, unsigned int idx_base, int idx_shift)
+{
+    IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
+    const int n = points_count;
+    _Count = n;
+    _Pos = (ImVec2*)scratch_buffer;
+    ImTriangulatorMonotoneSweepItem* sweep_items = (ImTriangulatorMonotoneSweepItem*)(void*)(_Pos + n);
+    int* order = (int*)(void*)(sweep_items + n);
+    _Order = order;
+    _Rank = order + n;
+    _Sorted = _Rank + n;
+    _Type = _Sorted + n;
+    _Helper = _Type + n;
+    _Status = _Helper + n;
+    _Diagonals = _Status + n;
+    _HalfEdges = (ImTriangulatorMonotoneHalfEdge*)(void*)(_Diagonals + (n + 2) * 2);
+    _VtxHalfEdges = (int*)(void*)(_HalfEdges + n * 4);
+    _VtxHalfEdgesOffset = _VtxHalfEdges + n * 4;
+    _StatusSize = _DiagonalsCount = 0;
+    _IdxWrite = out_idx;
+    _IdxBase = idx_base;
+    _IdxShift = idx_shift;
+
+    // Flip Y axis to use the usual conventions, and reverse order of points if needed to make polygon counter-clockwise
+    float area2 = 0.0f;
+    for (int i0 = n - 1, i1 = 0; i1 < n; i0 = i1++)
+        area2 += points[i0].x * points[i1].y - points[i1].x * points[i0].y;
+    const bool reverse = (area2 > 0.0f); // Counter-clockwise with Y pointing down == clockwise with Y pointing up
+    for (int i = 0; i < n; i++)
+    {
+        order[i] = reverse ? n - 1 - i : i;
+        _Pos[i] = ImVec2(points[order[i]].x, -points[order[i]].y);
+        sweep_items[i].Y = _Pos[i].y;
+        sweep_items[i].X = _Pos[i].x;
+        sweep_items[i].Index = i;
+    }
+    ImQsort(sweep_items, (size_t)n, sizeof(ImTriangulatorMonotoneSweepItem), ImTriangulatorMonotoneSweepItemComparer);
+    for (int r = 0; r < n; r++)
+    {
+        _Sorted[r] = sweep_items[r].Index;
+        _Rank[sweep_items[r].Index] = r;
+    }
+
+    if (!BuildDiagonals() || !BuildHalfEdges())
+        return false;
+
+    // Walk faces. Reuse space of sweep items for face vertices and visited flags.
+    int* face = (int*)(void*)sweep_items;
+    char* visited = (char*)(void*)(face + n);
+    const int half_edges_count = (n + _DiagonalsCount) * 2;
+    IM_ASSERT(sizeof(ImTriangulatorMonotoneSweepItem) * n >= sizeof(int) * n + (size_t)half_edges_count);
+    memset(visited, 0, (size_t)half_edges_count);
+    for (int h_start = 0; h_start < half_edges_count; h_start++)
+    {
+        if (visited[h_start] || (h_start < n * 2 && (h_start & 1)))
+            continue;
+        int face_size = 0;
+        int h = h_start;
+        do
+        {
+            if (visited[h] || (h < n * 2 && (h & 1)) || face_size == n)
+                return false; // Reached outside of polygon
+            visited[h] = 1;
+            face[face_size++] = _HalfEdges[h].Origin;
+
+            // Next half-edge around face: previous one around destination, starting from twin
+            const ImTriangulatorMonotoneHalfEdge& twin = _HalfEdges[h ^ 1];
+            const int slot_begin = _VtxHalfEdgesOffset[twin.Origin];
+            const int slot_end = _VtxHalfEdgesOffset[twin.Origin + 1];
+            h = _VtxHalfEdges[(twin.Slot == slot_begin) ? slot_end - 1 : twin.Slot - 1];
+        }
+        while (h != h_start);
+        if (face_size < 3 || !TriangulateFace(face, face_size))
+            return false;
+    }
+    return _IdxWrite == out_idx + (n - 2) * 3;
+}
+
+// X position of an edge at given Y position of the sweep line. Horizontal edges are considered to extend up to their right end.
+float ImTriangulatorMonotone::EdgeXAt(int edge, float y) const
+{
+    const ImVec2& a = _Pos[edge];
+    const ImVec2& b = _Pos[(edge + 1 == _Count) ? 0 : edge + 1];
+    if (a.y == b.y)
+        return ImMax(a.x, b.x);
+    const float t = ImSaturate((y - a.y) / (b.y - a.y));
+    return a.x + (b.x - a.x) * t;
+}
+
+// Return index in _Status[] of the edge directly on the left of a vertex, or -1
+int ImTriangulatorMonotone::StatusFindLeftOf(int vtx) const
+{
+    const ImVec2 p = _Pos[vtx];
+    int lo = 0, hi = _StatusSize;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (EdgeXAt(_Status[mid], p.y) <= p.x)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo - 1;
+}
+
+void ImTriangulatorMonotone::StatusInsert(int edge)
+{
+    const int pos = StatusFindLeftOf(edge) + 1;
+    memmove(_Status + pos + 1, _Status + pos, (size_t)(_StatusSize - pos) * sizeof(int));
+    _Status[pos] = edge;
+    _StatusSize++;
+}
+
+void ImTriangulatorMonotone::StatusErase(int edge)
+{
+    for (int pos = _StatusSize - 1; pos >= 0; pos--)
+        if (_Status[pos] == edge)
+        {
+            memmove(_Status + pos, _Status + pos + 1, (size_t)(_StatusSize - pos - 1) * sizeof(int));
+            _StatusSize--;
+            return;
+        }
+}
+
+void ImTriangulatorMonotone::AddDiagonal(int a, int b)
+{
+    _Diagonals[_DiagonalsCount * 2 + 0] = a;
+    _Diagonals[_DiagonalsCount * 2 + 1] = b;
+    _DiagonalsCount++;
+}
+
+// Sweep from top to bottom, adding diagonals to remove split and merge vertices
+bool ImTriangulatorMonotone::BuildDiagonals()
+{
+    const int n = _Count;
+    for (int i = 0; i < n; i++)
+    {
+        const int i_prev = (i == 0) ? n - 1 : i - 1;
+        const int i_next = (i + 1 == n) ? 0 : i + 1;
+        const bool prev_below = _Rank[i_prev] > _Rank[i];
+        const bool next_below = _Rank[i_next] > _Rank[i];
+        const ImVec2 d0 = _Pos[i] - _Pos[i_prev];
+        const ImVec2 d1 = _Pos[i_next] - _Pos[i];
+        const bool convex = (d0.x * d1.y - d0.y * d1.x) > 0.0f;
+        if (prev_below && next_below)
+            _Type[i] = convex ? ImTriangulatorMonotoneVtxType_Start : ImTriangulatorMonotoneVtxType_Split;
+        else if (!prev_below && !next_below)
+            _Type[i] = convex ? ImTriangulatorMonotoneVtxType_End : ImTriangulatorMonotoneVtxType_Merge;
+        else
+            _Type[i] = ImTriangulatorMonotoneVtxType_Regular;
+    }
+
+    for (int r = 0; r < n; r++)
+    {
+        const int i = _Sorted[r];
+        const int i_prev = (i == 0) ? n - 1 : i - 1; // Also index of edge ending at vertex 'i'
+        int left;
+        switch (_Type[i])
+        {
+        case ImTriangulatorMonotoneVtxType_Start:
+            StatusInsert(i);
+            _Helper[i] = i;
+            break;
+        case ImTriangulatorMonotoneVtxType_End:
+            if (_Type[_Helper[i_prev]] == ImTriangulatorMonotoneVtxType_Merge)
+                AddDiagonal(i, _Helper[i_prev]);
+            StatusErase(i_prev);
+            break;
+        case ImTriangulatorMonotoneVtxType_Split:
+            if ((left = StatusFindLeftOf(i)) < 0)
+                return false;
+            AddDiagonal(i, _Helper[_Status[left]]);
+            _Helper[_Status[left]] = i;
+            StatusInsert(i);
+            _Helper[i] = i;
+            break;
+        case ImTriangulatorMonotoneVtxType_Merge:
+            if (_Type[_Helper[i_prev]] == ImTriangulatorMonotoneVtxType_Merge)
+                AddDiagonal(i, _Helper[i_prev]);
+            StatusErase(i_prev);
+            if ((left = StatusFindLeftOf(i)) < 0)
+                return false;
+            if (_Type[_Helper[_Status[left]]] == ImTriangulatorMonotoneVtxType_Merge)
+                AddDiagonal(i, _Helper[_Status[left]]);
+            _Helper[_Status[left]] = i;
+            break;
+        case ImTriangulatorMonotoneVtxType_Regular:
+            if (_Rank[i_prev] < _Rank[i])
+            {
+                // Interior of polygon is on the right of vertex
+                if (_Type[_Helper[i_prev]] == ImTriangulatorMonotoneVtxType_Merge)
+                    AddDiagonal(i, _Helper[i_prev]);
+                StatusErase(i_prev);
+                StatusInsert(i);
+                _Helper[i] = i;
+            }
+            else
+            {
+                if ((left = StatusFindLeftOf(i)) < 0)
+                    return false;
+                if (_Type[_Helper[_Status[left]]] == ImTriangulatorMonotoneVtxType_Merge)
+                    AddDiagonal(i, _Helper[_Status[left]]);
+                _Helper[_Status[left]] = i;
+            }
+            break;
+        }
+        if (_DiagonalsCount > n)
+            return false;
+    }
+    return true;
 }
 
-void ImTriangulator::BuildNodes(const ImVec2* points, int points_count)
+// Build half-edges for polygon edges and diagonals, and sort them around each vertex
+bool ImTriangulatorMonotone::BuildHalfEdges()
 {
-    for (int i = 0; i < points_count; i++)
+    const int n = _Count;
+    const int half_edges_count = (n + _DiagonalsCount) * 2;
+    for (int h = 0; h < half_edges_count; h += 2)
     {
-        _Nodes[i].Type = ImTriangulatorNodeType_Convex;
-        _Nodes[i].Index = i;
-        _Nodes[i].Pos = points[i];
-        _Nodes[i].Next = _Nodes + i + 1;
-        _Nodes[i].Prev = _Nodes + i - 1;
+        const int a = (h < n * 2) ? h >> 1 : _Diagonals[h - n * 2];
+        const int b = (h < n * 2) ? ((a + 1 == n) ? 0 : a + 1) : _Diagonals[h - n * 2 + 1];
+        const ImVec2 d = _Pos[b] - _Pos[a];
+        if (a == b || (d.x == 0.0f && d.y == 0.0f))
+            return false;
+        ImTriangulatorMonotoneHalfEdge* he = &_HalfEdges[h];
+        he[0].Origin = he[1].Dest = a;
+        he[0].Dest = he[1].Origin = b;
+        he[0].Angle = ImTriangulatorMonotonePseudoAngle(d.x, d.y);
+        he[1].Angle = ImTriangulatorMonotonePseudoAngle(-d.x, -d.y);
     }
-    _Nodes[0].Prev = _Nodes + points_count - 1;
-    _Nodes[points_count - 1].Next = _Nodes;
-}
 
-void ImTriangulator::BuildReflexes()
-{
-    ImTriangulatorNode* n1 = _Nodes;
-    for (int i = _TrianglesLeft; i >= 0; i--, n1 = n1->Next)
+    // Bucket by origin (counting sort), then sort by angle around each vertex with an insertion sort (generally 2 to 4 half-edges)
+    int* fill = _Status; // Not used anymore
+    memset(_VtxHalfEdgesOffset, 0, (size_t)(n + 1) * sizeof(int));
+    for (int h = 0; h < half_edges_count; h++)
+        _VtxHalfEdgesOffset[_HalfEdges[h].Origin + 1]++;
+    for (int i = 0; i < n; i++)
+        _VtxHalfEdgesOffset[i + 1] += _VtxHalfEdgesOffset[i];
+    memcpy(fill, _VtxHalfEdgesOffset, (size_t)n * sizeof(int));
+    for (int h = 0; h < half_edges_count; h++)
+        _VtxHalfEdges[fill[_HalfEdges[h].Origin]++] = h;
+    for (int i = 0; i < n; i++)
     {
-        if (ImTriangleIsClockwise(n1->Prev->Pos, n1->Pos, n1->Next->Pos))
-            continue;
-        n1->Type = ImTriangulatorNodeType_Reflex;
-        _Reflexes.push_back(n1);
+        const int slot_begin = _VtxHalfEdgesOffset[i];
+        const int slot_end = _VtxHalfEdgesOffset[i + 1];
+        for (int slot = slot_begin + 1; slot < slot_end; slot++)
+        {
+            const int h = _VtxHalfEdges[slot];
+            const float angle = _HalfEdges[h].Angle;
+            int dst = slot;
+            for (; dst > slot_begin && _HalfEdges[_VtxHalfEdges[dst - 1]].Angle > angle; dst--)
+                _VtxHalfEdges[dst] = _VtxHalfEdges[dst - 1];
+            _VtxHalfEdges[dst] = h;
+        }
+        for (int slot = slot_begin; slot < slot_end; slot++)
+            _HalfEdges[_VtxHalfEdges[slot]].Slot = slot;
     }
+    return true;
 }
 
-void ImTriangulator::BuildEars()
+// Triangulate a y-monotone face (vertices in counter-clockwise order)
+bool ImTriangulatorMonotone::TriangulateFace(int* face, int face_size)
 {
-    ImTriangulatorNode* n1 = _Nodes;
-    for (int i = _TrianglesLeft; i >= 0; i--, n1 = n1->Next)
+    // Find top and bottom vertices. A monotone polygon has a single local top.
+    int top = 0;
+    int local_tops = 0;
+    for (int k0 = face_size - 1, k1 = 0, k2 = 1; k1 < face_size; k0 = k1, k1++, k2 = (k2 + 1 == face_size) ? 0 : k2 + 1)
     {
-        if (n1->Type != ImTriangulatorNodeType_Convex)
-            continue;
-        if (!IsEar(n1->Prev->Index, n1->Index, n1->Next->Index, n1->Prev->Pos, n1->Pos, n1->Next->Pos))
-            continue;
-        n1->Type = ImTriangulatorNodeType_Ear;
-        _Ears.push_back(n1);
+        const int rank = _Rank[face[k1]];
+        if (rank < _Rank[face[k0]] && rank < _Rank[face[k2]])
+            local_tops++;
+        if (rank < _Rank[face[top]])
+            top = k1;
     }
-}
+    if (local_tops != 1)
+        return false;
 
-void ImTriangulator::GetNextTriangle(unsigned int out_triangle[3])
-{
-    if (_Ears.Size == 0)
+    // Merge left chain (following counter-clockwise order from top) and right chain into sweep order.
+    // Reuse storage not needed anymore.
+    int* sorted = _Type;
+    int* chain = _Helper;
+    int* stack = _Status;
+    sorted[0] = face[top];
+    chain[0] = 0;
+    for (int k = 1, l = (top + 1 == face_size) ? 0 : top + 1, r = (top == 0) ? face_size - 1 : top - 1; k < face_size; k++)
     {
-        FlipNodeList();
-
-        ImTriangulatorNode* node = _Nodes;
-        for (int i = _TrianglesLeft; i >= 0; i--, node = node->Next)
-            node->Type = ImTriangulatorNodeType_Convex;
-        _Reflexes.Size = 0;
-        BuildReflexes();
-        BuildEars();
-
-        // If we still don't have ears, it means geometry is degenerated.
-        if (_Ears.Size == 0)
+        if (l == r || _Rank[face[l]] < _Rank[face[r]])
         {
-            // Return first triangle available, mimicking the behavior of convex fill.
-            IM_ASSERT(_TrianglesLeft > 0); // Geometry is degenerated
-            _Ears.Data[0] = _Nodes;
-            _Ears.Size    = 1;
+            sorted[k] = face[l];
+            chain[k] = 0;
+            l = (l + 1 == face_size) ? 0 : l + 1;
+        }
+        else
+        {
+            sorted[k] = face[r];
+            chain[k] = 1;
+            r = (r == 0) ? face_size - 1 : r - 1;
         }
     }
 
-    ImTriangulatorNode* ear = _Ears.Data[--_Ears.Size];
-    out_triangle[0] = ear->Prev->Index;
-    out_triangle[1] = ear->Index;
-    out_triangle[2] = ear->Next->Index;
-
-    ear->Unlink();
-    if (ear == _Nodes)
-        _Nodes = ear->Next;
-
-    ReclassifyNode(ear->Prev);
-    ReclassifyNode(ear->Next);
-    _TrianglesLeft--;
-}
-
-void ImTriangulator::FlipNodeList()
-{
-    ImTriangulatorNode* prev = _Nodes;
-    ImTriangulatorNode* temp = _Nodes;
-    ImTriangulatorNode* current = _Nodes->Next;
-    prev->Next = prev;
-    prev->Prev = prev;
-    while (current != _Nodes)
+    // Triangulate with a stack of vertices waiting for a diagonal (positions in sorted[])
+    int stack_size = 0;
+    stack[stack_size++] = 0;
+    stack[stack_size++] = 1;
+    for (int j = 2; j < face_size - 1; j++)
     {
-        temp = current->Next;
-
-        current->Next = prev;
-        prev->Prev = current;
-        _Nodes->Next = current;
-        current->Prev = _Nodes;
-
-        prev = current;
-        current = temp;
+        if (chain[j] != chain[stack[stack_size - 1]])
+        {
+            // Opposite chain: connect to all stacked vertices
+            for (; stack_size > 1; stack_size--)
+                EmitTriangle(sorted[j], sorted[stack[stack_size - 1]], sorted[stack[stack_size - 2]]);
+            stack_size = 0;
+            stack[stack_size++] = j - 1;
+            stack[stack_size++] = j;
+        }
+        else
+        {
+            // Same chain: connect to stacked vertices as long as diagonal is inside
+            int last = stack[--stack_size];
+            while (stack_size > 0)
+            {
+                const ImVec2& p0 = _Pos[sorted[stack[stack_size - 1]]];
+                const ImVec2& p1 = _Pos[sorted[last]];
+                const ImVec2& p2 = _Pos[sorted[j]];
+                const float cross = (chain[j] == 0) ? ImTriangleCross(p0, p1, p2) : ImTriangleCross(p2, p1, p0);
+                if (cross <= 0.0f)
+                    break;
+                EmitTriangle(sorted[j], sorted[last], sorted[stack[stack_size - 1]]);
+                last = stack[--stack_size];
+            }
+            stack[stack_size++] = last;
+            stack[stack_size++] = j;
+        }
     }
-    _Nodes = prev;
+    for (; stack_size > 1; stack_size--)
+        EmitTriangle(sorted[face_size - 1], sorted[stack[stack_size - 1]], sorted[stack[stack_size - 2]]);
+    return true;
 }
 
-// A triangle is an ear is no other vertex is inside it. We can test reflexes vertices only (see reference algorithm)
-bool ImTriangulator::IsEar(int i0, int i1, int i2, const ImVec2& v0, const ImVec2& v1, const ImVec2& v2) const
+// A polygon is convex when all its turns are in the same direction and it goes around only once (X direction changes at most twice).
+// Collinear and duplicate points are allowed.
+static bool ImPolygonIsConvex(const ImVec2* points, const int points_count)
 {
-    ImTriangulatorNode** p_end = _Reflexes.Data + _Reflexes.Size;
-    for (ImTriangulatorNode** p = _Reflexes.Data; p < p_end; p++)
+    float turn_sign = 0.0f;
+    int x_sign_changes = 0;
+    ImVec2 d0 = points[0] - points[points_count - 1];
+    float x_sign = (d0.x > 0.0f) ? 1.0f : (d0.x < 0.0f) ? -1.0f : 0.0f;
+    for (int i = 0; i < points_count; i++)
     {
-        ImTriangulatorNode* reflex = *p;
-        if (reflex->Index != i0 && reflex->Index != i1 && reflex->Index != i2)
-            if (ImTriangleContainsPoint(v0, v1, v2, reflex->Pos))
+        const ImVec2 d1 = points[(i + 1 == points_count) ? 0 : i + 1] - points[i];
+        const float cross = d0.x * d1.y - d0.y * d1.x;
+        if (cross != 0.0f)
+        {
+            if (turn_sign == 0.0f)
+                turn_sign = cross;
+            else if ((cross > 0.0f) != (turn_sign > 0.0f))
+                return false;
+        }
+        if (d1.x != 0.0f)
+        {
+            const float d1_x_sign = (d1.x > 0.0f) ? 1.0f : -1.0f;
+            if (x_sign != 0.0f && d1_x_sign != x_sign && ++x_sign_changes > 2)
                 return false;
+            x_sign = d1_x_sign;
+        }
+        d0 = d1;
     }
     return true;
 }
 
-void ImTriangulator::ReclassifyNode(ImTriangulatorNode* n1)
+// Write (points_count - 2) triangles to draw_list->_IdxWritePtr, vertex 'i' being written as 'idx_base + (i << idx_shift)'.
+// - Convex polygons are triangulated as a fan, like AddConvexPolyFilled().
+// - Large polygons use ImTriangulatorMonotone, O(N log N), falling back to ImTriangulator (ear-clipping, O(N^2)) if it fails on degenerate input.
+static void ImDrawList_TriangulatePolygon(ImDrawList* draw_list, const ImVec2* points, const int points_count, unsigned int idx_base, int idx_shift)
 {
-    // Classify node
-    ImTriangulatorNodeType type;
-    const ImTriangulatorNode* n0 = n1->Prev;
-    const ImTriangulatorNode* n2 = n1->Next;
-    if (!ImTriangleIsClockwise(n0->Pos, n1->Pos, n2->Pos))
-        type = ImTriangulatorNodeType_Reflex;
-    else if (IsEar(n0->Index, n1->Index, n2->Index, n0->Pos, n1->Pos, n2->Pos))
-        type = ImTriangulatorNodeType_Ear;
-    else
-        type = ImTriangulatorNodeType_Convex;
-
-    // Update lists when a type changes
-    if (type == n1->Type)
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    draw_list->_IdxWritePtr += (points_count - 2) * 3;
+    if (ImPolygonIsConvex(points, points_count))
+    {
+        for (int i = 2; i < points_count; i++, idx_write += 3)
+        {
+            idx_write[0] = (ImDrawIdx)(idx_base); idx_write[1] = (ImDrawIdx)(idx_base + ((i - 1) << idx_shift)); idx_write[2] = (ImDrawIdx)(idx_base + (i << idx_shift));
+        }
         return;
-    if (n1->Type == ImTriangulatorNodeType_Reflex)
-        _Reflexes.find_erase_unsorted(n1->Index);
-    else if (n1->Type == ImTriangulatorNodeType_Ear)
-        _Ears.find_erase_unsorted(n1->Index);
-    if (type == ImTriangulatorNodeType_Reflex)
-        _Reflexes.push_back(n1);
-    else if (type == ImTriangulatorNodeType_Ear)
-        _Ears.push_back(n1);
-    n1->Type = type;
+    }
+
+    ImVector<ImVec2>& temp_buffer = draw_list->_Data->TempBuffer;
+    if (points_count >= IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS)
+    {
+        temp_buffer.reserve_discard((ImTriangulatorMonotone::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
+        ImTriangulatorMonotone triangulator;
+        if (triangulator.Triangulate(points, points_count, temp_buffer.Data, idx_write, idx_base, idx_shift))
+            return;
+    }
+
+    temp_buffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
+    ImTriangulator triangulator;
+    unsigned int triangle[3];
+    triangulator.Init(points, points_count, temp_buffer.Data);
+    while (triangulator._TrianglesLeft > 0)
+    {
+        triangulator.GetNextTriangle(triangle);
+        idx_write[0] = (ImDrawIdx)(idx_base + (triangle[0] << idx_shift)); idx_write[1] = (ImDrawIdx)(idx_base + (triangle[1] << idx_shift)); idx_write[2] = (ImDrawIdx)(idx_base + (triangle[2] << idx_shift));
+        idx_write += 3;
+    }
 }
 
 // Use ear-clipping algorithm to triangulate a simple polygon (no self-interaction, no holes).
@@ -1967,8 +3275,6 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
-    ImTriangulator triangulator;
-    unsigned int triangle[3];
     if (Flags & ImDrawListFlags_AntiAliasedFill)
     {
         // Anti-aliased Fill
@@ -1982,14 +3288,7 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         unsigned int vtx_inner_idx = _VtxCurrentIdx;
         unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
 
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
-        while (triangulator._TrianglesLeft > 0)
-        {
-            triangulator.GetNextTriangle(triangle);
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (triangle[0] << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (triangle[1] << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_inner_idx + (triangle[2] << 1));
-            _IdxWritePtr += 3;
-        }
+        ImDrawList_TriangulatePolygon(this, points, points_count, vtx_inner_idx, 1);
 
         // Compute normals
         _Data->TempBuffer.reserve_discard(points_count);
@@ -2039,14 +3338,7 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
             _VtxWritePtr++;
         }
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
-        while (triangulator._TrianglesLeft > 0)
-        {
-            triangulator.GetNextTriangle(triangle);
-            _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx + triangle[0]); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + triangle[1]); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + triangle[2]);
-            _IdxWritePtr += 3;
-        }
+        ImDrawList_TriangulatePolygon(this, points, points_count, _VtxCurrentIdx, 0);
         _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
 }
@@ -2110,52 +3402,52 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // Reserve for the worst case (no merge) once. Channels keep their storage for next Split().
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
-    ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
-        ImDrawChannel& ch = _Channels[i];
-        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
-            ch._CmdBuffer.pop_back();
-
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
-        {
-            // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
-            // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
-            {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
-            }
-        }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
-        new_cmd_buffer_count += ch._CmdBuffer.Size;
-        new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
-        {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
-        }
+        new_cmd_buffer_count += _Channels[i]._CmdBuffer.Size;
+        new_idx_buffer_count += _Channels[i]._IdxBuffer.Size;
     }
-    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
+    draw_list->CmdBuffer.reserve(draw_list->CmdBuffer.Size + new_cmd_buffer_count + 1);
     draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
 
-    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
-    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
+    // Write commands in a single pass, fixing their IdxOffset values and merging the first command of each channel with previous command if matching.
+    // (we don't merge within a channel, where matching commands may have been split on purpose with AddDrawCmd()). Empty commands are skipped.
+    // Indices are copied per channel: their order is the same as commands. We don't copy vertices only indices.
+    // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
+    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    ImDrawCmd* last_cmd = (draw_list->CmdBuffer.Size > 0) ? cmd_write - 1 : NULL;
+    unsigned int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        bool ch_first_cmd = true;
+        for (const ImDrawCmd* cmd_read = ch._CmdBuffer.Data; cmd_read < ch._CmdBuffer.Data + ch._CmdBuffer.Size; cmd_read++)
+        {
+            if (cmd_read->UserCallback == NULL)
+            {
+                if (cmd_read->ElemCount == 0)
+                    continue;
+                if (ch_first_cmd && last_cmd != NULL && last_cmd->UserCallback == NULL && ImDrawCmd_HeaderCompare(last_cmd, cmd_read) == 0)
+                {
+                    ch_first_cmd = false;
+                    last_cmd->ElemCount += cmd_read->ElemCount;
+                    idx_offset += cmd_read->ElemCount;
+                    continue;
+                }
+            }
+            ch_first_cmd = false;
+            *cmd_write = *cmd_read;
+            cmd_write->IdxOffset = idx_offset;
+            idx_offset += cmd_read->ElemCount;
+            last_cmd = cmd_write++;
+        }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
     }
+    draw_list->CmdBuffer.Size = (int)(cmd_write - draw_list->CmdBuffer.Data);
     draw_list->_IdxWritePtr = idx_write;
 
     // Ensure there's always a non-callback draw command trailing the command-buffer
@@ -2207,6 +3499,11 @@ void ImDrawData::Clear()
     CmdLists.resize(0); // The ImDrawList are NOT owned by ImDrawData but e.g. by ImGuiContext, so we don't clear them.
     DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f);
     OwnerViewport = NULL;
+    DamageRectsValid = false;
+    DamageRects.resize(0);
+    FlatVtxCount = FlatIdxCount = 0;
+    FlatCmdBuffer.resize(0);
+    FlatLists.resize(0);
 }
 
 // Important: 'out_list' is generally going to be draw_data->CmdLists, but may be another temporary list
@@ -2243,6 +3540,17 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     if (sizeof(ImDrawIdx) == 2)
         IM_ASSERT(draw_list->_VtxCurrentIdx < (1 << 16) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
 
+    // Choose index size of this list (see ImGuiBackendFlags_RendererHasIdxSize)
+    // - With 16-bit ImDrawIdx: promote to 32-bit indices when there are too many vertices, instead of drawing with several VtxOffset.
+    // - With 32-bit ImDrawIdx: pack to 16-bit indices when they fit.
+    if ((draw_list->Flags & ImDrawListFlags_AllowIdxSize) && draw_list->IdxSize == (int)sizeof(ImDrawIdx))
+    {
+        if (sizeof(ImDrawIdx) == 2 && draw_list->VtxBuffer.Size > (1 << 16))
+            draw_list->_PromoteIdx32();
+        else if (sizeof(ImDrawIdx) == 4 && draw_list->VtxBuffer.Size <= (1 << 16))
+            draw_list->_PackIdx16();
+    }
+
     // Resolve callback data pointers
     if (draw_list->_CallbacksDataBuf.Size > 0)
         for (ImDrawCmd& cmd : draw_list->CmdBuffer)
@@ -2261,6 +3569,76 @@ void ImDrawData::AddDrawList(ImDrawList* draw_list)
     IM_ASSERT(CmdLists.Size == CmdListsCount);
     draw_list->_PopUnusedDrawCmd();
     ImGui::AddDrawListToDrawDataEx(this, &CmdLists, draw_list);
+    DamageRectsValid = false; // Not tracked
+    FlatLists.resize(0);
+}
+
+void ImDrawData::FlattenCmds()
+{
+    IM_ASSERT(CmdLists.Size == CmdListsCount);
+    int cmd_count = 0;
+    for (ImDrawList* draw_list : CmdLists)
+        cmd_count += draw_list->CmdBuffer.Size;
+    FlatCmdBuffer.resize(cmd_count);
+    FlatLists.resize(CmdListsCount + 1);
+
+    // Indices are copied as stored (see ImDrawList::IdxSize), so IdxOffset of flattened commands is in units of their own list's IdxSize.
+    // Lists with 32-bit indices start on a 4-byte boundary so the whole flattened buffer can be indexed with their index type.
+    ImDrawCmd* cmd_write = FlatCmdBuffer.Data;
+    int vtx_offset = 0;
+    int idx_offset = 0;
+    for (int n = 0; n < CmdListsCount; n++)
+    {
+        const ImDrawList* draw_list = CmdLists[n];
+        if (draw_list->IdxSize > (int)sizeof(ImDrawIdx)) // List promoted to 32-bit indices with 16-bit ImDrawIdx
+            idx_offset = (idx_offset + 1) & ~1;
+        const unsigned int list_idx_offset = (unsigned int)((size_t)idx_offset * sizeof(ImDrawIdx) / (size_t)draw_list->IdxSize);
+        ImDrawDataFlatList* flat_list = &FlatLists[n];
+        flat_list->CmdOffset = (int)(cmd_write - FlatCmdBuffer.Data);
+        flat_list->VtxOffset = vtx_offset;
+        flat_list->IdxOffset = idx_offset;
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            *cmd_write = cmd;
+            cmd_write->VtxOffset += (unsigned int)vtx_offset;
+            cmd_write->IdxOffset += list_idx_offset;
+            cmd_write++;
+        }
+        vtx_offset += draw_list->VtxBuffer.Size;
+        idx_offset += draw_list->IdxBuffer.Size;
+    }
+    FlatLists[CmdListsCount].CmdOffset = cmd_count;
+    FlatLists[CmdListsCount].VtxOffset = FlatVtxCount = vtx_offset;
+    FlatLists[CmdListsCount].IdxOffset = FlatIdxCount = idx_offset;
+}
+
+// Only reads from the draw list and writes to its own range of the destination buffers, so lists may be copied in parallel.
+void ImDrawData::FlattenCopyList(int list_n, ImDrawVert* vtx_dst, ImDrawIdx* idx_dst) const
+{
+    IM_ASSERT(FlatLists.Size == CmdListsCount + 1 && "Call FlattenCmds() first!");
+    IM_ASSERT(list_n >= 0 && list_n < CmdListsCount);
+    const ImDrawList* draw_list = CmdLists[list_n];
+    const ImDrawDataFlatList* flat_list = &FlatLists[list_n];
+    memcpy(vtx_dst + flat_list->VtxOffset, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+    memcpy(idx_dst + flat_list->IdxOffset, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+}
+
+void ImDrawData::Flatten(ImDrawVert* vtx_dst, ImDrawIdx* idx_dst)
+{
+    if (FlatLists.Size != CmdListsCount + 1)
+        FlattenCmds();
+    if (vtx_dst == NULL)
+    {
+        FlatVtxBuffer.resize(FlatVtxCount);
+        vtx_dst = FlatVtxBuffer.Data;
+    }
+    if (idx_dst == NULL)
+    {
+        FlatIdxBuffer.resize(FlatIdxCount);
+        idx_dst = FlatIdxBuffer.Data;
+    }
+    for (int n = 0; n < CmdListsCount; n++)
+        FlattenCopyList(n, vtx_dst, idx_dst);
 }
 
 // For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
@@ -2273,29 +3651,72 @@ void ImDrawData::DeIndexAllBuffers()
         ImDrawList* cmd_list = CmdLists[i];
         if (cmd_list->IdxBuffer.empty())
             continue;
-        new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
-        for (int j = 0; j < cmd_list->IdxBuffer.Size; j++)
-            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer[j]];
+        const ImDrawCmd& last_cmd = cmd_list->CmdBuffer.back();
+        const int idx_count = (cmd_list->IdxSize == (int)sizeof(ImDrawIdx)) ? cmd_list->IdxBuffer.Size : (int)(last_cmd.IdxOffset + last_cmd.ElemCount);
+        new_vtx_buffer.resize(idx_count);
+        ImDrawVert* vtx_dst = new_vtx_buffer.Data;
+        const ImDrawVert* vtx_src = cmd_list->VtxBuffer.Data;
+        if (cmd_list->IdxSize == 2)
+        {
+            const ImU16* idx_src = (const ImU16*)(const void*)cmd_list->IdxBuffer.Data;
+            for (int j = 0; j < idx_count; j++)
+                vtx_dst[j] = vtx_src[idx_src[j]];
+        }
+        else
+        {
+            const ImU32* idx_src = (const ImU32*)(const void*)cmd_list->IdxBuffer.Data;
+            for (int j = 0; j < idx_count; j++)
+                vtx_dst[j] = vtx_src[idx_src[j]];
+        }
         cmd_list->VtxBuffer.swap(new_vtx_buffer);
         cmd_list->IdxBuffer.resize(0);
+        cmd_list->IdxSize = (int)sizeof(ImDrawIdx);
         TotalVtxCount += cmd_list->VtxBuffer.Size;
     }
 }
 
+static void ImDrawCmd_ScaleClipRects(ImDrawCmd* cmds, int cmds_count, const ImVec2& fb_scale)
+{
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128 scale = _mm_setr_ps(fb_scale.x, fb_scale.y, fb_scale.x, fb_scale.y);
+    for (int n = 0; n < cmds_count; n++)
+        _mm_storeu_ps(&cmds[n].ClipRect.x, _mm_mul_ps(_mm_loadu_ps(&cmds[n].ClipRect.x), scale));
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t scale = vcombine_f32(vld1_f32(&fb_scale.x), vld1_f32(&fb_scale.x));
+    for (int n = 0; n < cmds_count; n++)
+        vst1q_f32(&cmds[n].ClipRect.x, vmulq_f32(vld1q_f32(&cmds[n].ClipRect.x), scale));
+#else
+    for (int n = 0; n < cmds_count; n++)
+    {
+        ImVec4& r = cmds[n].ClipRect;
+        r = ImVec4(r.x * fb_scale.x, r.y * fb_scale.y, r.z * fb_scale.x, r.w * fb_scale.y);
+    }
+#endif
+}
+
 // Helper to scale the ClipRect field of each ImDrawCmd.
 // Use if your final output buffer is at a different scale than draw_data->DisplaySize,
 // or if there is a difference between your window resolution and framebuffer resolution.
 void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
 {
     for (ImDrawList* draw_list : CmdLists)
-        for (ImDrawCmd& cmd : draw_list->CmdBuffer)
-            cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
+        ImDrawCmd_ScaleClipRects(draw_list->CmdBuffer.Data, draw_list->CmdBuffer.Size, fb_scale);
+    if (FlatLists.Size == CmdListsCount + 1) // Keep commands output by FlattenCmds() in sync
+        ImDrawCmd_ScaleClipRects(FlatCmdBuffer.Data, FlatCmdBuffer.Size, fb_scale);
+    for (ImVec4& rect : DamageRects)
+        rect = ImVec4(rect.x * fb_scale.x, rect.y * fb_scale.y, rect.z * fb_scale.x, rect.w * fb_scale.y);
 }
 
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
 
+// SIMD versions process 4 vertices per iteration and output the same values as the scalar code (same operations in the same order).
+// They rely on the default ImDrawVert layout (ImVec2 pos, ImVec2 uv, ImU32 col).
+#if (defined(IMGUI_ENABLE_SSE2) || defined(IMGUI_ENABLE_NEON)) && !defined(IMGUI_USE_COMPACT_DRAWVERT) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+#define IM_SHADEVERTS_SIMD
+#endif
+
 // Generic linear color gradient, write to RGB fields, leave A untouched.
 void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1)
 {
@@ -2309,7 +3730,66 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
     const int col_delta_r = ((int)(col1 >> IM_COL32_R_SHIFT) & 0xFF) - col0_r;
     const int col_delta_g = ((int)(col1 >> IM_COL32_G_SHIFT) & 0xFF) - col0_g;
     const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
-    for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
+    ImDrawVert* vert = vert_start;
+#ifdef IM_SHADEVERTS_SIMD
+    // Lerp R,G,B of one vertex per register, with lanes in the same order as bytes of ImU32 so they can be packed directly (alpha lane stays 0).
+    float col0_lanes[4] = {}, col_delta_lanes[4] = {};
+    col0_lanes[IM_COL32_R_SHIFT / 8] = (float)col0_r; col_delta_lanes[IM_COL32_R_SHIFT / 8] = (float)col_delta_r;
+    col0_lanes[IM_COL32_G_SHIFT / 8] = (float)col0_g; col_delta_lanes[IM_COL32_G_SHIFT / 8] = (float)col_delta_g;
+    col0_lanes[IM_COL32_B_SHIFT / 8] = (float)col0_b; col_delta_lanes[IM_COL32_B_SHIFT / 8] = (float)col_delta_b;
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128 v_p0_x = _mm_set1_ps(gradient_p0.x), v_p0_y = _mm_set1_ps(gradient_p0.y);
+    const __m128 v_extent_x = _mm_set1_ps(gradient_extent.x), v_extent_y = _mm_set1_ps(gradient_extent.y);
+    const __m128 v_inv_length2 = _mm_set1_ps(gradient_inv_length2), v_zero = _mm_setzero_ps(), v_one = _mm_set1_ps(1.0f);
+    const __m128 v_col0 = _mm_loadu_ps(col0_lanes), v_col_delta = _mm_loadu_ps(col_delta_lanes);
+    const __m128i v_alpha_mask = _mm_set1_epi32((int)IM_COL32_A_MASK);
+    for (; vert + 4 <= vert_end; vert += 4)
+    {
+        const __m128 px = _mm_setr_ps(vert[0].pos.x, vert[1].pos.x, vert[2].pos.x, vert[3].pos.x);
+        const __m128 py = _mm_setr_ps(vert[0].pos.y, vert[1].pos.y, vert[2].pos.y, vert[3].pos.y);
+        const __m128 d = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(px, v_p0_x), v_extent_x), _mm_mul_ps(_mm_sub_ps(py, v_p0_y), v_extent_y));
+        const __m128 t = _mm_min_ps(v_one, _mm_max_ps(v_zero, _mm_mul_ps(d, v_inv_length2))); // Operands order matches ImClamp() for NaN and signed zeros
+        const __m128i c0 = _mm_cvttps_epi32(_mm_add_ps(v_col0, _mm_mul_ps(v_col_delta, _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0)))));
+        const __m128i c1 = _mm_cvttps_epi32(_mm_add_ps(v_col0, _mm_mul_ps(v_col_delta, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1)))));
+        const __m128i c2 = _mm_cvttps_epi32(_mm_add_ps(v_col0, _mm_mul_ps(v_col_delta, _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2)))));
+        const __m128i c3 = _mm_cvttps_epi32(_mm_add_ps(v_col0, _mm_mul_ps(v_col_delta, _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 3, 3)))));
+        const __m128i col_old = _mm_setr_epi32((int)vert[0].col, (int)vert[1].col, (int)vert[2].col, (int)vert[3].col);
+        const __m128i col = _mm_or_si128(_mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3)), _mm_and_si128(col_old, v_alpha_mask));
+        vert[0].col = (ImU32)_mm_cvtsi128_si32(col);
+        vert[1].col = (ImU32)_mm_cvtsi128_si32(_mm_shuffle_epi32(col, _MM_SHUFFLE(1, 1, 1, 1)));
+        vert[2].col = (ImU32)_mm_cvtsi128_si32(_mm_shuffle_epi32(col, _MM_SHUFFLE(2, 2, 2, 2)));
+        vert[3].col = (ImU32)_mm_cvtsi128_si32(_mm_shuffle_epi32(col, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t v_p0_x = vdupq_n_f32(gradient_p0.x), v_p0_y = vdupq_n_f32(gradient_p0.y);
+    const float32x4_t v_extent_x = vdupq_n_f32(gradient_extent.x), v_extent_y = vdupq_n_f32(gradient_extent.y);
+    const float32x4_t v_inv_length2 = vdupq_n_f32(gradient_inv_length2), v_zero = vdupq_n_f32(0.0f), v_one = vdupq_n_f32(1.0f);
+    const float32x4_t v_col0 = vld1q_f32(col0_lanes), v_col_delta = vld1q_f32(col_delta_lanes);
+    const uint32x4_t v_alpha_mask = vdupq_n_u32(IM_COL32_A_MASK);
+    for (; vert + 4 <= vert_end; vert += 4)
+    {
+        const float px_lanes[4] = { vert[0].pos.x, vert[1].pos.x, vert[2].pos.x, vert[3].pos.x };
+        const float py_lanes[4] = { vert[0].pos.y, vert[1].pos.y, vert[2].pos.y, vert[3].pos.y };
+        const float32x4_t d = vaddq_f32(vmulq_f32(vsubq_f32(vld1q_f32(px_lanes), v_p0_x), v_extent_x), vmulq_f32(vsubq_f32(vld1q_f32(py_lanes), v_p0_y), v_extent_y));
+        float32x4_t t = vmulq_f32(d, v_inv_length2);
+        t = vbslq_f32(vcltq_f32(t, v_zero), v_zero, t); // Same as ImClamp(), vminq_f32()/vmaxq_f32() differ for NaN
+        t = vbslq_f32(vcgtq_f32(t, v_one), v_one, t);
+        const int32x4_t c0 = vcvtq_s32_f32(vaddq_f32(v_col0, vmulq_laneq_f32(v_col_delta, t, 0)));
+        const int32x4_t c1 = vcvtq_s32_f32(vaddq_f32(v_col0, vmulq_laneq_f32(v_col_delta, t, 1)));
+        const int32x4_t c2 = vcvtq_s32_f32(vaddq_f32(v_col0, vmulq_laneq_f32(v_col_delta, t, 2)));
+        const int32x4_t c3 = vcvtq_s32_f32(vaddq_f32(v_col0, vmulq_laneq_f32(v_col_delta, t, 3)));
+        const uint8x16_t rgb = vcombine_u8(vqmovun_s16(vcombine_s16(vqmovn_s32(c0), vqmovn_s32(c1))), vqmovun_s16(vcombine_s16(vqmovn_s32(c2), vqmovn_s32(c3))));
+        const ImU32 col_old_lanes[4] = { vert[0].col, vert[1].col, vert[2].col, vert[3].col };
+        ImU32 col_lanes[4];
+        vst1q_u32(col_lanes, vorrq_u32(vreinterpretq_u32_u8(rgb), vandq_u32(vld1q_u32(col_old_lanes), v_alpha_mask)));
+        vert[0].col = col_lanes[0];
+        vert[1].col = col_lanes[1];
+        vert[2].col = col_lanes[2];
+        vert[3].col = col_lanes[3];
+    }
+#endif
+#endif // #ifdef IM_SHADEVERTS_SIMD
+    for (; vert < vert_end; vert++)
     {
         float d = ImDot(vert->pos - gradient_p0, gradient_extent);
         float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
@@ -2331,16 +3811,57 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
 
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
+    const ImVec2 min = clamp ? ImMin(uv_a, uv_b) : ImVec2(-FLT_MAX, -FLT_MAX);
+    const ImVec2 max = clamp ? ImMax(uv_a, uv_b) : ImVec2(+FLT_MAX, +FLT_MAX);
+    ImDrawVert* vertex = vert_start;
+#ifdef IM_SHADEVERTS_SIMD
+    // Two vertices per register (x0, y0, x1, y1)
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128 v_a = _mm_setr_ps(a.x, a.y, a.x, a.y), v_scale = _mm_setr_ps(scale.x, scale.y, scale.x, scale.y), v_uv_a = _mm_setr_ps(uv_a.x, uv_a.y, uv_a.x, uv_a.y);
+    const __m128 v_min = _mm_setr_ps(min.x, min.y, min.x, min.y), v_max = _mm_setr_ps(max.x, max.y, max.x, max.y);
+    for (; vertex + 4 <= vert_end; vertex += 4)
+    {
+        const __m128 pos01 = _mm_loadh_pi(_mm_loadl_pi(v_a, (const __m64*)(const void*)&vertex[0].pos), (const __m64*)(const void*)&vertex[1].pos);
+        const __m128 pos23 = _mm_loadh_pi(_mm_loadl_pi(v_a, (const __m64*)(const void*)&vertex[2].pos), (const __m64*)(const void*)&vertex[3].pos);
+        __m128 uv01 = _mm_add_ps(v_uv_a, _mm_mul_ps(_mm_sub_ps(pos01, v_a), v_scale));
+        __m128 uv23 = _mm_add_ps(v_uv_a, _mm_mul_ps(_mm_sub_ps(pos23, v_a), v_scale));
+        if (clamp)
+        {
+            uv01 = _mm_min_ps(v_max, _mm_max_ps(v_min, uv01)); // Operands order matches ImClamp() for NaN and signed zeros
+            uv23 = _mm_min_ps(v_max, _mm_max_ps(v_min, uv23));
+        }
+        _mm_storel_pi((__m64*)(void*)&vertex[0].uv, uv01);
+        _mm_storeh_pi((__m64*)(void*)&vertex[1].uv, uv01);
+        _mm_storel_pi((__m64*)(void*)&vertex[2].uv, uv23);
+        _mm_storeh_pi((__m64*)(void*)&vertex[3].uv, uv23);
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t v_a = vcombine_f32(vld1_f32(&a.x), vld1_f32(&a.x)), v_scale = vcombine_f32(vld1_f32(&scale.x), vld1_f32(&scale.x)), v_uv_a = vcombine_f32(vld1_f32(&uv_a.x), vld1_f32(&uv_a.x));
+    const float32x4_t v_min = vcombine_f32(vld1_f32(&min.x), vld1_f32(&min.x)), v_max = vcombine_f32(vld1_f32(&max.x), vld1_f32(&max.x));
+    for (; vertex + 4 <= vert_end; vertex += 4)
+    {
+        float32x4_t uv01 = vaddq_f32(v_uv_a, vmulq_f32(vsubq_f32(vcombine_f32(vld1_f32(&vertex[0].pos.x), vld1_f32(&vertex[1].pos.x)), v_a), v_scale));
+        float32x4_t uv23 = vaddq_f32(v_uv_a, vmulq_f32(vsubq_f32(vcombine_f32(vld1_f32(&vertex[2].pos.x), vld1_f32(&vertex[3].pos.x)), v_a), v_scale));
+        if (clamp)
+        {
+            uv01 = vbslq_f32(vcltq_f32(uv01, v_min), v_min, vbslq_f32(vcgtq_f32(uv01, v_max), v_max, uv01)); // Same as ImClamp(), vminq_f32()/vmaxq_f32() differ for NaN
+            uv23 = vbslq_f32(vcltq_f32(uv23, v_min), v_min, vbslq_f32(vcgtq_f32(uv23, v_max), v_max, uv23));
+        }
+        vst1_f32(&vertex[0].uv.x, vget_low_f32(uv01));
+        vst1_f32(&vertex[1].uv.x, vget_high_f32(uv01));
+        vst1_f32(&vertex[2].uv.x, vget_low_f32(uv23));
+        vst1_f32(&vertex[3].uv.x, vget_high_f32(uv23));
+    }
+#endif
+#endif // #ifdef IM_SHADEVERTS_SIMD
     if (clamp)
     {
-        const ImVec2 min = ImMin(uv_a, uv_b);
-        const ImVec2 max = ImMax(uv_a, uv_b);
-        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+        for (; vertex < vert_end; ++vertex)
             vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
     }
     else
     {
-        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+        for (; vertex < vert_end; ++vertex)
             vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
     }
 }
@@ -2349,7 +3870,41 @@ void ImGui::ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, in
 {
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
-    for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+    ImDrawVert* vertex = vert_start;
+#ifdef IM_SHADEVERTS_SIMD
+    // Two vertices per register (x0, y0, x1, y1). 'x*cos + y*(-sin)' is the same as 'x*cos - y*sin' of ImRotate().
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128 v_pivot_in = _mm_setr_ps(pivot_in.x, pivot_in.y, pivot_in.x, pivot_in.y), v_pivot_out = _mm_setr_ps(pivot_out.x, pivot_out.y, pivot_out.x, pivot_out.y);
+    const __m128 v_cos = _mm_set1_ps(cos_a), v_sin = _mm_setr_ps(-sin_a, sin_a, -sin_a, sin_a);
+    for (; vertex + 4 <= vert_end; vertex += 4)
+    {
+        const __m128 d01 = _mm_sub_ps(_mm_loadh_pi(_mm_loadl_pi(v_pivot_in, (const __m64*)(const void*)&vertex[0].pos), (const __m64*)(const void*)&vertex[1].pos), v_pivot_in);
+        const __m128 d23 = _mm_sub_ps(_mm_loadh_pi(_mm_loadl_pi(v_pivot_in, (const __m64*)(const void*)&vertex[2].pos), (const __m64*)(const void*)&vertex[3].pos), v_pivot_in);
+        const __m128 pos01 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(d01, v_cos), _mm_mul_ps(_mm_shuffle_ps(d01, d01, _MM_SHUFFLE(2, 3, 0, 1)), v_sin)), v_pivot_out);
+        const __m128 pos23 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(d23, v_cos), _mm_mul_ps(_mm_shuffle_ps(d23, d23, _MM_SHUFFLE(2, 3, 0, 1)), v_sin)), v_pivot_out);
+        _mm_storel_pi((__m64*)(void*)&vertex[0].pos, pos01);
+        _mm_storeh_pi((__m64*)(void*)&vertex[1].pos, pos01);
+        _mm_storel_pi((__m64*)(void*)&vertex[2].pos, pos23);
+        _mm_storeh_pi((__m64*)(void*)&vertex[3].pos, pos23);
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t v_pivot_in = vcombine_f32(vld1_f32(&pivot_in.x), vld1_f32(&pivot_in.x)), v_pivot_out = vcombine_f32(vld1_f32(&pivot_out.x), vld1_f32(&pivot_out.x));
+    const float sin_lanes[4] = { -sin_a, sin_a, -sin_a, sin_a };
+    const float32x4_t v_cos = vdupq_n_f32(cos_a), v_sin = vld1q_f32(sin_lanes);
+    for (; vertex + 4 <= vert_end; vertex += 4)
+    {
+        const float32x4_t d01 = vsubq_f32(vcombine_f32(vld1_f32(&vertex[0].pos.x), vld1_f32(&vertex[1].pos.x)), v_pivot_in);
+        const float32x4_t d23 = vsubq_f32(vcombine_f32(vld1_f32(&vertex[2].pos.x), vld1_f32(&vertex[3].pos.x)), v_pivot_in);
+        const float32x4_t pos01 = vaddq_f32(vaddq_f32(vmulq_f32(d01, v_cos), vmulq_f32(vrev64q_f32(d01), v_sin)), v_pivot_out);
+        const float32x4_t pos23 = vaddq_f32(vaddq_f32(vmulq_f32(d23, v_cos), vmulq_f32(vrev64q_f32(d23), v_sin)), v_pivot_out);
+        vst1_f32(&vertex[0].pos.x, vget_low_f32(pos01));
+        vst1_f32(&vertex[1].pos.x, vget_high_f32(pos01));
+        vst1_f32(&vertex[2].pos.x, vget_low_f32(pos23));
+        vst1_f32(&vertex[3].pos.x, vget_high_f32(pos23));
+    }
+#endif
+#endif // #ifdef IM_SHADEVERTS_SIMD
+    for (; vertex < vert_end; ++vertex)
         vertex->pos = ImRotate(vertex->pos- pivot_in, cos_a, sin_a) + pivot_out;
 }
 
@@ -3665,6 +5220,8 @@ void ImFont::BuildLookupTable()
     IndexAdvanceX.clear();
     IndexLookup.clear();
     DirtyLookupTables = false;
+    if (ContainerAtlas)
+        ContainerAtlas->BuildCount++;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
     GrowIndex(max_codepoint + 1);
     for (int i = 0; i < Glyphs.Size; i++)
@@ -3825,6 +5382,8 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
     GrowIndex(dst + 1);
     IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
     IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    if (ContainerAtlas)
+        ContainerAtlas->BuildCount++;
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c)
@@ -3852,7 +5411,7 @@ static inline const char* CalcWordWrapNextLineStartA(const char* text, const cha
 {
     while (text < text_end && ImCharIsBlankA(*text))
         text++;
-    if (*text == '\n')
+    if (text < text_end && *text == '\n')
         text++;
     return text;
 }
@@ -3961,12 +5520,24 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
 }
 
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining)
+{
+    return ImFontCalcTextSizeEx(this, size, max_width, wrap_width, text_begin, text_end, remaining, NULL);
+}
+
+// Same as ImFont::CalcTextSizeA(), optionally outputting the offset of every line start (first line included) into 'out_line_offsets'.
+// Rendering with ImFont::RenderText() from any of those offsets produces the same lines as rendering from 'text_begin'.
+ImVec2 ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining, ImVector<int>* out_line_offsets)
 {
     if (!text_end)
         text_end = text_begin + strlen(text_begin); // FIXME-OPT: Need to avoid this.
 
     const float line_height = size;
-    const float scale = size / FontSize;
+    const float scale = size / font->FontSize;
+    if (out_line_offsets)
+    {
+        out_line_offsets->resize(0);
+        out_line_offsets->push_back(0);
+    }
 
     ImVec2 text_size = ImVec2(0, 0);
     float line_width = 0.0f;
@@ -3981,7 +5552,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
         {
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
             if (!word_wrap_eol)
-                word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
+                word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
 
             if (s >= word_wrap_eol)
             {
@@ -3991,10 +5562,28 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 line_width = 0.0f;
                 word_wrap_eol = NULL;
                 s = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
+                if (out_line_offsets)
+                    out_line_offsets->push_back((int)(s - text_begin));
                 continue;
             }
         }
 
+        // Fast path: accumulate a run of printable ASCII characters without decoding
+        const char* run_end = ((unsigned char)*s >= ' ' && (unsigned char)*s < 0x80) ? ImTextFindAsciiRunEnd(s, word_wrap_enabled ? ImMin(word_wrap_eol, text_end) : text_end, ' ') : s;
+        if (run_end > s)
+        {
+            for (; s < run_end; s++)
+            {
+                const float char_width = ImFontGetCharAdvanceX(font, (unsigned char)*s) * scale;
+                if (line_width + char_width >= max_width)
+                    break;
+                line_width += char_width;
+            }
+            if (s < run_end)
+                break;
+            continue;
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
@@ -4010,13 +5599,15 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 text_size.x = ImMax(text_size.x, line_width);
                 text_size.y += line_height;
                 line_width = 0.0f;
+                if (out_line_offsets)
+                    out_line_offsets->push_back((int)(s - text_begin));
                 continue;
             }
             if (c == '\r')
                 continue;
         }
 
-        const float char_width = ImFontGetCharAdvanceX(this, c) * scale;
+        const float char_width = ImFontGetCharAdvanceX(font, c) * scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -4119,6 +5710,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
+    const char* ascii_run_end = s;
 
     while (s < text_end)
     {
@@ -4141,24 +5733,34 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         }
 
         // Decode and advance source
+        // Runs of printable ASCII characters are identified in bulk: they need no decoding and no control character checks.
         unsigned int c = (unsigned int)*s;
-        if (c < 0x80)
+        if (s >= ascii_run_end && c >= ' ' && c < 0x80)
+            ascii_run_end = ImTextFindAsciiRunEnd(s, text_end, ' ');
+        if (s < ascii_run_end)
+        {
             s += 1;
+        }
         else
-            s += ImTextCharFromUtf8(&c, s, text_end);
-
-        if (c < 32)
         {
-            if (c == '\n')
+            if (c < 0x80)
+                s += 1;
+            else
+                s += ImTextCharFromUtf8(&c, s, text_end);
+
+            if (c < 32)
             {
-                x = origin_x;
-                y += line_height;
-                if (y > clip_rect.w)
-                    break; // break out of main loop
-                continue;
+                if (c == '\n')
+                {
+                    x = origin_x;
+                    y += line_height;
+                    if (y > clip_rect.w)
+                        break; // break out of main loop
+                    continue;
+                }
+                if (c == '\r')
+                    continue;
             }
-            if (c == '\r')
-                continue;
         }
 
         const ImFontGlyph* glyph = FindGlyph((ImWchar)c);
@@ -56,11 +56,32 @@ Index of this file:
 #include <stdlib.h>     // NULL, malloc, free, qsort, atoi, atof
 #include <math.h>       // sqrtf, fabsf, fmodf, powf, floorf, ceilf, cosf, sinf
 #include <limits.h>     // INT_MIN, INT_MAX
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>     // _BitScanForward, _BitScanForward64
+#endif
 
 // Enable SSE intrinsics if available
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define IMGUI_ENABLE_SSE2
+#endif
+#endif
+
+// Enable NEON intrinsics if available (AArch64 only)
+#if (defined __aarch64__ || defined _M_ARM64) && !defined(IMGUI_DISABLE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+// Enable hardware CRC32C intrinsics when requested with IMGUI_USE_CRC32C (used by ImHashData/ImHashStr). Note that hashes will differ from the table-based CRC32.
+#if defined(IMGUI_USE_CRC32C) && (defined __SSE4_2__ || defined __AVX__) && defined(IMGUI_ENABLE_SSE)
+#define IMGUI_ENABLE_SSE4_2_CRC
+#include <nmmintrin.h>
+#elif defined(IMGUI_USE_CRC32C) && defined(__ARM_FEATURE_CRC32)
+#define IMGUI_ENABLE_ARM_CRC32
+#include <arm_acle.h>
 #endif
 
 // Visual Studio warnings
@@ -337,6 +358,8 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
 // - Helper: ImGuiTextIndex
+// - Helper: ImGuiTextSizeCache
+// - Helper: ImGuiTextWrapLayout
 // - Helper: ImGuiStorage
 //-----------------------------------------------------------------------------
 
@@ -356,6 +379,16 @@ IMGUI_API ImU32         ImAlphaBlendColors(ImU32 col_a, ImU32 col_b);
 static inline bool      ImIsPowerOfTwo(int v)           { return v != 0 && (v & (v - 1)) == 0; }
 static inline bool      ImIsPowerOfTwo(ImU64 v)         { return v != 0 && (v & (v - 1)) == 0; }
 static inline int       ImUpperPowerOfTwo(int v)        { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
+#if defined(__GNUC__) || defined(__clang__)
+static inline int       ImCountTrailingZeros32(ImU32 v) { IM_ASSERT(v != 0); return __builtin_ctz(v); }
+static inline int       ImCountTrailingZeros64(ImU64 v) { IM_ASSERT(v != 0); return __builtin_ctzll(v); }
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+static inline int       ImCountTrailingZeros32(ImU32 v) { IM_ASSERT(v != 0); unsigned long n; _BitScanForward(&n, v); return (int)n; }
+static inline int       ImCountTrailingZeros64(ImU64 v) { IM_ASSERT(v != 0); unsigned long n; _BitScanForward64(&n, v); return (int)n; }
+#else
+static inline int       ImCountTrailingZeros32(ImU32 v) { IM_ASSERT(v != 0); int n = 0; while ((v & 1) == 0) { v >>= 1; n++; } return n; }
+static inline int       ImCountTrailingZeros64(ImU64 v) { IM_ASSERT(v != 0); int n = 0; while ((v & 1) == 0) { v >>= 1; n++; } return n; }
+#endif
 
 // Helpers: String
 IMGUI_API int           ImStricmp(const char* str1, const char* str2);                      // Case insensitive compare.
@@ -374,6 +407,7 @@ IM_MSVC_RUNTIME_CHECKS_OFF
 static inline char      ImToUpper(char c)               { return (c >= 'a' && c <= 'z') ? c &= ~32 : c; }
 static inline bool      ImCharIsBlankA(char c)          { return c == ' ' || c == '\t'; }
 static inline bool      ImCharIsBlankW(unsigned int c)  { return c == ' ' || c == '\t' || c == 0x3000; }
+static inline bool      ImCharIsAlphaA(char c)          { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
 static inline bool      ImCharIsXdigitA(char c)         { return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f'); }
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
@@ -400,6 +434,41 @@ IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, cons
 IMGUI_API const char*   ImTextFindPreviousUtf8Codepoint(const char* in_text_start, const char* in_text_curr);                   // return previous UTF-8 code-point.
 IMGUI_API int           ImTextCountLines(const char* in_text, const char* in_text_end);                                         // return number of lines taken by text. trailing carriage return doesn't count as an extra line.
 
+// Helpers: ASCII runs
+// - Return end of the leading run of ASCII characters >= 'min_char' in [in_text, in_text_end), processing 16 bytes (SIMD) or 8 bytes (scalar) at a time.
+// - Use min_char = 1 to stop on zero-terminator and non-ASCII bytes, min_char = ' ' to also stop on control characters such as '\n'.
+static inline const char* ImTextFindAsciiRunEnd(const char* in_text, const char* in_text_end, char min_char)
+{
+    IM_ASSERT(min_char > 0);
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128i v_min = _mm_set1_epi8((char)(min_char - 1));
+    for (; in_text_end - in_text >= 16; in_text += 16)
+    {
+        const int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(const void*)in_text), v_min)) ^ 0xFFFF;
+        if (mask != 0)
+            return in_text + ImCountTrailingZeros32((ImU32)mask);
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const int8x16_t v_min = vdupq_n_s8((int8_t)(min_char - 1));
+    for (; in_text_end - in_text >= 16; in_text += 16)
+        if (vminvq_u8(vcgtq_s8(vld1q_s8((const int8_t*)(const void*)in_text), v_min)) != 0xFF)
+            break;
+#else
+    // Bytes >= 0x80 have their high bit set, bytes < min_char borrow into their high bit.
+    const ImU64 k01 = 0x0101010101010101ULL, k80 = 0x8080808080808080ULL;
+    for (; in_text_end - in_text >= 8; in_text += 8)
+    {
+        ImU64 w;
+        memcpy(&w, in_text, 8);
+        if (((w | ((w - k01 * (ImU64)min_char) & ~w)) & k80) != 0)
+            break;
+    }
+#endif
+    while (in_text < in_text_end && (signed char)*in_text >= min_char)
+        in_text++;
+    return in_text;
+}
+
 // Helpers: File System
 #ifdef IMGUI_DISABLE_FILE_FUNCTIONS
 #define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
@@ -728,8 +797,57 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: ImGuiTextSizeCache
+// Cache results of CalcTextSize() across frames. Enabled with io.ConfigTextSizeCache.
+// Entries are keyed by a hash of (font, font size, wrap width, text contents) and discarded when unused for MaxFrameAge frames.
+struct ImGuiTextSizeCacheEntry
+{
+    ImGuiID         Key;                                    // 0: unused slot
+    int             TextLen;
+    int             TextOffset;                             // Offset of a copy of the text in ImGuiTextSizeCache::TextBuffer, compared on lookup so that hash collisions can't return a wrong size
+    ImFont*         Font;
+    float           FontSize;
+    float           WrapWidth;
+    int             LastFrameUsed;
+    ImVec2          Size;
+};
+
+struct ImGuiTextSizeCache
+{
+    ImVector<ImGuiTextSizeCacheEntry> Slots;                // Open-addressing hash table (linear probing). Size is zero or a power of two, load factor is kept <= 50%.
+    ImVector<char>  TextBuffer;                             // Copies of the texts of all entries. Compacted when the table is rebuilt.
+    int             EntriesCount = 0;
+    int             MaxEntries = 32768;                     // Stop adding entries past this count, until unused ones are discarded.
+    int             MaxFrameAge = 60;                       // Discard entries unused for this number of frames.
+    int             FontAtlasBuildCount = -1;               // Discard all entries when fonts are rebuilt.
+    int             HitCount = 0;                           // Stats for current frame
+    int             MissCount = 0;
+    int             HitCountLastFrame = 0;                  // Stats for previous frame
+    int             MissCountLastFrame = 0;
+
+    void            Clear()                                 { Slots.clear(); TextBuffer.clear(); EntriesCount = 0; }
+};
+
+// Helper: ImGuiTextWrapLayout
+// Line starts of a word-wrapped text for a given font, font size and wrap width, so that only visible lines need to be processed.
+// Obtained with ImGui::GetTextWrapLayout(), which only rebuilds it when text contents, font or wrap width changed.
+struct ImGuiTextWrapLayout
+{
+    const char*     TextPtr = NULL;                         // Text pointer the layout was built from. Only used to find the layout, may be dangling.
+    int             TextLen = 0;
+    ImVector<char>  Text;                                   // Copy of text contents, compared on lookup.
+    ImFont*         Font = NULL;
+    int             FontAtlasBuildCount = -1;
+    float           FontSize = 0.0f;
+    float           WrapWidth = 0.0f;
+    int             LastFrameUsed = -1;
+    ImVec2          Size;                                   // Same as ImFont::CalcTextSizeA() output
+    ImVector<int>   LineOffsets;                            // Offset of each line start from text start. Rendering from any line start produces the same subsequent lines.
+};
+
 // Helper: ImGuiStorage
 IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStoragePair* in_end, ImGuiID key);
+IMGUI_API void              ImGuiStorageRebuildHashIndex(ImGuiStorage* storage);  // Rebuild hash index after reordering 'Data' when IsHashIndexEnabled()
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -759,6 +877,21 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: Maximum number of segments for an auto-tessellated bezier curve (see CurveTessellationTol).
+#define IM_DRAWLIST_CURVE_AUTO_SEGMENT_MAX                      1024
+
+// ImDrawList: Analytic shapes UV encoding (see "Analytic shapes" in imgui.h)
+#define IM_DRAWLIST_SHAPE_UV_BASE                               2       // floor(uv) >= 2 marks an analytic shape
+#define IM_DRAWLIST_SHAPE_ELLIPSE                               0
+#define IM_DRAWLIST_SHAPE_RECT_ROUNDED                          16      // + rounded corners mask
+#define IM_DRAWLIST_SHAPE_ROUNDING_STEPS                        1000    // Corner radius = (rounding_code / 1000)^2 * min(half_size.x, half_size.y)
+#define IM_DRAWLIST_SHAPE_MAX_EXTENT                            1.75f   // Quad extent in normalized space must stay within fract(uv)
+
+// ImDrawList: AddConcavePolyFilled() uses ear-clipping (O(N^2)) below this number of points, monotone decomposition (O(N log N)) above.
+#ifndef IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS
+#define IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS                 32
+#endif
+
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
 struct IMGUI_API ImDrawListSharedData
@@ -783,6 +916,7 @@ struct IMGUI_API ImDrawListSharedData
 
     ImDrawListSharedData();
     void SetCircleTessellationMaxError(float max_error);
+    void CopySettingsFrom(const ImDrawListSharedData& src);    // Copy everything but TempBuffer
 };
 
 struct ImDrawDataBuilder
@@ -1805,6 +1939,42 @@ struct IMGUI_API ImGuiMultiSelectState
 // [SECTION] Viewport support
 //-----------------------------------------------------------------------------
 
+// Per draw command data kept from previous frame to compute ImDrawData::DamageRects (see io.ConfigDrawDataDamageRects)
+struct ImGuiDamageCmd
+{
+    ImGuiID             Hash;           // Hash of ClipRect, TextureId (not texture contents), indices (relative to lowest vertex) and vertices. 0 for callbacks: never considered unchanged.
+    ImRect              Bounds;         // Bounding box of vertices, clipped by ClipRect
+};
+
+// Per draw list data kept from previous frame to compute ImDrawData::DamageRects
+struct ImGuiDamageList
+{
+    const ImDrawList*   DrawList;
+    int                 CmdsOffset;     // Index into ImGuiViewportDamage::Cmds[]
+    int                 CmdsCount;
+    ImRect              Bounds;         // Union of commands bounds
+    bool                Matched;        // Found in current frame
+};
+
+#define IMGUI_DAMAGE_BUFFER_AGE_MAX     4   // Highest io.DisplayBufferAge value handled, older back buffers are entirely redrawn
+
+struct ImGuiViewportDamage
+{
+    bool                        Valid;          // Previous frame data is available
+    ImVec2                      DisplayPos;
+    ImVec2                      DisplaySize;
+    ImVector<ImGuiDamageList>   Lists;          // Previous frame
+    ImVector<ImGuiDamageCmd>    Cmds;
+    ImVector<ImGuiDamageList>   ListsNext;      // Current frame, swapped with previous frame after update
+    ImVector<ImGuiDamageCmd>    CmdsNext;
+    ImVector<ImVec4>            Rects;          // Damage of current frame alone
+    ImVector<ImVec4>            RectsHistory[IMGUI_DAMAGE_BUFFER_AGE_MAX - 1]; // Damage of previous frames, most recent first. Unioned with current frame damage when back buffer is older than previous frame.
+    int                         RectsHistoryCount;
+    ImVector<ImVec4>            UserRects;      // Added by AddDamageRect(), for next Render()
+
+    ImGuiViewportDamage()       { Valid = false; RectsHistoryCount = 0; }
+};
+
 // ImGuiViewport Private/Internals fields (cardinal sin: we are using inheritance!)
 // Every instance of ImGuiViewport is in fact a ImGuiViewportP.
 struct ImGuiViewportP : public ImGuiViewport
@@ -1813,6 +1983,7 @@ struct ImGuiViewportP : public ImGuiViewport
     ImDrawList*         BgFgDrawLists[2];       // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;        // Temporary data while building final ImDrawData
+    ImGuiViewportDamage Damage;                 // Previous frame data to compute DrawDataP.DamageRects
 
     // Per-viewport work area
     // - Insets are >= 0.0f values, distance from viewport corners to work area.
@@ -1967,6 +2138,7 @@ struct ImGuiMetricsConfig
     bool        ShowDrawCmdMesh = true;
     bool        ShowDrawCmdBoundingBoxes = true;
     bool        ShowTextEncodingViewer = false;
+    bool        ShowDamageRects = false;
     bool        ShowAtlasTintedWithTextColor = false;
     int         ShowWindowsRectsType = -1;
     int         ShowTablesRectsType = -1;
@@ -2033,6 +2205,8 @@ struct ImGuiContext
     float                   FontScale;                          // == FontSize / Font->FontSize
     float                   CurrentDpiScale;                    // Current window/viewport DpiScale
     ImDrawListSharedData    DrawListSharedData;
+    ImGuiTextSizeCache      TextSizeCache;                      // Cross-frame cache for CalcTextSize(), when io.ConfigTextSizeCache is enabled.
+    ImVector<ImGuiTextWrapLayout*> TextWrapLayouts;             // Word-wrap layouts of long texts, discarded when unused for a frame. See GetTextWrapLayout().
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
@@ -2353,8 +2527,7 @@ struct ImGuiContext
     // (some of the highly frequently used data are interleaved in other structures above: DebugBreakXXX fields, DebugHookIdInfo, DebugLocateId etc.)
     int                     DebugDrawIdConflictsCount;          // Locked count (preserved when holding CTRL)
     ImGuiDebugLogFlags      DebugLogFlags;
-    ImGuiTextBuffer         DebugLogBuf;
-    ImGuiTextIndex          DebugLogIndex;
+    ImGuiTextLog            DebugLogBuf;                        // Bounded to 4 MB, oldest lines are dropped
     int                     DebugLogSkippedErrors;
     ImGuiDebugLogFlags      DebugLogAutoDisableFlags;
     ImU8                    DebugLogAutoDisableFrames;
@@ -2379,6 +2552,8 @@ struct ImGuiContext
     int                     WantCaptureMouseNextFrame;          // Explicit capture override via SetNextFrameWantCaptureMouse()/SetNextFrameWantCaptureKeyboard(). Default to -1.
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;
+    float                   RedrawRequestDelay;                 // Smallest delay requested via RequestRedraw() during the frame, FLT_MAX if none.
+    int                     RedrawFramesAfterInput;             // Number of frames to keep processing after input events, so interactions can settle (e.g. window auto-resize, items appearing after a click).
     ImVector<char>          TempBuffer;                         // Temporary text buffer
     char                    TempKeychordName[64];
 
@@ -2550,10 +2725,11 @@ struct IMGUI_API ImGuiWindow
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
 
 public:
-    ImGuiWindow(ImGuiContext* context, const char* name);
+    ImGuiWindow(ImGuiContext* context, ImStrv name);
     ~ImGuiWindow();
 
     ImGuiID     GetID(const char* str, const char* str_end = NULL);
+    ImGuiID     GetID(const ImGuiLabel& label);
     ImGuiID     GetID(const void* ptr);
     ImGuiID     GetID(int n);
     ImGuiID     GetIDFromPos(const ImVec2& p_abs);
@@ -3071,6 +3247,7 @@ namespace ImGui
     IMGUI_API void          SetLastItemData(ImGuiID item_id, ImGuiItemFlags in_flags, ImGuiItemStatusFlags status_flags, const ImRect& item_rect);
     IMGUI_API ImVec2        CalcItemSize(ImVec2 size, float default_w, float default_h);
     IMGUI_API float         CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x);
+    IMGUI_API ImGuiTextWrapLayout* GetTextWrapLayout(const char* text, const char* text_end, float wrap_width);
     IMGUI_API void          PushMultiItemsWidths(int components, float width_full);
     IMGUI_API void          ShrinkWidths(ImGuiShrinkWidthItem* items, int count, float width_excess);
 
@@ -3086,7 +3263,7 @@ namespace ImGui
     IMGUI_API void          LogSetNextTextDecoration(const char* prefix, const char* suffix);
 
     // Childs
-    IMGUI_API bool          BeginChildEx(const char* name, ImGuiID id, const ImVec2& size_arg, ImGuiChildFlags child_flags, ImGuiWindowFlags window_flags);
+    IMGUI_API bool          BeginChildEx(ImStrv name, ImGuiID id, const ImVec2& size_arg, ImGuiChildFlags child_flags, ImGuiWindowFlags window_flags);
 
     // Popups, Modals
     IMGUI_API bool          BeginPopupEx(ImGuiID id, ImGuiWindowFlags extra_window_flags);
@@ -3383,6 +3560,7 @@ namespace ImGui
     // Widgets
     IMGUI_API void          TextEx(const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0);
     IMGUI_API bool          ButtonEx(const char* label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
+    IMGUI_API bool          ButtonEx(const ImGuiLabel& label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
     IMGUI_API bool          ArrowButtonEx(const char* str_id, ImGuiDir dir, ImVec2 size_arg, ImGuiButtonFlags flags = 0);
     IMGUI_API bool          ImageButtonEx(ImGuiID id, ImTextureID texture_id, const ImVec2& image_size, const ImVec2& uv0, const ImVec2& uv1, const ImVec4& bg_col, const ImVec4& tint_col, ImGuiButtonFlags flags = 0);
     IMGUI_API void          SeparatorEx(ImGuiSeparatorFlags flags, float thickness = 1.0f);
@@ -3544,6 +3722,9 @@ IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
+// Font internal API
+IMGUI_API ImVec2    ImFontCalcTextSizeEx(ImFont* font, float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining, ImVector<int>* out_line_offsets);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
 //-----------------------------------------------------------------------------
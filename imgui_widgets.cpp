@@ -173,6 +173,32 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
     {
         // Common case
         const float wrap_width = wrap_enabled ? CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x) : 0.0f;
+        if (wrap_enabled && text_end - text > 2000 && !g.LogEnabled)
+        {
+            // Long wrapped text!
+            // Use cached line starts to skip measuring the whole text and only render visible lines.
+            // (can't skip when logging text)
+            ImGuiTextWrapLayout* layout = GetTextWrapLayout(text_begin, text_end, wrap_width);
+            IM_ASSERT(layout->TextLen == (int)(text_end - text_begin));
+            const ImVec2 text_size(IM_TRUNC(layout->Size.x + 0.99999f), layout->Size.y); // Same rounding as CalcTextSize()
+
+            ImRect bb(text_pos, text_pos + text_size);
+            ItemSize(text_size, 0.0f);
+            if (!ItemAdd(bb, 0))
+                return;
+
+            // Render from first visible line up to the line following the last visible one
+            // (same first line as ImFont::RenderText() fast-forward, which works from truncated position)
+            const float line_height = g.FontSize;
+            const int line_count = layout->LineOffsets.Size;
+            const int line_first = (int)ImClamp(ImCeil((window->ClipRect.Min.y - IM_TRUNC(bb.Min.y)) / line_height) - 1.0f, 0.0f, (float)(line_count - 1));
+            const int line_end = (int)ImClamp((window->ClipRect.Max.y - bb.Min.y) / line_height + 2.0f, (float)line_first, (float)line_count);
+            const char* line_first_begin = text_begin + ImMin(layout->LineOffsets[line_first], layout->TextLen);
+            const char* lines_end = (line_end < line_count) ? text_begin + ImMin(layout->LineOffsets[line_end], layout->TextLen) : text_end;
+            RenderTextWrapped(ImVec2(bb.Min.x, bb.Min.y + line_first * line_height), line_first_begin, lines_end, wrap_width);
+            return;
+        }
+
         const ImVec2 text_size = CalcTextSize(text_begin, text_end, false, wrap_width);
 
         ImRect bb(text_pos, text_pos + text_size);
@@ -263,6 +289,11 @@ void ImGui::TextUnformatted(const char* text, const char* text_end)
     TextEx(text, text_end, ImGuiTextFlags_NoWidthForLargeClippedText);
 }
 
+void ImGui::TextUnformatted(ImStrv text)
+{
+    TextEx(text.Begin, text.End, ImGuiTextFlags_NoWidthForLargeClippedText);
+}
+
 void ImGui::Text(const char* fmt, ...)
 {
     va_list args;
@@ -715,6 +746,11 @@ bool ImGui::ButtonBehavior(const ImRect& bb, ImGuiID id, bool* out_hovered, bool
 }
 
 bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags)
+{
+    return ButtonEx(ImGuiLabel(label, NULL), size_arg, flags);
+}
+
+bool ImGui::ButtonEx(const ImGuiLabel& label, const ImVec2& size_arg, ImGuiButtonFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -723,7 +759,7 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcTextSize(label.Begin, label.DisplayEnd, false);
 
     ImVec2 pos = window->DC.CursorPos;
     if ((flags & ImGuiButtonFlags_AlignTextBaseLine) && style.FramePadding.y < window->DC.CurrLineTextBaseOffset) // Try to vertically align buttons that are smaller/have no padding so that text baseline matches (bit hacky, since it shouldn't be a flag)
@@ -745,13 +781,13 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
 
     if (g.LogEnabled)
         LogSetNextTextDecoration("[", "]");
-    RenderTextClipped(bb.Min + style.FramePadding, bb.Max - style.FramePadding, label, NULL, &label_size, style.ButtonTextAlign, &bb);
+    RenderTextClipped(bb.Min + style.FramePadding, bb.Max - style.FramePadding, label.Begin, label.DisplayEnd, &label_size, style.ButtonTextAlign, &bb);
 
     // Automatically close popups
     //if (pressed && !(flags & ImGuiButtonFlags_DontClosePopups) && (window->Flags & ImGuiWindowFlags_Popup))
     //    CloseCurrentPopup();
 
-    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label.Begin, g.LastItemData.StatusFlags);
     return pressed;
 }
 
@@ -760,6 +796,16 @@ bool ImGui::Button(const char* label, const ImVec2& size_arg)
     return ButtonEx(label, size_arg, ImGuiButtonFlags_None);
 }
 
+bool ImGui::Button(const ImGuiLabel& label, const ImVec2& size_arg)
+{
+    return ButtonEx(label, size_arg, ImGuiButtonFlags_None);
+}
+
+bool ImGui::Button(ImStrv label, const ImVec2& size_arg)
+{
+    return ButtonEx(ImGuiLabel(label.Begin, label.End), size_arg, ImGuiButtonFlags_None);
+}
+
 // Small buttons fits within text without additional vertical spacing.
 bool ImGui::SmallButton(const char* label)
 {
@@ -1136,6 +1182,16 @@ bool ImGui::ImageButton(ImTextureID user_texture_id, const ImVec2& size, const I
 #endif // #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 
 bool ImGui::Checkbox(const char* label, bool* v)
+{
+    return Checkbox(ImGuiLabel(label, NULL), v);
+}
+
+bool ImGui::Checkbox(ImStrv label, bool* v)
+{
+    return Checkbox(ImGuiLabel(label.Begin, label.End), v);
+}
+
+bool ImGui::Checkbox(const ImGuiLabel& label, bool* v)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -1144,7 +1200,7 @@ bool ImGui::Checkbox(const char* label, bool* v)
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcTextSize(label.Begin, label.DisplayEnd, false);
 
     const float square_sz = GetFrameHeight();
     const ImVec2 pos = window->DC.CursorPos;
@@ -1155,7 +1211,7 @@ bool ImGui::Checkbox(const char* label, bool* v)
     if (!is_visible)
         if (!is_multi_select || !g.BoxSelectState.UnclipMode || !g.BoxSelectState.UnclipRect.Overlaps(total_bb)) // Extra layer of "no logic clip" for box-select support
         {
-            IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (*v ? ImGuiItemStatusFlags_Checked : 0));
+            IMGUI_TEST_ENGINE_ITEM_INFO(id, label.Begin, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (*v ? ImGuiItemStatusFlags_Checked : 0));
             return false;
         }
 
@@ -1204,9 +1260,9 @@ bool ImGui::Checkbox(const char* label, bool* v)
     if (g.LogEnabled)
         LogRenderedText(&label_pos, mixed_value ? "[~]" : *v ? "[x]" : "[ ]");
     if (is_visible && label_size.x > 0.0f)
-        RenderText(label_pos, label);
+        RenderText(label_pos, label.Begin, label.DisplayEnd, false);
 
-    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (*v ? ImGuiItemStatusFlags_Checked : 0));
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label.Begin, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Checkable | (*v ? ImGuiItemStatusFlags_Checked : 0));
     return pressed;
 }
 
@@ -1349,6 +1405,7 @@ void ImGui::ProgressBar(float fraction, const ImVec2& size_arg, const char* over
 
     if (is_indeterminate)
     {
+        RequestRedraw(); // Animated
         const float fill_width_n = 0.2f;
         fill_n0 = ImFmod(-fraction, 1.0f) * (1.0f + fill_width_n) - fill_width_n;
         fill_n1 = ImSaturate(fill_n0 + fill_width_n);
@@ -6330,12 +6387,22 @@ bool ImGui::TreeNode(const void* ptr_id, const char* fmt, ...)
 }
 
 bool ImGui::TreeNode(const char* label)
+{
+    return TreeNode(ImGuiLabel(label, NULL));
+}
+
+bool ImGui::TreeNode(ImStrv label)
+{
+    return TreeNode(ImGuiLabel(label.Begin, label.End));
+}
+
+bool ImGui::TreeNode(const ImGuiLabel& label)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
     ImGuiID id = window->GetID(label);
-    return TreeNodeBehavior(id, ImGuiTreeNodeFlags_None, label, NULL);
+    return TreeNodeBehavior(id, ImGuiTreeNodeFlags_None, label.Begin, label.DisplayEnd);
 }
 
 bool ImGui::TreeNodeV(const char* str_id, const char* fmt, va_list args)
@@ -6353,8 +6420,9 @@ bool ImGui::TreeNodeEx(const char* label, ImGuiTreeNodeFlags flags)
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
-    ImGuiID id = window->GetID(label);
-    return TreeNodeBehavior(id, flags, label, NULL);
+    ImGuiLabel label_info(label, NULL);
+    ImGuiID id = window->GetID(label_info);
+    return TreeNodeBehavior(id, flags, label_info.Begin, label_info.DisplayEnd);
 }
 
 bool ImGui::TreeNodeEx(const char* str_id, ImGuiTreeNodeFlags flags, const char* fmt, ...)
@@ -6827,6 +6895,16 @@ bool ImGui::CollapsingHeader(const char* label, ImGuiTreeNodeFlags flags)
     return TreeNodeBehavior(id, flags | ImGuiTreeNodeFlags_CollapsingHeader, label);
 }
 
+bool ImGui::CollapsingHeader(ImStrv label, ImGuiTreeNodeFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    ImGuiLabel label_info(label.Begin, label.End);
+    ImGuiID id = window->GetID(label_info);
+    return TreeNodeBehavior(id, flags | ImGuiTreeNodeFlags_CollapsingHeader, label_info.Begin, label_info.DisplayEnd);
+}
+
 // p_visible == NULL                        : regular collapsing header
 // p_visible != NULL && *p_visible == true  : show a small close button on the corner of the header, clicking the button will set *p_visible = false
 // p_visible != NULL && *p_visible == false : do not show the header at all
@@ -6875,6 +6953,16 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
 // With this scheme, ImGuiSelectableFlags_SpanAllColumns and ImGuiSelectableFlags_AllowOverlap are also frequently used flags.
 // FIXME: Selectable() with (size.x == 0.0f) and (SelectableTextAlign.x > 0.0f) followed by SameLine() is currently not supported.
 bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
+{
+    return Selectable(ImGuiLabel(label, NULL), selected, flags, size_arg);
+}
+
+bool ImGui::Selectable(ImStrv label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
+{
+    return Selectable(ImGuiLabel(label.Begin, label.End), selected, flags, size_arg);
+}
+
+bool ImGui::Selectable(const ImGuiLabel& label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -6885,7 +6973,7 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
 
     // Submit label or explicit size to ItemSize(), whereas ItemAdd() will submit a larger/spanning rectangle.
     ImGuiID id = window->GetID(label);
-    ImVec2 label_size = CalcTextSize(label, NULL, true);
+    ImVec2 label_size = CalcTextSize(label.Begin, label.DisplayEnd, false);
     ImVec2 size(size_arg.x != 0.0f ? size_arg.x : label_size.x, size_arg.y != 0.0f ? size_arg.y : label_size.y);
     ImVec2 pos = window->DC.CursorPos;
     pos.y += window->DC.CurrLineTextBaseOffset;
@@ -7042,7 +7130,7 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
     }
 
     if (is_visible)
-        RenderTextClipped(text_min, text_max, label, NULL, &label_size, style.SelectableTextAlign, &bb);
+        RenderTextClipped(text_min, text_max, label.Begin, label.DisplayEnd, &label_size, style.SelectableTextAlign, &bb);
 
     // Automatically close popups
     if (pressed && (window->Flags & ImGuiWindowFlags_Popup) && !(flags & ImGuiSelectableFlags_NoAutoClosePopups) && (g.LastItemData.ItemFlags & ImGuiItemFlags_AutoClosePopups))
@@ -7054,7 +7142,7 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
     // Selectable() always returns a pressed state!
     // Users of BeginMultiSelect()/EndMultiSelect() scope: you may call ImGui::IsItemToggledSelection() to retrieve
     // selection toggle, only useful if you need that state updated (e.g. for rendering purpose) before reaching EndMultiSelect().
-    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags);
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label.Begin, g.LastItemData.StatusFlags);
     return pressed; //-V1020
 }
 
@@ -8016,6 +8104,7 @@ void ImGuiSelectionBasicStorage::Clear()
     Size = 0;
     _SelectionOrder = 1; // Always >0
     _Storage.Data.resize(0);
+    _Storage._HashIndex.resize(0);
 }
 
 void ImGuiSelectionBasicStorage::Swap(ImGuiSelectionBasicStorage& r)
@@ -8023,6 +8112,8 @@ void ImGuiSelectionBasicStorage::Swap(ImGuiSelectionBasicStorage& r)
     ImSwap(Size, r.Size);
     ImSwap(_SelectionOrder, r._SelectionOrder);
     _Storage.Data.swap(r._Storage.Data);
+    _Storage._HashIndex.swap(r._Storage._HashIndex);
+    ImSwap(_Storage._HashIndexEnabled, r._Storage._HashIndexEnabled);
 }
 
 bool ImGuiSelectionBasicStorage::Contains(ImGuiID id) const
@@ -8044,7 +8135,11 @@ bool ImGuiSelectionBasicStorage::GetNextSelectedItem(void** opaque_it, ImGuiID*
     ImGuiStoragePair* it = (ImGuiStoragePair*)*opaque_it;
     ImGuiStoragePair* it_end = _Storage.Data.Data + _Storage.Data.Size;
     if (PreserveOrder && it == NULL && it_end != NULL)
+    {
         ImQsort(_Storage.Data.Data, (size_t)_Storage.Data.Size, sizeof(ImGuiStoragePair), PairComparerByValueInt); // ~ImGuiStorage::BuildSortByValueInt()
+        if (_Storage.IsHashIndexEnabled())
+            ImGuiStorageRebuildHashIndex(&_Storage);
+    }
     if (it == NULL)
         it = _Storage.Data.Data;
     IM_ASSERT(it >= _Storage.Data.Data && it <= it_end);
@@ -8070,6 +8165,15 @@ void ImGuiSelectionBasicStorage::SetItemSelected(ImGuiID id, bool selected)
 static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicStorage* selection, ImGuiID id, bool selected, int size_before_amends, int selection_order)
 {
     ImGuiStorage* storage = &selection->_Storage;
+    if (storage->IsHashIndexEnabled())
+    {
+        // Hash indexed storage has O(1) insertion: no need for the append + sort scheme.
+        if (selected == (storage->GetInt(id, 0) != 0))
+            return;
+        storage->SetInt(id, selected ? selection_order : 0);
+        selection->Size += selected ? +1 : -1;
+        return;
+    }
     ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + size_before_amends, id);
     const bool is_contained = (it != storage->Data.Data + size_before_amends) && (it->key == id);
     if (selected == (is_contained && it->val_i != 0))
@@ -8084,7 +8188,7 @@ static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicS
 static void ImGuiSelectionBasicStorage_BatchFinish(ImGuiSelectionBasicStorage* selection, bool selected, int size_before_amends)
 {
     ImGuiStorage* storage = &selection->_Storage;
-    if (selected && selection->Size != size_before_amends)
+    if (selected && selection->Size != size_before_amends && !storage->IsHashIndexEnabled())
         storage->BuildSortByKey(); // When done selecting: sort everything
 }
 
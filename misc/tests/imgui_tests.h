@@ -0,0 +1,66 @@
+// dear imgui: shared helpers for the programs in misc/tests/
+// Those are small standalone programs (no backend) checking results against reference implementations and measuring timings.
+// They are not part of the library and are only used to validate changes to the core.
+
+#pragma once
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <chrono>
+
+static int GTestErrors = 0;
+
+#define IM_CHECK(_EXPR)             do { if (!(_EXPR)) { fprintf(stderr, "%s(%d): check failed: %s\n", __FILE__, __LINE__, #_EXPR); GTestErrors++; } } while (0)
+#define IM_CHECK_MSG(_EXPR, ...)    do { if (!(_EXPR)) { fprintf(stderr, "%s(%d): check failed: %s: ", __FILE__, __LINE__, #_EXPR); fprintf(stderr, __VA_ARGS__); fprintf(stderr, "\n"); GTestErrors++; } } while (0)
+
+// Deterministic pseudo-random numbers (xorshift32), so that failures are reproducible.
+struct ImTestRandom
+{
+    ImU32   State;
+    ImTestRandom(ImU32 seed = 0x12345678) { State = seed ? seed : 1; }
+    ImU32   Next()                      { State ^= State << 13; State ^= State >> 17; State ^= State << 5; return State; }
+    int     Int(int min, int max)       { return min + (int)(Next() % (ImU32)(max - min + 1)); }
+    float   Float(float min, float max) { return min + (max - min) * (float)(Next() >> 8) / (float)(1 << 24); }
+};
+
+// Run 'func' 'count' times and return the best time of 'repeat' runs, in nanoseconds per call.
+// Taking the best run is more stable than the average on a noisy machine.
+template<typename T>
+static inline double ImTestBench(int count, int repeat, T func)
+{
+    double best = 1e30;
+    for (int r = 0; r < repeat; r++)
+    {
+        std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+        for (int n = 0; n < count; n++)
+            func();
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / count;
+        if (ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+// Create a context with a built font atlas so draw lists can be used without a backend.
+static inline void ImTestCreateContext()
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+}
+
+static inline int ImTestExit(const char* name)
+{
+    if (GTestErrors == 0)
+        printf("%s: OK\n", name);
+    else
+        printf("%s: %d error(s)\n", name, GTestErrors);
+    return GTestErrors == 0 ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+// dear imgui: scalar emulation of the NEON intrinsics used by the library, for misc/tests/
+// This lets the NEON code paths be compiled and checked on machines without an AArch64 toolchain (e.g. 'make WITH_NEON_EMULATION=1 run' on x86).
+// - Only the intrinsics used by imgui*.cpp are provided. Lane indices and shift counts are regular arguments instead of immediates.
+// - Float operations are done one lane at a time with the same IEEE operations, so results match hardware for everything
+//   we use (no estimates: vrecpe/vrsqrte are not used). Build with -ffp-contract=off so the compiler doesn't fuse them either.
+// - This is force-included (-include) with IMGUI_DISABLE_SSE and IMGUI_ENABLE_NEON defined, see Makefile.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+template<typename T, int N> struct ImNeonEmuVec { T v[N]; };
+typedef ImNeonEmuVec<float, 2>      float32x2_t;
+typedef ImNeonEmuVec<float, 4>      float32x4_t;
+typedef ImNeonEmuVec<int8_t, 16>    int8x16_t;
+typedef ImNeonEmuVec<uint8_t, 8>    uint8x8_t;
+typedef ImNeonEmuVec<uint8_t, 16>   uint8x16_t;
+typedef ImNeonEmuVec<int16_t, 4>    int16x4_t;
+typedef ImNeonEmuVec<int16_t, 8>    int16x8_t;
+typedef ImNeonEmuVec<uint16_t, 8>   uint16x8_t;
+typedef ImNeonEmuVec<int32_t, 4>    int32x4_t;
+typedef ImNeonEmuVec<uint32_t, 4>   uint32x4_t;
+typedef ImNeonEmuVec<uint64_t, 1>   uint64x1_t;
+struct float32x4x2_t { float32x4_t val[2]; };
+
+#define IM_NEON_EMU_MAP1(R, EXPR)           { R r; for (int i = 0; i < (int)(sizeof(r.v) / sizeof(r.v[0])); i++) r.v[i] = (EXPR); return r; }
+static inline uint32_t ImNeonEmuMask32(bool b)   { return b ? 0xFFFFFFFFu : 0u; }
+
+// Load/store
+static inline float32x2_t   vld1_f32(const float* p)                                { float32x2_t r; memcpy(r.v, p, sizeof(r.v)); return r; }
+static inline float32x4_t   vld1q_f32(const float* p)                               { float32x4_t r; memcpy(r.v, p, sizeof(r.v)); return r; }
+static inline int8x16_t     vld1q_s8(const int8_t* p)                               { int8x16_t r; memcpy(r.v, p, sizeof(r.v)); return r; }
+static inline uint8x16_t    vld1q_u8(const uint8_t* p)                              { uint8x16_t r; memcpy(r.v, p, sizeof(r.v)); return r; }
+static inline uint32x4_t    vld1q_u32(const uint32_t* p)                            { uint32x4_t r; memcpy(r.v, p, sizeof(r.v)); return r; }
+static inline float32x4x2_t vld2q_f32(const float* p)                               { float32x4x2_t r; for (int i = 0; i < 4; i++) { r.val[0].v[i] = p[i * 2]; r.val[1].v[i] = p[i * 2 + 1]; } return r; }
+static inline void          vst1_f32(float* p, float32x2_t a)                       { memcpy(p, a.v, sizeof(a.v)); }
+static inline void          vst1q_f32(float* p, float32x4_t a)                      { memcpy(p, a.v, sizeof(a.v)); }
+static inline void          vst1q_u32(uint32_t* p, uint32x4_t a)                    { memcpy(p, a.v, sizeof(a.v)); }
+static inline void          vst2q_f32(float* p, float32x4x2_t a)                    { for (int i = 0; i < 4; i++) { p[i * 2] = a.val[0].v[i]; p[i * 2 + 1] = a.val[1].v[i]; } }
+
+// Set/get lanes, combine, reinterpret
+static inline float32x4_t   vdupq_n_f32(float a)                                    IM_NEON_EMU_MAP1(float32x4_t, a)
+static inline int8x16_t     vdupq_n_s8(int8_t a)                                    IM_NEON_EMU_MAP1(int8x16_t, a)
+static inline uint8x16_t    vdupq_n_u8(uint8_t a)                                   IM_NEON_EMU_MAP1(uint8x16_t, a)
+static inline uint32x4_t    vdupq_n_u32(uint32_t a)                                 IM_NEON_EMU_MAP1(uint32x4_t, a)
+static inline float         vgetq_lane_f32(float32x4_t a, int lane)                 { return a.v[lane]; }
+static inline uint64_t      vget_lane_u64(uint64x1_t a, int lane)                   { return a.v[lane]; }
+static inline float32x2_t   vget_low_f32(float32x4_t a)                             { float32x2_t r = { { a.v[0], a.v[1] } }; return r; }
+static inline float32x2_t   vget_high_f32(float32x4_t a)                            { float32x2_t r = { { a.v[2], a.v[3] } }; return r; }
+static inline float32x4_t   vcombine_f32(float32x2_t a, float32x2_t b)              { float32x4_t r = { { a.v[0], a.v[1], b.v[0], b.v[1] } }; return r; }
+static inline int16x8_t     vcombine_s16(int16x4_t a, int16x4_t b)                  { int16x8_t r; for (int i = 0; i < 4; i++) { r.v[i] = a.v[i]; r.v[i + 4] = b.v[i]; } return r; }
+static inline uint8x16_t    vcombine_u8(uint8x8_t a, uint8x8_t b)                   { uint8x16_t r; for (int i = 0; i < 8; i++) { r.v[i] = a.v[i]; r.v[i + 8] = b.v[i]; } return r; }
+static inline float32x4_t   vrev64q_f32(float32x4_t a)                              { float32x4_t r = { { a.v[1], a.v[0], a.v[3], a.v[2] } }; return r; }
+static inline float32x4_t   vextq_f32(float32x4_t a, float32x4_t b, int n)          { float32x4_t r; for (int i = 0; i < 4; i++) r.v[i] = (i + n < 4) ? a.v[i + n] : b.v[i + n - 4]; return r; }
+static inline uint32x4_t    vreinterpretq_u32_u8(uint8x16_t a)                      { uint32x4_t r; memcpy(r.v, a.v, sizeof(r.v)); return r; }
+static inline uint16x8_t    vreinterpretq_u16_u8(uint8x16_t a)                      { uint16x8_t r; memcpy(r.v, a.v, sizeof(r.v)); return r; }
+static inline uint8x16_t    vreinterpretq_u8_u32(uint32x4_t a)                      { uint8x16_t r; memcpy(r.v, a.v, sizeof(r.v)); return r; }
+static inline uint32x4_t    vreinterpretq_u32_f32(float32x4_t a)                    { uint32x4_t r; memcpy(r.v, a.v, sizeof(r.v)); return r; }
+static inline float32x4_t   vreinterpretq_f32_u32(uint32x4_t a)                     { float32x4_t r; memcpy(r.v, a.v, sizeof(r.v)); return r; }
+static inline uint64x1_t    vreinterpret_u64_u8(uint8x8_t a)                        { uint64x1_t r; memcpy(r.v, a.v, sizeof(r.v)); return r; }
+
+// Float arithmetic
+static inline float32x4_t   vaddq_f32(float32x4_t a, float32x4_t b)                 IM_NEON_EMU_MAP1(float32x4_t, a.v[i] + b.v[i])
+static inline float32x4_t   vsubq_f32(float32x4_t a, float32x4_t b)                 IM_NEON_EMU_MAP1(float32x4_t, a.v[i] - b.v[i])
+static inline float32x4_t   vmulq_f32(float32x4_t a, float32x4_t b)                 IM_NEON_EMU_MAP1(float32x4_t, a.v[i] * b.v[i])
+static inline float32x4_t   vmulq_n_f32(float32x4_t a, float b)                     IM_NEON_EMU_MAP1(float32x4_t, a.v[i] * b)
+static inline float32x4_t   vmulq_laneq_f32(float32x4_t a, float32x4_t b, int lane) IM_NEON_EMU_MAP1(float32x4_t, a.v[i] * b.v[lane])
+static inline float32x4_t   vdivq_f32(float32x4_t a, float32x4_t b)                 IM_NEON_EMU_MAP1(float32x4_t, a.v[i] / b.v[i])
+static inline float32x4_t   vsqrtq_f32(float32x4_t a)                               IM_NEON_EMU_MAP1(float32x4_t, sqrtf(a.v[i]))
+static inline float32x4_t   vnegq_f32(float32x4_t a)                                IM_NEON_EMU_MAP1(float32x4_t, -a.v[i])
+// FMIN/FMAX: NaN if either operand is NaN, -0.0f < +0.0f
+static inline float         ImNeonEmuMin(float a, float b)                          { if (a != a || b != b) return a + b; if (a == b) return signbit(a) ? a : b; return a < b ? a : b; }
+static inline float         ImNeonEmuMax(float a, float b)                          { if (a != a || b != b) return a + b; if (a == b) return signbit(a) ? b : a; return a > b ? a : b; }
+static inline float32x4_t   vminq_f32(float32x4_t a, float32x4_t b)                 IM_NEON_EMU_MAP1(float32x4_t, ImNeonEmuMin(a.v[i], b.v[i]))
+static inline float32x4_t   vmaxq_f32(float32x4_t a, float32x4_t b)                 IM_NEON_EMU_MAP1(float32x4_t, ImNeonEmuMax(a.v[i], b.v[i]))
+
+// Comparisons and bitwise
+static inline uint32x4_t    vcgtq_f32(float32x4_t a, float32x4_t b)                 IM_NEON_EMU_MAP1(uint32x4_t, ImNeonEmuMask32(a.v[i] > b.v[i]))
+static inline uint32x4_t    vcltq_f32(float32x4_t a, float32x4_t b)                 IM_NEON_EMU_MAP1(uint32x4_t, ImNeonEmuMask32(a.v[i] < b.v[i]))
+static inline uint8x16_t    vcgtq_s8(int8x16_t a, int8x16_t b)                      IM_NEON_EMU_MAP1(uint8x16_t, (uint8_t)(a.v[i] > b.v[i] ? 0xFF : 0))
+static inline uint8x16_t    vceqq_u8(uint8x16_t a, uint8x16_t b)                    IM_NEON_EMU_MAP1(uint8x16_t, (uint8_t)(a.v[i] == b.v[i] ? 0xFF : 0))
+static inline uint8x16_t    vandq_u8(uint8x16_t a, uint8x16_t b)                    IM_NEON_EMU_MAP1(uint8x16_t, (uint8_t)(a.v[i] & b.v[i]))
+static inline uint8x16_t    vorrq_u8(uint8x16_t a, uint8x16_t b)                    IM_NEON_EMU_MAP1(uint8x16_t, (uint8_t)(a.v[i] | b.v[i]))
+static inline uint32x4_t    vandq_u32(uint32x4_t a, uint32x4_t b)                   IM_NEON_EMU_MAP1(uint32x4_t, a.v[i] & b.v[i])
+static inline uint32x4_t    vorrq_u32(uint32x4_t a, uint32x4_t b)                   IM_NEON_EMU_MAP1(uint32x4_t, a.v[i] | b.v[i])
+static inline float32x4_t   vbslq_f32(uint32x4_t m, float32x4_t a, float32x4_t b)   { float32x4_t r; for (int i = 0; i < 4; i++) { uint32_t ua, ub; memcpy(&ua, &a.v[i], 4); memcpy(&ub, &b.v[i], 4); uint32_t ur = (ua & m.v[i]) | (ub & ~m.v[i]); memcpy(&r.v[i], &ur, 4); } return r; }
+static inline uint8_t       vminvq_u8(uint8x16_t a)                                 { uint8_t r = a.v[0]; for (int i = 1; i < 16; i++) r = a.v[i] < r ? a.v[i] : r; return r; }
+
+// Conversions and narrowing
+static inline int32_t       ImNeonEmuCvtS32(float f)                                { if (f != f) return 0; if (f >= 2147483648.0f) return INT32_MAX; if (f <= -2147483648.0f) return INT32_MIN; return (int32_t)f; } // FCVTZS: truncate, saturate, NaN -> 0
+static inline int32x4_t     vcvtq_s32_f32(float32x4_t a)                            IM_NEON_EMU_MAP1(int32x4_t, ImNeonEmuCvtS32(a.v[i]))
+static inline int16x4_t     vqmovn_s32(int32x4_t a)                                 IM_NEON_EMU_MAP1(int16x4_t, (int16_t)(a.v[i] < INT16_MIN ? INT16_MIN : a.v[i] > INT16_MAX ? INT16_MAX : a.v[i]))
+static inline uint8x8_t     vqmovun_s16(int16x8_t a)                                IM_NEON_EMU_MAP1(uint8x8_t, (uint8_t)(a.v[i] < 0 ? 0 : a.v[i] > 255 ? 255 : a.v[i]))
+static inline uint8x8_t     vshrn_n_u16(uint16x8_t a, int n)                        IM_NEON_EMU_MAP1(uint8x8_t, (uint8_t)(a.v[i] >> n))
+
+#undef IM_NEON_EMU_MAP1
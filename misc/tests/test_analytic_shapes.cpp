@@ -0,0 +1,236 @@
+// dear imgui: analytic shapes tests, CPU side (ImGuiBackendFlags_RendererHasAnalyticShapes, see "Analytic shapes" in imgui.h)
+// - Check that AddCircleFilled(), AddEllipseFilled() and rounded AddRectFilled() output a single quad, and decode its UV:
+//   shape kind and corner mask in floor(uv.x), corner radius in floor(uv.y), position in shape normalized space in fract(uv).
+// - Check the fallbacks to tessellation: shape too small for its fringe, AntiAliasedFill disabled, a texture other than the font atlas
+//   bound, explicit segment count, backend flag not set. (The IMGUI_USE_COMPACT_DRAWVERT fallback is checked in test_compact_drawvert.cpp)
+
+#include "imgui_tests.h"
+#include <math.h>
+
+struct DecodedVert
+{
+    int     Kind;       // floor(uv.x) - 2
+    int     Code;       // floor(uv.y) - 2
+    ImVec2  Q;          // Position in shape normalized space
+};
+
+static DecodedVert DecodeVert(const ImDrawVert& vert)
+{
+    DecodedVert d;
+    const ImVec2 code(ImFloor(vert.uv.x), ImFloor(vert.uv.y));
+    d.Kind = (int)code.x - IM_DRAWLIST_SHAPE_UV_BASE;
+    d.Code = (int)code.y - IM_DRAWLIST_SHAPE_UV_BASE;
+    d.Q = ImVec2((vert.uv.x - code.x - 0.5f) * 4.0f, (vert.uv.y - code.y - 0.5f) * 4.0f);
+    return d;
+}
+
+static void InitDrawList(ImDrawList* draw_list)
+{
+    draw_list->ResetForThread();
+    IM_CHECK(draw_list->Flags & ImDrawListFlags_AnalyticShapes);
+}
+
+// Check that the draw list holds a single quad encoding the shape, with the quad corners mapping to 'center + q.x * axis_x + q.y * axis_y'
+static void CheckQuad(const ImDrawList* draw_list, const char* desc, const ImVec2& center, const ImVec2& axis_x, const ImVec2& axis_y, const ImVec2& half_size, int kind, int code)
+{
+    IM_CHECK_MSG(draw_list->VtxBuffer.Size == 4 && draw_list->IdxBuffer.Size == 6, "%s: %d vertices, %d indices", desc, draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size);
+    if (draw_list->VtxBuffer.Size != 4 || draw_list->IdxBuffer.Size != 6)
+        return;
+    IM_CHECK(draw_list->CmdBuffer.back().ElemCount == 6);
+    for (int n = 0; n < 6; n++)
+        IM_CHECK(draw_list->IdxBuffer[n] < 4);
+    const float aa_size = draw_list->_FringeScale;
+    for (const ImDrawVert& vert : draw_list->VtxBuffer)
+    {
+        const DecodedVert d = DecodeVert(vert);
+        IM_CHECK_MSG(d.Kind == kind && d.Code == code, "%s: kind %d code %d, expected %d %d", desc, d.Kind, d.Code, kind, code);
+        const ImVec2 pos_expected = center + axis_x * d.Q.x + axis_y * d.Q.y;
+        IM_CHECK_MSG(ImFabs(vert.pos.x - pos_expected.x) < 0.01f && ImFabs(vert.pos.y - pos_expected.y) < 0.01f, "%s: vertex (%f,%f) decodes to (%f,%f)", desc, vert.pos.x, vert.pos.y, pos_expected.x, pos_expected.y);
+        IM_CHECK_MSG(ImFabs(ImFabs(d.Q.x) - (half_size.x + aa_size) / half_size.x) < 0.001f && ImFabs(ImFabs(d.Q.y) - (half_size.y + aa_size) / half_size.y) < 0.001f, "%s: quad doesn't extend by the fringe", desc);
+        IM_CHECK(vert.col == IM_COL32(255, 128, 0, 200));
+    }
+}
+
+// Check that the draw list holds a tessellated shape, without any encoded UV
+static void CheckTessellated(const ImDrawList* draw_list, const char* desc)
+{
+    IM_CHECK_MSG(draw_list->VtxBuffer.Size > 4, "%s: %d vertices", desc, draw_list->VtxBuffer.Size);
+    for (const ImDrawVert& vert : draw_list->VtxBuffer)
+        IM_CHECK_MSG(vert.uv.x <= 1.0f && vert.uv.y <= 1.0f, "%s: uv (%f,%f)", desc, vert.uv.x, vert.uv.y);
+}
+
+// Same clamping as PathRect(): at most half the size minus 1 along sides with two rounded corners
+static float ClampRounding(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
+{
+    if ((flags & ImDrawFlags_RoundCornersMask_) == 0)
+        flags |= ImDrawFlags_RoundCornersAll;
+    rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
+    rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
+    return rounding;
+}
+
+static void TestEncoding()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    const ImU32 col = IM_COL32(255, 128, 0, 200);
+
+    // Circles
+    const float radii[] = { 2.0f, 6.0f, 40.0f, 1000.0f };
+    for (float radius : radii)
+    {
+        InitDrawList(&draw_list);
+        draw_list.AddCircleFilled(ImVec2(100.5f, 200.25f), radius, col);
+        CheckQuad(&draw_list, "circle", ImVec2(100.5f, 200.25f), ImVec2(radius, 0.0f), ImVec2(0.0f, radius), ImVec2(radius, radius), IM_DRAWLIST_SHAPE_ELLIPSE, 0);
+    }
+
+    // Ellipses, rotated: local axes are rotated, 'q' stays in normalized space
+    const float rotations[] = { 0.0f, 0.3f, IM_PI * 0.5f, -2.0f };
+    for (float rot : rotations)
+    {
+        InitDrawList(&draw_list);
+        const ImVec2 radius(50.0f, 20.0f);
+        draw_list.AddEllipseFilled(ImVec2(300.0f, 300.0f), radius, col, rot);
+        const ImVec2 axis_x(ImCos(rot) * radius.x, ImSin(rot) * radius.x), axis_y(-ImSin(rot) * radius.y, ImCos(rot) * radius.y);
+        CheckQuad(&draw_list, "ellipse", ImVec2(300.0f, 300.0f), axis_x, axis_y, radius, IM_DRAWLIST_SHAPE_ELLIPSE, 0);
+    }
+
+    // Rounded rectangles: corners mask and radius code
+    struct RectCase { ImDrawFlags Flags; int Mask; };
+    const RectCase rect_cases[] =
+    {
+        { ImDrawFlags_None, 15 }, { ImDrawFlags_RoundCornersAll, 15 },
+        { ImDrawFlags_RoundCornersTopLeft, 1 }, { ImDrawFlags_RoundCornersTopRight, 2 }, { ImDrawFlags_RoundCornersBottomLeft, 4 }, { ImDrawFlags_RoundCornersBottomRight, 8 },
+        { ImDrawFlags_RoundCornersTop, 3 }, { ImDrawFlags_RoundCornersLeft, 5 }, { ImDrawFlags_RoundCornersBottom | ImDrawFlags_RoundCornersTopLeft, 13 },
+    };
+    const float roundings[] = { 0.5f, 4.0f, 12.5f, 25.0f };
+    for (const RectCase& rect_case : rect_cases)
+        for (float rounding : roundings)
+        {
+            InitDrawList(&draw_list);
+            const ImVec2 p_min(10.0f, 20.0f), p_max(110.0f, 70.0f);
+            const ImVec2 half_size = (p_max - p_min) * 0.5f;
+            draw_list.AddRectFilled(p_min, p_max, col, rounding, rect_case.Flags);
+            if (draw_list.VtxBuffer.Size != 4)
+            {
+                IM_CHECK_MSG(0, "rounded rect flags 0x%X rounding %f: %d vertices", rect_case.Flags, rounding, draw_list.VtxBuffer.Size);
+                continue;
+            }
+            const int code = DecodeVert(draw_list.VtxBuffer[0]).Code;
+            CheckQuad(&draw_list, "rounded rect", (p_min + p_max) * 0.5f, ImVec2(half_size.x, 0.0f), ImVec2(0.0f, half_size.y), half_size, IM_DRAWLIST_SHAPE_RECT_ROUNDED + rect_case.Mask, code);
+            const float decoded_ratio = (float)code / IM_DRAWLIST_SHAPE_ROUNDING_STEPS;
+            const float decoded_rounding = decoded_ratio * decoded_ratio * ImMin(half_size.x, half_size.y);
+            const float expected_rounding = ClampRounding(p_min, p_max, rounding, rect_case.Flags);
+            IM_CHECK_MSG(ImFabs(decoded_rounding - expected_rounding) < 0.05f, "rounding %f (clamped to %f) decodes to %f", rounding, expected_rounding, decoded_rounding);
+        }
+
+    // Rounding larger than the rectangle is clamped like the tessellated path (here to 24, the half height minus 1)
+    InitDrawList(&draw_list);
+    draw_list.AddRectFilled(ImVec2(10.0f, 20.0f), ImVec2(110.0f, 70.0f), col, 100.0f);
+    IM_CHECK(draw_list.VtxBuffer.Size == 4 && DecodeVert(draw_list.VtxBuffer[0]).Code == (int)(ImSqrt(24.0f / 25.0f) * IM_DRAWLIST_SHAPE_ROUNDING_STEPS + 0.5f));
+
+    // Several shapes: one quad each, all in the same draw command
+    InitDrawList(&draw_list);
+    for (int n = 0; n < 100; n++)
+        draw_list.AddCircleFilled(ImVec2(10.0f * n, 10.0f), 5.0f, col);
+    IM_CHECK(draw_list.VtxBuffer.Size == 400 && draw_list.IdxBuffer.Size == 600 && draw_list.CmdBuffer.Size == 1);
+}
+
+static void TestFallbacks()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    const ImU32 col = IM_COL32(255, 128, 0, 200);
+
+    // Too small for the anti-aliasing fringe: the quad would extend beyond IM_DRAWLIST_SHAPE_MAX_EXTENT in normalized space
+    const float min_radius = 1.0f / (IM_DRAWLIST_SHAPE_MAX_EXTENT - 1.0f); // With _FringeScale == 1.0f
+    InitDrawList(&draw_list);
+    draw_list.AddCircleFilled(ImVec2(100.0f, 100.0f), min_radius * 0.9f, col);
+    CheckTessellated(&draw_list, "small circle");
+    InitDrawList(&draw_list);
+    draw_list.AddCircleFilled(ImVec2(100.0f, 100.0f), min_radius * 1.01f, col);
+    IM_CHECK(draw_list.VtxBuffer.Size == 4);
+    InitDrawList(&draw_list);
+    draw_list.AddEllipseFilled(ImVec2(100.0f, 100.0f), ImVec2(50.0f, 1.0f), col);
+    CheckTessellated(&draw_list, "thin ellipse");
+    InitDrawList(&draw_list);
+    draw_list._FringeScale = 4.0f; // e.g. zoomed out
+    draw_list.AddCircleFilled(ImVec2(100.0f, 100.0f), 4.0f, col);
+    CheckTessellated(&draw_list, "circle with large fringe");
+    InitDrawList(&draw_list);
+    draw_list.AddRectFilled(ImVec2(10.0f, 10.0f), ImVec2(200.0f, 11.5f), col, 0.7f);
+    CheckTessellated(&draw_list, "thin rounded rect");
+
+    // A single rounded corner may exceed the smallest half size, which the encoding can't represent
+    InitDrawList(&draw_list);
+    draw_list.AddRectFilled(ImVec2(10.0f, 20.0f), ImVec2(110.0f, 70.0f), col, 40.0f, ImDrawFlags_RoundCornersTopLeft);
+    CheckTessellated(&draw_list, "large single corner");
+
+    // Explicit segment count
+    InitDrawList(&draw_list);
+    draw_list.AddCircleFilled(ImVec2(100.0f, 100.0f), 20.0f, col, 12);
+    CheckTessellated(&draw_list, "circle with num_segments");
+    InitDrawList(&draw_list);
+    draw_list.AddEllipseFilled(ImVec2(100.0f, 100.0f), ImVec2(20.0f, 10.0f), col, 0.0f, 12);
+    CheckTessellated(&draw_list, "ellipse with num_segments");
+
+    // Not rounded: regular rectangle using the white pixel
+    InitDrawList(&draw_list);
+    draw_list.AddRectFilled(ImVec2(10.0f, 10.0f), ImVec2(100.0f, 100.0f), col, 0.0f);
+    IM_CHECK(draw_list.VtxBuffer.Size == 4 && draw_list.VtxBuffer[0].uv.x <= 1.0f);
+
+    // Texture other than the font atlas bound: its UV may legitimately be > 1.0f
+    InitDrawList(&draw_list);
+    draw_list.PushTextureID((ImTextureID)(intptr_t)0x1234);
+    draw_list.AddCircleFilled(ImVec2(100.0f, 100.0f), 20.0f, col);
+    draw_list.AddRectFilled(ImVec2(10.0f, 10.0f), ImVec2(100.0f, 100.0f), col, 8.0f);
+    draw_list.PopTextureID();
+    CheckTessellated(&draw_list, "user texture");
+
+    // Anti-aliased fill disabled on the draw list
+    InitDrawList(&draw_list);
+    draw_list.Flags &= ~ImDrawListFlags_AntiAliasedFill;
+    draw_list.AddCircleFilled(ImVec2(100.0f, 100.0f), 20.0f, col);
+    CheckTessellated(&draw_list, "no AntiAliasedFill");
+}
+
+// Analytic shapes are enabled by NewFrame() from backend flags and style
+static void TestFlags()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGuiStyle& style = ImGui::GetStyle();
+    const ImDrawListSharedData* shared_data = ImGui::GetDrawListSharedData();
+
+    ImGui::NewFrame();
+    IM_CHECK((shared_data->InitialFlags & ImDrawListFlags_AnalyticShapes) != 0);
+    ImGui::EndFrame();
+
+    style.AntiAliasedFill = false;
+    ImGui::NewFrame();
+    IM_CHECK((shared_data->InitialFlags & ImDrawListFlags_AnalyticShapes) == 0);
+    ImGui::EndFrame();
+    style.AntiAliasedFill = true;
+
+    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasAnalyticShapes;
+    ImGui::NewFrame();
+    IM_CHECK((shared_data->InitialFlags & ImDrawListFlags_AnalyticShapes) == 0);
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    draw_list.ResetForThread();
+    draw_list.AddCircleFilled(ImVec2(100.0f, 100.0f), 20.0f, IM_COL32_WHITE);
+    CheckTessellated(&draw_list, "backend flag not set");
+    ImGui::EndFrame();
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasAnalyticShapes;
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasAnalyticShapes;
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame(); // Setup shared data
+    TestEncoding();
+    TestFallbacks();
+    ImGui::EndFrame();
+    TestFlags();
+    ImGui::DestroyContext();
+    return ImTestExit("test_analytic_shapes");
+}
@@ -0,0 +1,332 @@
+// dear imgui: ImDrawList batched primitives tests and benchmark
+// - Check AddRectsFilled(), AddLines(), AddCirclesFilled(), AddImages() against loops of AddRectFilled(), AddLine(), AddCircleFilled(),
+//   AddImage(): same vertices, and same triangles once indices are resolved with ImDrawCmd::VtxOffset.
+// - Cover all anti-aliasing paths (lines: non-AA, textured, thin, thick; fill: AA or not), fringe scales, per-shape color arrays,
+//   zero alpha shapes, shapes culled by the clipping rectangle, and counts crossing the 16K vertices chunks and the 64K vertices
+//   limit of 16-bit indices.
+// - Measure 1M shapes, batched vs single-shape calls.
+
+#include "imgui_tests.h"
+
+enum ShapeType { ShapeType_Rects, ShapeType_Lines, ShapeType_Circles, ShapeType_Images, ShapeType_COUNT };
+static const char* ShapeTypeNames[] = { "AddRectsFilled", "AddLines", "AddCirclesFilled", "AddImages" };
+static const ImTextureID TEST_TEX_ID = (ImTextureID)(intptr_t)0x1234;
+
+struct TestShapes
+{
+    ShapeType           Type;
+    ImVector<ImVec2>    A, B;           // p_min/p_max, p1/p2, centers
+    ImVector<ImVec2>    UvA, UvB;
+    ImVector<ImU32>     Cols;
+    ImU32               Col;
+    bool                UseCols;
+    bool                UseUvs;
+    float               Thickness;
+    float               Radius;
+    int                 NumSegments;
+};
+
+static void AddShapesSingle(ImDrawList* draw_list, const TestShapes& s, int n)
+{
+    const ImU32 col = s.UseCols ? s.Cols[n] : s.Col;
+    switch (s.Type)
+    {
+    case ShapeType_Rects:   draw_list->AddRectFilled(s.A[n], s.B[n], col); break;
+    case ShapeType_Lines:   draw_list->AddLine(s.A[n], s.B[n], col, s.Thickness); break;
+    case ShapeType_Circles: draw_list->AddCircleFilled(s.A[n], s.Radius, col, s.NumSegments); break;
+    case ShapeType_Images:  draw_list->AddImage(TEST_TEX_ID, s.A[n], s.B[n], s.UseUvs ? s.UvA[n] : ImVec2(0, 0), s.UseUvs ? s.UvB[n] : ImVec2(1, 1), col); break;
+    default: IM_ASSERT(0);
+    }
+}
+
+static void AddShapesBatched(ImDrawList* draw_list, const TestShapes& s)
+{
+    const ImU32* cols = s.UseCols ? s.Cols.Data : NULL;
+    switch (s.Type)
+    {
+    case ShapeType_Rects:   draw_list->AddRectsFilled(s.A.Data, s.B.Data, s.A.Size, s.Col, cols); break;
+    case ShapeType_Lines:   draw_list->AddLines(s.A.Data, s.B.Data, s.A.Size, s.Col, s.Thickness, cols); break;
+    case ShapeType_Circles: draw_list->AddCirclesFilled(s.A.Data, s.A.Size, s.Radius, s.Col, s.NumSegments, cols); break;
+    case ShapeType_Images:  draw_list->AddImages(TEST_TEX_ID, s.A.Data, s.B.Data, s.UseUvs ? s.UvA.Data : NULL, s.UseUvs ? s.UvB.Data : NULL, s.A.Size, s.Col, cols); break;
+    default: IM_ASSERT(0);
+    }
+}
+
+// Bounding box of the shape, 'inner' is covered by the shape and 'outer' contains all its vertices
+static void GetShapeBounds(const TestShapes& s, int n, ImRect* inner, ImRect* outer)
+{
+    const float fringe = 2.0f;
+    if (s.Type == ShapeType_Circles)
+    {
+        *inner = ImRect(s.A[n] - ImVec2(s.Radius * 0.5f, s.Radius * 0.5f), s.A[n] + ImVec2(s.Radius * 0.5f, s.Radius * 0.5f));
+        *outer = ImRect(s.A[n] - ImVec2(s.Radius + fringe, s.Radius + fringe), s.A[n] + ImVec2(s.Radius + fringe, s.Radius + fringe));
+        return;
+    }
+    ImVec2 a = s.A[n], b = s.B[n];
+    if (s.Type == ShapeType_Lines)
+        a += ImVec2(0.5f, 0.5f), b += ImVec2(0.5f, 0.5f);
+    *inner = ImRect(ImMin(a, b), ImMax(a, b));
+    *outer = *inner;
+    if (s.Type == ShapeType_Lines)
+        outer->Expand(s.Thickness * 0.5f + fringe + 1.0f);
+}
+
+// Shapes either overlap the clipping rectangle by at least 1 pixel (must be drawn), or are clearly outside of it (must be culled)
+static bool IsShapeVisible(const TestShapes& s, int n, const ImRect& clip_rect, bool* out_ambiguous)
+{
+    ImRect inner, outer;
+    GetShapeBounds(s, n, &inner, &outer);
+    ImRect clip_inner = clip_rect;
+    clip_inner.Expand(-1.0f);
+    ImRect clip_outer = clip_rect;
+    clip_outer.Expand(8.0f);
+    const bool visible = clip_inner.Overlaps(inner);
+    const bool culled = !clip_outer.Overlaps(outer);
+    *out_ambiguous = !visible && !culled;
+    return visible;
+}
+
+// Shapes are spread over the clipping rectangle extended by 'area_extend' times its size on each side
+static void GenerateShapes(TestShapes* s, ShapeType type, int count, const ImRect& clip_rect, float area_extend, ImTestRandom& rng)
+{
+    s->Type = type;
+    s->A.resize(0);
+    s->B.resize(0);
+    s->UvA.resize(0);
+    s->UvB.resize(0);
+    s->Cols.resize(0);
+    const ImRect area(clip_rect.Min - clip_rect.GetSize() * area_extend, clip_rect.Max + clip_rect.GetSize() * area_extend);
+    while (s->A.Size < count)
+    {
+        const ImVec2 a(rng.Float(area.Min.x, area.Max.x), rng.Float(area.Min.y, area.Max.y));
+        const ImVec2 b = a + ImVec2(rng.Float(-60.0f, 60.0f), rng.Float(-60.0f, 60.0f));
+        s->A.push_back(a);
+        s->B.push_back((type == ShapeType_Lines && rng.Int(0, 20) == 0) ? a : b); // Some zero-length lines
+        bool ambiguous;
+        IsShapeVisible(*s, s->A.Size - 1, clip_rect, &ambiguous);
+        if (ambiguous)
+        {
+            s->A.pop_back();
+            s->B.pop_back();
+            continue;
+        }
+        s->UvA.push_back(ImVec2(rng.Float(0.0f, 1.0f), rng.Float(0.0f, 1.0f)));
+        s->UvB.push_back(ImVec2(rng.Float(0.0f, 1.0f), rng.Float(0.0f, 1.0f)));
+        const ImU32 alpha = (rng.Int(0, 10) == 0) ? 0 : (ImU32)rng.Int(1, 255); // Some zero alpha shapes
+        s->Cols.push_back((rng.Next() & 0x00FFFFFF) | (alpha << IM_COL32_A_SHIFT));
+    }
+}
+
+static void ResetDrawList(ImDrawList* draw_list, ImDrawListFlags flags, float fringe_scale, const ImRect& clip_rect)
+{
+    draw_list->ResetForThread();
+    draw_list->Flags = flags | ImDrawListFlags_AllowVtxOffset;
+    draw_list->_FringeScale = fringe_scale;
+    draw_list->PushClipRect(clip_rect.Min, clip_rect.Max);
+}
+
+// Same vertices, and same triangles/textures/clip rectangles once indices are resolved with VtxOffset.
+// AddCirclesFilled() computes fringe normals once around the origin, AddCircleFilled() from points around the center: with tiny
+// segments (e.g. 1000 segments for a 1 pixel radius) normals differ by float rounding, moving fringe vertices by ~1/400 pixel.
+static const float POS_TOLERANCE = 0.01f;
+
+static bool CompareDrawLists(const ImDrawList* draw_list, const ImDrawList* ref)
+{
+    IM_CHECK_MSG(draw_list->VtxBuffer.Size == ref->VtxBuffer.Size, "%d vertices, expected %d", draw_list->VtxBuffer.Size, ref->VtxBuffer.Size);
+    IM_CHECK_MSG(draw_list->IdxBuffer.Size == ref->IdxBuffer.Size, "%d indices, expected %d", draw_list->IdxBuffer.Size, ref->IdxBuffer.Size);
+    if (draw_list->VtxBuffer.Size != ref->VtxBuffer.Size || draw_list->IdxBuffer.Size != ref->IdxBuffer.Size)
+        return false;
+    for (int n = 0; n < ref->VtxBuffer.Size; n++)
+    {
+        const ImDrawVert& v = draw_list->VtxBuffer[n];
+        const ImDrawVert& v_ref = ref->VtxBuffer[n];
+        if (ImFabs(v.pos.x - v_ref.pos.x) > POS_TOLERANCE || ImFabs(v.pos.y - v_ref.pos.y) > POS_TOLERANCE || v.uv.x != v_ref.uv.x || v.uv.y != v_ref.uv.y || v.col != v_ref.col)
+        {
+            IM_CHECK_MSG(0, "vertex %d: (%f,%f) uv (%f,%f) col %08X, expected (%f,%f) uv (%f,%f) col %08X", n, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col, v_ref.pos.x, v_ref.pos.y, v_ref.uv.x, v_ref.uv.y, v_ref.col);
+            return false;
+        }
+    }
+
+    // Resolve indices of both lists
+    const ImDrawList* lists[2] = { draw_list, ref };
+    ImVector<unsigned int> resolved[2];
+    ImVector<const ImDrawCmd*> resolved_cmds[2];
+    for (int list_n = 0; list_n < 2; list_n++)
+    {
+        const ImDrawList* list = lists[list_n];
+        int idx_total = 0;
+        for (const ImDrawCmd& cmd : list->CmdBuffer)
+        {
+            IM_CHECK(cmd.IdxOffset == (unsigned int)idx_total);
+            for (unsigned int i = cmd.IdxOffset; i < cmd.IdxOffset + cmd.ElemCount; i++)
+            {
+                const unsigned int vtx_idx = cmd.VtxOffset + (unsigned int)list->IdxBuffer[i];
+                IM_CHECK(vtx_idx < (unsigned int)list->VtxBuffer.Size);
+                resolved[list_n].push_back(vtx_idx);
+                resolved_cmds[list_n].push_back(&cmd);
+            }
+            idx_total += (int)cmd.ElemCount;
+        }
+        IM_CHECK(idx_total == list->IdxBuffer.Size);
+        IM_CHECK(list->_VtxCurrentIdx == (unsigned int)(list->VtxBuffer.Size - (int)list->_CmdHeader.VtxOffset)); // Next shape can be appended
+        IM_CHECK(list->_VtxWritePtr == list->VtxBuffer.Data + list->VtxBuffer.Size && list->_IdxWritePtr == list->IdxBuffer.Data + list->IdxBuffer.Size);
+    }
+    for (int i = 0; i < resolved[1].Size; i++)
+    {
+        const ImDrawCmd* cmd = resolved_cmds[0][i];
+        const ImDrawCmd* cmd_ref = resolved_cmds[1][i];
+        if (resolved[0][i] != resolved[1][i] || cmd->TextureId != cmd_ref->TextureId || memcmp(&cmd->ClipRect, &cmd_ref->ClipRect, sizeof(ImVec4)) != 0)
+        {
+            IM_CHECK_MSG(0, "index %d: vertex %u, expected %u", i, resolved[0][i], resolved[1][i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void CheckShapes(const TestShapes& s, ImDrawListFlags flags, float fringe_scale, const ImRect& clip_rect)
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawList ref(ImGui::GetDrawListSharedData());
+    ResetDrawList(&draw_list, flags, fringe_scale, clip_rect);
+    ResetDrawList(&ref, flags, fringe_scale, clip_rect);
+
+    // Leading and trailing single shapes, to check the batched functions append to existing contents and leave the list usable
+    draw_list.AddRectFilled(ImVec2(10, 10), ImVec2(20, 20), IM_COL32_WHITE);
+    ref.AddRectFilled(ImVec2(10, 10), ImVec2(20, 20), IM_COL32_WHITE);
+    AddShapesBatched(&draw_list, s);
+    for (int n = 0; n < s.A.Size; n++)
+    {
+        bool ambiguous;
+        if (IsShapeVisible(s, n, clip_rect, &ambiguous))
+            AddShapesSingle(&ref, s, n);
+    }
+    draw_list.AddRectFilled(ImVec2(30, 30), ImVec2(40, 40), IM_COL32_WHITE);
+    ref.AddRectFilled(ImVec2(30, 30), ImVec2(40, 40), IM_COL32_WHITE);
+
+    if (!CompareDrawLists(&draw_list, &ref))
+        fprintf(stderr, "  in %s, %d shapes, %s, flags 0x%X, fringe %.1f, clip (%.0f,%.0f)-(%.0f,%.0f), thickness %.2f, radius %.1f, segments %d\n",
+            ShapeTypeNames[s.Type], s.A.Size, s.UseCols ? "cols[]" : "col", flags, fringe_scale, clip_rect.Min.x, clip_rect.Min.y, clip_rect.Max.x, clip_rect.Max.y, s.Thickness, s.Radius, s.NumSegments);
+}
+
+static void TestMatchesSingleShapes()
+{
+    ImTestRandom rng;
+    TestShapes s;
+    const ImRect clip_full(0.0f, 0.0f, 1920.0f, 1080.0f);
+    const ImRect clip_small(300.0f, 200.0f, 700.0f, 500.0f);
+    const float thicknesses[] = { 1.0f, 0.5f, 1.5f, 2.0f, 3.0f, 7.0f, 70.0f };
+    const float radii[] = { 0.3f, 1.0f, 3.0f, 20.0f, 150.0f };
+    const int num_segments_list[] = { 0, 3, 5, 64, 1000 };
+    const ImDrawListFlags flags_list[] =
+    {
+        0,
+        ImDrawListFlags_AntiAliasedLines,
+        ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex,
+        ImDrawListFlags_AntiAliasedFill,
+        ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedFill,
+    };
+    const float fringe_scales[] = { 1.0f, 2.0f };
+
+    for (int type = 0; type < ShapeType_COUNT; type++)
+        for (ImDrawListFlags flags : flags_list)
+            for (float fringe_scale : fringe_scales)
+                for (int clip_n = 0; clip_n < 2; clip_n++)
+                    for (int use_cols = 0; use_cols < 2; use_cols++)
+                    {
+                        // Lines: all thicknesses, circles: all radii and segment counts (shapes are generated after, their culling depends on those)
+                        const ImRect& clip_rect = clip_n ? clip_small : clip_full;
+                        const int variants_count = (type == ShapeType_Lines) ? IM_ARRAYSIZE(thicknesses) : (type == ShapeType_Circles) ? IM_ARRAYSIZE(radii) * IM_ARRAYSIZE(num_segments_list) : 1;
+                        for (int variant = 0; variant < variants_count; variant++)
+                        {
+                            s.UseCols = use_cols != 0;
+                            s.UseUvs = rng.Int(0, 1) != 0;
+                            s.Col = (rng.Int(0, 4) == 0) ? IM_COL32(255, 255, 255, 0) : IM_COL32(255, 128, 0, 200); // Zero alpha 'col' draws nothing, unless 'cols' is used
+                            s.Thickness = (type == ShapeType_Lines) ? thicknesses[variant] : 1.0f;
+                            s.Radius = (type == ShapeType_Circles) ? radii[variant / IM_ARRAYSIZE(num_segments_list)] : 10.0f;
+                            s.NumSegments = (type == ShapeType_Circles) ? num_segments_list[variant % IM_ARRAYSIZE(num_segments_list)] : 0;
+                            GenerateShapes(&s, (ShapeType)type, rng.Int(0, 300), clip_rect, 1.0f, rng);
+                            CheckShapes(s, flags, fringe_scale, clip_rect);
+                        }
+                        if (GTestErrors > 10)
+                            return;
+                    }
+}
+
+// Counts crossing the 16K vertices chunks, and the 64K vertices limit of 16-bit indices (new ImDrawCmd with a VtxOffset)
+static void TestLargeCounts()
+{
+    ImTestRandom rng(0xB16);
+    TestShapes s;
+    const ImRect clip_rect(0.0f, 0.0f, 1920.0f, 1080.0f);
+    const ImDrawListFlags flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill;
+    const int counts[] = { 4095, 4096, 4097, 16383, 16384, 16385, 40000 };
+    for (int type = 0; type < ShapeType_COUNT; type++)
+        for (int count : counts)
+        {
+            s.UseCols = (count & 1) != 0;
+            s.UseUvs = true;
+            s.Col = IM_COL32(255, 128, 0, 200);
+            s.Thickness = 3.0f;     // 8 vertices per line
+            s.Radius = 4.0f;
+            s.NumSegments = 0;
+            GenerateShapes(&s, (ShapeType)type, count, clip_rect, 0.05f, rng);
+            CheckShapes(s, flags, 1.0f, clip_rect);
+            if (GTestErrors > 10)
+                return;
+        }
+
+    // Check that we crossed the 64K vertices limit
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ResetDrawList(&draw_list, flags, 1.0f, clip_rect);
+    GenerateShapes(&s, ShapeType_Rects, 40000, clip_rect, 0.05f, rng);
+    s.UseCols = false;
+    AddShapesBatched(&draw_list, s);
+    if (sizeof(ImDrawIdx) == 2)
+        IM_CHECK(draw_list.CmdBuffer.Size >= 2 && draw_list._CmdHeader.VtxOffset > 0);
+    IM_CHECK(draw_list.VtxBuffer.Size > 65536);
+}
+
+static void Benchmark()
+{
+    const int count = 1000000;
+    ImTestRandom rng(0xBE7C);
+    TestShapes s;
+    const ImRect clip_rect(0.0f, 0.0f, 1920.0f, 1080.0f);
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    printf("Batched shapes: %d shapes, ns per shape (single -> batched):\n", count);
+    for (int type = 0; type < ShapeType_COUNT; type++)
+    {
+        s.Type = (ShapeType)type;
+        s.A.resize(count);
+        s.B.resize(count);
+        for (int n = 0; n < count; n++)
+        {
+            s.A[n] = ImVec2(rng.Float(0.0f, 1920.0f), rng.Float(0.0f, 1080.0f));
+            s.B[n] = s.A[n] + ImVec2(rng.Float(1.0f, 8.0f), rng.Float(1.0f, 8.0f));
+        }
+        s.UseCols = false;
+        s.UseUvs = false;
+        s.Col = IM_COL32(255, 128, 0, 200);
+        s.Thickness = 1.0f;     // Textured AA lines
+        s.Radius = 3.0f;
+        s.NumSegments = 6;      // Hexagons, so that 1M shapes stay below 256 MB of vertices
+        const ImDrawListFlags flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedFill;
+        const double ns_single = ImTestBench(1, 3, [&]() { ResetDrawList(&draw_list, flags, 1.0f, clip_rect); for (int n = 0; n < count; n++) AddShapesSingle(&draw_list, s, n); }) / count;
+        const double ns_batched = ImTestBench(1, 3, [&]() { ResetDrawList(&draw_list, flags, 1.0f, clip_rect); AddShapesBatched(&draw_list, s); }) / count;
+        printf("  %-16s %6.1f -> %6.1f (%d vertices)\n", ShapeTypeNames[type], ns_single, ns_batched, draw_list.VtxBuffer.Size);
+    }
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame(); // Setup shared data
+    TestMatchesSingleShapes();
+    TestLargeCounts();
+    Benchmark();
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ImTestExit("test_batched_shapes");
+}
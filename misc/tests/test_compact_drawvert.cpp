@@ -0,0 +1,148 @@
+// dear imgui: compact ImDrawVert layout tests (IMGUI_USE_COMPACT_DRAWVERT)
+// This program and its copy of the library are built with IMGUI_USE_COMPACT_DRAWVERT (see Makefile).
+// - Check that quantized positions are within 1/8 pixel of the written value (half a step with the default 2 bits of fraction).
+// - Check that positions out of the -8192..+8191.75 range are clamped without asserting, and that rectangles crossing the range are
+//   drawn as the same rectangle clipped to the range.
+// - Run frames with geometry beyond the range (tall scrolled child window, large canvas rectangles and lines).
+// - Check that analytic shapes are not used, even when the backend supports them.
+
+#include "imgui_tests.h"
+#include <math.h>
+
+#ifndef IMGUI_USE_COMPACT_DRAWVERT
+#error "Build with -DIMGUI_USE_COMPACT_DRAWVERT"
+#endif
+
+static const float POS_STEP = 1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS);
+static const float POS_MIN = -32768.0f * POS_STEP;
+static const float POS_MAX = 32767.0f * POS_STEP;
+
+static float QuantizeRef(float f)
+{
+    return ImClamp(f, POS_MIN, POS_MAX);
+}
+
+static void TestQuantize()
+{
+    IM_CHECK(sizeof(ImDrawVert) == 12);
+    ImTestRandom rng;
+    ImDrawVertFixed16 q;
+    for (int n = 0; n < 1000000; n++)
+    {
+        const float f = (n & 1) ? rng.Float(POS_MIN, POS_MAX) : (float)rng.Int(-32768, 32767) * POS_STEP + (float)rng.Int(-1, 1) * POS_STEP * 0.5f; // Random, and exact steps/ties
+        q = f;
+        const float err = ImFabs((float)q - QuantizeRef(f));
+        IM_CHECK_MSG(err <= POS_STEP * 0.5f, "f=%f -> %f", f, (float)q);
+        if (GTestErrors > 10)
+            return;
+    }
+
+    // Out of range: clamped
+    const float out_of_range[] = { 8192.0f, 10000.0f, 20000.0f, 1e9f, FLT_MAX, -8192.25f, -8193.0f, -20000.0f, -1e9f, -FLT_MAX };
+    for (float f : out_of_range)
+    {
+        q = f;
+        IM_CHECK_MSG((float)q == (f > 0.0f ? POS_MAX : POS_MIN), "f=%f -> %f", f, (float)q);
+    }
+
+    // Accumulating operators quantize each result
+    q = 100.0f;
+    q += 0.3f;
+    IM_CHECK((float)q == 100.25f);
+    q -= 20000.0f;
+    IM_CHECK((float)q == POS_MIN);
+}
+
+// Rectangles crossing the range give the rectangle clipped to the range
+static void TestDrawListClamp()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    draw_list.ResetForThread();
+    draw_list.Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill;
+    const ImVec4 rects[] = { ImVec4(-20000.0f, 10.3f, 100.6f, 30000.0f), ImVec4(5.1f, -1e6f, 1e6f, 7.9f), ImVec4(-9000.0f, -9000.0f, 9000.0f, 9000.0f), ImVec4(1.0f, 2.0f, 3.0f, 4.0f) };
+    for (const ImVec4& r : rects)
+    {
+        const int vtx_start = draw_list.VtxBuffer.Size;
+        draw_list.AddRectFilled(ImVec2(r.x, r.y), ImVec2(r.z, r.w), IM_COL32_WHITE);
+        IM_CHECK(draw_list.VtxBuffer.Size == vtx_start + 4);
+        for (int n = vtx_start; n < draw_list.VtxBuffer.Size; n++)
+        {
+            const ImVec2 pos = draw_list.VtxBuffer[n].pos;
+            const float expected_x = (ImFabs(pos.x - QuantizeRef(r.x)) < ImFabs(pos.x - QuantizeRef(r.z))) ? QuantizeRef(r.x) : QuantizeRef(r.z);
+            const float expected_y = (ImFabs(pos.y - QuantizeRef(r.y)) < ImFabs(pos.y - QuantizeRef(r.w))) ? QuantizeRef(r.y) : QuantizeRef(r.w);
+            IM_CHECK_MSG(ImFabs(pos.x - expected_x) <= POS_STEP * 0.5f && ImFabs(pos.y - expected_y) <= POS_STEP * 0.5f, "rect (%f,%f)-(%f,%f): vertex (%f,%f)", r.x, r.y, r.z, r.w, pos.x, pos.y);
+        }
+    }
+
+    // Other shapes beyond the range: no assert, all vertices in range
+    draw_list.AddLine(ImVec2(-50000.0f, 100.0f), ImVec2(50000.0f, 120.0f), IM_COL32_WHITE, 2.0f);
+    draw_list.AddCircleFilled(ImVec2(8000.0f, 0.0f), 1000.0f, IM_COL32_WHITE);
+    draw_list.AddRect(ImVec2(-10000.0f, -10000.0f), ImVec2(10000.0f, 10000.0f), IM_COL32_WHITE, 8.0f, 0, 3.0f);
+    draw_list.AddText(ImVec2(8180.0f, 10.0f), IM_COL32_WHITE, "Text crossing the range");
+    for (const ImDrawVert& vert : draw_list.VtxBuffer)
+        IM_CHECK(vert.pos.x >= POS_MIN && vert.pos.x <= POS_MAX && vert.pos.y >= POS_MIN && vert.pos.y <= POS_MAX);
+}
+
+// Analytic shapes encode UV > 1.0f, which the compact layout can't store: they are never enabled (see test_analytic_shapes.cpp)
+static void TestNoAnalyticShapes()
+{
+    IM_CHECK((ImGui::GetDrawListSharedData()->InitialFlags & ImDrawListFlags_AnalyticShapes) == 0);
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    draw_list.ResetForThread();
+    draw_list.AddCircleFilled(ImVec2(100.0f, 100.0f), 20.0f, IM_COL32_WHITE);
+    draw_list.AddRectFilled(ImVec2(10.0f, 10.0f), ImVec2(100.0f, 100.0f), IM_COL32_WHITE, 8.0f);
+    IM_CHECK(draw_list.VtxBuffer.Size > 8);
+}
+
+// Full frames with content beyond the range
+static void TestFrames()
+{
+    for (int frame = 0; frame < 4; frame++)
+    {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(ImVec2(800.0f, 600.0f));
+        ImGui::Begin("Compact");
+        if (frame >= 2)
+            ImGui::SetScrollY(15000.0f);
+        ImGui::BeginChild("Tall", ImVec2(0.0f, 20000.0f), ImGuiChildFlags_Borders);
+        ImGui::Text("Top of tall child");
+        ImGui::EndChild();
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        const ImVec2 canvas_origin = ImGui::GetCursorScreenPos();
+        draw_list->AddRectFilled(canvas_origin - ImVec2(30000.0f, 30000.0f), canvas_origin + ImVec2(30000.0f, 30000.0f), IM_COL32(40, 40, 40, 255));
+        draw_list->AddLine(canvas_origin - ImVec2(20000.0f, 0.0f), canvas_origin + ImVec2(20000.0f, 0.0f), IM_COL32_WHITE);
+        ImGui::Dummy(ImVec2(100.0f, 100.0f));
+        ImGui::End();
+        ImGui::Render();
+    }
+
+    // The scrolled child starts ~15000 pixels above the window: its background is clamped to the top of the range
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    int vtx_count = 0, vtx_clamped_count = 0;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+        for (const ImDrawVert& vert : draw_list->VtxBuffer)
+        {
+            IM_CHECK(vert.pos.x >= POS_MIN && vert.pos.x <= POS_MAX && vert.pos.y >= POS_MIN && vert.pos.y <= POS_MAX);
+            vtx_count++;
+            vtx_clamped_count += (vert.pos.y == POS_MIN) ? 1 : 0;
+        }
+    IM_CHECK(vtx_count > 0);
+    IM_CHECK(vtx_clamped_count > 0);
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasCompactVtx | ImGuiBackendFlags_RendererHasAnalyticShapes;
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame(); // Setup shared data
+    TestQuantize();
+    TestDrawListClamp();
+    TestNoAnalyticShapes();
+    ImGui::EndFrame();
+    TestFrames();
+    ImGui::DestroyContext();
+    return ImTestExit("test_compact_drawvert");
+}
@@ -0,0 +1,483 @@
+// dear imgui: AddConcavePolyFilled() tests and benchmark
+// - Random simple polygons (stars, combs, spirals) of 3 to 3000 points, both windings: triangles must be in range and their areas
+//   must add up to the polygon area (so they don't overlap and don't cover anything outside of the polygon).
+// - Degenerate polygons (self-intersecting, duplicate and collinear points): must not crash, and must output (N - 2) triangles in range.
+// - Benchmark against the previous ear-clipping implementation (RefAddConcavePolyFilled() below).
+
+#include "imgui_tests.h"
+#include <string.h>
+#include <math.h>
+
+//-----------------------------------------------------------------------------
+// Reference: AddConcavePolyFilled() before the monotone triangulator (1.91.5), non anti-aliased path only.
+// ImTriangulator is renamed to RefTriangulator, as the library still has its own copy.
+//-----------------------------------------------------------------------------
+
+enum RefTriangulatorNodeType
+{
+    RefTriangulatorNodeType_Convex,
+    RefTriangulatorNodeType_Ear,
+    RefTriangulatorNodeType_Reflex
+};
+
+struct RefTriangulatorNode
+{
+    RefTriangulatorNodeType Type;
+    int                     Index;
+    ImVec2                  Pos;
+    RefTriangulatorNode*    Next;
+    RefTriangulatorNode*    Prev;
+
+    void    Unlink()        { Next->Prev = Prev; Prev->Next = Next; }
+};
+
+struct RefTriangulatorNodeSpan
+{
+    RefTriangulatorNode**   Data = NULL;
+    int                     Size = 0;
+
+    void    push_back(RefTriangulatorNode* node)    { Data[Size++] = node; }
+    void    find_erase_unsorted(int idx)            { for (int i = Size - 1; i >= 0; i--) if (Data[i]->Index == idx) { Data[i] = Data[Size - 1]; Size--; return; } }
+};
+
+struct RefTriangulator
+{
+    static int EstimateTriangleCount(int points_count)      { return (points_count < 3) ? 0 : points_count - 2; }
+    static int EstimateScratchBufferSize(int points_count)  { return sizeof(RefTriangulatorNode) * points_count + sizeof(RefTriangulatorNode*) * points_count * 2; }
+
+    void    Init(const ImVec2* points, int points_count, void* scratch_buffer);
+    void    GetNextTriangle(unsigned int out_triangle[3]);
+
+    void    BuildNodes(const ImVec2* points, int points_count);
+    void    BuildReflexes();
+    void    BuildEars();
+    void    FlipNodeList();
+    bool    IsEar(int i0, int i1, int i2, const ImVec2& v0, const ImVec2& v1, const ImVec2& v2) const;
+    void    ReclassifyNode(RefTriangulatorNode* node);
+
+    int                     _TrianglesLeft = 0;
+    RefTriangulatorNode*    _Nodes = NULL;
+    RefTriangulatorNodeSpan _Ears;
+    RefTriangulatorNodeSpan _Reflexes;
+};
+
+void RefTriangulator::Init(const ImVec2* points, int points_count, void* scratch_buffer)
+{
+    IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
+    _TrianglesLeft = EstimateTriangleCount(points_count);
+    _Nodes         = (RefTriangulatorNode*)scratch_buffer;                          // points_count x Node
+    _Ears.Data     = (RefTriangulatorNode**)(_Nodes + points_count);                // points_count x Node*
+    _Reflexes.Data = (RefTriangulatorNode**)(_Nodes + points_count) + points_count; // points_count x Node*
+    BuildNodes(points, points_count);
+    BuildReflexes();
+    BuildEars();
+}
+
+void RefTriangulator::BuildNodes(const ImVec2* points, int points_count)
+{
+    for (int i = 0; i < points_count; i++)
+    {
+        _Nodes[i].Type = RefTriangulatorNodeType_Convex;
+        _Nodes[i].Index = i;
+        _Nodes[i].Pos = points[i];
+        _Nodes[i].Next = _Nodes + i + 1;
+        _Nodes[i].Prev = _Nodes + i - 1;
+    }
+    _Nodes[0].Prev = _Nodes + points_count - 1;
+    _Nodes[points_count - 1].Next = _Nodes;
+}
+
+void RefTriangulator::BuildReflexes()
+{
+    RefTriangulatorNode* n1 = _Nodes;
+    for (int i = _TrianglesLeft; i >= 0; i--, n1 = n1->Next)
+    {
+        if (ImTriangleIsClockwise(n1->Prev->Pos, n1->Pos, n1->Next->Pos))
+            continue;
+        n1->Type = RefTriangulatorNodeType_Reflex;
+        _Reflexes.push_back(n1);
+    }
+}
+
+void RefTriangulator::BuildEars()
+{
+    RefTriangulatorNode* n1 = _Nodes;
+    for (int i = _TrianglesLeft; i >= 0; i--, n1 = n1->Next)
+    {
+        if (n1->Type != RefTriangulatorNodeType_Convex)
+            continue;
+        if (!IsEar(n1->Prev->Index, n1->Index, n1->Next->Index, n1->Prev->Pos, n1->Pos, n1->Next->Pos))
+            continue;
+        n1->Type = RefTriangulatorNodeType_Ear;
+        _Ears.push_back(n1);
+    }
+}
+
+void RefTriangulator::GetNextTriangle(unsigned int out_triangle[3])
+{
+    if (_Ears.Size == 0)
+    {
+        FlipNodeList();
+
+        RefTriangulatorNode* node = _Nodes;
+        for (int i = _TrianglesLeft; i >= 0; i--, node = node->Next)
+            node->Type = RefTriangulatorNodeType_Convex;
+        _Reflexes.Size = 0;
+        BuildReflexes();
+        BuildEars();
+
+        // If we still don't have ears, it means geometry is degenerated.
+        if (_Ears.Size == 0)
+        {
+            // Return first triangle available, mimicking the behavior of convex fill.
+            IM_ASSERT(_TrianglesLeft > 0); // Geometry is degenerated
+            _Ears.Data[0] = _Nodes;
+            _Ears.Size    = 1;
+        }
+    }
+
+    RefTriangulatorNode* ear = _Ears.Data[--_Ears.Size];
+    out_triangle[0] = ear->Prev->Index;
+    out_triangle[1] = ear->Index;
+    out_triangle[2] = ear->Next->Index;
+
+    ear->Unlink();
+    if (ear == _Nodes)
+        _Nodes = ear->Next;
+
+    ReclassifyNode(ear->Prev);
+    ReclassifyNode(ear->Next);
+    _TrianglesLeft--;
+}
+
+void RefTriangulator::FlipNodeList()
+{
+    RefTriangulatorNode* prev = _Nodes;
+    RefTriangulatorNode* temp = _Nodes;
+    RefTriangulatorNode* current = _Nodes->Next;
+    prev->Next = prev;
+    prev->Prev = prev;
+    while (current != _Nodes)
+    {
+        temp = current->Next;
+
+        current->Next = prev;
+        prev->Prev = current;
+        _Nodes->Next = current;
+        current->Prev = _Nodes;
+
+        prev = current;
+        current = temp;
+    }
+    _Nodes = prev;
+}
+
+bool RefTriangulator::IsEar(int i0, int i1, int i2, const ImVec2& v0, const ImVec2& v1, const ImVec2& v2) const
+{
+    RefTriangulatorNode** p_end = _Reflexes.Data + _Reflexes.Size;
+    for (RefTriangulatorNode** p = _Reflexes.Data; p < p_end; p++)
+    {
+        RefTriangulatorNode* reflex = *p;
+        if (reflex->Index != i0 && reflex->Index != i1 && reflex->Index != i2)
+            if (ImTriangleContainsPoint(v0, v1, v2, reflex->Pos))
+                return false;
+    }
+    return true;
+}
+
+void RefTriangulator::ReclassifyNode(RefTriangulatorNode* n1)
+{
+    RefTriangulatorNodeType type;
+    const RefTriangulatorNode* n0 = n1->Prev;
+    const RefTriangulatorNode* n2 = n1->Next;
+    if (!ImTriangleIsClockwise(n0->Pos, n1->Pos, n2->Pos))
+        type = RefTriangulatorNodeType_Reflex;
+    else if (IsEar(n0->Index, n1->Index, n2->Index, n0->Pos, n1->Pos, n2->Pos))
+        type = RefTriangulatorNodeType_Ear;
+    else
+        type = RefTriangulatorNodeType_Convex;
+
+    if (type == n1->Type)
+        return;
+    if (n1->Type == RefTriangulatorNodeType_Reflex)
+        _Reflexes.find_erase_unsorted(n1->Index);
+    else if (n1->Type == RefTriangulatorNodeType_Ear)
+        _Ears.find_erase_unsorted(n1->Index);
+    if (type == RefTriangulatorNodeType_Reflex)
+        _Reflexes.push_back(n1);
+    else if (type == RefTriangulatorNodeType_Ear)
+        _Ears.push_back(n1);
+    n1->Type = type;
+}
+
+static void RefAddConcavePolyFilled(ImDrawList* dl, const ImVec2* points, const int points_count, ImU32 col)
+{
+    if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
+        return;
+
+    const ImVec2 uv = dl->_Data->TexUvWhitePixel;
+    RefTriangulator triangulator;
+    unsigned int triangle[3];
+    IM_ASSERT((dl->Flags & ImDrawListFlags_AntiAliasedFill) == 0);
+
+    // Non Anti-aliased Fill
+    const int idx_count = (points_count - 2) * 3;
+    const int vtx_count = points_count;
+    dl->PrimReserve(idx_count, vtx_count);
+    for (int i = 0; i < vtx_count; i++)
+    {
+        dl->_VtxWritePtr[0].pos = points[i]; dl->_VtxWritePtr[0].uv = uv; dl->_VtxWritePtr[0].col = col;
+        dl->_VtxWritePtr++;
+    }
+    dl->_Data->TempBuffer.reserve_discard((RefTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
+    triangulator.Init(points, points_count, dl->_Data->TempBuffer.Data);
+    while (triangulator._TrianglesLeft > 0)
+    {
+        triangulator.GetNextTriangle(triangle);
+        dl->_IdxWritePtr[0] = (ImDrawIdx)(dl->_VtxCurrentIdx + triangle[0]); dl->_IdxWritePtr[1] = (ImDrawIdx)(dl->_VtxCurrentIdx + triangle[1]); dl->_IdxWritePtr[2] = (ImDrawIdx)(dl->_VtxCurrentIdx + triangle[2]);
+        dl->_IdxWritePtr += 3;
+    }
+    dl->_VtxCurrentIdx += (ImDrawIdx)vtx_count;
+}
+
+//-----------------------------------------------------------------------------
+// Polygon generators
+//-----------------------------------------------------------------------------
+
+enum PolyShape
+{
+    PolyShape_Star,
+    PolyShape_Comb,
+    PolyShape_Spiral,
+    PolyShape_COUNT
+};
+
+static const char* GetPolyShapeName(int shape)
+{
+    const char* names[] = { "star", "comb", "spiral" };
+    return names[shape];
+}
+
+// Star-shaped around its center: strictly increasing angles and random radii.
+static void MakeStar(ImVector<ImVec2>* points, int points_count, ImTestRandom& rng)
+{
+    points->resize(points_count);
+    for (int i = 0; i < points_count; i++)
+    {
+        const float a = (i + rng.Float(0.0f, 0.9f)) * IM_PI * 2.0f / points_count;
+        const float r = (i & 1) ? rng.Float(20.0f, 200.0f) : rng.Float(100.0f, 400.0f);
+        (*points)[i] = ImVec2(cosf(a) * r, sinf(a) * r);
+    }
+}
+
+// Comb: a base with teeth of random heights on top of it. At least 8 points.
+static void MakeComb(ImVector<ImVec2>* points, int points_count, ImTestRandom& rng)
+{
+    const int teeth_count = ImMax((points_count - 2) / 4, 1);
+    const float spacing = 800.0f / teeth_count;
+    const float base_y = 20.0f;
+    points->resize(0);
+    points->push_back(ImVec2(0.0f, 0.0f));
+    points->push_back(ImVec2(800.0f, 0.0f));
+    for (int i = teeth_count - 1; i >= 0; i--)
+    {
+        const float x0 = i * spacing;
+        const float x1 = x0 + spacing * rng.Float(0.2f, 0.8f);
+        const float h = base_y + rng.Float(1.0f, 300.0f);
+        points->push_back(ImVec2(x1, base_y));
+        points->push_back(ImVec2(x1, h));
+        points->push_back(ImVec2(x0, h));
+        points->push_back(ImVec2(x0, base_y));
+    }
+}
+
+// Spiral strip: outer edge going out, then inner edge coming back.
+static void MakeSpiral(ImVector<ImVec2>* points, int points_count, ImTestRandom& rng)
+{
+    const int half_count = ImMax(points_count / 2, 2);
+    const float turns = rng.Float(0.5f, 6.0f);
+    const float growth = 20.0f; // Radius increase per turn
+    const float width = growth * rng.Float(0.2f, 0.8f);
+    points->resize(half_count * 2);
+    for (int i = 0; i < half_count; i++)
+    {
+        const float t = turns * i / (half_count - 1);
+        const float a = t * IM_PI * 2.0f;
+        const float r = 30.0f + growth * t;
+        (*points)[i] = ImVec2(cosf(a) * r, sinf(a) * r);
+        (*points)[half_count * 2 - 1 - i] = ImVec2(cosf(a) * (r - width), sinf(a) * (r - width));
+    }
+}
+
+static void MakePolygon(ImVector<ImVec2>* points, int shape, int points_count, ImTestRandom& rng)
+{
+    switch (shape)
+    {
+    case PolyShape_Star:   MakeStar(points, points_count, rng); break;
+    case PolyShape_Comb:   MakeComb(points, points_count, rng); break;
+    case PolyShape_Spiral: MakeSpiral(points, points_count, rng); break;
+    }
+}
+
+// Random rotation, translation and winding
+static void TransformPolygon(ImVector<ImVec2>* points, ImTestRandom& rng)
+{
+    const float a = rng.Float(0.0f, IM_PI * 2.0f);
+    const float c = cosf(a), s = sinf(a);
+    const ImVec2 offset(rng.Float(500.0f, 1500.0f), rng.Float(500.0f, 1500.0f));
+    for (ImVec2& p : *points)
+        p = ImVec2(p.x * c - p.y * s, p.x * s + p.y * c) + offset;
+    if (rng.Int(0, 1))
+        for (int i = 0, j = points->Size - 1; i < j; i++, j--)
+            ImSwap((*points)[i], (*points)[j]);
+}
+
+//-----------------------------------------------------------------------------
+// Tests
+//-----------------------------------------------------------------------------
+
+static double PolygonArea(const ImVec2* points, int points_count)
+{
+    double area2 = 0.0;
+    for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        area2 += (double)points[i0].x * points[i1].y - (double)points[i1].x * points[i0].y;
+    return fabs(area2) * 0.5;
+}
+
+// Fill polygon and check triangles: index count, range, and optionally sum of their areas.
+static bool CheckFill(ImDrawList* draw_list, const ImVector<ImVec2>& points, bool anti_aliased, bool check_area)
+{
+    draw_list->_ResetForNewFrame();
+    draw_list->PushClipRectFullScreen();
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    draw_list->Flags = anti_aliased ? ImDrawListFlags_AntiAliasedFill : ImDrawListFlags_None;
+    draw_list->_FringeScale = 1.0f;
+    draw_list->AddConcavePolyFilled(points.Data, points.Size, IM_COL32_WHITE);
+
+    const int fill_idx_count = (points.Size - 2) * 3;
+    const int idx_count = fill_idx_count + (anti_aliased ? points.Size * 6 : 0);
+    const int vtx_count = anti_aliased ? points.Size * 2 : points.Size;
+    if (draw_list->IdxBuffer.Size != idx_count || draw_list->VtxBuffer.Size != vtx_count || draw_list->CmdBuffer.back().ElemCount != (unsigned int)idx_count)
+        return false;
+    for (ImDrawIdx idx : draw_list->IdxBuffer)
+        if ((int)idx >= vtx_count)
+            return false;
+    if (!check_area)
+        return true;
+
+    // Fill triangles come first, vertex 'i' of polygon is at 'i << 1' with anti-aliasing (inner vertices are offset by fringe, use original points)
+    double triangles_area = 0.0;
+    const int vtx_shift = anti_aliased ? 1 : 0;
+    for (int n = 0; n < fill_idx_count; n += 3)
+    {
+        const ImVec2& a = points[draw_list->IdxBuffer[n + 0] >> vtx_shift];
+        const ImVec2& b = points[draw_list->IdxBuffer[n + 1] >> vtx_shift];
+        const ImVec2& c = points[draw_list->IdxBuffer[n + 2] >> vtx_shift];
+        triangles_area += fabs(((double)b.x - a.x) * ((double)c.y - a.y) - ((double)b.y - a.y) * ((double)c.x - a.x)) * 0.5;
+    }
+    const double area = PolygonArea(points.Data, points.Size);
+    return fabs(triangles_area - area) <= area * 1e-4 + 1.0;
+}
+
+static void TestSimplePolygons()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImTestRandom rng;
+    ImVector<ImVec2> points;
+    for (int n = 0; n < 3000; n++)
+    {
+        const int shape = rng.Int(0, PolyShape_COUNT - 1);
+        const int points_count = rng.Int(0, 3) ? rng.Int(3, 200) : rng.Int(200, 3000); // Both sides of IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS
+        MakePolygon(&points, shape, points_count, rng);
+        TransformPolygon(&points, rng);
+        const bool anti_aliased = rng.Int(0, 1) != 0;
+        IM_CHECK_MSG(CheckFill(&draw_list, points, anti_aliased, true), "n=%d %s points=%d anti_aliased=%d", n, GetPolyShapeName(shape), points.Size, anti_aliased);
+        if (GTestErrors > 10)
+            return;
+    }
+}
+
+static void TestDegeneratePolygons()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImTestRandom rng;
+    ImVector<ImVec2> points;
+    for (int n = 0; n < 3000; n++)
+    {
+        const int points_count = rng.Int(0, 3) ? rng.Int(3, 100) : rng.Int(100, 1000);
+        const int kind = rng.Int(0, 3);
+        if (kind == 0)
+        {
+            // Random points: self-intersecting
+            points.resize(points_count);
+            for (ImVec2& p : points)
+                p = ImVec2(rng.Float(0.0f, 1000.0f), rng.Float(0.0f, 1000.0f));
+        }
+        else
+        {
+            // Simple polygon with duplicate points, collinear points, or points snapped to a coarse grid (creating touching edges)
+            MakePolygon(&points, rng.Int(0, PolyShape_COUNT - 1), points_count, rng);
+            TransformPolygon(&points, rng);
+            for (int i = 0; i < points.Size; i++)
+            {
+                if (kind == 1 && rng.Int(0, 3) == 0)
+                    points.insert(points.Data + i, points[i]), i++;
+                else if (kind == 2 && rng.Int(0, 3) == 0)
+                    points.insert(points.Data + i + 1, (points[i] + points[(i + 1) % points.Size]) * 0.5f), i++;
+                else if (kind == 3)
+                    points[i] = ImVec2(ImFloor(points[i].x / 50.0f) * 50.0f, ImFloor(points[i].y / 50.0f) * 50.0f);
+            }
+        }
+        const bool anti_aliased = rng.Int(0, 1) != 0;
+        IM_CHECK_MSG(CheckFill(&draw_list, points, anti_aliased, false), "n=%d kind=%d points=%d anti_aliased=%d", n, kind, points.Size, anti_aliased);
+        if (GTestErrors > 10)
+            return;
+    }
+
+    // All points identical, all points on a line
+    points.resize(500);
+    for (int i = 0; i < points.Size; i++)
+        points[i] = ImVec2(100.0f, 100.0f);
+    IM_CHECK(CheckFill(&draw_list, points, false, false));
+    for (int i = 0; i < points.Size; i++)
+        points[i] = ImVec2(100.0f, 100.0f) + ImVec2(1.0f, 2.0f) * (float)((i < points.Size / 2) ? i : points.Size - i);
+    IM_CHECK(CheckFill(&draw_list, points, true, false));
+}
+
+static void Benchmark()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImTestRandom rng;
+    ImVector<ImVec2> points;
+    const int points_counts[] = { 64, 1000, 10000 };
+    printf("AddConcavePolyFilled(), points/us (old -> new):\n");
+    for (int shape = 0; shape < PolyShape_COUNT; shape++)
+        for (int points_count : points_counts)
+        {
+            MakePolygon(&points, shape, points_count, rng);
+            float area2 = 0.0f; // Use the winding that the previous implementation handles correctly (clockwise with Y pointing down)
+            for (int i0 = points.Size - 1, i1 = 0; i1 < points.Size; i0 = i1++)
+                area2 += points[i0].x * points[i1].y - points[i1].x * points[i0].y;
+            if (area2 < 0.0f)
+                for (int i = 0, j = points.Size - 1; i < j; i++, j--)
+                    ImSwap(points[i], points[j]);
+            const int count = ImMax(1, 200000 / points_count / (points_count >= 10000 ? 20 : 1));
+            auto init = [&]() { draw_list._ResetForNewFrame(); draw_list.PushClipRectFullScreen(); draw_list.PushTextureID(ImGui::GetIO().Fonts->TexID); draw_list.Flags = ImDrawListFlags_None; };
+            const double ns_ref = ImTestBench(count, 3, [&]() { init(); RefAddConcavePolyFilled(&draw_list, points.Data, points.Size, IM_COL32_WHITE); });
+            const double ns_new = ImTestBench(count, 3, [&]() { init(); draw_list.AddConcavePolyFilled(points.Data, points.Size, IM_COL32_WHITE); });
+            printf("  %-6s %5d points: %7.3f -> %7.3f (x%.1f)\n", GetPolyShapeName(shape), points.Size, points.Size * 1000.0 / ns_ref, points.Size * 1000.0 / ns_new, ns_ref / ns_new);
+        }
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame(); // Setup shared data (TexUvWhitePixel)
+    TestSimplePolygons();
+    TestDegeneratePolygons();
+    Benchmark();
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ImTestExit("test_concave_poly");
+}
@@ -0,0 +1,104 @@
+// dear imgui: ImDrawData::DamageRects tests (io.ConfigDrawDataDamageRects)
+// - Check that damage is the union over the age of the back buffer (io.DisplayBufferAge), or the whole display when the age is unknown.
+// - Check that AddDamageRect() adds to next damage.
+
+#include "imgui_tests.h"
+
+static bool RectContains(const ImVec4& outer, const ImVec4& inner)
+{
+    return outer.x <= inner.x && outer.y <= inner.y && outer.z >= inner.z && outer.w >= inner.w;
+}
+
+static bool DamageContains(const ImDrawData* draw_data, const ImVec4& r)
+{
+    for (const ImVec4& damage_rect : draw_data->DamageRects)
+        if (RectContains(damage_rect, r))
+            return true;
+    return false;
+}
+
+static bool DamageOverlaps(const ImDrawData* draw_data, const ImVec4& r)
+{
+    for (const ImVec4& damage_rect : draw_data->DamageRects)
+        if (ImRect(damage_rect).Overlaps(ImRect(r)))
+            return true;
+    return false;
+}
+
+// Render a frame where the text of a single label changes on 'change_frame'
+static ImDrawData* RenderFrame(int frame, int change_frame, int buffer_age, ImVec4* out_label_rect = NULL, bool add_damage_rect = false)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.DeltaTime = 1.0f / 60.0f;
+    io.DisplayBufferAge = buffer_age;
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(100, 100));
+    ImGui::SetNextWindowSize(ImVec2(300, 200));
+    ImGui::Begin("Test", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::Text("Static text");
+    ImGui::Text("Counter %d", frame >= change_frame ? 1 : 0);
+    if (out_label_rect)
+        *out_label_rect = ImVec4(ImGui::GetItemRectMin().x, ImGui::GetItemRectMin().y, ImGui::GetItemRectMax().x, ImGui::GetItemRectMax().y);
+    ImGui::End();
+    if (add_damage_rect)
+        ImGui::AddDamageRect(ImVec2(500, 500), ImVec2(600, 550)); // e.g. where a video texture is displayed
+    ImGui::Render();
+    return ImGui::GetDrawData();
+}
+
+static void TestBufferAge(int buffer_age)
+{
+    const ImVec4 display_rect(0.0f, 0.0f, ImGui::GetIO().DisplaySize.x, ImGui::GetIO().DisplaySize.y);
+    const int change_frame = 10;
+    for (int frame = 0; frame < 20; frame++)
+    {
+        ImVec4 label_rect;
+        ImDrawData* draw_data = RenderFrame(frame, change_frame, buffer_age, &label_rect);
+        IM_CHECK(draw_data->DamageRectsValid);
+        if (frame < 5) // Let windows settle
+            continue;
+        const bool is_full = draw_data->DamageRects.Size == 1 && RectContains(draw_data->DamageRects[0], display_rect);
+        if (buffer_age <= 0)
+        {
+            IM_CHECK_MSG(is_full, "age %d, frame %d", buffer_age, frame);
+            continue;
+        }
+        // Back buffer misses the changes of the last 'buffer_age' frames
+        const bool expect_damage = (frame >= change_frame && frame < change_frame + buffer_age);
+        IM_CHECK_MSG(!is_full, "age %d, frame %d", buffer_age, frame);
+        if (expect_damage)
+            IM_CHECK_MSG(DamageOverlaps(draw_data, label_rect), "age %d, frame %d", buffer_age, frame);
+        else
+            IM_CHECK_MSG(draw_data->DamageRects.Size == 0, "age %d, frame %d: %d rects", buffer_age, frame, draw_data->DamageRects.Size);
+    }
+
+    // Back buffer older than the history we keep
+    ImDrawData* draw_data = RenderFrame(0, change_frame, IMGUI_DAMAGE_BUFFER_AGE_MAX + 1);
+    IM_CHECK(draw_data->DamageRects.Size == 1 && RectContains(draw_data->DamageRects[0], display_rect));
+}
+
+static void TestAddDamageRect()
+{
+    for (int frame = 0; frame < 5; frame++)
+        RenderFrame(frame, 0, 1);
+    ImDrawData* draw_data = RenderFrame(5, 0, 1, NULL, true);
+    IM_CHECK(DamageContains(draw_data, ImVec4(500, 500, 600, 550)));
+    draw_data = RenderFrame(6, 0, 1);
+    IM_CHECK(draw_data->DamageRects.Size == 0);
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasDamageRects;
+    io.ConfigDrawDataDamageRects = true;
+    io.ConfigInputTextCursorBlink = false;
+    TestBufferAge(0);
+    TestBufferAge(1);
+    TestBufferAge(2);
+    TestBufferAge(3);
+    TestAddDamageRect();
+    ImGui::DestroyContext();
+    return ImTestExit("test_damage_rects");
+}
@@ -0,0 +1,75 @@
+// dear imgui: filling draw lists from other threads (see "Filling draw lists from other threads" in imgui.h)
+// - Each worker thread uses its own ImDrawListSharedData copy and ImDrawList::ResetForThread().
+// - Check that appending their output with AddDrawList() gives the same vertices as drawing directly on the main thread.
+
+#include "imgui_tests.h"
+#include <thread>
+#include <string.h>
+
+static void DrawShapes(ImDrawList* draw_list, int seed)
+{
+    ImTestRandom rng((ImU32)seed + 1);
+    for (int n = 0; n < 500; n++)
+    {
+        const ImVec2 p(rng.Float(0.0f, 800.0f), rng.Float(0.0f, 600.0f));
+        switch (rng.Int(0, 3))
+        {
+        case 0: draw_list->AddRectFilled(p, p + ImVec2(20, 10), IM_COL32(255, 0, 0, 255), 4.0f); break;
+        case 1: draw_list->AddCircle(p, rng.Float(2.0f, 40.0f), IM_COL32(0, 255, 0, 255)); break;
+        case 2: draw_list->AddLine(p, p + ImVec2(30, 30), IM_COL32(0, 0, 255, 255), 2.0f); break;
+        case 3: draw_list->AddText(p, IM_COL32_WHITE, "Hello"); break;
+        }
+    }
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    const int THREAD_COUNT = 4;
+    ImDrawListSharedData* shared_data[THREAD_COUNT];
+    ImDrawList* worker_lists[THREAD_COUNT];
+    for (int n = 0; n < THREAD_COUNT; n++)
+    {
+        shared_data[n] = ImGui::CreateDrawListSharedData();
+        worker_lists[n] = IM_NEW(ImDrawList)(shared_data[n]);
+    }
+    ImDrawList draw_list_ref(ImGui::GetDrawListSharedData());
+
+    for (int frame = 0; frame < 3; frame++)
+    {
+        io.DeltaTime = 1.0f / 60.0f;
+        ImGui::NewFrame();
+        for (int n = 0; n < THREAD_COUNT; n++)
+            ImGui::UpdateDrawListSharedData(shared_data[n]);
+
+        std::thread threads[THREAD_COUNT];
+        for (int n = 0; n < THREAD_COUNT; n++)
+            threads[n] = std::thread([&worker_lists, n]() { worker_lists[n]->ResetForThread(); DrawShapes(worker_lists[n], n); });
+        for (int n = 0; n < THREAD_COUNT; n++)
+            threads[n].join();
+
+        // Same drawing on the main thread
+        draw_list_ref.ResetForThread();
+        for (int n = 0; n < THREAD_COUNT; n++)
+            DrawShapes(&draw_list_ref, n);
+
+        ImDrawList* draw_list = ImGui::GetForegroundDrawList();
+        const int vtx_start = draw_list->VtxBuffer.Size;
+        for (int n = 0; n < THREAD_COUNT; n++)
+            draw_list->AddDrawList(worker_lists[n]);
+        const int vtx_count = draw_list->VtxBuffer.Size - vtx_start;
+        IM_CHECK_MSG(vtx_count == draw_list_ref.VtxBuffer.Size, "frame %d: %d vs %d vertices", frame, vtx_count, draw_list_ref.VtxBuffer.Size);
+        if (vtx_count == draw_list_ref.VtxBuffer.Size)
+            IM_CHECK(memcmp(draw_list->VtxBuffer.Data + vtx_start, draw_list_ref.VtxBuffer.Data, (size_t)vtx_count * sizeof(ImDrawVert)) == 0);
+        ImGui::Render();
+    }
+
+    for (int n = 0; n < THREAD_COUNT; n++)
+    {
+        IM_DELETE(worker_lists[n]);
+        ImGui::DestroyDrawListSharedData(shared_data[n]);
+    }
+    ImGui::DestroyContext();
+    return ImTestExit("test_drawlist_threads");
+}
@@ -0,0 +1,200 @@
+// dear imgui: ImFormatString() fast path tests and benchmark
+// - Check ImFormatString() output and return value against vsnprintf() for single "%d", "%i", "%u", "%f" formats (handled by
+//   ImFormatStringFastV()) with all combinations of flags, widths, precisions and 'l'/'ll' length modifiers.
+// - Check integer limits, -0.0, exact rounding ties and near-ties, values around the 1e15 limit, inf/nan, "%%" in surrounding text,
+//   and truncation with small buffer sizes.
+// - Measure "%d" and "%.3f" formatting.
+
+#include "imgui_tests.h"
+#include <stdarg.h>
+#include <string.h>
+#include <limits.h>
+#include <float.h>
+#include <math.h>
+
+static int GChecksCount = 0;
+
+// Compare ImFormatStringV() with vsnprintf() for all buffer sizes up to the full output length (+2)
+static void CheckFormat(const char* fmt, ...)
+{
+    char ref[512];
+    va_list args;
+    va_start(args, fmt);
+    const int ref_len = vsnprintf(ref, sizeof(ref), fmt, args);
+    va_end(args);
+    IM_CHECK(ref_len >= 0 && ref_len < (int)sizeof(ref));
+
+    for (int buf_size = ref_len + 2; buf_size >= 1; buf_size--)
+    {
+        // Exact size heap buffer (with a guard byte), so overflows are caught by the guard or by address sanitizer
+        char* buf = (char*)malloc((size_t)buf_size + 1);
+        buf[buf_size] = 0x7F;
+        va_start(args, fmt);
+        const int len = ImFormatStringV(buf, (size_t)buf_size, fmt, args);
+        va_end(args);
+        const int expected_len = ImMin(ref_len, buf_size - 1);
+        IM_CHECK_MSG(len == expected_len && memcmp(buf, ref, (size_t)expected_len) == 0 && buf[expected_len] == 0 && buf[buf_size] == 0x7F,
+            "format \"%s\" buf_size %d: \"%.*s\" (%d), expected \"%.*s\" (%d)", fmt, buf_size, ImMax(len, 0), buf, len, expected_len, ref, expected_len);
+        free(buf);
+        GChecksCount++;
+        if (GTestErrors > 10)
+            return;
+        if (buf_size < ref_len - 4 && buf_size > 4) // Middle sizes are redundant
+            buf_size = 5;
+    }
+}
+
+// Build "[prefix]%[flags][width][.precision][length]conv[suffix]"
+static void BuildFormat(char* fmt, size_t fmt_size, const char* prefix, int flags_mask, int width, int precision, const char* length, char conv, const char* suffix)
+{
+    char flags[8];
+    int flags_len = 0;
+    const char flag_chars[] = { '-', '+', ' ', '0' };
+    for (int n = 0; n < 4; n++)
+        if (flags_mask & (1 << n))
+            flags[flags_len++] = flag_chars[n];
+    flags[flags_len] = 0;
+    char width_str[16] = "";
+    char precision_str[16] = "";
+    if (width >= 0)
+        snprintf(width_str, sizeof(width_str), "%d", width);
+    if (precision >= 0)
+        snprintf(precision_str, sizeof(precision_str), ".%d", precision);
+    snprintf(fmt, fmt_size, "%s%%%s%s%s%s%c%s", prefix, flags, width_str, precision_str, length, conv, suffix);
+}
+
+static const int    TEST_WIDTHS[] = { -1, 0, 1, 2, 5, 12, 21, 30, 63, 64, 70 };
+static const char*  TEST_AFFIXES[][2] = { { "", "" }, { "Value: ", "" }, { "", " units" }, { "a%%b ", " %%c%%" }, { "%%", "%%" } };
+
+static void TestIntegers()
+{
+    const int values_i[] = { 0, 1, -1, 9, -9, 10, 99, 100, 12345, -12345, 1000000000, INT_MAX, INT_MIN, INT_MIN + 1 };
+    const long values_l[] = { 0, -1, 1L << 20, -(1L << 30), LONG_MAX, LONG_MIN };
+    const long long values_ll[] = { 0, -1, 4294967295LL, 4294967296LL, -4294967296LL, 999999999999999999LL, LLONG_MAX, LLONG_MIN, LLONG_MIN + 1 };
+    const unsigned int values_u[] = { 0, 1, 10, 4294967295u, 2147483648u };
+    const unsigned long values_ul[] = { 0, ULONG_MAX };
+    const unsigned long long values_ull[] = { 0, 4294967295ULL, 4294967296ULL, 10000000000000000000ULL, ULLONG_MAX };
+
+    char fmt[64];
+    for (const char* const* affix : TEST_AFFIXES)
+        for (int flags = 0; flags < 16; flags++)
+            for (int width : TEST_WIDTHS)
+            {
+                for (int conv_n = 0; conv_n < 2; conv_n++)
+                {
+                    const char conv = conv_n ? 'i' : 'd';
+                    BuildFormat(fmt, sizeof(fmt), affix[0], flags, width, -1, "", conv, affix[1]);
+                    for (int v : values_i)
+                        CheckFormat(fmt, v);
+                    BuildFormat(fmt, sizeof(fmt), affix[0], flags, width, -1, "l", conv, affix[1]);
+                    for (long v : values_l)
+                        CheckFormat(fmt, v);
+                    BuildFormat(fmt, sizeof(fmt), affix[0], flags, width, -1, "ll", conv, affix[1]);
+                    for (long long v : values_ll)
+                        CheckFormat(fmt, v);
+                }
+                BuildFormat(fmt, sizeof(fmt), affix[0], flags & ~6, width, -1, "", 'u', affix[1]); // '+' and ' ' are not defined for %u
+                for (unsigned int v : values_u)
+                    CheckFormat(fmt, v);
+                BuildFormat(fmt, sizeof(fmt), affix[0], flags & ~6, width, -1, "l", 'u', affix[1]);
+                for (unsigned long v : values_ul)
+                    CheckFormat(fmt, v);
+                BuildFormat(fmt, sizeof(fmt), affix[0], flags & ~6, width, -1, "ll", 'u', affix[1]);
+                for (unsigned long long v : values_ull)
+                    CheckFormat(fmt, v);
+                if (GTestErrors > 10)
+                    return;
+            }
+
+    // Random values
+    ImTestRandom rng;
+    for (int n = 0; n < 20000; n++)
+    {
+        const long long v = (long long)(((ImU64)rng.Next() << 32) | rng.Next()) >> rng.Int(0, 63);
+        CheckFormat("%lld", v);
+        CheckFormat("%d", (int)v);
+        CheckFormat("%u", (unsigned int)v);
+    }
+
+    // Formats not handled by the fast path (go through vsnprintf()): precision on integers, '#', '*', several specifiers
+    CheckFormat("%.3d", 5);
+    CheckFormat("%#x", 255);
+    CheckFormat("%*d", 6, 42);
+    CheckFormat("%d %d", 1, 2);
+    CheckFormat("%d%s", 1, "abc");
+    CheckFormat("%5%d", 42);
+    CheckFormat("100%%");
+}
+
+static void TestFloats()
+{
+    const double values[] =
+    {
+        0.0, -0.0, 1.0, -1.0, 0.1, 0.2, 0.3, 1.0 / 3.0, 2.0 / 3.0, 3.14159265358979, -2.718281828459045, 123456.789, 1e-10, -1e-10, 1e-300,
+        0.5, 1.5, 2.5, -0.5, -2.5, 0.125, 0.375, 2.675, 1.005, 0.045, 1e-5, 5e-7, 4.9999999e-7, -5e-7,     // Exact ties and decimal near-ties
+        999999.5, 9999999.4999, 99999999999999.5, 999999999999999.0, 999999999999999.5, 1e15, 1e15 + 2.0, 1e16, 1e20, 1e300, // Around 1e15
+        -999999999999999.0, -1e15, (double)INT_MAX, (double)LLONG_MAX, DBL_MAX, DBL_MIN, -DBL_MIN, DBL_EPSILON,
+        (double)INFINITY, -(double)INFINITY, (double)NAN, -(double)NAN,
+    };
+    const int precisions[] = { -1, 0, 1, 2, 3, 4, 6, 9, 10, 14, 15, 16, 20 };
+    const int widths[] = { -1, 0, 3, 8, 12, 30, 63, 64 };
+
+    char fmt[64];
+    for (int affix_n = 0; affix_n < IM_ARRAYSIZE(TEST_AFFIXES); affix_n += 2) // Affixes are independent from the conversion: fewer here
+        for (int flags = 0; flags < 16; flags++)
+            for (int width : widths)
+                for (int precision : precisions)
+                {
+                    BuildFormat(fmt, sizeof(fmt), TEST_AFFIXES[affix_n][0], flags, width, precision, (flags & 1) ? "l" : "", 'f', TEST_AFFIXES[affix_n][1]);
+                    for (double v : values)
+                        CheckFormat(fmt, v);
+                    if (GTestErrors > 10)
+                        return;
+                }
+
+    // Random values, exact ties and near-ties at each precision (e.g. x.xx5 and its neighbors), values around 1e15 once scaled
+    ImTestRandom rng;
+    for (int n = 0; n < 50000; n++)
+    {
+        const int precision = rng.Int(0, 15);
+        const double scale = pow(10.0, (double)precision);
+        double v;
+        switch (n % 5)
+        {
+        case 0: v = (double)(int)rng.Next() / (double)(1 << rng.Int(0, 30)); break;
+        case 1: v = ((double)rng.Int(-1000000, 1000000) + 0.5) / scale; break;
+        case 2: v = nextafter(((double)rng.Int(-1000000, 1000000) + 0.5) / scale, (rng.Next() & 1) ? 1e300 : -1e300); break;
+        case 3: v = 1e15 / scale * (1.0 + (double)rng.Int(-100, 100) * DBL_EPSILON); break;
+        default: v = (double)rng.Float(-1.0f, 1.0f) * pow(10.0, (double)rng.Int(-8, 16)); break;
+        }
+        snprintf(fmt, sizeof(fmt), "%%.%df", precision);
+        CheckFormat(fmt, v);
+        CheckFormat("%f", v);
+        if (GTestErrors > 10)
+            return;
+    }
+}
+
+static void Benchmark()
+{
+    printf("Format: ns per call (vsnprintf -> ImFormatString):\n");
+    char buf[64];
+    static volatile int sink;
+    unsigned int n = 0;
+    const double ns_d_ref = ImTestBench(200000, 5, [&]() { sink += snprintf(buf, sizeof(buf), "%d", (int)(n++ * 7919u)); });
+    const double ns_d_new = ImTestBench(200000, 5, [&]() { sink += ImFormatString(buf, sizeof(buf), "%d", (int)(n++ * 7919u)); });
+    const double ns_f_ref = ImTestBench(200000, 5, [&]() { sink += snprintf(buf, sizeof(buf), "%.3f", (n++ & 0xFFFF) * 0.0123f); });
+    const double ns_f_new = ImTestBench(200000, 5, [&]() { sink += ImFormatString(buf, sizeof(buf), "%.3f", (n++ & 0xFFFF) * 0.0123f); });
+    const double ns_s_ref = ImTestBench(200000, 5, [&]() { sink += snprintf(buf, sizeof(buf), "Value: %8.2f units", (n++ & 0xFFFF) * 0.0123f); });
+    const double ns_s_new = ImTestBench(200000, 5, [&]() { sink += ImFormatString(buf, sizeof(buf), "Value: %8.2f units", (n++ & 0xFFFF) * 0.0123f); });
+    printf("  \"%%d\": %6.1f -> %6.1f, \"%%.3f\": %6.1f -> %6.1f, \"Value: %%8.2f units\": %6.1f -> %6.1f\n", ns_d_ref, ns_d_new, ns_f_ref, ns_f_new, ns_s_ref, ns_s_new);
+}
+
+int main()
+{
+    TestIntegers();
+    TestFloats();
+    printf("Format: %d checks\n", GChecksCount);
+    Benchmark();
+    return ImTestExit("test_format");
+}
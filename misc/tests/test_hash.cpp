@@ -0,0 +1,138 @@
+// dear imgui: ImHashData()/ImHashStr() tests and benchmark
+// - Check the output against a bitwise reference CRC (CRC32 by default, CRC32C when building with IMGUI_USE_CRC32C).
+// - Check the "###" operator handling of ImHashStr().
+// - Count collisions over typical generated labels.
+// - Measure throughput (ns/byte, GB/s) for short, medium and long inputs.
+
+#include "imgui_tests.h"
+#include <string.h>
+
+// Bitwise reference (reflected polynomials)
+#if defined(IMGUI_ENABLE_SSE4_2_CRC) || defined(IMGUI_ENABLE_ARM_CRC32)
+static const ImU32 CRC_POLY = 0x82F63B78;   // CRC32C (Castagnoli)
+static const char* CRC_NAME = "CRC32C (hardware)";
+#else
+static const ImU32 CRC_POLY = 0xEDB88320;   // CRC32 (IEEE)
+static const char* CRC_NAME = "CRC32 (slice-by-8 table)";
+#endif
+
+static ImGuiID RefHashData(const void* data, size_t size, ImGuiID seed)
+{
+    ImU32 crc = ~seed;
+    const unsigned char* p = (const unsigned char*)data;
+    while (size-- != 0)
+    {
+        crc ^= *p++;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (CRC_POLY & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+// Reference for ImHashStr(): only hash from the last "###" occurrence
+static ImGuiID RefHashStr(const char* str, ImGuiID seed)
+{
+    const char* begin = str;
+    for (const char* p = str; p[0] && p[1] && p[2]; p++)
+        if (p[0] == '#' && p[1] == '#' && p[2] == '#')
+            begin = p;
+    return RefHashData(begin, strlen(begin), seed);
+}
+
+static void TestReference()
+{
+    // Check values
+    // Known value for the standard "123456789" check string (with a 0 seed, ImHashData() matches the standard CRC)
+    const ImU32 check_value = (CRC_POLY == 0xEDB88320) ? 0xCBF43926 : 0xE3069283;
+    IM_CHECK(ImHashData("123456789", 9, 0) == check_value);
+    IM_CHECK(ImHashStr("123456789", 0, 0) == check_value);
+
+    // All lengths, alignments and seeds, to cover the wide and tail paths
+    ImTestRandom rng;
+    unsigned char buf[256 + 16];
+    for (int n = 0; n < IM_ARRAYSIZE(buf); n++)
+        buf[n] = (unsigned char)rng.Next();
+    for (int offset = 0; offset < 8; offset++)
+        for (int len = 0; len <= 256; len++)
+        {
+            const ImGuiID seed = (len & 1) ? rng.Next() : 0;
+            IM_CHECK_MSG(ImHashData(buf + offset, len, seed) == RefHashData(buf + offset, len, seed), "offset %d len %d", offset, len);
+        }
+}
+
+static void TestTripleHash()
+{
+    const char* labels[] = { "Hello", "Hello###ID", "Other###ID", "##Hidden", "A###B###C", "X###C", "###", "##", "#", "a#b##c", "abc###", "Long label with some text###Stable", "####4" };
+    for (int n = 0; n < IM_ARRAYSIZE(labels); n++)
+    {
+        const char* label = labels[n];
+        IM_CHECK_MSG(ImHashStr(label, 0, 0) == RefHashStr(label, 0), "'%s'", label);
+        IM_CHECK_MSG(ImHashStr(label, 0, 0x1234) == RefHashStr(label, 0x1234), "'%s'", label);
+        IM_CHECK_MSG(ImHashStr(label, strlen(label), 0x1234) == RefHashStr(label, 0x1234), "'%s'", label);
+    }
+    IM_CHECK(ImHashStr("Hello###ID") == ImHashStr("Other###ID"));
+    IM_CHECK(ImHashStr("A###B###C") == ImHashStr("X###C"));
+    IM_CHECK(ImHashStr("Hello") != ImHashStr("Hello###ID"));
+
+    // Explicit length stops before the zero-terminator, including in the middle of a "###"
+    IM_CHECK(ImHashStr("Hello###ID", 5) == ImHashStr("Hello"));
+    IM_CHECK(ImHashStr("Hello##", 7) == ImHashStr("Hello##"));
+}
+
+// Count collisions over labels typically generated by applications ("Item %d", "##row%d_col%d"...) hashed with the same seed.
+// Those are expected to be close to the birthday bound for a 32-bit hash: n^2 / 2^33 (~1.2 for 100k keys).
+static void TestCollisions()
+{
+    const char* formats[] = { "Item %d", "##row%d", "Button###btn%d", "%d", "Node %08X" };
+    const int count = 100000;
+    ImVector<ImGuiID> ids;
+    ids.reserve(count);
+    for (int f = 0; f < IM_ARRAYSIZE(formats); f++)
+    {
+        ids.resize(0);
+        char buf[64];
+        for (int n = 0; n < count; n++)
+        {
+            ImFormatString(buf, IM_ARRAYSIZE(buf), formats[f], n);
+            ids.push_back(ImHashStr(buf, 0, 0x8D4A2B19));
+        }
+        ImQsort(ids.Data, (size_t)ids.Size, sizeof(ImGuiID), [](const void* a, const void* b) { ImGuiID ia = *(const ImGuiID*)a, ib = *(const ImGuiID*)b; return (ia > ib) - (ia < ib); });
+        int collisions = 0;
+        for (int n = 1; n < ids.Size; n++)
+            if (ids[n] == ids[n - 1])
+                collisions++;
+        printf("  collisions for %d x \"%s\": %d\n", count, formats[f], collisions);
+        IM_CHECK_MSG(collisions <= 8, "%d collisions for \"%s\"", collisions, formats[f]);
+    }
+}
+
+// Report ns/byte and GB/s (1 byte/ns == 1 GB/s): short inputs are dominated by per-call overhead, long ones by the CRC loop.
+static void Benchmark()
+{
+    // Label-like text without '#', so ImHashStr() measures the same hash plus its "###" scan
+    static char text[64 * 1024];
+    ImTestRandom rng;
+    for (int n = 0; n < IM_ARRAYSIZE(text); n++)
+        text[n] = (char)((rng.Int(0, 7) == 0) ? ' ' : 'a' + rng.Int(0, 25));
+    struct { const char* Name; int Len; } inputs[] = { { "short", 4 }, { "short", 16 }, { "short", 32 }, { "medium", 64 }, { "medium", 256 }, { "long", 4 * 1024 }, { "long", 64 * 1024 } };
+    printf("  %-6s %6s  %-26s %s\n", "input", "bytes", "ImHashData()", "ImHashStr()");
+    for (int n = 0; n < IM_ARRAYSIZE(inputs); n++)
+    {
+        const size_t len = (size_t)inputs[n].Len;
+        const int count = ImMax(200, (int)((16 << 20) / len)); // ~16 MB per run
+        static volatile ImGuiID sink;
+        const double ns_data = ImTestBench(count, 5, [&]() { sink = ImHashData(text, len, sink); }) / (double)len;
+        const double ns_str = ImTestBench(count, 5, [&]() { sink = ImHashStr(text, len, sink); }) / (double)len;
+        printf("  %-6s %6d  %6.3f ns/byte %6.2f GB/s  %6.3f ns/byte %6.2f GB/s\n", inputs[n].Name, (int)len, ns_data, 1.0 / ns_data, ns_str, 1.0 / ns_str);
+    }
+}
+
+int main(int, char**)
+{
+    printf("Hash: %s\n", CRC_NAME);
+    TestReference();
+    TestTripleHash();
+    TestCollisions();
+    Benchmark();
+    return ImTestExit("test_hash");
+}
@@ -0,0 +1,144 @@
+// dear imgui: per-list index size tests (ImGuiBackendFlags_RendererHasIdxSize)
+// - Check that draw lists with more than 64K vertices are promoted to 32-bit indices, with commands split by VtxOffset merged back,
+//   and that they still draw the same triangles as the split 16-bit draw list.
+// - Check that small draw lists keep 16-bit indices.
+// - Check that ImDrawData::Flatten() keeps each list's index size and draws the same triangles.
+
+#include "imgui_tests.h"
+
+static void FillDrawList(ImDrawList* draw_list, ImDrawListFlags flags, int rect_count)
+{
+    draw_list->ResetForThread();
+    draw_list->Flags = flags;
+    ImTestRandom rng;
+    for (int n = 0; n < rect_count; n++)
+    {
+        const ImVec2 p(rng.Float(0.0f, 1000.0f), rng.Float(0.0f, 1000.0f));
+        draw_list->AddRectFilled(p, p + ImVec2(5.0f, 5.0f), IM_COL32(255, 255, 255, 255));
+        if (n == rect_count / 2)
+            draw_list->AddCallback(ImDrawCallback_ResetRenderState, NULL); // Callbacks must not be merged
+    }
+    draw_list->_PopUnusedDrawCmd();
+}
+
+// Vertex position of each index, following draw commands
+static void GetTrianglesPos(ImDrawList* draw_list, ImVector<ImVec2>* out_pos)
+{
+    out_pos->resize(0);
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        for (unsigned int idx_n = cmd.IdxOffset; idx_n < cmd.IdxOffset + cmd.ElemCount; idx_n++)
+            out_pos->push_back(draw_list->VtxBuffer[cmd.VtxOffset + draw_list->_GetIdx(idx_n)].pos);
+}
+
+// Flatten lists with mixed index sizes, then check each flattened command against the list's own commands
+static void TestFlatten(ImDrawList** draw_lists, int draw_lists_count)
+{
+    ImDrawData draw_data;
+    for (int n = 0; n < draw_lists_count; n++)
+        draw_data.CmdLists.push_back(draw_lists[n]);
+    draw_data.CmdListsCount = draw_lists_count;
+    draw_data.Flatten();
+    IM_CHECK(draw_data.FlatLists.Size == draw_lists_count + 1);
+    IM_CHECK(draw_data.FlatIdxBuffer.Size == draw_data.FlatIdxCount);
+
+    ImVector<ImVec2> pos_ref, pos;
+    for (int n = 0; n < draw_lists_count; n++)
+    {
+        ImDrawList* draw_list = draw_lists[n];
+        const ImDrawDataFlatList* flat_list = &draw_data.FlatLists[n];
+        IM_CHECK(flat_list[1].CmdOffset - flat_list->CmdOffset == draw_list->CmdBuffer.Size);
+        IM_CHECK(((size_t)flat_list->IdxOffset * sizeof(ImDrawIdx)) % (size_t)draw_list->IdxSize == 0); // Indices are aligned to their size
+        pos.resize(0);
+        for (int cmd_i = flat_list->CmdOffset; cmd_i < flat_list[1].CmdOffset; cmd_i++)
+        {
+            const ImDrawCmd& cmd = draw_data.FlatCmdBuffer[cmd_i];
+            IM_CHECK(cmd.UserCallback == draw_list->CmdBuffer[cmd_i - flat_list->CmdOffset].UserCallback);
+            const char* idx_data = (const char*)(const void*)draw_data.FlatIdxBuffer.Data;
+            for (unsigned int idx_n = cmd.IdxOffset; idx_n < cmd.IdxOffset + cmd.ElemCount; idx_n++)
+            {
+                const unsigned int idx = (draw_list->IdxSize == 2) ? *(const ImU16*)(const void*)(idx_data + idx_n * 2) : *(const ImU32*)(const void*)(idx_data + idx_n * 4);
+                pos.push_back(draw_data.FlatVtxBuffer[cmd.VtxOffset + idx].pos);
+            }
+        }
+        GetTrianglesPos(draw_list, &pos_ref);
+        IM_CHECK_MSG(pos.Size == pos_ref.Size && memcmp(pos.Data, pos_ref.Data, (size_t)pos.size_in_bytes()) == 0, "list %d", n);
+    }
+
+    // ScaleClipRects() keeps flattened commands in sync
+    draw_data.ScaleClipRects(ImVec2(2.0f, 0.5f));
+    for (int n = 0; n < draw_lists_count; n++)
+        for (int cmd_i = 0; cmd_i < draw_lists[n]->CmdBuffer.Size; cmd_i++)
+            IM_CHECK(memcmp(&draw_lists[n]->CmdBuffer[cmd_i].ClipRect, &draw_data.FlatCmdBuffer[draw_data.FlatLists[n].CmdOffset + cmd_i].ClipRect, sizeof(ImVec4)) == 0);
+    draw_data.ScaleClipRects(ImVec2(0.5f, 2.0f));
+    draw_data.CmdLists.resize(0); // Lists are owned by caller
+}
+
+static void TestIdxSize(int rect_count)
+{
+    const ImDrawListFlags flags = ImDrawListFlags_AllowVtxOffset;
+    ImDrawList draw_list_ref(ImGui::GetDrawListSharedData());
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    FillDrawList(&draw_list_ref, flags, rect_count);
+    FillDrawList(&draw_list, flags | ImDrawListFlags_AllowIdxSize, rect_count);
+    const int cmd_count_ref = draw_list_ref.CmdBuffer.Size;
+
+    ImDrawData draw_data;
+    ImGui::AddDrawListToDrawDataEx(&draw_data, &draw_data.CmdLists, &draw_list_ref);
+    ImGui::AddDrawListToDrawDataEx(&draw_data, &draw_data.CmdLists, &draw_list);
+    IM_CHECK(draw_list_ref.IdxSize == (int)sizeof(ImDrawIdx));
+
+    const bool large = draw_list.VtxBuffer.Size > (1 << 16);
+    IM_CHECK(draw_list.IdxSize == (large ? 4 : 2)); // Whatever sizeof(ImDrawIdx) is
+    if (large)
+    {
+        if (sizeof(ImDrawIdx) == 2)
+            IM_CHECK(cmd_count_ref > 3); // Reference was split by VtxOffset
+        IM_CHECK_MSG(draw_list.CmdBuffer.Size == 3, "%d commands", draw_list.CmdBuffer.Size); // Before callback, callback, after callback
+        IM_CHECK(draw_list.CmdBuffer[1].UserCallback == ImDrawCallback_ResetRenderState);
+        for (const ImDrawCmd& cmd : draw_list.CmdBuffer)
+            IM_CHECK(cmd.VtxOffset == 0);
+    }
+    IM_CHECK((int)draw_list.IdxBuffer.Size * (int)sizeof(ImDrawIdx) >= (int)(draw_list.CmdBuffer.back().IdxOffset + draw_list.CmdBuffer.back().ElemCount) * draw_list.IdxSize);
+
+    ImVector<ImVec2> pos_ref, pos;
+    GetTrianglesPos(&draw_list_ref, &pos_ref);
+    GetTrianglesPos(&draw_list, &pos);
+    IM_CHECK(pos.Size == pos_ref.Size && memcmp(pos.Data, pos_ref.Data, (size_t)pos.size_in_bytes()) == 0);
+
+    // Flattening with an odd index count before each list, so lists with 32-bit indices need to be realigned
+    ImDrawList* draw_lists_tri[3];
+    for (ImDrawList*& draw_list_tri : draw_lists_tri)
+    {
+        draw_list_tri = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+        draw_list_tri->ResetForThread();
+        draw_list_tri->AddTriangleFilled(ImVec2(0.0f, 0.0f), ImVec2(10.0f, 0.0f), ImVec2(0.0f, 10.0f), IM_COL32(255, 0, 0, 255));
+        draw_list_tri->_PopUnusedDrawCmd();
+    }
+    ImDrawList* flat_lists[] = { draw_lists_tri[0], &draw_list_ref, draw_lists_tri[1], &draw_list, draw_lists_tri[2] };
+    TestFlatten(flat_lists, IM_ARRAYSIZE(flat_lists));
+    for (ImDrawList* draw_list_tri : draw_lists_tri)
+        IM_DELETE(draw_list_tri);
+
+    // De-indexing gives the same vertices
+    draw_data.DeIndexAllBuffers();
+    IM_CHECK(draw_list.VtxBuffer.Size == pos_ref.Size);
+    for (int n = 0; n < draw_list.VtxBuffer.Size && n < pos_ref.Size; n++)
+        if (draw_list.VtxBuffer[n].pos.x != pos_ref[n].x || draw_list.VtxBuffer[n].pos.y != pos_ref[n].y)
+        {
+            IM_CHECK_MSG(0, "vertex %d", n);
+            break;
+        }
+    draw_data.CmdLists.resize(0); // Lists are owned by us
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame(); // Setup shared data
+    TestIdxSize(100);       // 400 vertices
+    TestIdxSize(40000);     // 160K vertices
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ImTestExit("test_idx_size");
+}
@@ -0,0 +1,128 @@
+// dear imgui: ImGuiLabel tests
+// - Check that DisplayEnd matches FindRenderedTextEnd() and that ImGuiWindow::GetID(const ImGuiLabel&) matches ImHashStr(),
+//   for labels with "##", "###", "####", trailing '#' and empty labels, parsed at compile-time and at runtime.
+// - Check (static_assert) that constructing from a string literal is a constant expression, and that a mutable char array is
+//   parsed at runtime, after its contents are set.
+
+#include "imgui_tests.h"
+#include <string.h>
+#include <type_traits>
+
+static constexpr int LabelLen(const ImGuiLabel& label)          { return (int)(label.End - label.Begin); }
+static constexpr int LabelDisplayLen(const ImGuiLabel& label)   { return (int)(label.DisplayEnd - label.Begin); }
+static constexpr int LabelIdOffset(const ImGuiLabel& label)     { return (int)(label.IdBegin - label.Begin); }
+
+// Constructors are explicit: a label doesn't silently capture a (possibly mutable) char array.
+static_assert(!std::is_convertible<const char(&)[6], ImGuiLabel>::value, "");
+static_assert(!std::is_convertible<char(&)[6], ImGuiLabel>::value, "");
+
+// Compile-time parse
+#define CHECK_CONSTEXPR_LABEL(STR, DISPLAY_LEN, ID_OFFSET) \
+    static_assert(LabelLen(ImGuiLabel(STR)) == (int)sizeof(STR) - 1 && LabelDisplayLen(ImGuiLabel(STR)) == DISPLAY_LEN && LabelIdOffset(ImGuiLabel(STR)) == ID_OFFSET, STR)
+CHECK_CONSTEXPR_LABEL("", 0, 0);
+CHECK_CONSTEXPR_LABEL("a", 1, 0);
+CHECK_CONSTEXPR_LABEL("#", 1, 0);
+CHECK_CONSTEXPR_LABEL("a#", 2, 0);
+CHECK_CONSTEXPR_LABEL("##", 0, 0);
+CHECK_CONSTEXPR_LABEL("a##", 1, 0);
+CHECK_CONSTEXPR_LABEL("Apply##1", 5, 0);
+CHECK_CONSTEXPR_LABEL("###", 0, 0);
+CHECK_CONSTEXPR_LABEL("Apply###ID", 5, 5);
+CHECK_CONSTEXPR_LABEL("####", 0, 1);
+CHECK_CONSTEXPR_LABEL("a####b", 1, 2);
+CHECK_CONSTEXPR_LABEL("#####", 0, 2);
+CHECK_CONSTEXPR_LABEL("a#b#c", 5, 0);
+CHECK_CONSTEXPR_LABEL("a##b##c", 1, 0);
+CHECK_CONSTEXPR_LABEL("a##b###c", 1, 4);
+CHECK_CONSTEXPR_LABEL("a###b###c", 1, 5);
+CHECK_CONSTEXPR_LABEL("a###b##c", 1, 1);
+#undef CHECK_CONSTEXPR_LABEL
+static_assert(LabelLen(ImGuiLabel("a\0##b")) == 1 && LabelDisplayLen(ImGuiLabel("a\0##b")) == 1, ""); // Stops at first zero-terminator
+static_assert(!std::is_constructible<ImGuiLabel, const char*>::value, "");  // Pointers: use ImGuiLabel(str, str_end)
+
+static void CheckLabel(ImGuiWindow* window, const ImGuiLabel& label, const char* str, const char* str_end, const char* what)
+{
+    IM_CHECK_MSG(label.Begin == str && label.End == str_end, "%s \"%.*s\": length %d", what, (int)(str_end - str), str, LabelLen(label));
+    IM_CHECK_MSG(label.DisplayEnd == ImGui::FindRenderedTextEnd(str, str_end), "%s \"%.*s\": DisplayEnd %d", what, (int)(str_end - str), str, LabelDisplayLen(label));
+    IM_CHECK_MSG(label.IdBegin >= label.Begin && label.IdBegin <= label.End, "%s \"%.*s\": IdBegin %d", what, (int)(str_end - str), str, LabelIdOffset(label));
+    // ImHashStr() and GetID(str, str_end) treat an empty range as a zero-terminated string: hash "" instead.
+    const bool empty = (str == str_end);
+    const ImGuiID id = window->GetID(label);
+    IM_CHECK_MSG(id == ImHashStr(empty ? "" : str, (size_t)(str_end - str), window->IDStack.back()), "%s \"%.*s\": IdBegin %d", what, (int)(str_end - str), str, LabelIdOffset(label));
+    IM_CHECK_MSG(id == (empty ? window->GetID("") : window->GetID(str, str_end)), "%s \"%.*s\"", what, (int)(str_end - str), str);
+    IM_CHECK_MSG(id == ImGui::GetID(label), "%s \"%.*s\"", what, (int)(str_end - str), str);
+}
+
+// Compile-time parse, checked against runtime functions
+static void TestConstexpr(ImGuiWindow* window)
+{
+#define CHECK_LABEL(STR) \
+    do { static constexpr ImGuiLabel label(STR); CheckLabel(window, label, label.Begin, label.Begin + strlen(STR), "constexpr"); } while (0)
+    CHECK_LABEL("");
+    CHECK_LABEL("a");
+    CHECK_LABEL("#");
+    CHECK_LABEL("a#");
+    CHECK_LABEL("##");
+    CHECK_LABEL("a##");
+    CHECK_LABEL("Apply##1");
+    CHECK_LABEL("###");
+    CHECK_LABEL("Apply###ID");
+    CHECK_LABEL("####");
+    CHECK_LABEL("a####b");
+    CHECK_LABEL("#####");
+    CHECK_LABEL("a#b#c");
+    CHECK_LABEL("a##b##c");
+    CHECK_LABEL("a##b###c");
+    CHECK_LABEL("a###b###c");
+    CHECK_LABEL("a###b##c");
+#undef CHECK_LABEL
+}
+
+// Runtime parse: all strings made of 'a' and '#' up to 12 characters, zero-terminated or not
+static void TestRuntime(ImGuiWindow* window)
+{
+    char buf[16];
+    for (int len = 0; len <= 12; len++)
+        for (int bits = 0; bits < (1 << len); bits++)
+        {
+            for (int n = 0; n < len; n++)
+                buf[n] = (bits & (1 << n)) ? '#' : 'a';
+            buf[len] = '#'; // Not part of the label when passing str_end
+            CheckLabel(window, ImGuiLabel(buf, buf + len), buf, buf + len, "runtime");
+            buf[len] = 0;
+            CheckLabel(window, ImGuiLabel(buf, NULL), buf, buf + len, "runtime");
+        }
+}
+
+// Mutable char arrays are parsed at runtime, on their current contents
+static void TestMutableArray(ImGuiWindow* window)
+{
+    char buf[16] = "";
+    strcpy(buf, "Save###Save");
+    ImGuiLabel label(buf);
+    CheckLabel(window, label, buf, buf + strlen(buf), "mutable");
+    IM_CHECK(LabelDisplayLen(label) == 4 && LabelIdOffset(label) == 4);
+    strcpy(buf, "Load##2");
+    label = ImGuiLabel(buf);
+    CheckLabel(window, label, buf, buf + strlen(buf), "mutable");
+    IM_CHECK(LabelDisplayLen(label) == 4 && LabelIdOffset(label) == 0);
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame();
+    ImGui::Begin("Test", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::PushID("Seed");
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    TestConstexpr(window);
+    TestRuntime(window);
+    TestMutableArray(window);
+    ImGui::PopID();
+    ImGui::End();
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ImTestExit("test_label");
+}
@@ -0,0 +1,596 @@
+// dear imgui: AddPolyline() tests and benchmark
+// - Check that vertex and index buffers are byte-identical to the previous multi-pass implementation (RefAddPolyline() below),
+//   for every anti-aliased sub-path (textured, thin, thick), open and closed lines, duplicate points and fringe scales.
+// - Check ImDrawFlags_JoinMiter lines: buffer sizes and _VtxCurrentIdx match the actual writes, every segment is a quad with its
+//   corners at half the thickness on each side of the segment, 2 vertices per point on gentle turns, a bevel past the miter limit,
+//   reversals, all-duplicate and two-point inputs, and lists crossing 64k vertices (VtxOffset) with 16-bit indices.
+// - Build with WITH_SSE=0 and WITH_NEON_EMULATION=1 to check the scalar and NEON code paths.
+
+#include "imgui_tests.h"
+#include <string.h>
+#include <math.h>
+
+// Reference: AddPolyline() before the single-pass kernel (1.91.5), only adapted to be a free function.
+#define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = ImRsqrt(d2); VX *= inv_len; VY *= inv_len; } } (void)0
+#define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
+#define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
+
+static void RefAddPolyline(ImDrawList* dl, const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
+{
+    if (points_count < 2 || (col & IM_COL32_A_MASK) == 0)
+        return;
+
+    const bool closed = (flags & ImDrawFlags_Closed) != 0;
+    const ImVec2 opaque_uv = dl->_Data->TexUvWhitePixel;
+    const int count = closed ? points_count : points_count - 1; // The number of line segments we need to draw
+    const bool thick_line = (thickness > dl->_FringeScale);
+
+    if (dl->Flags & ImDrawListFlags_AntiAliasedLines)
+    {
+        // Anti-aliased stroke
+        const float AA_SIZE = dl->_FringeScale;
+        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+
+        // Thicknesses <1.0 should behave like thickness 1.0
+        thickness = ImMax(thickness, 1.0f);
+        const int integer_thickness = (int)thickness;
+        const float fractional_thickness = thickness - integer_thickness;
+
+        // Do we want to draw this line using a texture?
+        // - For now, only draw integer-width lines using textures to avoid issues with the way scaling occurs, could be improved.
+        // - If AA_SIZE is not 1.0f we cannot use the texture path.
+        const bool use_texture = (dl->Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+
+        // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
+        IM_ASSERT_PARANOID(!use_texture || !(dl->_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
+
+        const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
+        const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
+        dl->PrimReserve(idx_count, vtx_count);
+
+        // Temporary buffer
+        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
+        dl->_Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+        ImVec2* temp_normals = dl->_Data->TempBuffer.Data;
+        ImVec2* temp_points = temp_normals + points_count;
+
+        // Calculate normals (tangents) for each line segment
+        for (int i1 = 0; i1 < count; i1++)
+        {
+            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+            float dx = points[i2].x - points[i1].x;
+            float dy = points[i2].y - points[i1].y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            temp_normals[i1].x = dy;
+            temp_normals[i1].y = -dx;
+        }
+        if (!closed)
+            temp_normals[points_count - 1] = temp_normals[points_count - 2];
+
+        // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
+        if (use_texture || !thick_line)
+        {
+            // [PATH 1] Texture-based lines (thick or non-thick)
+            // [PATH 2] Non texture-based lines (non-thick)
+
+            // The width of the geometry we need to draw - this is essentially <thickness> pixels for the line itself, plus "one pixel" for AA.
+            // - In the texture-based path, we don't use AA_SIZE here because the +1 is tied to the generated texture
+            //   (see ImFontAtlasBuildRenderLinesTexData() function), and so alternate values won't work without changes to that code.
+            // - In the non texture-based paths, we would allow AA_SIZE to potentially be != 1.0f with a patch (e.g. fringe_scale patch to
+            //   allow scaling geometry while preserving one-screen-pixel AA fringe).
+            const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
+
+            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
+            if (!closed)
+            {
+                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
+                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
+                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
+                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
+            }
+
+            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
+            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            unsigned int idx1 = dl->_VtxCurrentIdx; // Vertex index for start of line segment
+            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            {
+                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
+                const unsigned int idx2 = ((i1 + 1) == points_count) ? dl->_VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
+
+                // Average normals
+                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
+                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
+                IM_FIXNORMAL2F(dm_x, dm_y);
+                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
+                dm_y *= half_draw_size;
+
+                // Add temporary vertexes for the outer edges
+                ImVec2* out_vtx = &temp_points[i2 * 2];
+                out_vtx[0].x = points[i2].x + dm_x;
+                out_vtx[0].y = points[i2].y + dm_y;
+                out_vtx[1].x = points[i2].x - dm_x;
+                out_vtx[1].y = points[i2].y - dm_y;
+
+                if (use_texture)
+                {
+                    // Add indices for two triangles
+                    dl->_IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); dl->_IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); dl->_IdxWritePtr[2] = (ImDrawIdx)(idx1 + 1); // Right tri
+                    dl->_IdxWritePtr[3] = (ImDrawIdx)(idx2 + 1); dl->_IdxWritePtr[4] = (ImDrawIdx)(idx1 + 1); dl->_IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Left tri
+                    dl->_IdxWritePtr += 6;
+                }
+                else
+                {
+                    // Add indexes for four triangles
+                    dl->_IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); dl->_IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); dl->_IdxWritePtr[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
+                    dl->_IdxWritePtr[3] = (ImDrawIdx)(idx1 + 2); dl->_IdxWritePtr[4] = (ImDrawIdx)(idx2 + 2); dl->_IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
+                    dl->_IdxWritePtr[6] = (ImDrawIdx)(idx2 + 1); dl->_IdxWritePtr[7] = (ImDrawIdx)(idx1 + 1); dl->_IdxWritePtr[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
+                    dl->_IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); dl->_IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); dl->_IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
+                    dl->_IdxWritePtr += 12;
+                }
+
+                idx1 = idx2;
+            }
+
+            // Add vertexes for each point on the line
+            if (use_texture)
+            {
+                // If we're using textures we only need to emit the left/right edge vertices
+                ImVec4 tex_uvs = dl->_Data->TexUvLines[integer_thickness];
+                /*if (fractional_thickness != 0.0f) // Currently always zero when use_texture==false!
+                {
+                    const ImVec4 tex_uvs_1 = dl->_Data->TexUvLines[integer_thickness + 1];
+                    tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
+                    tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
+                    tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
+                    tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
+                }*/
+                ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
+                ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
+                for (int i = 0; i < points_count; i++)
+                {
+                    dl->_VtxWritePtr[0].pos = temp_points[i * 2 + 0]; dl->_VtxWritePtr[0].uv = tex_uv0; dl->_VtxWritePtr[0].col = col; // Left-side outer edge
+                    dl->_VtxWritePtr[1].pos = temp_points[i * 2 + 1]; dl->_VtxWritePtr[1].uv = tex_uv1; dl->_VtxWritePtr[1].col = col; // Right-side outer edge
+                    dl->_VtxWritePtr += 2;
+                }
+            }
+            else
+            {
+                // If we're not using a texture, we need the center vertex as well
+                for (int i = 0; i < points_count; i++)
+                {
+                    dl->_VtxWritePtr[0].pos = points[i];              dl->_VtxWritePtr[0].uv = opaque_uv; dl->_VtxWritePtr[0].col = col;       // Center of line
+                    dl->_VtxWritePtr[1].pos = temp_points[i * 2 + 0]; dl->_VtxWritePtr[1].uv = opaque_uv; dl->_VtxWritePtr[1].col = col_trans; // Left-side outer edge
+                    dl->_VtxWritePtr[2].pos = temp_points[i * 2 + 1]; dl->_VtxWritePtr[2].uv = opaque_uv; dl->_VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                    dl->_VtxWritePtr += 3;
+                }
+            }
+        }
+        else
+        {
+            // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
+            const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+
+            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
+            if (!closed)
+            {
+                const int points_last = points_count - 1;
+                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
+                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
+                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
+                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
+                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
+                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
+                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
+                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
+            }
+
+            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
+            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            unsigned int idx1 = dl->_VtxCurrentIdx; // Vertex index for start of line segment
+            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            {
+                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
+                const unsigned int idx2 = (i1 + 1) == points_count ? dl->_VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
+
+                // Average normals
+                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
+                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
+                IM_FIXNORMAL2F(dm_x, dm_y);
+                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
+                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
+                float dm_in_x = dm_x * half_inner_thickness;
+                float dm_in_y = dm_y * half_inner_thickness;
+
+                // Add temporary vertices
+                ImVec2* out_vtx = &temp_points[i2 * 4];
+                out_vtx[0].x = points[i2].x + dm_out_x;
+                out_vtx[0].y = points[i2].y + dm_out_y;
+                out_vtx[1].x = points[i2].x + dm_in_x;
+                out_vtx[1].y = points[i2].y + dm_in_y;
+                out_vtx[2].x = points[i2].x - dm_in_x;
+                out_vtx[2].y = points[i2].y - dm_in_y;
+                out_vtx[3].x = points[i2].x - dm_out_x;
+                out_vtx[3].y = points[i2].y - dm_out_y;
+
+                // Add indexes
+                dl->_IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); dl->_IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); dl->_IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
+                dl->_IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); dl->_IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); dl->_IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
+                dl->_IdxWritePtr[6]  = (ImDrawIdx)(idx2 + 1); dl->_IdxWritePtr[7]  = (ImDrawIdx)(idx1 + 1); dl->_IdxWritePtr[8]  = (ImDrawIdx)(idx1 + 0);
+                dl->_IdxWritePtr[9]  = (ImDrawIdx)(idx1 + 0); dl->_IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); dl->_IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1);
+                dl->_IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); dl->_IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); dl->_IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
+                dl->_IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); dl->_IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); dl->_IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
+                dl->_IdxWritePtr += 18;
+
+                idx1 = idx2;
+            }
+
+            // Add vertices
+            for (int i = 0; i < points_count; i++)
+            {
+                dl->_VtxWritePtr[0].pos = temp_points[i * 4 + 0]; dl->_VtxWritePtr[0].uv = opaque_uv; dl->_VtxWritePtr[0].col = col_trans;
+                dl->_VtxWritePtr[1].pos = temp_points[i * 4 + 1]; dl->_VtxWritePtr[1].uv = opaque_uv; dl->_VtxWritePtr[1].col = col;
+                dl->_VtxWritePtr[2].pos = temp_points[i * 4 + 2]; dl->_VtxWritePtr[2].uv = opaque_uv; dl->_VtxWritePtr[2].col = col;
+                dl->_VtxWritePtr[3].pos = temp_points[i * 4 + 3]; dl->_VtxWritePtr[3].uv = opaque_uv; dl->_VtxWritePtr[3].col = col_trans;
+                dl->_VtxWritePtr += 4;
+            }
+        }
+        dl->_VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+    else
+    {
+        // [PATH 4] Non texture-based, Non anti-aliased lines
+        const int idx_count = count * 6;
+        const int vtx_count = count * 4;    // FIXME-OPT: Not sharing edges
+        dl->PrimReserve(idx_count, vtx_count);
+
+        for (int i1 = 0; i1 < count; i1++)
+        {
+            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+            const ImVec2& p1 = points[i1];
+            const ImVec2& p2 = points[i2];
+
+            float dx = p2.x - p1.x;
+            float dy = p2.y - p1.y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            dx *= (thickness * 0.5f);
+            dy *= (thickness * 0.5f);
+
+            dl->_VtxWritePtr[0].pos.x = p1.x + dy; dl->_VtxWritePtr[0].pos.y = p1.y - dx; dl->_VtxWritePtr[0].uv = opaque_uv; dl->_VtxWritePtr[0].col = col;
+            dl->_VtxWritePtr[1].pos.x = p2.x + dy; dl->_VtxWritePtr[1].pos.y = p2.y - dx; dl->_VtxWritePtr[1].uv = opaque_uv; dl->_VtxWritePtr[1].col = col;
+            dl->_VtxWritePtr[2].pos.x = p2.x - dy; dl->_VtxWritePtr[2].pos.y = p2.y + dx; dl->_VtxWritePtr[2].uv = opaque_uv; dl->_VtxWritePtr[2].col = col;
+            dl->_VtxWritePtr[3].pos.x = p1.x - dy; dl->_VtxWritePtr[3].pos.y = p1.y + dx; dl->_VtxWritePtr[3].uv = opaque_uv; dl->_VtxWritePtr[3].col = col;
+            dl->_VtxWritePtr += 4;
+
+            dl->_IdxWritePtr[0] = (ImDrawIdx)(dl->_VtxCurrentIdx); dl->_IdxWritePtr[1] = (ImDrawIdx)(dl->_VtxCurrentIdx + 1); dl->_IdxWritePtr[2] = (ImDrawIdx)(dl->_VtxCurrentIdx + 2);
+            dl->_IdxWritePtr[3] = (ImDrawIdx)(dl->_VtxCurrentIdx); dl->_IdxWritePtr[4] = (ImDrawIdx)(dl->_VtxCurrentIdx + 2); dl->_IdxWritePtr[5] = (ImDrawIdx)(dl->_VtxCurrentIdx + 3);
+            dl->_IdxWritePtr += 6;
+            dl->_VtxCurrentIdx += 4;
+        }
+    }
+}
+
+static void InitDrawList(ImDrawList* draw_list, ImDrawListFlags flags, float fringe_scale)
+{
+    draw_list->_ResetForNewFrame();
+    draw_list->PushClipRectFullScreen();
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    draw_list->Flags = flags;
+    draw_list->_FringeScale = fringe_scale;
+}
+
+static bool DrawListsEqual(const ImDrawList* a, const ImDrawList* b)
+{
+    if (a->VtxBuffer.Size != b->VtxBuffer.Size || a->IdxBuffer.Size != b->IdxBuffer.Size)
+        return false;
+    return memcmp(a->VtxBuffer.Data, b->VtxBuffer.Data, (size_t)a->VtxBuffer.size_in_bytes()) == 0 && memcmp(a->IdxBuffer.Data, b->IdxBuffer.Data, (size_t)a->IdxBuffer.size_in_bytes()) == 0;
+}
+
+static void TestMatchesReference()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawList draw_list_ref(ImGui::GetDrawListSharedData());
+    const ImDrawListFlags flags_list[] = { ImDrawListFlags_None, ImDrawListFlags_AntiAliasedLines, ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex };
+    const float thickness_list[] = { 1.0f, 1.5f, 2.0f, 3.0f, 5.0f, 0.5f, 12.25f }; // Integer thicknesses use the textured path when available
+    ImTestRandom rng;
+    ImVector<ImVec2> points;
+    for (int n = 0; n < 20000; n++)
+    {
+        const ImDrawListFlags flags = flags_list[rng.Int(0, IM_ARRAYSIZE(flags_list) - 1)];
+        const float fringe_scale = rng.Int(0, 3) == 0 ? 1.5f : 1.0f;
+        const float thickness = thickness_list[rng.Int(0, IM_ARRAYSIZE(thickness_list) - 1)];
+        const ImDrawFlags draw_flags = rng.Int(0, 1) ? ImDrawFlags_Closed : ImDrawFlags_None;
+        points.resize(rng.Int(2, 40));
+        for (int i = 0; i < points.Size; i++)
+        {
+            if (i > 0 && rng.Int(0, 7) == 0)
+                points[i] = points[i - 1]; // Duplicate points give zero-length segments
+            else
+                points[i] = ImVec2(rng.Float(0.0f, 500.0f), rng.Float(0.0f, 500.0f));
+        }
+
+        InitDrawList(&draw_list, flags, fringe_scale);
+        InitDrawList(&draw_list_ref, flags, fringe_scale);
+        draw_list.AddPolyline(points.Data, points.Size, IM_COL32(255, 128, 0, 200), draw_flags, thickness);
+        RefAddPolyline(&draw_list_ref, points.Data, points.Size, IM_COL32(255, 128, 0, 200), draw_flags, thickness);
+        IM_CHECK_MSG(DrawListsEqual(&draw_list, &draw_list_ref), "n=%d flags=0x%X fringe=%.1f thickness=%.2f points=%d closed=%d", n, flags, fringe_scale, thickness, points.Size, draw_flags != 0);
+        if (GTestErrors > 10)
+            return;
+    }
+}
+
+// Explicit negative segment counts must not write anything (only 0 selects auto-tessellation)
+static void TestBezierSegmentCounts()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    InitDrawList(&draw_list, ImDrawListFlags_None, 1.0f);
+    const int segments_list[] = { -100, -1, 0, 1, 3, 4, 5, 17 };
+    for (int n = 0; n < IM_ARRAYSIZE(segments_list); n++)
+    {
+        const int num_segments = segments_list[n];
+        draw_list.PathClear();
+        draw_list.PathLineTo(ImVec2(10.0f, 10.0f));
+        draw_list.PathBezierCubicCurveTo(ImVec2(100.0f, 0.0f), ImVec2(0.0f, 100.0f), ImVec2(100.0f, 100.0f), num_segments);
+        draw_list.PathBezierQuadraticCurveTo(ImVec2(200.0f, 0.0f), ImVec2(200.0f, 200.0f), num_segments);
+        if (num_segments < 0)
+            IM_CHECK_MSG(draw_list._Path.Size == 1, "num_segments=%d path=%d", num_segments, draw_list._Path.Size);
+        else if (num_segments > 0)
+            IM_CHECK_MSG(draw_list._Path.Size == 1 + num_segments * 2, "num_segments=%d path=%d", num_segments, draw_list._Path.Size);
+        if (num_segments > 0)
+            IM_CHECK(draw_list._Path.back().x == 200.0f && draw_list._Path.back().y == 200.0f);
+    }
+    draw_list.PathClear();
+}
+
+// Check one ImDrawFlags_JoinMiter polyline added at the end of 'draw_list'. Return the number of vertices and indices it wrote.
+// - Buffer sizes, write pointers and _VtxCurrentIdx match the actual writes, indices only reference the new vertices and all of them.
+// - Indices are a sequence of bevel triangles (3) and segment quads (6: l0,l1,r1, l0,r1,r0), one quad per segment in order.
+//   All four corners of a quad are at half the thickness from the segment line: l on the normal side, r on the other side.
+static void CheckMiterPolyline(ImDrawList* draw_list, const ImVec2* points, int points_count, ImDrawFlags flags, float thickness, int* out_vtx_count = NULL, int* out_idx_count = NULL)
+{
+    const int errors_start = GTestErrors;
+    const int vtx_start = draw_list->VtxBuffer.Size;
+    const int idx_start = draw_list->IdxBuffer.Size;
+    draw_list->AddPolyline(points, points_count, IM_COL32_WHITE, flags | ImDrawFlags_JoinMiter, thickness);
+    const int vtx_count = draw_list->VtxBuffer.Size - vtx_start;
+    const int idx_count = draw_list->IdxBuffer.Size - idx_start;
+    if (out_vtx_count)
+        *out_vtx_count = vtx_count;
+    if (out_idx_count)
+        *out_idx_count = idx_count;
+
+    IM_CHECK(draw_list->_VtxWritePtr == draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size);
+    IM_CHECK(draw_list->_IdxWritePtr == draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size);
+    IM_CHECK(draw_list->_VtxCurrentIdx == (unsigned int)(draw_list->VtxBuffer.Size - (int)draw_list->_CmdHeader.VtxOffset));
+    if (sizeof(ImDrawIdx) == 2)
+        IM_CHECK(draw_list->_VtxCurrentIdx <= (1 << 16));
+    int elem_count = 0;
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        IM_CHECK(cmd.IdxOffset == (unsigned int)elem_count);
+        elem_count += (int)cmd.ElemCount;
+    }
+    IM_CHECK(elem_count == draw_list->IdxBuffer.Size);
+    if (GTestErrors > errors_start)
+        return;
+
+    // Resolve indices (VtxOffset + index), they all belong to the last command
+    const ImDrawCmd& cmd = draw_list->CmdBuffer.back();
+    IM_CHECK((int)cmd.IdxOffset <= idx_start);
+    ImVector<int> idx;
+    ImVector<bool> vtx_used;
+    vtx_used.resize(vtx_count, false);
+    for (int n = idx_start; n < draw_list->IdxBuffer.Size; n++)
+    {
+        const int vtx_n = (int)cmd.VtxOffset + (int)draw_list->IdxBuffer[n];
+        IM_CHECK_MSG(vtx_n >= vtx_start && vtx_n < draw_list->VtxBuffer.Size, "index %d -> vertex %d, new vertices %d..%d", n, vtx_n, vtx_start, draw_list->VtxBuffer.Size);
+        if (vtx_n < vtx_start || vtx_n >= draw_list->VtxBuffer.Size)
+            return;
+        idx.push_back(vtx_n);
+        vtx_used[vtx_n - vtx_start] = true;
+    }
+
+    // Segments between distinct consecutive points (a closed line also drops the trailing points equal to the first one)
+    const bool closed = (flags & ImDrawFlags_Closed) != 0;
+    ImVector<ImVec2> uniques;
+    for (int n = 0; n < points_count; n++)
+        if (uniques.Size == 0 || points[n].x != uniques.back().x || points[n].y != uniques.back().y)
+            uniques.push_back(points[n]);
+    while (closed && uniques.Size > 1 && uniques.back().x == uniques[0].x && uniques.back().y == uniques[0].y)
+        uniques.pop_back();
+    const int segments_count = closed ? uniques.Size : uniques.Size - 1;
+    if (segments_count > 0)
+        for (int n = 0; n < vtx_count; n++)
+            IM_CHECK_MSG(vtx_used[n], "vertex %d of %d unused", n, vtx_count);
+    else
+        IM_CHECK(idx_count == 0);
+
+    const float half_thickness = thickness * 0.5f;
+    int segment_n = 0;
+    for (int n = 0; n < idx.Size && GTestErrors == errors_start; )
+    {
+        const bool is_quad = (n + 6 <= idx.Size) && idx[n] == idx[n + 3] && idx[n + 2] == idx[n + 4];
+        if (!is_quad)
+        {
+            IM_CHECK_MSG(n + 3 <= idx.Size && idx[n + 1] == idx[n] + 1 && idx[n + 2] == idx[n] + 2, "indices %d: not a quad nor a bevel triangle", n);
+            n += 3;
+            continue;
+        }
+        IM_CHECK_MSG(segment_n < segments_count, "segment %d of %d", segment_n, segments_count);
+        if (segment_n >= segments_count)
+            return;
+        const ImVec2 p1 = uniques[segment_n];
+        const ImVec2 p2 = uniques[(segment_n + 1) % uniques.Size];
+        segment_n++;
+        const float len = ImSqrt(ImLengthSqr(p2 - p1));
+        if (len > 0.0f)
+        {
+            const ImVec2 normal((p2.y - p1.y) / len, -(p2.x - p1.x) / len);
+            const int corners[4] = { idx[n + 0], idx[n + 1], idx[n + 2], idx[n + 5] }; // l0, l1, r1, r0
+            for (int c = 0; c < 4; c++)
+            {
+                const ImVec2 pos = draw_list->VtxBuffer[corners[c]].pos;
+                const float dist = ImDot(pos - p1, normal);
+                const float expected_dist = (c < 2) ? half_thickness : -half_thickness;
+                const float join_dist = ImSqrt(ImLengthSqr(pos - ((c == 1 || c == 2) ? p2 : p1)));
+                const float tolerance = 0.01f + join_dist * 0.001f; // Float errors are amplified on long miters and shared inner vertices
+                IM_CHECK_MSG(ImFabs(dist - expected_dist) <= tolerance, "segment %d (%.2f,%.2f)-(%.2f,%.2f) corner %d (%.2f,%.2f): distance %f, expected %f",
+                    segment_n - 1, p1.x, p1.y, p2.x, p2.y, c, pos.x, pos.y, dist, expected_dist);
+            }
+        }
+        n += 6;
+    }
+    IM_CHECK_MSG(segment_n == segments_count, "%d segment quads, expected %d", segment_n, segments_count);
+}
+
+static void TestJoinMiter()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImVector<ImVec2> points;
+    int vtx_count, idx_count;
+
+    // Gentle turns: 2 vertices per point, a quad per segment
+    points.resize(200);
+    for (int i = 0; i < points.Size; i++)
+        points[i] = ImVec2(10.0f + i * 3.0f, 300.0f + sinf(i * 0.1f) * 100.0f);
+    InitDrawList(&draw_list, ImDrawListFlags_None, 1.0f);
+    CheckMiterPolyline(&draw_list, points.Data, points.Size, ImDrawFlags_None, 3.0f, &vtx_count, &idx_count);
+    IM_CHECK_MSG(vtx_count == points.Size * 2 && idx_count == (points.Size - 1) * 6, "vtx %d idx %d", vtx_count, idx_count);
+    points.resize(64);
+    for (int i = 0; i < points.Size; i++)
+        points[i] = ImVec2(500.0f + cosf(i * IM_PI * 2.0f / points.Size) * 200.0f, 500.0f + sinf(i * IM_PI * 2.0f / points.Size) * 200.0f);
+    InitDrawList(&draw_list, ImDrawListFlags_None, 1.0f);
+    CheckMiterPolyline(&draw_list, points.Data, points.Size, ImDrawFlags_Closed, 5.0f, &vtx_count, &idx_count);
+    IM_CHECK_MSG(vtx_count == points.Size * 2 && idx_count == points.Size * 6, "vtx %d idx %d", vtx_count, idx_count);
+
+    // Zigzags turning by a given angle: miter up to the limit (turning by 2*acos(1/IM_POLYLINE_MITER_LIMIT) ~= 151 degrees), bevel past it.
+    // Long segments: the inner side of bevels is shared, 3 vertices per point and a bevel triangle.
+    const float turn_degrees[] = { 30.0f, 90.0f, 120.0f, 149.0f, 153.0f, 170.0f };
+    for (float turn : turn_degrees)
+    {
+        const float half_angle = turn * 0.5f * IM_PI / 180.0f; // Angle between each segment and the zigzag axis
+        points.resize(20);
+        for (int i = 0; i < points.Size; i++)
+            points[i] = ImVec2(50.0f + i * cosf(half_angle) * 200.0f, 400.0f + ((i & 1) ? sinf(half_angle) * 200.0f : 0.0f));
+        const bool bevel = turn > 151.0f;
+        InitDrawList(&draw_list, ImDrawListFlags_None, 1.0f);
+        CheckMiterPolyline(&draw_list, points.Data, points.Size, ImDrawFlags_None, 4.0f, &vtx_count, &idx_count);
+        const int joins = points.Size - 2;
+        IM_CHECK_MSG(vtx_count == 4 + joins * (bevel ? 3 : 2), "turn %.0f: vtx %d", turn, vtx_count);
+        IM_CHECK_MSG(idx_count == (points.Size - 1) * 6 + (bevel ? joins * 3 : 0), "turn %.0f: idx %d", turn, idx_count);
+    }
+
+    // Reversals: the inner side can't be shared, 5 vertices
+    {
+        const ImVec2 exact[] = { ImVec2(100.0f, 100.0f), ImVec2(300.0f, 100.0f), ImVec2(100.0f, 100.0f) };
+        const ImVec2 nearly[] = { ImVec2(100.0f, 100.0f), ImVec2(300.0f, 100.0f), ImVec2(100.0f, 100.5f) };
+        const ImVec2 nearly_long[] = { ImVec2(100.0f, 100.0f), ImVec2(300.0f, 100.0f), ImVec2(100.0f, 140.0f) }; // 169 degrees, shared inner side
+        const float thickness_list[] = { 1.0f, 4.0f, 10.0f };
+        for (float thickness : thickness_list)
+        {
+            InitDrawList(&draw_list, ImDrawListFlags_None, 1.0f);
+            CheckMiterPolyline(&draw_list, exact, 3, ImDrawFlags_None, thickness, &vtx_count, &idx_count);
+            IM_CHECK_MSG(vtx_count == 2 + 5 + 2 && idx_count == 6 * 2 + 3, "exact reversal, thickness %.0f: vtx %d idx %d", thickness, vtx_count, idx_count);
+            CheckMiterPolyline(&draw_list, nearly, 3, ImDrawFlags_None, thickness, &vtx_count, &idx_count);
+            IM_CHECK_MSG(vtx_count == 2 + 5 + 2 && idx_count == 6 * 2 + 3, "near reversal, thickness %.0f: vtx %d idx %d", thickness, vtx_count, idx_count);
+            CheckMiterPolyline(&draw_list, nearly_long, 3, ImDrawFlags_None, thickness, &vtx_count, &idx_count);
+            IM_CHECK_MSG(vtx_count == 2 + 3 + 2 && idx_count == 6 * 2 + 3, "169 degrees, thickness %.0f: vtx %d idx %d", thickness, vtx_count, idx_count);
+            CheckMiterPolyline(&draw_list, exact, 3, ImDrawFlags_Closed, thickness, &vtx_count, &idx_count); // Closing segment overlaps the first one
+            IM_CHECK_MSG(vtx_count == 5 * 2 && idx_count == 6 * 2 + 3 * 2, "closed exact reversal, thickness %.0f: vtx %d idx %d", thickness, vtx_count, idx_count);
+        }
+    }
+
+    // Two points, and duplicates
+    {
+        const ImVec2 two[] = { ImVec2(10.0f, 10.0f), ImVec2(50.0f, 30.0f) };
+        const ImVec2 two_dup[] = { ImVec2(10.0f, 10.0f), ImVec2(10.0f, 10.0f), ImVec2(50.0f, 30.0f), ImVec2(50.0f, 30.0f), ImVec2(50.0f, 30.0f) };
+        const ImVec2 all_dup[] = { ImVec2(70.0f, 80.0f), ImVec2(70.0f, 80.0f), ImVec2(70.0f, 80.0f), ImVec2(70.0f, 80.0f) };
+        InitDrawList(&draw_list, ImDrawListFlags_None, 1.0f);
+        CheckMiterPolyline(&draw_list, two, 2, ImDrawFlags_None, 2.0f, &vtx_count, &idx_count);
+        IM_CHECK_MSG(vtx_count == 4 && idx_count == 6, "two points: vtx %d idx %d", vtx_count, idx_count);
+        CheckMiterPolyline(&draw_list, two_dup, IM_ARRAYSIZE(two_dup), ImDrawFlags_None, 2.0f, &vtx_count, &idx_count);
+        IM_CHECK_MSG(vtx_count == 4 && idx_count == 6, "two points with duplicates: vtx %d idx %d", vtx_count, idx_count);
+        CheckMiterPolyline(&draw_list, two, 2, ImDrawFlags_Closed, 2.0f, &vtx_count, &idx_count); // Both points are reversals
+        IM_CHECK_MSG(vtx_count == 10 && idx_count == 18, "two points closed: vtx %d idx %d", vtx_count, idx_count);
+        CheckMiterPolyline(&draw_list, two_dup, IM_ARRAYSIZE(two_dup), ImDrawFlags_Closed, 2.0f, &vtx_count, &idx_count);
+        IM_CHECK_MSG(vtx_count == 10 && idx_count == 18, "two points with duplicates closed: vtx %d idx %d", vtx_count, idx_count);
+        for (int closed = 0; closed < 2; closed++)
+        {
+            // All duplicates: nothing visible, all vertices on the point
+            const int vtx_start = draw_list.VtxBuffer.Size;
+            CheckMiterPolyline(&draw_list, all_dup, IM_ARRAYSIZE(all_dup), closed ? ImDrawFlags_Closed : ImDrawFlags_None, 2.0f, &vtx_count, &idx_count);
+            for (int n = vtx_start; n < draw_list.VtxBuffer.Size; n++)
+                IM_CHECK_MSG(draw_list.VtxBuffer[n].pos.x == all_dup[0].x && draw_list.VtxBuffer[n].pos.y == all_dup[0].y, "all duplicates, closed=%d: vertex (%f,%f)", closed, draw_list.VtxBuffer[n].pos.x, draw_list.VtxBuffer[n].pos.y);
+        }
+    }
+
+    // Random lines with duplicates and sharp turns
+    ImTestRandom rng;
+    for (int n = 0; n < 20000 && GTestErrors == 0; n++)
+    {
+        points.resize(rng.Int(2, 30));
+        for (int i = 0; i < points.Size; i++)
+        {
+            if (i > 0 && rng.Int(0, 7) == 0)
+                points[i] = points[i - 1];
+            else if (i > 1 && rng.Int(0, 7) == 0)
+                points[i] = points[i - 2]; // Reversal
+            else
+                points[i] = ImVec2(rng.Float(0.0f, 500.0f), rng.Float(0.0f, 500.0f));
+        }
+        InitDrawList(&draw_list, ImDrawListFlags_None, 1.0f);
+        CheckMiterPolyline(&draw_list, points.Data, points.Size, rng.Int(0, 1) ? ImDrawFlags_Closed : ImDrawFlags_None, rng.Float(0.5f, 20.0f));
+    }
+
+    // Lists crossing 64k vertices: the reservation starts a new VtxOffset with 16-bit indices
+    InitDrawList(&draw_list, ImDrawListFlags_AllowVtxOffset, 1.0f);
+    while (draw_list.VtxBuffer.Size < 65000)
+        draw_list.AddRectFilled(ImVec2(0.0f, 0.0f), ImVec2(10.0f, 10.0f), IM_COL32_WHITE);
+    points.resize(2000);
+    for (int i = 0; i < points.Size; i++)
+        points[i] = ImVec2(10.0f + i * 0.5f, 300.0f + ((i % 7) == 0 ? 50.0f : 0.0f) + sinf(i * 0.1f) * 100.0f); // Some sharp turns
+    for (int closed = 0; closed < 2; closed++)
+        for (int repeat = 0; repeat < 20; repeat++)
+            CheckMiterPolyline(&draw_list, points.Data, points.Size, closed ? ImDrawFlags_Closed : ImDrawFlags_None, 2.0f);
+    IM_CHECK(draw_list.VtxBuffer.Size > (1 << 16) * 2);
+    if (sizeof(ImDrawIdx) == 2)
+        IM_CHECK(draw_list.CmdBuffer.Size >= 3 && draw_list.CmdBuffer.back().VtxOffset > 0);
+}
+
+static void Benchmark()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImVector<ImVec2> points;
+    points.resize(6000);
+    for (int i = 0; i < points.Size; i++)
+        points[i] = ImVec2(i * 0.3f, 500.0f + sinf(i * 0.01f) * 400.0f);
+
+    struct { const char* Name; ImDrawListFlags Flags; float Thickness; } cases[] =
+    {
+        { "textured 1px", ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex, 1.0f },
+        { "thin        ", ImDrawListFlags_AntiAliasedLines, 1.0f },
+        { "thick 4px   ", ImDrawListFlags_AntiAliasedLines, 4.0f },
+    };
+    printf("AddPolyline(), %d-point sine, points/us (old -> new):\n", points.Size);
+    for (int c = 0; c < IM_ARRAYSIZE(cases); c++)
+    {
+        const double ns_ref = ImTestBench(20, 10, [&]() { InitDrawList(&draw_list, cases[c].Flags, 1.0f); RefAddPolyline(&draw_list, points.Data, points.Size, IM_COL32_WHITE, ImDrawFlags_None, cases[c].Thickness); });
+        const double ns_new = ImTestBench(20, 10, [&]() { InitDrawList(&draw_list, cases[c].Flags, 1.0f); draw_list.AddPolyline(points.Data, points.Size, IM_COL32_WHITE, ImDrawFlags_None, cases[c].Thickness); });
+        printf("  %s %6.0f -> %6.0f\n", cases[c].Name, points.Size * 1000.0 / ns_ref, points.Size * 1000.0 / ns_new);
+    }
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame(); // Setup shared data (TexUvLines, TexUvWhitePixel)
+    TestMatchesReference();
+    TestBezierSegmentCounts();
+    TestJoinMiter();
+    Benchmark();
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ImTestExit("test_polyline");
+}
@@ -0,0 +1,242 @@
+// dear imgui: io.WantRedraw / io.NextRedrawDelay tests (low-power applications)
+// - Check that idle frames settle to WantRedraw == false with NextRedrawDelay == FLT_MAX.
+// - Check that held keys, appearing windows and opened popups keep frames coming, and that cursor blinking gives a finite delay.
+// - Check that hover delays for tooltips give a finite delay, and that waiting for that delay is enough to display the tooltip.
+// - Check that RequestRedraw() and RequestRedraw(delay) are honored, for one frame only.
+
+#include "imgui_tests.h"
+#include <float.h>
+
+enum FrameFlags
+{
+    FrameFlags_None             = 0,
+    FrameFlags_ShowWindow2      = 1 << 0,
+    FrameFlags_OpenPopup        = 1 << 1,
+    FrameFlags_InputText        = 1 << 2,
+};
+
+// Process a frame with a fixed window, after 'dt' seconds. Return true if the button was hovered long enough to display its tooltip.
+static bool RunFrame(int flags = FrameFlags_None, float dt = 1.0f / 60.0f, float request_redraw_delay = -1.0f)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.DeltaTime = dt;
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(100, 100));
+    ImGui::SetNextWindowSize(ImVec2(300, 200));
+    ImGui::Begin("Test", NULL, ImGuiWindowFlags_NoSavedSettings);
+    ImGui::Button("Button", ImVec2(100, 30)); // At (108,127)-(208,157) with default style
+    const bool tooltip = ImGui::IsItemHovered(ImGuiHoveredFlags_ForTooltip);
+    if (tooltip)
+        ImGui::SetTooltip("Tooltip");
+    if (flags & FrameFlags_OpenPopup)
+        ImGui::OpenPopup("Popup");
+    if (ImGui::BeginPopup("Popup"))
+    {
+        ImGui::Text("Popup");
+        ImGui::EndPopup();
+    }
+    if (flags & FrameFlags_InputText)
+    {
+        static char buf[32] = "Hello";
+        if (ImGui::GetActiveID() == 0)
+            ImGui::SetKeyboardFocusHere();
+        ImGui::InputText("Input", buf, IM_ARRAYSIZE(buf));
+    }
+    ImGui::End();
+    if (flags & FrameFlags_ShowWindow2)
+    {
+        ImGui::SetNextWindowPos(ImVec2(500, 100));
+        ImGui::Begin("Window 2", NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize);
+        ImGui::Text("Window 2");
+        ImGui::End();
+    }
+    if (request_redraw_delay >= 0.0f)
+        ImGui::RequestRedraw(request_redraw_delay);
+    ImGui::Render();
+    return tooltip;
+}
+
+static bool IsIdle()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    return !io.WantRedraw && io.NextRedrawDelay == FLT_MAX;
+}
+
+// Delay until next frame for an application waiting for input events while io.WantRedraw is false
+static float GetNextFrameDelay()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    return io.WantRedraw ? 1.0f / 60.0f : io.NextRedrawDelay;
+}
+
+// Run frames as an application saving power would, until idle. Return number of frames, or -1 if frames keep coming.
+static int RunFramesUntilIdle(int flags = FrameFlags_None, int max_frames = 20)
+{
+    for (int n = 1; n <= max_frames; n++)
+    {
+        RunFrame(flags, IsIdle() ? 1.0f / 60.0f : GetNextFrameDelay());
+        if (IsIdle())
+            return n;
+    }
+    return -1;
+}
+
+static void TestIdle()
+{
+    const int frames = RunFramesUntilIdle();
+    IM_CHECK_MSG(frames > 0, "idle frames don't settle");
+    for (int n = 0; n < 10; n++)
+    {
+        RunFrame(FrameFlags_None, 1.0f); // Long waits, as an application waiting for events would do
+        IM_CHECK_MSG(IsIdle(), "frame %d: WantRedraw %d, NextRedrawDelay %f", n, ImGui::GetIO().WantRedraw, ImGui::GetIO().NextRedrawDelay);
+    }
+}
+
+static void TestHeldKey()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_CHECK(RunFramesUntilIdle() > 0);
+    io.AddKeyEvent(ImGuiKey_A, true);
+    for (int n = 0; n < 30; n++)
+    {
+        RunFrame();
+        IM_CHECK_MSG(io.WantRedraw && io.NextRedrawDelay == 0.0f, "frame %d", n);
+    }
+
+    // Modifiers alone don't count, once their input event is processed
+    io.AddKeyEvent(ImGuiKey_A, false);
+    io.AddKeyEvent(ImGuiKey_LeftShift, true);
+    IM_CHECK(RunFramesUntilIdle() > 0);
+    io.AddKeyEvent(ImGuiKey_LeftShift, false);
+    IM_CHECK(RunFramesUntilIdle() > 0);
+}
+
+static void TestAppearingWindow()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_CHECK(RunFramesUntilIdle() > 0);
+    RunFrame(FrameFlags_ShowWindow2);
+    IM_CHECK(io.WantRedraw);
+    IM_CHECK(RunFramesUntilIdle(FrameFlags_ShowWindow2) > 0);
+    RunFrame(FrameFlags_None); // Disappearing
+    IM_CHECK(io.WantRedraw);
+    IM_CHECK(RunFramesUntilIdle() > 0);
+}
+
+static void TestPopup()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_CHECK(RunFramesUntilIdle() > 0);
+    RunFrame(FrameFlags_OpenPopup);
+    IM_CHECK(io.WantRedraw);
+    IM_CHECK(ImGui::IsPopupOpen("Popup", ImGuiPopupFlags_AnyPopupId));
+    IM_CHECK(RunFramesUntilIdle() > 0);
+    ImGui::GetCurrentContext()->OpenPopupStack.resize(0); // Close without an input event
+    RunFrame();
+    IM_CHECK(io.WantRedraw);
+    IM_CHECK(RunFramesUntilIdle() > 0);
+}
+
+static void TestCursorBlink()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    io.ConfigInputTextCursorBlink = true;
+    IM_CHECK(RunFramesUntilIdle() > 0);
+
+    // Waiting for the requested delays is enough to see the cursor blink
+    for (int n = 0; n < 10; n++)
+        RunFrame(FrameFlags_InputText);
+    IM_CHECK(g.InputTextState.ID != 0 && g.ActiveId == g.InputTextState.ID);
+    int toggles = 0;
+    bool cursor_visible = (g.InputTextState.CursorAnim <= 0.0f) || ImFmod(g.InputTextState.CursorAnim, 1.20f) <= 0.80f;
+    for (int n = 0; n < 20; n++)
+    {
+        IM_CHECK_MSG(!io.WantRedraw && io.NextRedrawDelay > 0.0f && io.NextRedrawDelay <= 1.11f, "frame %d: WantRedraw %d, NextRedrawDelay %f", n, io.WantRedraw, io.NextRedrawDelay);
+        if (io.WantRedraw || io.NextRedrawDelay == FLT_MAX)
+            break;
+        RunFrame(FrameFlags_InputText, io.NextRedrawDelay);
+        const bool new_cursor_visible = ImFmod(g.InputTextState.CursorAnim, 1.20f) <= 0.80f;
+        if (new_cursor_visible != cursor_visible)
+            toggles++;
+        cursor_visible = new_cursor_visible;
+    }
+    IM_CHECK_MSG(toggles >= 19, "%d toggles", toggles);
+
+    // Without blinking
+    io.ConfigInputTextCursorBlink = false;
+    IM_CHECK(RunFramesUntilIdle(FrameFlags_InputText) > 0);
+    ImGui::ClearActiveID();
+    IM_CHECK(RunFramesUntilIdle() > 0);
+}
+
+static void TestHoverDelay()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_CHECK(RunFramesUntilIdle() > 0);
+
+    // Mouse over the button: wait for the delays requested until the tooltip is displayed
+    io.AddMousePosEvent(150.0f, 140.0f);
+    int frames = 1;
+    float waited = 1.0f / 60.0f;
+    bool tooltip = RunFrame(FrameFlags_None, waited); // Woken up by input event
+    for (; frames < 20 && !tooltip; frames++)
+    {
+        const float dt = GetNextFrameDelay();
+        IM_CHECK_MSG(dt > 0.0f && dt < FLT_MAX, "frame %d: WantRedraw %d, NextRedrawDelay %f", frames, io.WantRedraw, io.NextRedrawDelay);
+        if (dt == FLT_MAX)
+            break;
+        if (!io.WantRedraw)
+            IM_CHECK_MSG(io.NextRedrawDelay <= ImGui::GetStyle().HoverDelayNormal, "frame %d: NextRedrawDelay %f", frames, io.NextRedrawDelay);
+        tooltip = RunFrame(FrameFlags_None, dt);
+        waited += dt;
+    }
+    IM_CHECK_MSG(tooltip, "tooltip not displayed after %d frames", frames);
+    const float expected_wait = ImMax(ImGui::GetStyle().HoverDelayShort, ImGui::GetStyle().HoverStationaryDelay); // Default style.HoverFlagsForTooltipMouse
+    IM_CHECK_MSG(waited >= expected_wait && waited < expected_wait + 0.1f && frames <= 8, "waited %f in %d frames", waited, frames);
+    IM_CHECK(RunFramesUntilIdle() > 0);
+
+    // Leave
+    io.AddMousePosEvent(-FLT_MAX, -FLT_MAX);
+    IM_CHECK(RunFramesUntilIdle() > 0);
+}
+
+static void TestRequestRedraw()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_CHECK(RunFramesUntilIdle() > 0);
+    RunFrame(FrameFlags_None, 1.0f / 60.0f, 0.0f);
+    IM_CHECK(io.WantRedraw && io.NextRedrawDelay == 0.0f);
+    RunFrame();
+    IM_CHECK(IsIdle());
+    RunFrame(FrameFlags_None, 1.0f / 60.0f, 0.5f);
+    IM_CHECK(!io.WantRedraw && io.NextRedrawDelay == 0.5f);
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(100, 100));
+    ImGui::SetNextWindowSize(ImVec2(300, 200));
+    ImGui::Begin("Test", NULL, ImGuiWindowFlags_NoSavedSettings); // Keep window alive
+    ImGui::End();
+    ImGui::RequestRedraw(0.5f);
+    ImGui::RequestRedraw(0.25f); // Smallest delay wins
+    ImGui::RequestRedraw(2.0f);
+    ImGui::Render();
+    IM_CHECK_MSG(!io.WantRedraw && io.NextRedrawDelay == 0.25f, "WantRedraw %d, NextRedrawDelay %f", io.WantRedraw, io.NextRedrawDelay);
+    RunFrame(FrameFlags_None, 0.25f);
+    IM_CHECK(IsIdle());
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.ConfigInputTextCursorBlink = false;
+    TestIdle();
+    TestHeldKey();
+    TestAppearingWindow();
+    TestPopup();
+    TestCursorBlink();
+    TestHoverDelay();
+    TestRequestRedraw();
+    ImGui::DestroyContext();
+    return ImTestExit("test_redraw");
+}
@@ -0,0 +1,355 @@
+// dear imgui: ShadeVertsXXX helpers, ImDrawData::ScaleClipRects() and ImDrawData::DeIndexAllBuffers() tests and benchmark
+// - Check that the SIMD versions output exactly the same bytes as the previous scalar code (Ref functions below),
+//   for random vertex ranges (covering the scalar tail), signed zeros, huge values, NaN, degenerate rectangles and short gradients.
+// - Check that vertices outside of the requested range are left untouched.
+// - Build with 'make WITH_SSE=0', 'make WITH_NEON_EMULATION=1' and 'make WITH_IDX32=1' to check the other code paths.
+
+#include "imgui_tests.h"
+#include <string.h>
+#include <limits>
+
+// Reference: ShadeVertsXXX functions, ScaleClipRects() and DeIndexAllBuffers() before SIMD (1.91.5), only adapted to be free functions.
+static void RefShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1)
+{
+    ImVec2 gradient_extent = gradient_p1 - gradient_p0;
+    float gradient_inv_length2 = 1.0f / ImLengthSqr(gradient_extent);
+    ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
+    ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
+    const int col0_r = (int)(col0 >> IM_COL32_R_SHIFT) & 0xFF;
+    const int col0_g = (int)(col0 >> IM_COL32_G_SHIFT) & 0xFF;
+    const int col0_b = (int)(col0 >> IM_COL32_B_SHIFT) & 0xFF;
+    const int col_delta_r = ((int)(col1 >> IM_COL32_R_SHIFT) & 0xFF) - col0_r;
+    const int col_delta_g = ((int)(col1 >> IM_COL32_G_SHIFT) & 0xFF) - col0_g;
+    const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
+    for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
+    {
+        float d = ImDot(vert->pos - gradient_p0, gradient_extent);
+        float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
+        int r = (int)(col0_r + col_delta_r * t);
+        int g = (int)(col0_g + col_delta_g * t);
+        int b = (int)(col0_b + col_delta_b * t);
+        vert->col = (r << IM_COL32_R_SHIFT) | (g << IM_COL32_G_SHIFT) | (b << IM_COL32_B_SHIFT) | (vert->col & IM_COL32_A_MASK);
+    }
+}
+
+static void RefShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, bool clamp)
+{
+    const ImVec2 size = b - a;
+    const ImVec2 uv_size = uv_b - uv_a;
+    const ImVec2 scale = ImVec2(
+        size.x != 0.0f ? (uv_size.x / size.x) : 0.0f,
+        size.y != 0.0f ? (uv_size.y / size.y) : 0.0f);
+
+    ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
+    ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
+    if (clamp)
+    {
+        const ImVec2 min = ImMin(uv_a, uv_b);
+        const ImVec2 max = ImMax(uv_a, uv_b);
+        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+    }
+    else
+    {
+        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+    }
+}
+
+static void RefShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& pivot_in, float cos_a, float sin_a, const ImVec2& pivot_out)
+{
+    ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
+    ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
+    for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+        vertex->pos = ImRotate(vertex->pos- pivot_in, cos_a, sin_a) + pivot_out;
+}
+
+static void RefScaleClipRects(ImDrawData* draw_data, const ImVec2& fb_scale)
+{
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+        for (ImDrawCmd& cmd : draw_list->CmdBuffer)
+            cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
+    for (ImVec4& rect : draw_data->DamageRects)
+        rect = ImVec4(rect.x * fb_scale.x, rect.y * fb_scale.y, rect.z * fb_scale.x, rect.w * fb_scale.y);
+}
+
+static void RefDeIndexAllBuffers(ImDrawData* draw_data)
+{
+    ImVector<ImDrawVert> new_vtx_buffer;
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    for (int i = 0; i < draw_data->CmdListsCount; i++)
+    {
+        ImDrawList* cmd_list = draw_data->CmdLists[i];
+        if (cmd_list->IdxBuffer.empty())
+            continue;
+        const ImDrawCmd& last_cmd = cmd_list->CmdBuffer.back();
+        const int idx_count = (cmd_list->IdxSize == (int)sizeof(ImDrawIdx)) ? cmd_list->IdxBuffer.Size : (int)(last_cmd.IdxOffset + last_cmd.ElemCount);
+        new_vtx_buffer.resize(idx_count);
+        for (int j = 0; j < idx_count; j++)
+            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->_GetIdx(j)];
+        cmd_list->VtxBuffer.swap(new_vtx_buffer);
+        cmd_list->IdxBuffer.resize(0);
+        cmd_list->IdxSize = (int)sizeof(ImDrawIdx);
+        draw_data->TotalVtxCount += cmd_list->VtxBuffer.Size;
+    }
+}
+
+// Mostly regular coordinates, with signed zeros, large values and (optionally) NaN
+static float RandomCoord(ImTestRandom& rng, float huge, bool allow_nan)
+{
+    switch (rng.Int(0, 15))
+    {
+    case 0: return 0.0f;
+    case 1: return -0.0f;
+    case 2: return rng.Int(0, 1) ? huge : -huge;
+    case 3: return allow_nan ? std::numeric_limits<float>::quiet_NaN() : 1.0f;
+    case 4: return (float)rng.Int(-100, 100); // Exact values, to land on gradient ends and UV rectangle edges
+    default: return rng.Float(-200.0f, 1200.0f);
+    }
+}
+
+static void FillVertices(ImDrawList* draw_list, ImTestRandom& rng, int vtx_count, float huge, bool allow_nan)
+{
+    draw_list->VtxBuffer.resize(vtx_count);
+    for (ImDrawVert& vert : draw_list->VtxBuffer)
+    {
+        vert.pos = ImVec2(RandomCoord(rng, huge, allow_nan), RandomCoord(rng, huge, allow_nan));
+        vert.uv = ImVec2(rng.Float(0.0f, 1.0f), rng.Float(0.0f, 1.0f));
+        vert.col = rng.Next();
+    }
+}
+
+static bool VerticesEqual(const ImDrawList* a, const ImDrawList* b)
+{
+    return a->VtxBuffer.Size == b->VtxBuffer.Size && memcmp(a->VtxBuffer.Data, b->VtxBuffer.Data, (size_t)a->VtxBuffer.size_in_bytes()) == 0;
+}
+
+static void TestShadeVerts()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawList draw_list_ref(ImGui::GetDrawListSharedData());
+    ImTestRandom rng;
+    for (int n = 0; n < 30000 && GTestErrors <= 10; n++)
+    {
+        const int func = n % 3;
+        const int vtx_count = rng.Int(0, 3) ? rng.Int(0, 24) : rng.Int(0, 1000);
+        const int vert_start_idx = rng.Int(0, vtx_count);
+        const int vert_end_idx = rng.Int(vert_start_idx, vtx_count); // Random length, so all tail sizes are used
+        FillVertices(&draw_list, rng, vtx_count, (func == 0) ? 1e6f : 1e30f, func != 0); // Gradient: NaN and infinite distances would convert out of range to int
+        draw_list_ref.VtxBuffer = draw_list.VtxBuffer;
+
+        if (func == 0)
+        {
+            const ImVec2 p0(rng.Float(-100.0f, 1100.0f), rng.Float(-100.0f, 1100.0f));
+            ImVec2 p1(rng.Float(-100.0f, 1100.0f), rng.Float(-100.0f, 1100.0f));
+            if (rng.Int(0, 7) == 0)
+                p1 = p0 + ImVec2(rng.Float(-0.1f, 0.1f), 0.05f); // Short gradient
+            const ImU32 col0 = rng.Next(), col1 = rng.Next();
+            ImGui::ShadeVertsLinearColorGradientKeepAlpha(&draw_list, vert_start_idx, vert_end_idx, p0, p1, col0, col1);
+            RefShadeVertsLinearColorGradientKeepAlpha(&draw_list_ref, vert_start_idx, vert_end_idx, p0, p1, col0, col1);
+            IM_CHECK_MSG(VerticesEqual(&draw_list, &draw_list_ref), "n=%d gradient %d..%d p0=(%f,%f) p1=(%f,%f)", n, vert_start_idx, vert_end_idx, p0.x, p0.y, p1.x, p1.y);
+        }
+        else if (func == 1)
+        {
+            const ImVec2 a(RandomCoord(rng, 1e30f, false), RandomCoord(rng, 1e30f, false));
+            ImVec2 b(rng.Float(-200.0f, 1200.0f), rng.Float(-200.0f, 1200.0f));
+            if (rng.Int(0, 7) == 0)
+                b.x = a.x; // Degenerate rectangle: scale is 0
+            if (rng.Int(0, 7) == 0)
+                b.y = a.y;
+            const ImVec2 uv_a(rng.Float(0.0f, 1.0f), rng.Float(0.0f, 1.0f));
+            const ImVec2 uv_b = rng.Int(0, 7) ? ImVec2(rng.Float(0.0f, 1.0f), rng.Float(0.0f, 1.0f)) : uv_a;
+            const bool clamp = rng.Int(0, 1) != 0;
+            ImGui::ShadeVertsLinearUV(&draw_list, vert_start_idx, vert_end_idx, a, b, uv_a, uv_b, clamp);
+            RefShadeVertsLinearUV(&draw_list_ref, vert_start_idx, vert_end_idx, a, b, uv_a, uv_b, clamp);
+            IM_CHECK_MSG(VerticesEqual(&draw_list, &draw_list_ref), "n=%d uv %d..%d a=(%f,%f) b=(%f,%f) clamp=%d", n, vert_start_idx, vert_end_idx, a.x, a.y, b.x, b.y, clamp);
+        }
+        else
+        {
+            const float angle = rng.Int(0, 7) ? rng.Float(-10.0f, 10.0f) : IM_PI * 0.5f * rng.Int(0, 4);
+            const ImVec2 pivot_in(RandomCoord(rng, 1e30f, false), RandomCoord(rng, 1e30f, false));
+            const ImVec2 pivot_out(rng.Float(-200.0f, 1200.0f), rng.Float(-200.0f, 1200.0f));
+            ImGui::ShadeVertsTransformPos(&draw_list, vert_start_idx, vert_end_idx, pivot_in, ImCos(angle), ImSin(angle), pivot_out);
+            RefShadeVertsTransformPos(&draw_list_ref, vert_start_idx, vert_end_idx, pivot_in, ImCos(angle), ImSin(angle), pivot_out);
+            IM_CHECK_MSG(VerticesEqual(&draw_list, &draw_list_ref), "n=%d transform %d..%d angle=%f pivot_in=(%f,%f)", n, vert_start_idx, vert_end_idx, angle, pivot_in.x, pivot_in.y);
+        }
+    }
+}
+
+// Random rectangles with random clip rectangles (one command each) and a callback, with 16-bit or 32-bit indices
+static void FillDrawList(ImDrawList* draw_list, ImTestRandom& rng, ImDrawListFlags flags, int rect_count)
+{
+    draw_list->ResetForThread();
+    draw_list->Flags = flags;
+    for (int n = 0; n < rect_count; n++)
+    {
+        if (rng.Int(0, 3) == 0)
+            draw_list->PushClipRect(ImVec2(rng.Float(-10.0f, 900.0f), rng.Float(-10.0f, 900.0f)), ImVec2(rng.Float(900.0f, 1900.0f), rng.Float(900.0f, 1900.0f)));
+        const ImVec2 p(rng.Float(0.0f, 1000.0f), rng.Float(0.0f, 1000.0f));
+        if (rng.Int(0, 1))
+            draw_list->AddRectFilled(p, p + ImVec2(5.0f, 5.0f), rng.Next());
+        else
+            draw_list->AddTriangleFilled(p, p + ImVec2(5.0f, 0.0f), p + ImVec2(0.0f, 5.0f), rng.Next());
+        if (draw_list->_ClipRectStack.Size > 0 && rng.Int(0, 1))
+            draw_list->PopClipRect();
+        if (n == rect_count / 2)
+            draw_list->AddCallback(ImDrawCallback_ResetRenderState, NULL);
+    }
+    draw_list->_PopUnusedDrawCmd();
+}
+
+// Fill two sets of identical draw lists, one for each implementation. Even lists may use 16-bit indices when ImDrawIdx is 32-bit, or 32-bit indices when they have too many vertices.
+static void FillDrawData(ImDrawData* draw_data, ImDrawData* draw_data_ref, ImVector<ImDrawList*>* draw_lists, ImU32 seed, const int* rect_counts, int draw_lists_count)
+{
+    ImDrawData* datas[] = { draw_data, draw_data_ref };
+    for (ImDrawData* data : datas)
+    {
+        ImTestRandom rng(seed);
+        data->Clear();
+        for (int n = 0; n < draw_lists_count; n++)
+        {
+            ImDrawList* draw_list = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+            FillDrawList(draw_list, rng, ImDrawListFlags_AllowVtxOffset | ((n & 1) ? 0 : ImDrawListFlags_AllowIdxSize), rect_counts[n]);
+            ImGui::AddDrawListToDrawDataEx(data, &data->CmdLists, draw_list);
+            draw_lists->push_back(draw_list);
+        }
+        for (int n = 0; n < 4; n++)
+            data->DamageRects.push_back(ImVec4(rng.Float(0.0f, 900.0f), rng.Float(0.0f, 900.0f), rng.Float(900.0f, 1900.0f), rng.Float(900.0f, 1900.0f)));
+    }
+}
+
+static void DeleteDrawLists(ImVector<ImDrawList*>* draw_lists)
+{
+    for (ImDrawList* draw_list : *draw_lists)
+        IM_DELETE(draw_list);
+    draw_lists->resize(0);
+}
+
+static void TestDrawData()
+{
+    ImDrawData draw_data, draw_data_ref;
+    ImVector<ImDrawList*> draw_lists;
+    ImTestRandom rng;
+    const int rect_counts[] = { 0, 1, 7, 300, 20000, 20000 }; // 20000 rectangles: 32-bit indices in list 4, split by VtxOffset in list 5 if ImDrawIdx is 16-bit
+    for (int n = 0; n < 40 && GTestErrors <= 10; n++)
+    {
+        // ScaleClipRects(), including negative, zero and fractional scales
+        FillDrawData(&draw_data, &draw_data_ref, &draw_lists, rng.Next(), rect_counts, IM_ARRAYSIZE(rect_counts) - (n & 1));
+        const float scales[] = { 1.0f, 2.0f, 1.25f, 0.0f, -0.0f, -1.5f, 1e30f };
+        const ImVec2 fb_scale(scales[rng.Int(0, IM_ARRAYSIZE(scales) - 1)], scales[rng.Int(0, IM_ARRAYSIZE(scales) - 1)]);
+        draw_data.ScaleClipRects(fb_scale);
+        RefScaleClipRects(&draw_data_ref, fb_scale);
+        for (int list_n = 0; list_n < draw_data.CmdListsCount; list_n++)
+        {
+            const ImDrawList* draw_list = draw_data.CmdLists[list_n];
+            const ImDrawList* draw_list_ref = draw_data_ref.CmdLists[list_n];
+            IM_CHECK(draw_list->CmdBuffer.Size == draw_list_ref->CmdBuffer.Size);
+            for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size && cmd_n < draw_list_ref->CmdBuffer.Size; cmd_n++)
+                IM_CHECK_MSG(memcmp(&draw_list->CmdBuffer[cmd_n].ClipRect, &draw_list_ref->CmdBuffer[cmd_n].ClipRect, sizeof(ImVec4)) == 0, "n=%d list %d cmd %d scale=(%f,%f)", n, list_n, cmd_n, fb_scale.x, fb_scale.y);
+        }
+        IM_CHECK(memcmp(draw_data.DamageRects.Data, draw_data_ref.DamageRects.Data, (size_t)draw_data.DamageRects.size_in_bytes()) == 0);
+
+        // DeIndexAllBuffers()
+        draw_data.DeIndexAllBuffers();
+        RefDeIndexAllBuffers(&draw_data_ref);
+        IM_CHECK(draw_data.TotalVtxCount == draw_data_ref.TotalVtxCount && draw_data.TotalIdxCount == draw_data_ref.TotalIdxCount);
+        for (int list_n = 0; list_n < draw_data.CmdListsCount; list_n++)
+        {
+            const ImDrawList* draw_list = draw_data.CmdLists[list_n];
+            const ImDrawList* draw_list_ref = draw_data_ref.CmdLists[list_n];
+            IM_CHECK_MSG(VerticesEqual(draw_list, draw_list_ref), "n=%d list %d: %d vs %d vertices", n, list_n, draw_list->VtxBuffer.Size, draw_list_ref->VtxBuffer.Size);
+            IM_CHECK(draw_list->IdxBuffer.Size == 0 && draw_list->IdxSize == draw_list_ref->IdxSize);
+        }
+        DeleteDrawLists(&draw_lists);
+    }
+    draw_data.Clear();
+    draw_data_ref.Clear();
+}
+
+// Best time of DeIndexAllBuffers() calls only, in microseconds, as restoring the index buffers costs about as much as de-indexing them.
+template<typename T>
+static double BenchDeIndex(ImDrawData* draw_data, const ImVector<ImDrawVert>& vtx_buffer, const ImVector<ImDrawIdx>& idx_buffer, int idx_size, T deindex_func)
+{
+    ImDrawList* draw_list = draw_data->CmdLists[0];
+    double best = 1e30;
+    for (int r = 0; r < 50; r++)
+    {
+        draw_list->VtxBuffer = vtx_buffer;
+        draw_list->IdxBuffer = idx_buffer;
+        draw_list->IdxSize = idx_size;
+        std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+        deindex_func();
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+        const double us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+        if (us < best)
+            best = us;
+    }
+    return best;
+}
+
+static void Benchmark()
+{
+    const int vtx_count = 100000;
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImTestRandom rng;
+    FillVertices(&draw_list, rng, vtx_count, 1000.0f, false);
+    const float angle = 0.3f;
+    printf("ShadeVertsXXX(), %dk vertices, us per call (old -> new):\n", vtx_count / 1000);
+    const double gradient_ref = ImTestBench(20, 10, [&]() { RefShadeVertsLinearColorGradientKeepAlpha(&draw_list, 0, vtx_count, ImVec2(0.0f, 0.0f), ImVec2(800.0f, 600.0f), IM_COL32(255, 0, 0, 255), IM_COL32(0, 128, 255, 255)); }) / 1000.0;
+    const double gradient_new = ImTestBench(20, 10, [&]() { ImGui::ShadeVertsLinearColorGradientKeepAlpha(&draw_list, 0, vtx_count, ImVec2(0.0f, 0.0f), ImVec2(800.0f, 600.0f), IM_COL32(255, 0, 0, 255), IM_COL32(0, 128, 255, 255)); }) / 1000.0;
+    printf("  ShadeVertsLinearColorGradientKeepAlpha() %7.1f -> %7.1f\n", gradient_ref, gradient_new);
+    const double uv_ref = ImTestBench(20, 10, [&]() { RefShadeVertsLinearUV(&draw_list, 0, vtx_count, ImVec2(100.0f, 100.0f), ImVec2(900.0f, 700.0f), ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), false); }) / 1000.0;
+    const double uv_new = ImTestBench(20, 10, [&]() { ImGui::ShadeVertsLinearUV(&draw_list, 0, vtx_count, ImVec2(100.0f, 100.0f), ImVec2(900.0f, 700.0f), ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), false); }) / 1000.0;
+    printf("  ShadeVertsLinearUV()                     %7.1f -> %7.1f\n", uv_ref, uv_new);
+    const double uv_clamp_ref = ImTestBench(20, 10, [&]() { RefShadeVertsLinearUV(&draw_list, 0, vtx_count, ImVec2(100.0f, 100.0f), ImVec2(900.0f, 700.0f), ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), true); }) / 1000.0;
+    const double uv_clamp_new = ImTestBench(20, 10, [&]() { ImGui::ShadeVertsLinearUV(&draw_list, 0, vtx_count, ImVec2(100.0f, 100.0f), ImVec2(900.0f, 700.0f), ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), true); }) / 1000.0;
+    printf("  ShadeVertsLinearUV(), clamp              %7.1f -> %7.1f\n", uv_clamp_ref, uv_clamp_new);
+    const double transform_ref = ImTestBench(20, 10, [&]() { RefShadeVertsTransformPos(&draw_list, 0, vtx_count, ImVec2(500.0f, 500.0f), ImCos(angle), ImSin(angle), ImVec2(500.0f, 500.0f)); }) / 1000.0;
+    const double transform_new = ImTestBench(20, 10, [&]() { ImGui::ShadeVertsTransformPos(&draw_list, 0, vtx_count, ImVec2(500.0f, 500.0f), ImCos(angle), ImSin(angle), ImVec2(500.0f, 500.0f)); }) / 1000.0;
+    printf("  ShadeVertsTransformPos()                 %7.1f -> %7.1f\n", transform_ref, transform_new);
+
+    // ScaleClipRects() on many small commands (e.g. one per table cell)
+    ImDrawData draw_data, draw_data_ref;
+    ImVector<ImDrawList*> draw_lists;
+    const int rect_counts_clip[] = { 20000, 20000, 20000, 20000 };
+    FillDrawData(&draw_data, &draw_data_ref, &draw_lists, 1, rect_counts_clip, IM_ARRAYSIZE(rect_counts_clip));
+    int cmd_count = 0;
+    for (ImDrawList* cmd_list : draw_data.CmdLists)
+        cmd_count += cmd_list->CmdBuffer.Size;
+    const double clip_ref = ImTestBench(20, 10, [&]() { RefScaleClipRects(&draw_data_ref, ImVec2(1.0f, 1.0f)); }) / 1000.0;
+    const double clip_new = ImTestBench(20, 10, [&]() { draw_data.ScaleClipRects(ImVec2(1.0f, 1.0f)); }) / 1000.0;
+    printf("ImDrawData::ScaleClipRects(), %d commands, us per call (old -> new): %.1f -> %.1f\n", cmd_count, clip_ref, clip_new);
+    DeleteDrawLists(&draw_lists);
+
+    // DeIndexAllBuffers() on a single list, with 16-bit indices and with 32-bit indices
+    printf("ImDrawData::DeIndexAllBuffers(), us per call (old -> new):\n");
+    for (int large = 0; large < 2; large++)
+    {
+        const int rect_counts_deindex[] = { large ? 40000 : 10000 }; // 40000 rectangles are too many vertices for 16-bit indices
+        FillDrawData(&draw_data, &draw_data_ref, &draw_lists, 1, rect_counts_deindex, 1);
+        const ImDrawList* src = draw_data.CmdLists[0];
+        const ImVector<ImDrawVert> vtx_buffer = src->VtxBuffer;
+        const ImVector<ImDrawIdx> idx_buffer = src->IdxBuffer;
+        const int idx_count = (int)(src->CmdBuffer.back().IdxOffset + src->CmdBuffer.back().ElemCount);
+        const int idx_size = src->IdxSize; // Reset by DeIndexAllBuffers()
+        const double deindex_ref = BenchDeIndex(&draw_data_ref, vtx_buffer, idx_buffer, idx_size, [&]() { RefDeIndexAllBuffers(&draw_data_ref); });
+        const double deindex_new = BenchDeIndex(&draw_data, vtx_buffer, idx_buffer, idx_size, [&]() { draw_data.DeIndexAllBuffers(); });
+        printf("  %3dk indices, %d-bit  %7.1f -> %7.1f\n", idx_count / 1000, idx_size * 8, deindex_ref, deindex_new);
+        DeleteDrawLists(&draw_lists);
+    }
+    draw_data.Clear();
+    draw_data_ref.Clear();
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame(); // Setup shared data
+    TestShadeVerts();
+    TestDrawData();
+    Benchmark();
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ImTestExit("test_shade_verts");
+}
@@ -0,0 +1,281 @@
+// dear imgui: ImDrawListSplitter::Merge() tests and benchmark
+// - Check that merged draw lists are identical to the previous implementation (RefMerge() below) for random channel contents
+//   (rectangles, clip rect and texture changes, callbacks), including merging into a draw list which already has commands.
+// - With explicit empty commands (which the new implementation skips), check that both outputs draw the same thing.
+
+#include "imgui_tests.h"
+#include <string.h>
+
+// Reference: ImDrawListSplitter::Merge() before the single-pass merge (1.91.5), only adapted to be a free function.
+#define ImDrawCmd_HeaderSize                            (offsetof(ImDrawCmd, VtxOffset) + sizeof(unsigned int))
+#define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset
+#define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy((void*)CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset
+
+static void RefMerge(ImDrawListSplitter* splitter, ImDrawList* draw_list)
+{
+    // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
+    if (splitter->_Count <= 1)
+        return;
+
+    splitter->SetCurrentChannel(draw_list, 0);
+    draw_list->_PopUnusedDrawCmd();
+
+    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    int new_cmd_buffer_count = 0;
+    int new_idx_buffer_count = 0;
+    ImDrawCmd* last_cmd = (splitter->_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
+    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
+    for (int i = 1; i < splitter->_Count; i++)
+    {
+        ImDrawChannel& ch = splitter->_Channels[i];
+        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+            ch._CmdBuffer.pop_back();
+
+        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
+        {
+            // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
+            // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
+            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
+            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
+            {
+                // Merge previous channel last draw command with current channel first draw command if matching.
+                last_cmd->ElemCount += next_cmd->ElemCount;
+                idx_offset += next_cmd->ElemCount;
+                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
+            }
+        }
+        if (ch._CmdBuffer.Size > 0)
+            last_cmd = &ch._CmdBuffer.back();
+        new_cmd_buffer_count += ch._CmdBuffer.Size;
+        new_idx_buffer_count += ch._IdxBuffer.Size;
+        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
+        {
+            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
+            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
+        }
+    }
+    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
+    draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+
+    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
+    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
+    ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    for (int i = 1; i < splitter->_Count; i++)
+    {
+        ImDrawChannel& ch = splitter->_Channels[i];
+        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+    }
+    draw_list->_IdxWritePtr = idx_write;
+
+    // Ensure there's always a non-callback draw command trailing the command-buffer
+    if (draw_list->CmdBuffer.Size == 0 || draw_list->CmdBuffer.back().UserCallback != NULL)
+        draw_list->AddDrawCmd();
+
+    // If current command is used with different settings we need to add a new command
+    ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
+    if (curr_cmd->ElemCount == 0)
+        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
+    else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
+        draw_list->AddDrawCmd();
+
+    splitter->_Count = 1;
+}
+
+static void DummyCallback(const ImDrawList*, const ImDrawCmd*) {}
+
+static void InitDrawList(ImDrawList* draw_list)
+{
+    draw_list->ResetForThread();
+    draw_list->Flags = ImDrawListFlags_None;
+}
+
+// Random drawing into random channels. 'rng' is passed by value so that both draw lists receive the same operations.
+static void FillChannels(ImDrawList* draw_list, ImDrawListSplitter* splitter, ImTestRandom rng, int channels_count, int ops_count, bool with_empty_cmds)
+{
+    const ImVec4 clip_rects[] = { ImVec4(0, 0, 1920, 1080), ImVec4(10, 10, 500, 500), ImVec4(100, 0, 200, 1080) };
+    const ImTextureID tex_ids[] = { ImGui::GetIO().Fonts->TexID, (ImTextureID)1, (ImTextureID)2 };
+    splitter->Split(draw_list, channels_count);
+    for (int n = 0; n < ops_count; n++)
+    {
+        switch (rng.Int(0, with_empty_cmds ? 9 : 8))
+        {
+        case 0:
+            splitter->SetCurrentChannel(draw_list, rng.Int(0, channels_count - 1));
+            break;
+        case 1:
+        {
+            const ImVec4& r = clip_rects[rng.Int(0, IM_ARRAYSIZE(clip_rects) - 1)];
+            if (draw_list->_ClipRectStack.Size > 1 && rng.Int(0, 1))
+                draw_list->PopClipRect();
+            else
+                draw_list->PushClipRect(ImVec2(r.x, r.y), ImVec2(r.z, r.w));
+            break;
+        }
+        case 2:
+            if (draw_list->_TextureIdStack.Size > 1 && rng.Int(0, 1))
+                draw_list->PopTextureID();
+            else
+                draw_list->PushTextureID(tex_ids[rng.Int(0, IM_ARRAYSIZE(tex_ids) - 1)]);
+            break;
+        case 3:
+            draw_list->AddCallback(rng.Int(0, 3) ? DummyCallback : ImDrawCallback_ResetRenderState, NULL);
+            break;
+        case 9:
+            draw_list->AddDrawCmd(); // May leave empty commands in the middle of a channel
+            break;
+        default:
+        {
+            const ImVec2 p(rng.Float(0.0f, 1000.0f), rng.Float(0.0f, 1000.0f));
+            draw_list->AddRectFilled(p, p + ImVec2(rng.Float(1.0f, 50.0f), rng.Float(1.0f, 50.0f)), IM_COL32(255, 255, 255, 255), rng.Int(0, 3) ? 0.0f : 4.0f);
+            break;
+        }
+        }
+    }
+}
+
+static bool CmdEqual(const ImDrawCmd& a, const ImDrawCmd& b)
+{
+    return memcmp(&a.ClipRect, &b.ClipRect, sizeof(ImVec4)) == 0 && a.TextureId == b.TextureId && a.VtxOffset == b.VtxOffset && a.IdxOffset == b.IdxOffset
+        && a.ElemCount == b.ElemCount && a.UserCallback == b.UserCallback && a.UserCallbackData == b.UserCallbackData;
+}
+
+static bool CmdBuffersEqual(const ImVector<ImDrawCmd>& a, const ImVector<ImDrawCmd>& b)
+{
+    if (a.Size != b.Size)
+        return false;
+    for (int n = 0; n < a.Size; n++)
+        if (!CmdEqual(a[n], b[n]))
+            return false;
+    return true;
+}
+
+// Commands as a renderer sees them: without empty commands, and with sequential commands sharing the same state merged.
+static void NormalizeCmdBuffer(const ImVector<ImDrawCmd>& cmds, ImVector<ImDrawCmd>* out_cmds)
+{
+    out_cmds->resize(0);
+    for (const ImDrawCmd& cmd : cmds)
+    {
+        if (cmd.UserCallback == NULL && cmd.ElemCount == 0)
+            continue;
+        ImDrawCmd* last_cmd = out_cmds->Size > 0 ? &out_cmds->back() : NULL;
+        if (last_cmd && last_cmd->UserCallback == NULL && cmd.UserCallback == NULL && ImDrawCmd_HeaderCompare(last_cmd, &cmd) == 0 && last_cmd->IdxOffset + last_cmd->ElemCount == cmd.IdxOffset)
+            last_cmd->ElemCount += cmd.ElemCount;
+        else
+            out_cmds->push_back(cmd);
+    }
+}
+
+static void TestMatchesReference(bool with_empty_cmds)
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawList draw_list_ref(ImGui::GetDrawListSharedData());
+    ImDrawListSplitter splitter, splitter_ref;
+    ImVector<ImDrawCmd> cmds, cmds_ref;
+    ImTestRandom rng;
+    for (int n = 0; n < 5000; n++)
+    {
+        InitDrawList(&draw_list);
+        InitDrawList(&draw_list_ref);
+        const int merges_count = rng.Int(1, 3); // Merge into a draw list which already has commands
+        for (int merge_n = 0; merge_n < merges_count; merge_n++)
+        {
+            const int channels_count = rng.Int(2, 12);
+            const int ops_count = rng.Int(0, 60);
+            FillChannels(&draw_list, &splitter, rng, channels_count, ops_count, with_empty_cmds);
+            FillChannels(&draw_list_ref, &splitter_ref, rng, channels_count, ops_count, with_empty_cmds);
+            rng.Next();
+            splitter.Merge(&draw_list);
+            RefMerge(&splitter_ref, &draw_list_ref);
+        }
+
+        bool ok = draw_list.IdxBuffer.Size == draw_list_ref.IdxBuffer.Size && memcmp(draw_list.IdxBuffer.Data, draw_list_ref.IdxBuffer.Data, (size_t)draw_list.IdxBuffer.size_in_bytes()) == 0;
+        ok &= (draw_list._IdxWritePtr - draw_list.IdxBuffer.Data) == (draw_list_ref._IdxWritePtr - draw_list_ref.IdxBuffer.Data);
+        ok &= memcmp(&draw_list._CmdHeader, &draw_list_ref._CmdHeader, sizeof(ImDrawCmdHeader)) == 0;
+        if (with_empty_cmds)
+        {
+            ok &= draw_list.CmdBuffer.Size <= draw_list_ref.CmdBuffer.Size;
+            NormalizeCmdBuffer(draw_list.CmdBuffer, &cmds);
+            NormalizeCmdBuffer(draw_list_ref.CmdBuffer, &cmds_ref);
+            ok &= CmdBuffersEqual(cmds, cmds_ref);
+        }
+        else
+        {
+            ok &= CmdBuffersEqual(draw_list.CmdBuffer, draw_list_ref.CmdBuffer);
+        }
+        IM_CHECK_MSG(ok, "n=%d with_empty_cmds=%d cmds=%d cmds_ref=%d", n, with_empty_cmds, draw_list.CmdBuffer.Size, draw_list_ref.CmdBuffer.Size);
+        if (GTestErrors > 10)
+            return;
+    }
+}
+
+// Table-like usage: one channel per column, half of the columns sharing the previous column clip rect so their first command is merged.
+// Each row of a column uses its own clip rect, so channels hold several commands.
+static void FillColumns(ImDrawList* draw_list, ImDrawListSplitter* splitter, int columns_count, int rows_count)
+{
+    splitter->Split(draw_list, columns_count + 1);
+    for (int column_n = 0; column_n < columns_count; column_n++)
+    {
+        splitter->SetCurrentChannel(draw_list, column_n + 1);
+        const float x = (float)((column_n / 2) * 20);
+        for (int row_n = 0; row_n < rows_count; row_n++)
+        {
+            const float y = (float)(((column_n & 1) ? rows_count - 1 - row_n : row_n) * 10);
+            draw_list->PushClipRect(ImVec2(x, y), ImVec2(x + 20.0f, y + 10.0f));
+            draw_list->AddRectFilled(ImVec2(x, y), ImVec2(x + 15.0f, y + 8.0f), IM_COL32_WHITE);
+            draw_list->PopClipRect();
+        }
+    }
+}
+
+// Best total time of Merge() calls only, in microseconds, as filling channels costs more than merging them.
+template<typename T>
+static double BenchMerge(ImDrawList* draw_list, ImDrawListSplitter* splitter, int columns_count, int rows_count, T merge_func)
+{
+    double best = 1e30;
+    for (int r = 0; r < 10; r++)
+    {
+        double total = 0.0;
+        for (int n = 0; n < 200; n++)
+        {
+            InitDrawList(draw_list);
+            FillColumns(draw_list, splitter, columns_count, rows_count);
+            std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+            merge_func();
+            std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+            total += std::chrono::duration<double, std::micro>(t1 - t0).count();
+        }
+        if (total / 200 < best)
+            best = total / 200;
+    }
+    return best;
+}
+
+static void Benchmark()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawListSplitter splitter;
+    printf("ImDrawListSplitter::Merge(), us per merge (old -> new):\n");
+    const int columns_counts[] = { 8, 32, 128 };
+    const int rows_counts[] = { 1, 4, 16 };
+    for (int columns_count : columns_counts)
+        for (int rows_count : rows_counts)
+        {
+            const double us_ref = BenchMerge(&draw_list, &splitter, columns_count, rows_count, [&]() { RefMerge(&splitter, &draw_list); });
+            const double us_new = BenchMerge(&draw_list, &splitter, columns_count, rows_count, [&]() { splitter.Merge(&draw_list); });
+            printf("  %3d channels, %2d commands each: %6.2f -> %6.2f\n", columns_count, rows_count, us_ref, us_new);
+        }
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame(); // Setup shared data
+    TestMatchesReference(false);
+    TestMatchesReference(true);
+    Benchmark();
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ImTestExit("test_splitter");
+}
@@ -0,0 +1,326 @@
+// dear imgui: ImGuiStorage hash index mode tests and benchmark
+// - Check random Set/Get/GetIntRef/GetVoidPtrRef sequences against the same sequence applied to a sorted storage.
+// - Check enabling and disabling the hash index on a populated storage, and the rebuild done by BuildSortByKey().
+// - Check Clear() and ImGuiSelectionBasicStorage::Clear()/Swap() between a hash indexed and a sorted selection.
+// - Check ImGuiSelectionBasicStorage::ApplyRequests() batch helpers in hash mode against sorted mode.
+// - Measure lookups and insertions for 1k, 100k and 1M keys, sorted vs hash index.
+
+#include "imgui_tests.h"
+
+// Types are not stored: in those tests, odd keys store pointers and even keys store integers.
+static bool IsPtrKey(ImGuiID key) { return (key & 1) != 0; }
+
+// Check that 'storage' holds the same pairs as the sorted 'ref' storage, and that its index finds all of them
+static void CheckSameContents(const ImGuiStorage& storage, const ImGuiStorage& ref)
+{
+    IM_CHECK_MSG(storage.Data.Size == ref.Data.Size, "%d pairs, expected %d", storage.Data.Size, ref.Data.Size);
+    for (const ImGuiStoragePair& pair : ref.Data)
+        if (IsPtrKey(pair.key))
+            IM_CHECK_MSG(storage.GetVoidPtr(pair.key) == pair.val_p, "key 0x%08X", pair.key);
+        else
+            IM_CHECK_MSG(storage.GetInt(pair.key, -1) == pair.val_i, "key 0x%08X", pair.key);
+    for (const ImGuiStoragePair& pair : storage.Data)
+        IM_CHECK_MSG(ref.GetInt(pair.key, -1) == pair.val_i, "key 0x%08X", pair.key);
+    if (storage.IsHashIndexEnabled())
+        IM_CHECK(storage.Data.Size == 0 || storage._HashIndex.Size >= storage.Data.Size * 2);
+}
+
+static bool IsSortedByKey(const ImGuiStorage& storage)
+{
+    for (int n = 1; n < storage.Data.Size; n++)
+        if (storage.Data[n - 1].key >= storage.Data[n].key)
+            return false;
+    return true;
+}
+
+// Random keys: mostly from a small set (to hit existing pairs), sometimes any 32-bit value, sometimes sequential values (as used by ImGuiSelectionBasicStorage)
+static ImGuiID RandomKey(ImTestRandom& rng)
+{
+    switch (rng.Int(0, 3))
+    {
+    case 0: return rng.Next();
+    case 1: return (ImGuiID)rng.Int(0, 5000);
+    default: return rng.Next() % 2000 * 0x9E3779B9u;
+    }
+}
+
+static void TestRandomOperations()
+{
+    ImTestRandom rng;
+    ImGuiStorage storage, ref;
+    storage.SetHashIndexEnabled(true);
+    IM_CHECK(storage.IsHashIndexEnabled() && !ref.IsHashIndexEnabled());
+    IM_CHECK(storage.GetInt(123, 7) == 7 && storage.GetVoidPtr(123) == NULL); // Empty, no index allocated yet
+
+    for (int n = 0; n < 200000; n++)
+    {
+        const int op = rng.Int(0, 5);
+        const ImGuiID key = (op == 3 || op == 4) ? (RandomKey(rng) | 1) : (RandomKey(rng) & ~1u);
+        const int val = (int)rng.Next();
+        switch (op)
+        {
+        case 0:
+            storage.SetInt(key, val);
+            ref.SetInt(key, val);
+            break;
+        case 1:
+            IM_CHECK_MSG(storage.GetInt(key, 42) == ref.GetInt(key, 42), "key 0x%08X", key);
+            IM_CHECK_MSG(storage.GetVoidPtr(key | 1) == ref.GetVoidPtr(key | 1), "key 0x%08X", key | 1);
+            break;
+        case 2:
+        {
+            int* p_storage = storage.GetIntRef(key, val);
+            int* p_ref = ref.GetIntRef(key, val);
+            IM_CHECK_MSG(*p_storage == *p_ref, "key 0x%08X", key);
+            *p_storage += 1;
+            *p_ref += 1;
+            break;
+        }
+        case 3:
+        {
+            void** p_storage = storage.GetVoidPtrRef(key, (void*)(intptr_t)val);
+            void** p_ref = ref.GetVoidPtrRef(key, (void*)(intptr_t)val);
+            IM_CHECK_MSG(*p_storage == *p_ref, "key 0x%08X", key);
+            *p_storage = *p_ref = (void*)(intptr_t)(n + 1);
+            break;
+        }
+        case 4:
+            storage.SetVoidPtr(key, (void*)(intptr_t)val);
+            ref.SetVoidPtr(key, (void*)(intptr_t)val);
+            break;
+        case 5:
+            IM_CHECK_MSG(storage.GetBool(key) == ref.GetBool(key), "key 0x%08X", key);
+            break;
+        }
+        if ((n % 20000) == 0)
+            CheckSameContents(storage, ref);
+        if (GTestErrors > 10)
+            return;
+    }
+    IM_CHECK(!IsSortedByKey(storage)); // Pairs are kept in insertion order
+    CheckSameContents(storage, ref);
+
+    // SetAllInt() doesn't need to touch the index
+    storage.SetAllInt(3);
+    ref.SetAllInt(3);
+    for (const ImGuiStoragePair& pair : ref.Data)
+        IM_CHECK(storage.GetInt(pair.key) == 3);
+}
+
+// Enable/disable on a populated storage, and BuildSortByKey() after modifying Data directly
+static void TestEnableDisable()
+{
+    ImTestRandom rng(0xABCD);
+    ImGuiStorage storage, ref;
+    for (int n = 0; n < 10000; n++)
+    {
+        const ImGuiID key = RandomKey(rng) & ~1u;
+        storage.SetInt(key, n);
+        ref.SetInt(key, n);
+    }
+
+    for (int pass = 0; pass < 3; pass++)
+    {
+        // Enabling keeps pairs in place (sorted) and builds the index
+        storage.SetHashIndexEnabled(true);
+        IM_CHECK(storage.IsHashIndexEnabled() && IsSortedByKey(storage));
+        CheckSameContents(storage, ref);
+        storage.SetHashIndexEnabled(true); // No-op
+        CheckSameContents(storage, ref);
+
+        // Insertions while indexed, then disabling sorts the pairs back and frees the index
+        for (int n = 0; n < 1000; n++)
+        {
+            const ImGuiID key = rng.Next() & ~1u;
+            storage.SetInt(key, n);
+            ref.SetInt(key, n);
+        }
+        storage.SetHashIndexEnabled(false);
+        IM_CHECK(!storage.IsHashIndexEnabled() && storage._HashIndex.Size == 0 && IsSortedByKey(storage));
+        CheckSameContents(storage, ref);
+        storage.SetHashIndexEnabled(false); // No-op
+        CheckSameContents(storage, ref);
+    }
+
+    // Modify Data directly (the "add all contents then sort once" pattern) then BuildSortByKey(): sorts and rebuilds the index
+    storage.SetHashIndexEnabled(true);
+    for (int n = 0; n < 20000; n++)
+    {
+        const ImGuiID key = rng.Next() & ~1u;
+        if (ref.GetInt(key, -1) != -1)
+            continue;
+        storage.Data.push_back(ImGuiStoragePair(key, n));
+        ref.SetInt(key, n);
+    }
+    storage.BuildSortByKey();
+    IM_CHECK(storage.IsHashIndexEnabled() && IsSortedByKey(storage));
+    CheckSameContents(storage, ref);
+
+    // Reordering Data then rebuilding the index (as done by ImGuiSelectionBasicStorage with PreserveOrder)
+    for (int n = 0; n < storage.Data.Size / 2; n++)
+        ImSwap(storage.Data[n], storage.Data[storage.Data.Size - 1 - n]);
+    ImGuiStorageRebuildHashIndex(&storage);
+    CheckSameContents(storage, ref);
+}
+
+static void TestClear()
+{
+    ImGuiStorage storage;
+    storage.SetHashIndexEnabled(true);
+    for (int n = 0; n < 1000; n++)
+        storage.SetInt((ImGuiID)n, n + 1);
+    storage.Clear();
+    IM_CHECK(storage.Data.Size == 0 && storage._HashIndex.Size == 0 && storage.IsHashIndexEnabled()); // Mode is kept
+    IM_CHECK(storage.GetInt(10, -1) == -1);
+    storage.SetInt(10, 5);
+    storage.SetInt(20, 6);
+    IM_CHECK(storage.GetInt(10) == 5 && storage.GetInt(20) == 6 && storage.GetInt(30, -1) == -1);
+}
+
+// Compare two selections: same size, same contents, same iteration order with PreserveOrder
+static void CheckSameSelection(ImGuiSelectionBasicStorage& selection, ImGuiSelectionBasicStorage& ref, int items_count)
+{
+    IM_CHECK_MSG(selection.Size == ref.Size, "Size %d, expected %d", selection.Size, ref.Size);
+    for (int n = 0; n < items_count; n++)
+        IM_CHECK_MSG(selection.Contains((ImGuiID)n) == ref.Contains((ImGuiID)n), "item %d", n);
+
+    selection.PreserveOrder = ref.PreserveOrder = true;
+    void* it = NULL;
+    void* it_ref = NULL;
+    ImGuiID id, id_ref;
+    int count = 0;
+    for (bool has_more = true; has_more; count++)
+    {
+        has_more = selection.GetNextSelectedItem(&it, &id);
+        IM_CHECK(has_more == ref.GetNextSelectedItem(&it_ref, &id_ref));
+        IM_CHECK_MSG(!has_more || id == id_ref, "item %d: id %d, expected %d", count, id, id_ref);
+        if (GTestErrors > 10)
+            return;
+    }
+    IM_CHECK(count - 1 == ref.Size);
+    selection.PreserveOrder = ref.PreserveOrder = false;
+
+    // Iteration after reordering: index is rebuilt
+    for (int n = 0; n < items_count; n++)
+        IM_CHECK_MSG(selection.Contains((ImGuiID)n) == ref.Contains((ImGuiID)n), "item %d", n);
+}
+
+static void ApplyRequest(ImGuiSelectionBasicStorage& selection, int items_count, ImGuiSelectionRequestType type, bool selected, int first = 0, int last = 0)
+{
+    ImGuiMultiSelectIO ms_io;
+    ms_io.ItemsCount = items_count;
+    ImGuiSelectionRequest req = { type, selected, (ImS8)(first <= last ? +1 : -1), (ImGuiSelectionUserData)ImMin(first, last), (ImGuiSelectionUserData)ImMax(first, last) };
+    ms_io.Requests.push_back(req);
+    selection.ApplyRequests(&ms_io);
+}
+
+static void TestSelection()
+{
+    const int items_count = 20000;
+    ImTestRandom rng(0x5E1E);
+    ImGuiSelectionBasicStorage selection, ref;
+    selection._Storage.SetHashIndexEnabled(true);
+
+    for (int n = 0; n < 400; n++)
+    {
+        const int first = rng.Int(0, items_count - 1);
+        const int last = ImClamp(first + (rng.Int(0, 3) == 0 ? rng.Int(-items_count / 2, items_count / 2) : rng.Int(-3, 3)), 0, items_count - 1);
+        const bool selected = rng.Int(0, 2) != 0;
+        switch (rng.Int(0, 9))
+        {
+        case 0:
+            ApplyRequest(selection, items_count, ImGuiSelectionRequestType_SetAll, selected);
+            ApplyRequest(ref, items_count, ImGuiSelectionRequestType_SetAll, selected);
+            break;
+        case 1:
+            selection.SetItemSelected((ImGuiID)first, selected);
+            ref.SetItemSelected((ImGuiID)first, selected);
+            break;
+        default: // Single items use SetItemSelected(), large ranges use the batch helpers
+            ApplyRequest(selection, items_count, ImGuiSelectionRequestType_SetRange, selected, first, last);
+            ApplyRequest(ref, items_count, ImGuiSelectionRequestType_SetRange, selected, first, last);
+            break;
+        }
+        if ((n % 50) == 0)
+            CheckSameSelection(selection, ref, items_count);
+        if (GTestErrors > 10)
+            return;
+    }
+    IM_CHECK(selection._Storage.IsHashIndexEnabled());
+    CheckSameSelection(selection, ref, items_count);
+
+    // Swap() exchanges the mode along with the contents
+    ImGuiSelectionBasicStorage other;
+    other.SetItemSelected(7, true);
+    other.SetItemSelected(3, true);
+    selection.Swap(other);
+    IM_CHECK(!selection._Storage.IsHashIndexEnabled() && other._Storage.IsHashIndexEnabled());
+    IM_CHECK(selection.Size == 2 && selection.Contains(3) && selection.Contains(7) && !selection.Contains(5));
+    CheckSameSelection(other, ref, items_count);
+    selection.Swap(other);
+    IM_CHECK(selection._Storage.IsHashIndexEnabled() && !other._Storage.IsHashIndexEnabled());
+    CheckSameSelection(selection, ref, items_count);
+
+    // Clear() keeps the mode
+    selection.Clear();
+    IM_CHECK(selection.Size == 0 && selection._Storage.IsHashIndexEnabled());
+    for (int n = 0; n < items_count; n += 97)
+        IM_CHECK(!selection.Contains((ImGuiID)n));
+    ApplyRequest(selection, items_count, ImGuiSelectionRequestType_SetRange, true, 100, 5000);
+    IM_CHECK(selection.Size == 4901 && selection.Contains(100) && selection.Contains(5000) && !selection.Contains(99) && !selection.Contains(5001));
+}
+
+static void Benchmark()
+{
+    printf("Storage: ns per call (sorted -> hash index):\n");
+    const int sizes[] = { 1000, 100000, 1000000 };
+    for (int size : sizes)
+    {
+        ImTestRandom rng(0xBE7C);
+        ImVector<ImGuiID> keys;
+        keys.resize(size);
+        for (ImGuiID& key : keys)
+            key = rng.Next();
+
+        // Build: sorted storage is built with the "add all contents then sort once" pattern, since sorted insertion is O(N)
+        ImGuiStorage sorted, hashed;
+        const double ns_build_sorted = ImTestBench(1, 3, [&]() { sorted.Clear(); for (ImGuiID key : keys) sorted.Data.push_back(ImGuiStoragePair(key, 1)); sorted.BuildSortByKey(); }) / size;
+        hashed.SetHashIndexEnabled(true);
+        const double ns_build_hashed = ImTestBench(1, 3, [&]() { hashed.Clear(); for (ImGuiID key : keys) hashed.SetInt(key, 1); }) / size;
+
+        // Lookups of existing keys, in random order
+        static volatile int sink;
+        int n = 0;
+        const double ns_get_sorted = ImTestBench(200000, 5, [&]() { sink += sorted.GetInt(keys.Data[n]); n = (n + 7919) % size; });
+        const double ns_get_hashed = ImTestBench(200000, 5, [&]() { sink += hashed.GetInt(keys.Data[n]); n = (n + 7919) % size; });
+
+        // Insertions of new keys in a storage of 'size' keys, each run starts from its own copy
+        const int insert_count = 256;
+        const int repeat = 3;
+        double ns_insert[2];
+        for (int mode = 0; mode < 2; mode++)
+        {
+            ImGuiStorage copies[repeat];
+            for (ImGuiStorage& copy : copies)
+            {
+                copy = mode ? hashed : sorted;
+                copy.Data.reserve(copy.Data.Size + insert_count); // Don't measure the reallocation of a copy allocated at its exact size
+            }
+            int copy_n = 0;
+            ImTestRandom rng_insert(0x1234);
+            ns_insert[mode] = ImTestBench(1, repeat, [&]() { ImGuiStorage& storage = copies[copy_n++]; for (int i = 0; i < insert_count; i++) storage.SetInt(rng_insert.Next(), 2); }) / insert_count;
+        }
+        printf("  %7d keys: build %6.1f -> %6.1f, GetInt() %6.1f -> %6.1f, SetInt() new key %9.1f -> %6.1f\n",
+            size, ns_build_sorted, ns_build_hashed, ns_get_sorted, ns_get_hashed, ns_insert[0], ns_insert[1]);
+    }
+}
+
+int main()
+{
+    TestRandomOperations();
+    TestEnableDisable();
+    TestClear();
+    TestSelection();
+    Benchmark();
+    return ImTestExit("test_storage");
+}
@@ -0,0 +1,616 @@
+// dear imgui: ASCII run fast path tests and benchmark (ImTextFindAsciiRunEnd() and UTF-8 decoding)
+// - Check ImTextFindAsciiRunEnd() against a byte-by-byte loop, for run lengths around the 8 and 16 bytes blocks, every stop byte position,
+//   stop bytes around 'min_char', 0x7F and 0x80, and exact-size heap buffers (so reads past the end are caught by address sanitizer).
+// - Check ImTextStrFromUtf8(), ImTextCountCharsFromUtf8(), ImTextCountUtf8BytesFromStr(), ImFont::CalcTextSizeA() and ImFont::RenderText()
+//   against copies of the previous character-by-character loops, on random mixed ASCII and multibyte strings, with invalid bytes,
+//   zero bytes and sequences truncated at the end of the buffer.
+// - Build with WITH_SSE=0 and WITH_NEON_EMULATION=1 to check the scalar and NEON code paths.
+// - Measure decoding, counting, measuring and rendering ASCII and mixed text.
+
+#include "imgui_tests.h"
+#include <string.h>
+#include <stdlib.h>
+
+#define ImFontGetCharAdvanceX(_FONT, _CH)  ((int)(_CH) < (_FONT)->IndexAdvanceX.Size ? (_FONT)->IndexAdvanceX.Data[_CH] : (_FONT)->FallbackAdvanceX)
+
+static const char* RefFindAsciiRunEnd(const char* in_text, const char* in_text_end, char min_char)
+{
+    while (in_text < in_text_end && (signed char)*in_text >= min_char)
+        in_text++;
+    return in_text;
+}
+
+// Reference: ImTextStrFromUtf8(), ImTextCountCharsFromUtf8(), ImTextCountUtf8BytesFromStr() before the ASCII run fast path (1.91.5).
+static int RefTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining)
+{
+    ImWchar* buf_out = buf;
+    ImWchar* buf_end = buf + buf_size;
+    while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
+    {
+        unsigned int c;
+        in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+        *buf_out++ = (ImWchar)c;
+    }
+    *buf_out = 0;
+    if (in_text_remaining)
+        *in_text_remaining = in_text;
+    return (int)(buf_out - buf);
+}
+
+static int RefTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
+{
+    int char_count = 0;
+    while ((!in_text_end || in_text < in_text_end) && *in_text)
+    {
+        unsigned int c;
+        in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+        char_count++;
+    }
+    return char_count;
+}
+
+static inline int RefTextCountUtf8BytesFromChar(unsigned int c)
+{
+    if (c < 0x80) return 1;
+    if (c < 0x800) return 2;
+    if (c < 0x10000) return 3;
+    if (c <= 0x10FFFF) return 4;
+    return 3;
+}
+
+static int RefTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end)
+{
+    int bytes_count = 0;
+    while ((!in_text_end || in_text < in_text_end) && *in_text)
+    {
+        unsigned int c = (unsigned int)(*in_text++);
+        if (c < 0x80)
+            bytes_count++;
+        else
+            bytes_count += RefTextCountUtf8BytesFromChar(c);
+    }
+    return bytes_count;
+}
+
+// Reference: ImFont::CalcTextSizeA() and ImFont::RenderText() before the ASCII run fast path (1.91.5), only adapted to be free functions.
+static inline const char* RefCalcWordWrapNextLineStartA(const char* text, const char* text_end)
+{
+    while (text < text_end && ImCharIsBlankA(*text))
+        text++;
+    if (text < text_end && *text == '\n') // Fixed: was reading past text_end
+        text++;
+    return text;
+}
+
+static ImVec2 RefCalcTextSizeA(ImFont* font, float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining)
+{
+    if (!text_end)
+        text_end = text_begin + strlen(text_begin); // FIXME-OPT: Need to avoid this.
+
+    const float line_height = size;
+    const float scale = size / font->FontSize;
+
+    ImVec2 text_size = ImVec2(0, 0);
+    float line_width = 0.0f;
+
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    const char* word_wrap_eol = NULL;
+
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        if (word_wrap_enabled)
+        {
+            // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
+            if (!word_wrap_eol)
+                word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
+
+            if (s >= word_wrap_eol)
+            {
+                if (text_size.x < line_width)
+                    text_size.x = line_width;
+                text_size.y += line_height;
+                line_width = 0.0f;
+                word_wrap_eol = NULL;
+                s = RefCalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
+                continue;
+            }
+        }
+
+        // Decode and advance source
+        const char* prev_s = s;
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                text_size.x = ImMax(text_size.x, line_width);
+                text_size.y += line_height;
+                line_width = 0.0f;
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+
+        const float char_width = ImFontGetCharAdvanceX(font, c) * scale;
+        if (line_width + char_width >= max_width)
+        {
+            s = prev_s;
+            break;
+        }
+
+        line_width += char_width;
+    }
+
+    if (text_size.x < line_width)
+        text_size.x = line_width;
+
+    if (line_width > 0 || text_size.y == 0.0f)
+        text_size.y += line_height;
+
+    if (remaining)
+        *remaining = s;
+
+    return text_size;
+}
+
+static void RefRenderText(ImFont* font, ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip)
+{
+    if (!text_end)
+        text_end = text_begin + strlen(text_begin); // ImGui:: functions generally already provides a valid text_end, so this is merely to handle direct calls.
+
+    // Align to be pixel perfect
+    float x = IM_TRUNC(pos.x);
+    float y = IM_TRUNC(pos.y);
+    if (y > clip_rect.w)
+        return;
+
+    const float scale = size / font->FontSize;
+    const float line_height = font->FontSize * scale;
+    const float origin_x = x;
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+
+    // Fast-forward to first visible line
+    const char* s = text_begin;
+    if (y + line_height < clip_rect.y)
+        while (y + line_height < clip_rect.y && s < text_end)
+        {
+            const char* line_end = (const char*)memchr(s, '\n', text_end - s);
+            if (word_wrap_enabled)
+            {
+                // FIXME-OPT: This is not optimal as do first do a search for \n before calling CalcWordWrapPositionA().
+                // If the specs for CalcWordWrapPositionA() were reworked to optionally return on \n we could combine both.
+                // However it is still better than nothing performing the fast-forward!
+                s = font->CalcWordWrapPositionA(scale, s, line_end ? line_end : text_end, wrap_width);
+                s = RefCalcWordWrapNextLineStartA(s, text_end);
+            }
+            else
+            {
+                s = line_end ? line_end + 1 : text_end;
+            }
+            y += line_height;
+        }
+
+    // For large text, scan for the last visible line in order to avoid over-reserving in the call to PrimReserve()
+    // Note that very large horizontal line will still be affected by the issue (e.g. a one megabyte string buffer without a newline will likely crash atm)
+    if (text_end - s > 10000 && !word_wrap_enabled)
+    {
+        const char* s_end = s;
+        float y_end = y;
+        while (y_end < clip_rect.w && s_end < text_end)
+        {
+            s_end = (const char*)memchr(s_end, '\n', text_end - s_end);
+            s_end = s_end ? s_end + 1 : text_end;
+            y_end += line_height;
+        }
+        text_end = s_end;
+    }
+    if (s == text_end)
+        return;
+
+    // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
+    const int vtx_count_max = (int)(text_end - s) * 4;
+    const int idx_count_max = (int)(text_end - s) * 6;
+    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+    const char* word_wrap_eol = NULL;
+
+    while (s < text_end)
+    {
+        if (word_wrap_enabled)
+        {
+            // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
+            if (!word_wrap_eol)
+                word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - origin_x));
+
+            if (s >= word_wrap_eol)
+            {
+                x = origin_x;
+                y += line_height;
+                if (y > clip_rect.w)
+                    break; // break out of main loop
+                word_wrap_eol = NULL;
+                s = RefCalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
+                continue;
+            }
+        }
+
+        // Decode and advance source
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                x = origin_x;
+                y += line_height;
+                if (y > clip_rect.w)
+                    break; // break out of main loop
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+
+        const ImFontGlyph* glyph = font->FindGlyph((ImWchar)c);
+        if (glyph == NULL)
+            continue;
+
+        float char_width = glyph->AdvanceX * scale;
+        if (glyph->Visible)
+        {
+            // We don't do a second finer clipping test on the Y axis as we've already skipped anything before clip_rect.y and exit once we pass clip_rect.w
+            float x1 = x + glyph->X0 * scale;
+            float x2 = x + glyph->X1 * scale;
+            float y1 = y + glyph->Y0 * scale;
+            float y2 = y + glyph->Y1 * scale;
+            if (x1 <= clip_rect.z && x2 >= clip_rect.x)
+            {
+                // Render a character
+                float u1 = glyph->U0;
+                float v1 = glyph->V0;
+                float u2 = glyph->U1;
+                float v2 = glyph->V1;
+
+                // CPU side clipping used to fit text in their frame when the frame is too small. Only does clipping for axis aligned quads.
+                if (cpu_fine_clip)
+                {
+                    if (x1 < clip_rect.x)
+                    {
+                        u1 = u1 + (1.0f - (x2 - clip_rect.x) / (x2 - x1)) * (u2 - u1);
+                        x1 = clip_rect.x;
+                    }
+                    if (y1 < clip_rect.y)
+                    {
+                        v1 = v1 + (1.0f - (y2 - clip_rect.y) / (y2 - y1)) * (v2 - v1);
+                        y1 = clip_rect.y;
+                    }
+                    if (x2 > clip_rect.z)
+                    {
+                        u2 = u1 + ((clip_rect.z - x1) / (x2 - x1)) * (u2 - u1);
+                        x2 = clip_rect.z;
+                    }
+                    if (y2 > clip_rect.w)
+                    {
+                        v2 = v1 + ((clip_rect.w - y1) / (y2 - y1)) * (v2 - v1);
+                        y2 = clip_rect.w;
+                    }
+                    if (y1 >= y2)
+                    {
+                        x += char_width;
+                        continue;
+                    }
+                }
+
+                // Support for untinted glyphs
+                ImU32 glyph_col = glyph->Colored ? col_untinted : col;
+
+                // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
+                {
+                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
+                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
+                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
+                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+                    idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+                    vtx_write += 4;
+                    vtx_index += 4;
+                    idx_write += 6;
+                }
+            }
+        }
+        x += char_width;
+    }
+
+    // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
+    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
+    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_index;
+}
+
+// Heap copy of exactly 'len' bytes, so reads past the end are caught by address sanitizer.
+static char* DupText(const char* text, int len, bool zero_terminate)
+{
+    char* buf = (char*)malloc((size_t)ImMax(len + (zero_terminate ? 1 : 0), 1));
+    memcpy(buf, text, (size_t)len);
+    if (zero_terminate)
+        buf[len] = 0;
+    return buf;
+}
+
+// Random mix of printable ASCII runs (lengths around 8 and 16), control characters, 0x7F, valid 2/3/4 bytes sequences (Latin-1 ones have glyphs
+// in the default font), invalid bytes and zero bytes, optionally ending with a truncated sequence. Return length.
+static int GenerateText(char* buf, int buf_size, ImTestRandom* rng, bool allow_zero)
+{
+    static const int run_lengths[] = { 1, 2, 3, 7, 8, 9, 15, 16, 17, 23, 24, 31, 32, 33, 40 };
+    const int len_max = buf_size - 4;
+    int len = 0;
+    while (len < len_max)
+    {
+        const int kind = rng->Int(0, 15);
+        if (kind < 6)
+        {
+            int run = run_lengths[rng->Int(0, IM_ARRAYSIZE(run_lengths) - 1)];
+            for (; run > 0 && len < len_max; run--)
+                buf[len++] = (rng->Int(0, 5) == 0) ? ' ' : (char)rng->Int(0x21, 0x7E);
+        }
+        else if (kind == 6)
+        {
+            static const char controls[] = { '\n', '\n', '\r', '\t', 0x01, 0x1F, 0x7F };
+            buf[len++] = controls[rng->Int(0, IM_ARRAYSIZE(controls) - 1)];
+        }
+        else if (kind < 13)
+        {
+            // Valid sequence
+            const int bytes = (kind < 10) ? 2 : (kind < 12) ? 3 : 4;
+            const unsigned int c = (bytes == 2) ? (unsigned int)rng->Int(0x80, (kind == 7) ? 0x7FF : 0xFF) : (bytes == 3) ? (unsigned int)rng->Int(0x800, 0xFFFF) : (unsigned int)rng->Int(0x10000, 0x10FFFF);
+            char seq[5];
+            const int seq_len = (int)strlen(ImTextCharToUtf8(seq, c));
+            for (int n = 0; n < seq_len && len < len_max; n++)
+                buf[len++] = seq[n];
+        }
+        else if (kind < 15)
+        {
+            buf[len++] = (char)rng->Int(0x80, 0xFF); // Invalid/stray byte
+        }
+        else if (allow_zero)
+        {
+            buf[len++] = 0;
+        }
+        if (rng->Int(0, 15) == 0)
+            break;
+    }
+    if (rng->Int(0, 3) == 0)
+    {
+        // Truncated sequence at the end of the buffer
+        static const char* truncated[] = { "\xC3", "\xE2", "\xE2\x82", "\xF0", "\xF0\x9F", "\xF0\x9F\x98" };
+        const char* seq = truncated[rng->Int(0, IM_ARRAYSIZE(truncated) - 1)];
+        for (; *seq; seq++)
+            buf[len++] = *seq;
+    }
+    return len;
+}
+
+static void TestFindAsciiRunEnd()
+{
+    ImTestRandom rng;
+    const char min_chars[] = { 1, 2, 0x1F, ' ', '!', 0x40, 0x7E, 0x7F };
+    for (char min_char : min_chars)
+        for (int len = 0; len <= 50; len++)
+            for (int stop_pos = 0; stop_pos <= len; stop_pos++) // stop_pos == len: run reaches the end of the buffer
+            {
+                const int stop_bytes[] = { min_char - 1, 0, rng.Int(0, min_char - 1), 0x80, 0xFF, rng.Int(0x80, 0xFF) };
+                for (int stop_byte : stop_bytes)
+                {
+                    char* buf = (char*)malloc((size_t)len + 1);
+                    for (int n = 0; n < len; n++)
+                        buf[n] = (char)rng.Int(min_char, (n & 1) ? min_char : 0x7F); // Bytes in the run: min_char..0x7F, with many exactly min_char
+                    if (stop_pos < len)
+                        buf[stop_pos] = (char)stop_byte;
+                    for (int start = 0; start <= ImMin(len, 3); start++) // Unaligned starts
+                    {
+                        const char* end = ImTextFindAsciiRunEnd(buf + start, buf + len, min_char);
+                        const char* end_ref = RefFindAsciiRunEnd(buf + start, buf + len, min_char);
+                        IM_CHECK_MSG(end == end_ref, "min_char 0x%02X len %d stop_pos %d stop_byte 0x%02X start %d: %d, expected %d", min_char, len, stop_pos, stop_byte, start, (int)(end - buf), (int)(end_ref - buf));
+                    }
+                    free(buf);
+                    if (GTestErrors > 10)
+                        return;
+                    if (stop_pos == len)
+                        break;
+                }
+            }
+}
+
+static void TestDecoders()
+{
+    ImTestRandom rng;
+    char text[512];
+    ImWchar* wbuf = (ImWchar*)malloc(sizeof(ImWchar) * (IM_ARRAYSIZE(text) + 1));
+    ImWchar* wbuf_ref = (ImWchar*)malloc(sizeof(ImWchar) * (IM_ARRAYSIZE(text) + 1));
+    for (int n = 0; n < 100000 && GTestErrors == 0; n++)
+    {
+        const int len = GenerateText(text, (n % 10 == 0) ? IM_ARRAYSIZE(text) : 64, &rng, true);
+        for (int zero_terminate = 0; zero_terminate < 2; zero_terminate++)
+        {
+            // With a NULL end pointer, the previous code could step over the zero-terminator after a truncated sequence
+            // (ImTextCharFromUtf8() reads a whole sequence): compare with the reference stopping at the zero-terminator.
+            char* buf = DupText(text, len, zero_terminate != 0);
+            const char* buf_end = zero_terminate ? NULL : buf + len;
+            const char* buf_end_ref = zero_terminate ? buf + strlen(buf) : buf + len;
+
+            const int count = ImTextCountCharsFromUtf8(buf, buf_end);
+            const int count_ref = RefTextCountCharsFromUtf8(buf, buf_end_ref);
+            IM_CHECK_MSG(count == count_ref, "n=%d ImTextCountCharsFromUtf8(): %d, expected %d", n, count, count_ref);
+
+            // Full output buffer and truncated ones
+            const int wbuf_sizes[] = { len + 1, rng.Int(1, len + 1), rng.Int(1, 20), 1 };
+            for (int wbuf_size : wbuf_sizes)
+            {
+                const char* remaining = NULL;
+                const char* remaining_ref = NULL;
+                const int wlen = ImTextStrFromUtf8(wbuf, wbuf_size, buf, buf_end, &remaining);
+                const int wlen_ref = RefTextStrFromUtf8(wbuf_ref, wbuf_size, buf, buf_end_ref, &remaining_ref);
+                IM_CHECK_MSG(wlen == wlen_ref && remaining == remaining_ref && memcmp(wbuf, wbuf_ref, sizeof(ImWchar) * (wlen_ref + 1)) == 0,
+                    "n=%d ImTextStrFromUtf8() buf_size %d: %d chars remaining %d, expected %d chars remaining %d", n, wbuf_size, wlen, (int)(remaining - buf), wlen_ref, (int)(remaining_ref - buf));
+            }
+            free(buf);
+        }
+
+        // Decoded text back to UTF-8 bytes count, with and without end pointer
+        const int wlen = ImTextStrFromUtf8(wbuf, IM_ARRAYSIZE(text) + 1, text, text + len);
+        IM_CHECK(ImTextCountUtf8BytesFromStr(wbuf, wbuf + wlen) == RefTextCountUtf8BytesFromStr(wbuf, wbuf + wlen));
+        IM_CHECK(ImTextCountUtf8BytesFromStr(wbuf, NULL) == RefTextCountUtf8BytesFromStr(wbuf, NULL));
+    }
+    free(wbuf);
+    free(wbuf_ref);
+
+    // Wide strings with ASCII runs around the 4/8 characters blocks, stop characters at every position
+    const unsigned int stop_chars[] = { 0, 0x80, 0xFF, 0x100, 0x17F, 0x7FF, 0x800, 0xFFFF, IM_UNICODE_CODEPOINT_MAX };
+    for (int len = 0; len <= 40; len++)
+        for (int stop_pos = 0; stop_pos <= len; stop_pos++)
+            for (unsigned int stop_char : stop_chars)
+            {
+                ImWchar* wtext = (ImWchar*)malloc(sizeof(ImWchar) * ((size_t)len + 1));
+                for (int i = 0; i < len; i++)
+                    wtext[i] = (ImWchar)rng.Int(1, 0x7F);
+                wtext[len] = 0;
+                if (stop_pos < len)
+                    wtext[stop_pos] = (ImWchar)stop_char;
+                const int bytes = ImTextCountUtf8BytesFromStr(wtext, wtext + len);
+                const int bytes_ref = RefTextCountUtf8BytesFromStr(wtext, wtext + len);
+                IM_CHECK_MSG(bytes == bytes_ref, "len %d stop_pos %d stop_char 0x%X: %d, expected %d", len, stop_pos, stop_char, bytes, bytes_ref);
+                IM_CHECK(ImTextCountUtf8BytesFromStr(wtext, NULL) == RefTextCountUtf8BytesFromStr(wtext, NULL));
+                free(wtext);
+                if (GTestErrors > 10)
+                    return;
+            }
+}
+
+static void InitDrawList(ImDrawList* draw_list)
+{
+    draw_list->_ResetForNewFrame();
+    draw_list->PushClipRectFullScreen();
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+}
+
+static void TestFont()
+{
+    ImFont* font = ImGui::GetFont();
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawList draw_list_ref(ImGui::GetDrawListSharedData());
+    ImTestRandom rng;
+    char text[512];
+    for (int n = 0; n < 50000 && GTestErrors == 0; n++)
+    {
+        const int len = GenerateText(text, (n % 10 == 0) ? IM_ARRAYSIZE(text) : 96, &rng, true);
+        char* buf = DupText(text, len, false);
+        const float size = (n & 1) ? font->FontSize : 20.5f;
+        const float max_width = (n % 3 == 0) ? FLT_MAX : rng.Float(10.0f, 400.0f);
+        const float wrap_width = (n % 4 < 2) ? 0.0f : rng.Float(1.0f, 300.0f);
+
+        const char* remaining = NULL;
+        const char* remaining_ref = NULL;
+        const ImVec2 text_size = font->CalcTextSizeA(size, max_width, wrap_width, buf, buf + len, &remaining);
+        const ImVec2 text_size_ref = RefCalcTextSizeA(font, size, max_width, wrap_width, buf, buf + len, &remaining_ref);
+        IM_CHECK_MSG(text_size.x == text_size_ref.x && text_size.y == text_size_ref.y && remaining == remaining_ref,
+            "n=%d CalcTextSizeA() max_width %.1f wrap_width %.1f: (%f,%f) remaining %d, expected (%f,%f) remaining %d",
+            n, max_width, wrap_width, text_size.x, text_size.y, (int)(remaining - buf), text_size_ref.x, text_size_ref.y, (int)(remaining_ref - buf));
+
+        const ImVec2 pos(rng.Float(-50.0f, 200.0f), rng.Float(-100.0f, 200.0f));
+        const ImVec4 clip_rect = (n % 3 == 0) ? ImVec4(-1000.0f, -1000.0f, 5000.0f, 5000.0f) : ImVec4(rng.Float(-20.0f, 100.0f), rng.Float(-20.0f, 100.0f), rng.Float(100.0f, 400.0f), rng.Float(100.0f, 400.0f));
+        const bool cpu_fine_clip = (n & 2) != 0;
+        InitDrawList(&draw_list);
+        InitDrawList(&draw_list_ref);
+        font->RenderText(&draw_list, size, pos, IM_COL32(255, 200, 100, 255), clip_rect, buf, buf + len, wrap_width, cpu_fine_clip);
+        RefRenderText(font, &draw_list_ref, size, pos, IM_COL32(255, 200, 100, 255), clip_rect, buf, buf + len, wrap_width, cpu_fine_clip);
+        IM_CHECK_MSG(draw_list.VtxBuffer.Size == draw_list_ref.VtxBuffer.Size && draw_list.IdxBuffer.Size == draw_list_ref.IdxBuffer.Size
+            && memcmp(draw_list.VtxBuffer.Data, draw_list_ref.VtxBuffer.Data, (size_t)draw_list.VtxBuffer.size_in_bytes()) == 0
+            && memcmp(draw_list.IdxBuffer.Data, draw_list_ref.IdxBuffer.Data, (size_t)draw_list.IdxBuffer.size_in_bytes()) == 0
+            && draw_list.CmdBuffer.back().ElemCount == draw_list_ref.CmdBuffer.back().ElemCount && draw_list._VtxCurrentIdx == draw_list_ref._VtxCurrentIdx,
+            "n=%d RenderText() wrap_width %.1f cpu_fine_clip %d: %d vertices, expected %d", n, wrap_width, cpu_fine_clip, draw_list.VtxBuffer.Size, draw_list_ref.VtxBuffer.Size);
+        free(buf);
+    }
+}
+
+static void Benchmark()
+{
+    ImFont* font = ImGui::GetFont();
+    const float font_size = font->FontSize;
+    ImTestRandom rng;
+    ImVector<char> text_ascii, text_mixed;
+    for (int n = 0; n < 256 * 1024; n++)
+    {
+        const bool eol = (n % 80) == 79;
+        text_ascii.push_back(eol ? '\n' : (rng.Int(0, 5) == 0) ? ' ' : (char)rng.Int('a', 'z'));
+        if (!eol && rng.Int(0, 4) == 0)
+        {
+            char seq[5];
+            ImTextCharToUtf8(seq, (unsigned int)rng.Int(0xC0, 0xFF)); // Latin-1 accented letters
+            text_mixed.push_back(seq[0]);
+            text_mixed.push_back(seq[1]);
+        }
+        else
+        {
+            text_mixed.push_back(text_ascii.back());
+        }
+    }
+    ImVector<ImWchar> wbuf;
+    wbuf.resize(text_mixed.Size + 1);
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    static volatile int sink;
+
+    printf("ASCII runs: MB/s (old -> new):\n");
+    for (int text_n = 0; text_n < 2; text_n++)
+    {
+        const ImVector<char>& text = text_n ? text_mixed : text_ascii;
+        const char* text_begin = text.Data;
+        const char* text_end = text.Data + text.Size;
+        const char* text_end_render = text.Data + 16 * 1024; // Rendering outputs 4 vertices per character: use less text
+        const double mb = text.Size / (1024.0 * 1024.0);
+        const double mb_render = 16.0 / 1024.0;
+        const double count_ref = ImTestBench(1, 10, [&]() { sink += RefTextCountCharsFromUtf8(text_begin, text_end); });
+        const double count_new = ImTestBench(1, 10, [&]() { sink += ImTextCountCharsFromUtf8(text_begin, text_end); });
+        const double decode_ref = ImTestBench(1, 10, [&]() { sink += RefTextStrFromUtf8(wbuf.Data, wbuf.Size, text_begin, text_end, NULL); });
+        const double decode_new = ImTestBench(1, 10, [&]() { sink += ImTextStrFromUtf8(wbuf.Data, wbuf.Size, text_begin, text_end); });
+        const double size_ref = ImTestBench(1, 10, [&]() { sink += (int)RefCalcTextSizeA(font, font_size, FLT_MAX, 0.0f, text_begin, text_end, NULL).x; });
+        const double size_new = ImTestBench(1, 10, [&]() { sink += (int)font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, text_begin, text_end).x; });
+        const ImVec4 clip_rect(0.0f, 0.0f, 100000.0f, 100000.0f);
+        const double render_ref = ImTestBench(1, 10, [&]() { InitDrawList(&draw_list); RefRenderText(font, &draw_list, font_size, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, clip_rect, text_begin, text_end_render, 0.0f, false); });
+        const double render_new = ImTestBench(1, 10, [&]() { InitDrawList(&draw_list); font->RenderText(&draw_list, font_size, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, clip_rect, text_begin, text_end_render, 0.0f, false); });
+        printf("  %s: ImTextCountCharsFromUtf8() %6.0f -> %6.0f, ImTextStrFromUtf8() %6.0f -> %6.0f, CalcTextSizeA() %6.0f -> %6.0f, RenderText() %6.0f -> %6.0f\n", text_n ? "mixed" : "ASCII",
+            mb * 1e9 / count_ref, mb * 1e9 / count_new, mb * 1e9 / decode_ref, mb * 1e9 / decode_new, mb * 1e9 / size_ref, mb * 1e9 / size_new, mb_render * 1e9 / render_ref, mb_render * 1e9 / render_new);
+    }
+}
+
+int main()
+{
+    ImTestCreateContext();
+    ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame(); // Setup shared data and current font
+    TestFindAsciiRunEnd();
+    TestDecoders();
+    TestFont();
+    Benchmark();
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return ImTestExit("test_text_ascii");
+}
@@ -0,0 +1,270 @@
+// dear imgui: ImStristr() and ImGuiTextFilter tests and benchmark
+// - Check ImStristr() against the previous byte-by-byte implementation, on exact-size heap buffers (so that reading past the
+//   end is caught by address sanitizer), for every needle length and for matches at the end of the haystack.
+// - Check that non-letters differing by 0x20 ('@' vs '`', '[' vs '{', etc.) are not folded together.
+// - Check ImGuiTextFilter::PassFilter() include/exclude term ordering and PassFilterMultiple() against the previous implementation.
+// - Measure ImStristr() and PassFilter() over a list of asset-like paths.
+// Run with WITH_SSE=0 and WITH_NEON_EMULATION=1 to cover the scalar and NEON code paths.
+
+#include "imgui_tests.h"
+#include <string.h>
+
+// Reference: ImStristr() before SIMD candidate search (1.91.5), only adapted to be a free function and to not match past 'haystack_end'
+// (it used to compare the needle beyond the end of the range).
+static const char* RefStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
+{
+    if (!needle_end)
+        needle_end = needle + strlen(needle);
+
+    const char un0 = (char)ImToUpper(*needle);
+    while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end && haystack_end - haystack >= needle_end - needle))
+    {
+        if (ImToUpper(*haystack) == un0)
+        {
+            const char* b = needle + 1;
+            for (const char* a = haystack + 1; b < needle_end; a++, b++)
+                if (ImToUpper(*a) != ImToUpper(*b))
+                    break;
+            if (b == needle_end)
+                return haystack;
+        }
+        haystack++;
+    }
+    return NULL;
+}
+
+// Reference: ImGuiTextFilter::PassFilter() before ImStristr() changes (1.91.5), only adapted to be a free function.
+static bool RefPassFilter(const ImGuiTextFilter& filter, const char* text, const char* text_end = NULL)
+{
+    if (filter.Filters.Size == 0)
+        return true;
+
+    if (text == NULL)
+        text = "";
+
+    for (const ImGuiTextFilter::ImGuiTextRange& f : filter.Filters)
+    {
+        if (f.b == f.e)
+            continue;
+        if (f.b[0] == '-')
+        {
+            // Subtract
+            if (RefStristr(text, text_end, f.b + 1, f.e) != NULL)
+                return false;
+        }
+        else
+        {
+            // Grep
+            if (RefStristr(text, text_end, f.b, f.e) != NULL)
+                return true;
+        }
+    }
+
+    // Implicit * grep
+    if (filter.CountGrep == 0)
+        return true;
+
+    return false;
+}
+
+// Characters likely to produce matches and case folding pitfalls: letters, and non-letters differing from others by 0x20
+static const char TEST_CHARS[] = { 'a', 'A', 'b', 'B', 'z', 'Z', '@', '`', '[', '{', ']', '}', '^', '~', '_', 0x7F, '0', '/', '.', ' ', (char)0x80, (char)0xC1, (char)0xE1 };
+
+// Copy into an exact-size heap buffer, without zero-terminator
+static char* AllocExact(const char* src, size_t len)
+{
+    char* buf = (char*)malloc(ImMax(len, (size_t)1));
+    memcpy(buf, src, len);
+    return buf;
+}
+
+static void CheckStristr(const char* haystack_src, int haystack_len, const char* needle_src, int needle_len)
+{
+    char* haystack = AllocExact(haystack_src, (size_t)haystack_len);
+    char* needle = AllocExact(needle_src, (size_t)needle_len);
+    const char* result = ImStristr(haystack, haystack + haystack_len, needle, needle + needle_len);
+    const char* expected = RefStristr(haystack, haystack + haystack_len, needle, needle + needle_len);
+    IM_CHECK_MSG(result == expected, "haystack \"%.*s\" needle \"%.*s\": offset %d, expected %d", haystack_len, haystack_src, needle_len, needle_src,
+        result ? (int)(result - haystack) : -1, expected ? (int)(expected - haystack) : -1);
+    free(haystack);
+    free(needle);
+}
+
+static void TestStristr()
+{
+    // Every needle length, matching at every position including the tail, with case changes, for haystacks crossing the 8/16 bytes blocks
+    ImTestRandom rng;
+    char haystack[128];
+    char needle[128];
+    for (int haystack_len = 0; haystack_len <= 80; haystack_len++)
+        for (int needle_len = 1; needle_len <= haystack_len + 1 && needle_len <= 40; needle_len++)
+            for (int pass = 0; pass < 12; pass++)
+            {
+                const int alphabet_size = (pass & 1) ? 4 : IM_ARRAYSIZE(TEST_CHARS); // Small alphabet: many candidates
+                for (int n = 0; n < haystack_len; n++)
+                    haystack[n] = TEST_CHARS[rng.Int(0, alphabet_size - 1)];
+                const int pos = (pass < 4) ? ImMax(haystack_len - needle_len, 0) : rng.Int(0, ImMax(haystack_len - needle_len, 0)); // Tail first
+                for (int n = 0; n < needle_len; n++)
+                {
+                    char c = (pos + n < haystack_len) ? haystack[pos + n] : TEST_CHARS[rng.Int(0, alphabet_size - 1)];
+                    if (ImCharIsAlphaA(c) && rng.Int(0, 1))
+                        c ^= 0x20; // Case change
+                    else if (pass >= 8 && n == rng.Int(0, needle_len - 1))
+                        c = TEST_CHARS[rng.Int(0, alphabet_size - 1)]; // Near miss
+                    needle[n] = c;
+                }
+                CheckStristr(haystack, haystack_len, needle, needle_len);
+                if (GTestErrors > 10)
+                    return;
+            }
+
+    // Non-letters differing by 0x20 are not folded, letters are
+    const char* pairs[][2] = { { "@", "`" }, { "[", "{" }, { "]", "}" }, { "^", "~" }, { "\\", "|" }, { "_", "\x7F" }, { "\xC1", "\xE1" }, { "a", "A" }, { "z", "Z" } };
+    for (const char* const* pair : pairs)
+        for (int side = 0; side < 2; side++)
+        {
+            const char* a = pair[side];
+            const char* b = pair[side ^ 1];
+            const bool expect_match = ImCharIsAlphaA(a[0]);
+            char text[64];
+            for (int len = 1; len < IM_ARRAYSIZE(text); len++) // Needle char as first/last char of a needle, at all positions
+            {
+                memset(text, '.', (size_t)len);
+                text[len - 1] = b[0];
+                CheckStristr(text, len, a, 1);
+                IM_CHECK((ImStristr(text, text + len, a, a + 1) != NULL) == expect_match);
+                char needle2[3] = { '.', a[0], 0 };
+                CheckStristr(text, len, needle2, 2);
+                char needle3[3] = { a[0], '.', 0 };
+                text[0] = b[0];
+                CheckStristr(text, len, needle3, 2);
+            }
+        }
+
+    // Zero-terminated haystack and needle, and empty needle (never matches)
+    const char* haystacks[] = { "", "a", "Hello World", "hello_world.png", "textures/rock_12_ALBEDO_HD.dds", "@@@@@@@@@@@@@@@@@@@@`", "{{{{{{{{{{{{{{{{{{[" };
+    const char* needles[] = { "a", "WORLD", "o_W", "png", "ALBEDO_hd", "`", "@`", "[", "{[", "xyz", "hello world", "s/r" };
+    for (const char* h : haystacks)
+    {
+        for (const char* n : needles)
+        {
+            IM_CHECK_MSG(ImStristr(h, NULL, n, NULL) == RefStristr(h, NULL, n, NULL), "\"%s\" \"%s\"", h, n);
+            CheckStristr(h, (int)strlen(h), n, (int)strlen(n));
+        }
+        IM_CHECK(ImStristr(h, NULL, "", NULL) == NULL);
+        IM_CHECK(ImStristr(h, NULL, needles[0], needles[0]) == NULL);
+    }
+}
+
+static void TestPassFilter()
+{
+    ImTestRandom rng(0xF11E);
+    const char* terms[] = { "rock", "ROCK_1", "-rock", "-hd", "hd", "", "-", "  png ", "-.DDS", "tex", "@", "-`", "a", "-a", "zz", "-zz", "[x]", "-{x}" };
+    const char* words[] = { "textures", "rock", "Rock", "12", "albedo", "HD", "ld", "png", "dds", "@", "`", "[x]", "{x}", "a", "zz" };
+    const char* separators[] = { "/", "_", ".", " " };
+    ImVector<char*> texts;
+    for (int n = 0; n < 2000; n++)
+    {
+        char buf[256] = "";
+        int len = 0;
+        for (int w = rng.Int(0, 6); w > 0; w--)
+            len += snprintf(buf + len, sizeof(buf) - len, "%s%s", words[rng.Int(0, IM_ARRAYSIZE(words) - 1)], separators[rng.Int(0, IM_ARRAYSIZE(separators) - 1)]);
+        texts.push_back(AllocExact(buf, (size_t)len + 1));
+    }
+
+    for (int n = 0; n < 500; n++)
+    {
+        // Random filter, terms order matters: the first matching include or exclude term decides
+        ImGuiTextFilter filter;
+        int len = 0;
+        for (int t = rng.Int(0, 4); t > 0; t--)
+            len += snprintf(filter.InputBuf + len, sizeof(filter.InputBuf) - len, "%s%s", terms[rng.Int(0, IM_ARRAYSIZE(terms) - 1)], t > 1 ? "," : "");
+        filter.Build();
+
+        ImVector<int> indices;
+        const int pass_count = filter.PassFilterMultiple(texts.Data, texts.Size, &indices);
+        IM_CHECK(pass_count == indices.Size);
+        int ref_pass_count = 0;
+        for (int text_n = 0; text_n < texts.Size; text_n++)
+        {
+            const char* text = texts[text_n];
+            const bool ref_pass = RefPassFilter(filter, text);
+            IM_CHECK_MSG(filter.PassFilter(text) == ref_pass, "filter \"%s\" text \"%s\"", filter.InputBuf, text);
+            IM_CHECK_MSG(filter.PassFilter(text, text + strlen(text)) == ref_pass, "filter \"%s\" text \"%s\"", filter.InputBuf, text);
+            if (ref_pass)
+            {
+                IM_CHECK(ref_pass_count < indices.Size && indices[ref_pass_count] == text_n);
+                ref_pass_count++;
+            }
+            if (GTestErrors > 10)
+                break;
+        }
+        IM_CHECK(pass_count == ref_pass_count);
+        IM_CHECK(filter.PassFilter(NULL) == RefPassFilter(filter, NULL));
+        if (GTestErrors > 10)
+            break;
+    }
+
+    // Explicit ordering cases
+    const struct { const char* Filter; const char* Text; bool Pass; } cases[] =
+    {
+        { "rock,-hd", "rock_hd.png", true },    // Include term first
+        { "-hd,rock", "rock_hd.png", false },   // Exclude term first
+        { "-hd", "rock.png", true },            // Only exclude terms: implicit include
+        { "-hd,rock", "stone.png", false },
+        { "ROCK", "textures/rock.png", true },
+        { "-", "rock.png", true },              // Empty exclude term is ignored
+        { "@", "`", false },
+        { "{x}", "[X]", false },
+    };
+    for (const auto& c : cases)
+    {
+        ImGuiTextFilter filter(c.Filter);
+        IM_CHECK_MSG(filter.PassFilter(c.Text) == c.Pass && RefPassFilter(filter, c.Text) == c.Pass, "filter \"%s\" text \"%s\"", c.Filter, c.Text);
+    }
+
+    for (char* text : texts)
+        free(text);
+}
+
+static void Benchmark()
+{
+    ImTestRandom rng(0xBE7C);
+    const char* folders[] = { "textures", "meshes", "materials", "sounds", "scripts", "levels" };
+    const char* names[] = { "rock", "grass", "tree", "water", "sky", "metal", "wood", "cloth" };
+    const char* suffixes[] = { "albedo", "normal", "roughness", "ALBEDO_HD", "ld", "lod0", "lod1" };
+    const char* exts[] = { ".png", ".dds", ".fbx", ".wav", ".lua" };
+    const int count = 100000;
+    ImVector<char> text_buf;
+    ImVector<int> text_offsets;
+    for (int n = 0; n < count; n++)
+    {
+        char buf[256];
+        const int len = snprintf(buf, sizeof(buf), "assets/%s/%s/%s_%d_%s%s", folders[rng.Int(0, 5)], names[rng.Int(0, 7)], names[rng.Int(0, 7)], rng.Int(0, 99), suffixes[rng.Int(0, 6)], exts[rng.Int(0, 4)]);
+        text_offsets.push_back(text_buf.Size);
+        text_buf.resize(text_buf.Size + len + 1);
+        memcpy(text_buf.Data + text_offsets.back(), buf, (size_t)len + 1);
+    }
+    ImVector<const char*> texts;
+    for (int offset : text_offsets)
+        texts.push_back(text_buf.Data + offset);
+
+    printf("TextFilter: %d paths, ns per path (old -> new):\n", count);
+    const char* filters[] = { "rock_12", "zzz,-rock", "hd,ld,xx", "ALBEDO_HD" };
+    for (const char* filter_str : filters)
+    {
+        ImGuiTextFilter filter(filter_str);
+        static volatile int sink;
+        const double ns_ref = ImTestBench(1, 5, [&]() { int c = 0; for (const char* text : texts) c += RefPassFilter(filter, text) ? 1 : 0; sink += c; }) / count;
+        const double ns_new = ImTestBench(1, 5, [&]() { sink += filter.PassFilterMultiple(texts.Data, texts.Size); }) / count;
+        printf("  \"%s\": %6.1f -> %6.1f\n", filter_str, ns_ref, ns_new);
+    }
+}
+
+int main()
+{
+    TestStristr();
+    TestPassFilter();
+    Benchmark();
+    return ImTestExit("test_text_filter");
+}
@@ -0,0 +1,276 @@
+// dear imgui: ImGuiTextLog tests and benchmark
+// - Check stored lines against a plain list of all appended lines, with random ChunkSize and MaxSize values: partial lines continued
+//   by later appends, lines larger than a chunk, empty lines, append() and appendf(), ChunkSize and MaxSize changes, and clear().
+// - Check that line numbers start at the oldest line still stored after dropping chunks (LinesDropped), that stored text stays within
+//   MaxSize, that terminated lines don't move until dropped, and copy_to().
+// - Measure appending lines, compared to ImGuiTextBuffer + a vector of line offsets (previous "Examples->Log" demo).
+
+#include "imgui_tests.h"
+#include <string.h>
+#include <string>
+#include <vector>
+
+// All lines appended since last clear(), including dropped ones
+struct TextLogModel
+{
+    std::vector<std::string>    Lines;
+    bool                        LastLineOpen = false;
+    size_t                      TotalSize = 0;
+
+    void Append(const char* str, int len)
+    {
+        TotalSize += (size_t)len;
+        for (const char* p = str, *p_end = str + len; p < p_end; )
+        {
+            if (!LastLineOpen)
+                Lines.push_back(std::string());
+            const char* line_end = (const char*)memchr(p, '\n', (size_t)(p_end - p));
+            Lines.back().append(p, line_end ? line_end : p_end);
+            LastLineOpen = (line_end == NULL);
+            p = line_end ? line_end + 1 : p_end;
+        }
+    }
+    void Clear() { Lines.clear(); LastLineOpen = false; TotalSize = 0; }
+};
+
+// MaxSize changes are applied on next new chunk: pass check_max_size = false until then.
+static void CheckLog(const ImGuiTextLog& log, const TextLogModel& model, bool check_all_lines, bool check_max_size = true)
+{
+    IM_CHECK_MSG(log.LinesDropped + log.size() == (int)model.Lines.size(), "%d dropped + %d lines, expected %d lines", log.LinesDropped, log.size(), (int)model.Lines.size());
+    IM_CHECK(log.TotalSize == (ImU64)model.TotalSize);
+    IM_CHECK(log.LastLineOpen == (model.LastLineOpen && log.size() > 0));
+    IM_CHECK(log.empty() == (log.size() == 0));
+    if (check_max_size)
+        IM_CHECK(log.ChunksTotalSize <= log.MaxSize || log.MaxSize == 0 || log.Chunks.Size == 1);
+    int chunks_total_size = 0;
+    for (const ImGuiTextLog::ImGuiTextLogChunk& chunk : log.Chunks)
+    {
+        IM_CHECK(chunk.Used < chunk.Size);
+        chunks_total_size += chunk.Size;
+    }
+    IM_CHECK(chunks_total_size == log.ChunksTotalSize);
+    if (GTestErrors > 0)
+        return;
+
+    // Lines are numbered from the oldest line still stored. Checking the last few lines is enough after each operation.
+    for (int line_no = check_all_lines ? 0 : ImMax(log.size() - 3, 0); line_no < log.size(); line_no++)
+    {
+        const std::string& expected = model.Lines[(size_t)(log.LinesDropped + line_no)];
+        const char* begin = log.get_line_begin(line_no);
+        const char* end = log.get_line_end(line_no);
+        IM_CHECK_MSG((size_t)(end - begin) == expected.size() && memcmp(begin, expected.data(), expected.size()) == 0,
+            "line %d (+%d dropped): \"%.*s\", expected \"%s\"", line_no, log.LinesDropped, (int)(end - begin), begin, expected.c_str());
+
+        // Each line is stored in the chunk it refers to
+        const ImGuiTextLog::ImGuiTextLogLine& line = log.get_line(line_no);
+        const int chunk_idx = line.ChunkNo - log.ChunksDropped;
+        IM_CHECK(chunk_idx >= 0 && chunk_idx < log.Chunks.Size);
+        if (chunk_idx >= 0 && chunk_idx < log.Chunks.Size)
+            IM_CHECK(line.Begin >= log.Chunks[chunk_idx].Data && line.Begin + line.Len <= log.Chunks[chunk_idx].Data + log.Chunks[chunk_idx].Used);
+        if (GTestErrors > 0)
+            return;
+    }
+    if (!log.empty())
+        IM_CHECK(log.get_line_end(log.size() - 1) + (log.LastLineOpen ? 0 : 1) == log.end());
+
+    if (check_all_lines)
+    {
+        std::string expected;
+        for (int line_no = 0; line_no < log.size(); line_no++)
+        {
+            expected += model.Lines[(size_t)(log.LinesDropped + line_no)];
+            if (line_no + 1 < log.size() || !log.LastLineOpen)
+                expected += '\n';
+        }
+        ImGuiTextBuffer buf;
+        log.copy_to(&buf);
+        IM_CHECK((size_t)buf.size() == expected.size() && memcmp(buf.c_str(), expected.data(), expected.size()) == 0);
+    }
+}
+
+// Random fragment: empty lines, short lines, lines around and above ChunkSize, optionally not terminated
+static int GenerateFragment(char* buf, int buf_size, int chunk_size, ImTestRandom* rng)
+{
+    int len = 0;
+    const int lines_count = rng->Int(1, 4);
+    for (int n = 0; n < lines_count && len < buf_size - 1; n++)
+    {
+        const int kind = rng->Int(0, 15);
+        int line_len = (kind == 0) ? 0 : (kind < 12) ? rng->Int(1, 40) : (kind < 15) ? rng->Int(chunk_size - 4, chunk_size + 4) : rng->Int(chunk_size, chunk_size * 3);
+        line_len = ImMin(line_len, buf_size - 1 - len);
+        for (int i = 0; i < line_len; i++)
+            buf[len++] = (char)rng->Int('a', 'z');
+        if (len < buf_size - 1 && (n + 1 < lines_count || rng->Int(0, 2) != 0))
+            buf[len++] = '\n';
+    }
+    return len;
+}
+
+static void TestRandom()
+{
+    const int chunk_sizes[] = { 16, 17, 64, 100, 1024 };
+    ImTestRandom rng;
+    std::vector<char> buf(1024 * 4);
+    for (int config = 0; config < 300 && GTestErrors == 0; config++)
+    {
+        ImGuiTextLog log;
+        TextLogModel model;
+        log.ChunkSize = chunk_sizes[rng.Int(0, IM_ARRAYSIZE(chunk_sizes) - 1)];
+        const int max_sizes[] = { 0, log.ChunkSize, log.ChunkSize * 3, log.ChunkSize * 3 + 7, rng.Int(1, log.ChunkSize * 10) };
+        log.MaxSize = max_sizes[rng.Int(0, IM_ARRAYSIZE(max_sizes) - 1)];
+
+        // Terminated lines don't move until dropped: track one of them
+        int tracked_line_abs = -1;
+        const char* tracked_line_begin = NULL;
+        bool max_size_pending = false;
+
+        for (int op = 0; op < 1000 && GTestErrors == 0; op++)
+        {
+            const int chunks_created = log.ChunksDropped + log.Chunks.Size;
+            const int kind = rng.Int(0, 99);
+            if (kind < 70)
+            {
+                const int len = GenerateFragment(buf.data(), (int)buf.size(), log.ChunkSize, &rng);
+                if (len > 0 && rng.Int(0, 1))
+                {
+                    log.append(buf.data(), buf.data() + len);
+                }
+                else
+                {
+                    buf[len] = 0;
+                    log.append(buf.data());
+                }
+                model.Append(buf.data(), len);
+            }
+            else if (kind < 95)
+            {
+                char formatted[64];
+                const int value = rng.Int(-100000, 100000);
+                const char* fmt = (kind & 1) ? "%d: value\n" : "[%05d]";
+                const int len = snprintf(formatted, sizeof(formatted), fmt, value);
+                log.appendf(fmt, value);
+                model.Append(formatted, len);
+            }
+            else if (kind < 97)
+            {
+                log.MaxSize = max_sizes[rng.Int(0, IM_ARRAYSIZE(max_sizes) - 1)];
+                max_size_pending = true;
+            }
+            else if (kind < 98)
+            {
+                log.ChunkSize = chunk_sizes[rng.Int(0, IM_ARRAYSIZE(chunk_sizes) - 1)];
+            }
+            else
+            {
+                log.clear();
+                model.Clear();
+                IM_CHECK(log.size() == 0 && log.LinesDropped == 0 && log.TotalSize == 0 && log.end() == NULL);
+                tracked_line_abs = -1;
+            }
+            if (log.ChunksDropped + log.Chunks.Size != chunks_created || log.Chunks.Size == 0)
+                max_size_pending = false;
+            CheckLog(log, model, (op % 50) == 0, !max_size_pending);
+
+            if (tracked_line_abs >= log.LinesDropped)
+                IM_CHECK_MSG(log.get_line_begin(tracked_line_abs - log.LinesDropped) == tracked_line_begin, "config %d op %d: line %d moved", config, op, tracked_line_abs);
+            else if (log.size() > 1)
+            {
+                tracked_line_abs = log.LinesDropped + rng.Int(0, log.size() - 2);
+                tracked_line_begin = log.get_line_begin(tracked_line_abs - log.LinesDropped);
+            }
+        }
+        CheckLog(log, model, true, !max_size_pending);
+    }
+}
+
+static void TestExplicit()
+{
+    // Partial lines continued over chunks
+    ImGuiTextLog log;
+    TextLogModel model;
+    log.ChunkSize = 16;
+    const char* fragments[] = { "abc", "defgh", "ijklmnop", "qrstuvwxyz", "\n", "0123456789ABCDEF", "GHIJ\nKL", "\n\n", "M" };
+    for (const char* fragment : fragments)
+    {
+        log.append(fragment);
+        model.Append(fragment, (int)strlen(fragment));
+        CheckLog(log, model, true);
+    }
+    IM_CHECK(log.size() == 5 && log.LastLineOpen);
+    IM_CHECK(strncmp(log.get_line_begin(0), "abcdefghijklmnopqrstuvwxyz", 26) == 0 && log.get_line_end(0) - log.get_line_begin(0) == 26);
+
+    // Bounded to 2 chunks: old lines are dropped, numbering restarts from the oldest line kept
+    log.clear();
+    model.Clear();
+    log.ChunkSize = 32;
+    log.MaxSize = 64;
+    for (int n = 0; n < 100; n++)
+    {
+        log.appendf("line %d\n", n);
+        char line[32];
+        model.Append(line, snprintf(line, sizeof(line), "line %d\n", n));
+    }
+    CheckLog(log, model, true);
+    IM_CHECK(log.LinesDropped > 0 && log.size() > 0 && log.ChunksTotalSize <= 64);
+    IM_CHECK(strncmp(log.get_line_begin(log.size() - 1), "line 99", 7) == 0);
+
+    // A line larger than MaxSize is kept alone
+    std::string large(200, 'x');
+    log.append(large.c_str());
+    model.Append(large.c_str(), (int)large.size());
+    CheckLog(log, model, true);
+    log.append("\n");
+    model.Append("\n", 1);
+    log.append("y\n");
+    model.Append("y\n", 2);
+    CheckLog(log, model, true);
+    IM_CHECK(log.size() >= 1 && strncmp(log.get_line_begin(log.size() - 1), "y", 1) == 0);
+}
+
+static void Benchmark()
+{
+    const int lines_count = 200000;
+    static volatile int sink;
+    printf("ImGuiTextLog: ns per line (ImGuiTextBuffer + line offsets -> ImGuiTextLog -> ImGuiTextLog with MaxSize 1 MB):\n");
+    const double ns_ref = ImTestBench(1, 5, [&]()
+    {
+        ImGuiTextBuffer buf;
+        ImVector<int> line_offsets;
+        line_offsets.push_back(0);
+        for (int n = 0; n < lines_count; n++)
+        {
+            int old_size = buf.size();
+            buf.appendf("[%05d] Hello, current time is %.1f, here's a word: '%s'\n", n, n * 0.016f, "Dear ImGui");
+            for (int new_size = buf.size(); old_size < new_size; old_size++)
+                if (buf[old_size] == '\n')
+                    line_offsets.push_back(old_size + 1);
+        }
+        sink += line_offsets.Size;
+    }) / lines_count;
+    const double ns_log = ImTestBench(1, 5, [&]()
+    {
+        ImGuiTextLog log;
+        for (int n = 0; n < lines_count; n++)
+            log.appendf("[%05d] Hello, current time is %.1f, here's a word: '%s'\n", n, n * 0.016f, "Dear ImGui");
+        sink += log.size();
+    }) / lines_count;
+    const double ns_log_bounded = ImTestBench(1, 5, [&]()
+    {
+        ImGuiTextLog log;
+        log.MaxSize = 1024 * 1024;
+        for (int n = 0; n < lines_count; n++)
+            log.appendf("[%05d] Hello, current time is %.1f, here's a word: '%s'\n", n, n * 0.016f, "Dear ImGui");
+        sink += log.size();
+    }) / lines_count;
+    printf("  %d lines: %5.1f -> %5.1f -> %5.1f\n", lines_count, ns_ref, ns_log, ns_log_bounded);
+}
+
+int main()
+{
+    ImTestCreateContext();
+    TestExplicit();
+    TestRandom();
+    Benchmark();
+    ImGui::DestroyContext();
+    return ImTestExit("test_text_log");
+}
@@ -0,0 +1,109 @@
+// dear imgui: CalcTextSize() cross-frame cache tests (io.ConfigTextSizeCache)
+// - Check that cached sizes match uncached ones while texts, fonts and wrap widths change over frames.
+// - Check that texts whose cache keys collide don't return each other's size.
+
+#include "imgui_tests.h"
+#include <string.h>
+
+static ImVec2 CalcTextSizeRef(const char* text, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    ImVec2 size = g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, wrap_width, text, NULL, NULL);
+    size.x = IM_TRUNC(size.x + 0.99999f);
+    return size;
+}
+
+static void NewFrame()
+{
+    ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame();
+}
+
+static void TestMatchesUncached()
+{
+    ImGuiContext& g = *GImGui;
+    ImTestRandom rng;
+    char buf[128];
+    for (int frame = 0; frame < 200; frame++)
+    {
+        NewFrame();
+        for (int n = 0; n < 200; n++)
+        {
+            const int len = rng.Int(1, IM_ARRAYSIZE(buf) - 1);
+            for (int c = 0; c < len; c++)
+                buf[c] = (rng.Int(0, 7) == 0) ? ' ' : (rng.Int(0, 31) == 0) ? '\n' : (char)rng.Int('a', 'e'); // Small alphabet so texts repeat
+            buf[len] = 0;
+            const float wrap_width = (n & 1) ? -1.0f : (float)rng.Int(20, 200);
+            const ImVec2 size = ImGui::CalcTextSize(buf, NULL, false, wrap_width);
+            const ImVec2 size_ref = CalcTextSizeRef(buf, wrap_width);
+            IM_CHECK_MSG(size.x == size_ref.x && size.y == size_ref.y, "frame %d '%s'", frame, buf);
+        }
+        ImGui::EndFrame();
+    }
+    IM_CHECK(g.TextSizeCache.HitCountLastFrame > 0);
+}
+
+// Generate texts of the same length until some of them share the same cache key, then check each gets its own size.
+// (CRC is linear and detects all bursts of up to 32 bits, so texts need to differ in many bits for keys to collide)
+static void MakeCollisionText(char* buf, int n)
+{
+    const char* alphabet = "ab\ncd\nef"; // Default font is monospace: use line breaks so that colliding texts are likely to have different sizes
+    ImTestRandom rng((ImU32)n + 1);
+    for (int c = 0; c < 12; c++)
+        buf[c] = alphabet[rng.Next() & 7];
+    buf[12] = 0;
+}
+
+static void TestCollisions()
+{
+    ImGuiContext& g = *GImGui;
+    struct { ImFont* Font; float FontSize; float WrapWidth; } key_data = { g.Font, g.FontSize, -1.0f };
+    const ImGuiID seed = ImHashData(&key_data, sizeof(key_data));
+
+    const int count = 400000; // ~18 expected collisions for a 32-bit hash
+    ImVector<ImU64> keys;
+    keys.resize(count);
+    char buf[16];
+    for (int n = 0; n < count; n++)
+    {
+        MakeCollisionText(buf, n);
+        keys[n] = ((ImU64)ImHashData(buf, 12, seed) << 32) | (ImU64)n;
+    }
+    ImQsort(keys.Data, (size_t)keys.Size, sizeof(ImU64), [](const void* a, const void* b) { ImU64 ka = *(const ImU64*)a, kb = *(const ImU64*)b; return (ka > kb) - (ka < kb); });
+
+    int pairs = 0;
+    for (int n = 1; n < keys.Size; n++)
+    {
+        if ((keys[n] >> 32) != (keys[n - 1] >> 32))
+            continue;
+        char text_a[16], text_b[16];
+        MakeCollisionText(text_a, (int)(keys[n - 1] & 0xFFFFFFFF));
+        MakeCollisionText(text_b, (int)(keys[n] & 0xFFFFFFFF));
+        if (strcmp(text_a, text_b) == 0)
+            continue;
+        for (int frame = 0; frame < 3; frame++)
+        {
+            NewFrame();
+            const ImVec2 size_a = ImGui::CalcTextSize(text_a);
+            const ImVec2 size_b = ImGui::CalcTextSize(text_b);
+            const ImVec2 size_a_ref = CalcTextSizeRef(text_a, -1.0f);
+            const ImVec2 size_b_ref = CalcTextSizeRef(text_b, -1.0f);
+            IM_CHECK(size_a.x == size_a_ref.x && size_a.y == size_a_ref.y);
+            IM_CHECK(size_b.x == size_b_ref.x && size_b.y == size_b_ref.y);
+            ImGui::EndFrame();
+        }
+        pairs++;
+    }
+    printf("  tested %d colliding pairs\n", pairs);
+    IM_CHECK(pairs > 0);
+}
+
+int main(int, char**)
+{
+    ImTestCreateContext();
+    ImGui::GetIO().ConfigTextSizeCache = true;
+    TestMatchesUncached();
+    TestCollisions();
+    ImGui::DestroyContext();
+    return ImTestExit("test_text_size_cache");
+}
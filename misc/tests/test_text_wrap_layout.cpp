@@ -0,0 +1,174 @@
+// dear imgui: cached word-wrap layout tests (GetTextWrapLayout(), TextEx() on long wrapped text)
+// - Check that long wrapped text rendered by TextEx() from a cached layout (only visible lines) outputs the same visible glyphs
+//   as rendering the whole text with RenderTextWrapped() (previous path, CalcWordWrapPositionA() from text start), and has the
+//   same size as CalcTextSize(), for several wrap widths and scroll offsets.
+// - Check that layouts are rebuilt when the font atlas is rebuilt (ImFontAtlas::BuildCount) and when text contents change.
+
+#include "imgui_tests.h"
+#include <string.h>
+
+// Words of random lengths with single/multiple spaces, newlines, blank lines and words longer than the wrap width
+static void GenerateText(ImVector<char>* out, int size, ImTestRandom& rng)
+{
+    out->resize(0);
+    while (out->Size < size)
+    {
+        const int kind = rng.Int(0, 99);
+        int word_len = (kind < 3) ? rng.Int(40, 120) : rng.Int(1, 12);
+        while (word_len-- > 0)
+            out->push_back((char)('a' + rng.Int(0, 25)));
+        if (kind >= 90)
+            out->push_back('\n');
+        else if (kind >= 87)
+            for (int n = rng.Int(2, 6); n > 0; n--)
+                out->push_back(' ');
+        else if (kind == 86)
+        {
+            out->push_back('\n');
+            out->push_back('\n');
+        }
+        else
+            out->push_back(' ');
+    }
+    out->push_back(0);
+}
+
+// Append vertices of glyph quads overlapping 'clip_rect'. RenderText() outputs 4 vertices per glyph.
+static void GetVisibleGlyphVertices(const ImDrawList* draw_list, int vtx_begin, int vtx_end, const ImRect& clip_rect, ImVector<ImDrawVert>* out)
+{
+    IM_CHECK((vtx_end - vtx_begin) % 4 == 0);
+    for (int n = vtx_begin; n + 4 <= vtx_end; n += 4)
+    {
+        const ImDrawVert* v = &draw_list->VtxBuffer[n];
+        const ImRect quad_rect(v[0].pos, v[2].pos);
+        if (quad_rect.Overlaps(clip_rect))
+            for (int k = 0; k < 4; k++)
+                out->push_back(v[k]);
+    }
+}
+
+static bool SameVertices(const ImVector<ImDrawVert>& a, const ImVector<ImDrawVert>& b)
+{
+    if (a.Size != b.Size)
+        return false;
+    for (int n = 0; n < a.Size; n++)
+        if (a[n].pos.x != b[n].pos.x || a[n].pos.y != b[n].pos.y || a[n].uv.x != b[n].uv.x || a[n].uv.y != b[n].uv.y || a[n].col != b[n].col)
+            return false;
+    return true;
+}
+
+// Render a frame with 'text' in a scrolled window. Compare TextEx() output with the previous path, on the last frame only.
+static void RunFrames(const char* text, float wrap_pos_x, float scroll_y, int frames, const char* desc)
+{
+    const char* text_end = text + strlen(text);
+    IM_CHECK(text_end - text > 2000); // Use cached layout
+    for (int frame = 0; frame < frames; frame++)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        io.DeltaTime = 1.0f / 60.0f;
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(10, 10));
+        ImGui::SetNextWindowSize(ImVec2(600, 400));
+        ImGui::SetNextWindowScroll(ImVec2(0.0f, scroll_y));
+        ImGui::Begin("Test", NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        ImDrawList* draw_list = window->DrawList;
+        ImGui::Text("Header");
+        ImGui::PushTextWrapPos(wrap_pos_x);
+
+        // Cached layout path
+        const ImVec2 text_pos(window->DC.CursorPos.x, window->DC.CursorPos.y + window->DC.CurrLineTextBaseOffset);
+        const float wrap_width = ImGui::CalcWrapWidthForPos(window->DC.CursorPos, window->DC.TextWrapPos);
+        const int vtx_0 = draw_list->VtxBuffer.Size;
+        ImGui::TextEx(text, text_end);
+        const ImVec2 item_size = ImGui::GetItemRectSize();
+        const int vtx_1 = draw_list->VtxBuffer.Size;
+
+        // Previous path: measure and render the whole text, RenderText() skips clipped lines by scanning from text start
+        const ImVec2 ref_size = ImGui::CalcTextSize(text, text_end, false, wrap_width);
+        ImGui::RenderTextWrapped(text_pos, text, text_end, wrap_width);
+        const int vtx_2 = draw_list->VtxBuffer.Size;
+
+        ImGui::PopTextWrapPos();
+        ImGui::Text("Footer");
+        if (frame == frames - 1)
+        {
+            ImVector<ImDrawVert> vertices, ref_vertices;
+            GetVisibleGlyphVertices(draw_list, vtx_0, vtx_1, window->ClipRect, &vertices);
+            GetVisibleGlyphVertices(draw_list, vtx_1, vtx_2, window->ClipRect, &ref_vertices);
+            IM_CHECK_MSG(item_size.x == ref_size.x && item_size.y == ref_size.y, "%s: size (%.2f,%.2f), expected (%.2f,%.2f)", desc, item_size.x, item_size.y, ref_size.x, ref_size.y);
+            IM_CHECK_MSG(ref_vertices.Size > 0, "%s: nothing visible", desc);
+            IM_CHECK_MSG(SameVertices(vertices, ref_vertices), "%s: %d visible vertices, expected %d", desc, vertices.Size, ref_vertices.Size);
+        }
+        ImGui::End();
+        ImGui::Render();
+    }
+}
+
+static void TestWrapWidthsAndScroll(const char* text, const char* text_desc)
+{
+    const float wrap_pos_xs[] = { 0.0f, 37.0f, 150.0f, 333.5f, 560.0f }; // 0.0f: wrap at window edge
+    const float scroll_ys[] = { 0.0f, 1.0f, 500.0f, 1234.5f, 5000.0f, 1e9f }; // Clamped to ScrollMax.y
+    for (float wrap_pos_x : wrap_pos_xs)
+        for (float scroll_y : scroll_ys)
+        {
+            char desc[128];
+            ImFormatString(desc, IM_ARRAYSIZE(desc), "%s, wrap_pos_x %.1f, scroll_y %.1f", text_desc, wrap_pos_x, scroll_y);
+            RunFrames(text, wrap_pos_x, scroll_y, 3, desc);
+        }
+}
+
+// Font lookup tables rebuilt with the same ImFont and size: cached layout must be rebuilt too
+static void TestFontRebuild(const char* text)
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    ImFont* font = ImGui::GetFont();
+    ImFontGlyph* glyph = (ImFontGlyph*)font->FindGlyphNoFallback('e');
+    IM_CHECK(glyph != NULL);
+    if (glyph == NULL)
+        return;
+    const float advance_x = glyph->AdvanceX;
+    RunFrames(text, 200.0f, 300.0f, 3, "before rebuild");
+    const int build_count = atlas->BuildCount;
+    glyph->AdvanceX = advance_x * 3.0f; // Change advance of a common character (default font is monospace)
+    font->BuildLookupTable();
+    IM_CHECK(atlas->BuildCount != build_count);
+    RunFrames(text, 200.0f, 300.0f, 1, "after rebuild");
+    glyph->AdvanceX = advance_x;
+    font->BuildLookupTable();
+    RunFrames(text, 200.0f, 300.0f, 1, "after restore");
+}
+
+// Same pointer and length, different contents
+static void TestContentsChange(char* text)
+{
+    RunFrames(text, 250.0f, 700.0f, 3, "before change");
+    for (char* p = text; *p; p++)
+        if (*p == ' ' && p[1] >= 'a' && p[1] <= 'z' && ((p - text) % 7) == 0)
+            *p = 'x'; // Merge words
+    RunFrames(text, 250.0f, 700.0f, 1, "after change");
+}
+
+int main()
+{
+    ImTestCreateContext();
+
+    ImTestRandom rng;
+    ImVector<char> text;
+    GenerateText(&text, 20000, rng);
+    TestWrapWidthsAndScroll(text.Data, "random");
+
+    // Single long paragraph without newlines
+    ImVector<char> paragraph;
+    for (int n = 0; n < 600; n++)
+        for (const char* p = "lorem ipsum dolor sit amet "; *p; p++)
+            paragraph.push_back(*p);
+    paragraph.push_back(0);
+    TestWrapWidthsAndScroll(paragraph.Data, "paragraph");
+
+    TestFontRebuild(text.Data);
+    TestContentsChange(text.Data);
+
+    ImGui::DestroyContext();
+    return ImTestExit("test_text_wrap_layout");
+}
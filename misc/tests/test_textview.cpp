@@ -0,0 +1,148 @@
+// dear imgui: misc/textview/ tests
+// - Check indexed lines against the file contents, including long lines spanning several reads and CRLF line endings.
+// - Check that a file truncated while open (e.g. 'copytruncate' log rotation) doesn't crash and is indexed again on Refresh().
+// - Check that appended data is picked up by Refresh().
+
+#include "imgui_tests.h"
+#include "misc/textview/imgui_textview.h"
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const char* TEST_FILENAME = "test_textview.tmp";
+
+static void WriteFile(const char* mode, const std::vector<std::string>& lines, const char* eol)
+{
+    FILE* f = fopen(TEST_FILENAME, mode); // "wb" truncates the file in place, same as 'copytruncate'
+    IM_CHECK(f != NULL);
+    for (const std::string& line : lines)
+        fprintf(f, "%s%s", line.c_str(), eol);
+    fclose(f);
+}
+
+static std::vector<std::string> MakeLines(const char* prefix, int count, ImTestRandom* rng)
+{
+    std::vector<std::string> lines;
+    for (int n = 0; n < count; n++)
+    {
+        char buf[64];
+        ImFormatString(buf, IM_ARRAYSIZE(buf), "%s %d ", prefix, n);
+        std::string line = buf;
+        if (rng->Int(0, 999) == 0)
+            line.append((size_t)rng->Int(70000, 200000), 'x'); // Longer than a GetLine() read
+        else
+            line.append((size_t)rng->Int(0, 100), 'a' + (char)(n % 26));
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+static void WaitIndexing(ImGuiTextViewSource* source)
+{
+    while (source->IsIndexing())
+        std::this_thread::yield();
+}
+
+static void CheckLines(ImGuiTextViewSource* source, const std::vector<std::string>& lines)
+{
+    IM_CHECK_MSG(source->GetLineCount() == (ImU64)lines.size(), "%d lines, expected %d", (int)source->GetLineCount(), (int)lines.size());
+    for (size_t n = 0; n < lines.size(); n++)
+    {
+        const char* line_begin;
+        const char* line_end;
+        if (!source->GetLine((ImU64)n, &line_begin, &line_end))
+        {
+            IM_CHECK_MSG(0, "GetLine(%d) failed", (int)n);
+            return;
+        }
+        IM_CHECK_MSG(std::string(line_begin, line_end) == lines[n], "line %d", (int)n);
+    }
+    const char* line_begin;
+    const char* line_end;
+    IM_CHECK(!source->GetLine((ImU64)lines.size(), &line_begin, &line_end));
+}
+
+static void TestFile()
+{
+    ImTestRandom rng;
+    ImGuiTextViewSource source;
+    std::vector<std::string> lines = MakeLines("first", 20000, &rng);
+    WriteFile("wb", lines, "\r\n");
+    IM_CHECK(source.OpenFile(TEST_FILENAME));
+    WaitIndexing(&source);
+    CheckLines(&source, lines);
+
+    // Truncate and write less data. Reading old lines must fail gracefully instead of raising SIGBUS.
+    std::vector<std::string> new_lines = MakeLines("second", 100, &rng);
+    WriteFile("wb", new_lines, "\n");
+    for (ImU64 n = 0; n < source.GetLineCount(); n += 97)
+    {
+        const char* line_begin;
+        const char* line_end;
+        source.GetLine(n, &line_begin, &line_end);
+    }
+    IM_CHECK(source.Refresh());
+    WaitIndexing(&source);
+    CheckLines(&source, new_lines);
+
+    // Append
+    std::vector<std::string> more_lines = MakeLines("third", 5000, &rng);
+    WriteFile("ab", more_lines, "\n");
+    IM_CHECK(source.Refresh());
+    IM_CHECK(!source.Refresh());
+    WaitIndexing(&source);
+    new_lines.insert(new_lines.end(), more_lines.begin(), more_lines.end());
+    CheckLines(&source, new_lines);
+
+    // Truncate to empty
+    WriteFile("wb", std::vector<std::string>(), "\n");
+    IM_CHECK(source.Refresh());
+    WaitIndexing(&source);
+    IM_CHECK(source.GetLineCount() == 0);
+    source.Close();
+    remove(TEST_FILENAME);
+}
+
+static void TestMemory()
+{
+    const char text[] = "one\ntwo\r\n\nfour";
+    ImGuiTextViewSource source;
+    source.OpenMemory(text, sizeof(text) - 1);
+    WaitIndexing(&source);
+    std::vector<std::string> lines = { "one", "two", "", "four" };
+    CheckLines(&source, lines);
+}
+
+// Render a tail-following view while the file is truncated and rewritten every few frames
+static void TestViewTruncation()
+{
+    ImTestRandom rng;
+    ImGuiTextViewSource source;
+    WriteFile("wb", MakeLines("view", 5000, &rng), "\n");
+    IM_CHECK(source.OpenFile(TEST_FILENAME));
+    for (int frame = 0; frame < 60; frame++)
+    {
+        if (frame % 10 == 5)
+            WriteFile("wb", MakeLines("view", rng.Int(0, 5000), &rng), "\n");
+        ImGui::GetIO().DeltaTime = 0.3f; // Past refresh interval
+        ImGui::NewFrame();
+        ImGui::SetNextWindowSize(ImVec2(800, 600));
+        ImGui::Begin("TextView");
+        ImGui::TextView("##log", &source, ImVec2(0.0f, 0.0f), ImGuiTextViewFlags_TailFollow | ImGuiTextViewFlags_LineNumbers);
+        ImGui::End();
+        ImGui::Render();
+    }
+    source.Close();
+    remove(TEST_FILENAME);
+}
+
+int main(int, char**)
+{
+    ImTestCreateContext();
+    TestFile();
+    TestMemory();
+    TestViewTruncation();
+    ImGui::DestroyContext();
+    return ImTestExit("test_textview");
+}
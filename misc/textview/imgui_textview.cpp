@@ -0,0 +1,537 @@
+// dear imgui: large text viewer (files read on demand, background line indexing)
+// (code)
+
+// Changelog:
+// - v0.11: Files are read with pread()/ReadFile() instead of being memory-mapped, so that a file truncated by another process can't crash us (SIGBUS).
+// - v0.10: Initial version. Added ImGuiTextViewSource and ImGui::TextView().
+
+// Implementation notes:
+// - The line index is sparse: we store the offset of one every IMGUI_TEXTVIEW_LINES_PER_CHUNK lines (64-bit offsets, so files > 4 GB are supported).
+//   Locating a line is a lookup followed by at most IMGUI_TEXTVIEW_LINES_PER_CHUNK-1 memchr() calls.
+// - Files are not memory-mapped: when another process truncates a mapped file (e.g. 'copytruncate' log rotation), accessing
+//   the mapping past the new end of file raises SIGBUS, and there is no race-free way to check for it beforehand.
+//   Instead we read with pread()/ReadFile() into buffers we own:
+//   - The worker thread reads blocks into its own buffer and appends to the index under a mutex, one block at a time.
+//   - GetLine() reads through a small cache, since visible lines are generally contiguous.
+//   A short read means the file shrank: we stop there, and index from scratch on next Refresh().
+// - Memory sources are accessed directly. The worker thread is always stopped before the source changes (on Refresh/Close).
+// - We don't use ImGuiListClipper or window scrolling for vertical scrolling: window coordinates are 32-bit floats,
+//   which would lose line precision past a few million lines. Instead we keep a 64-bit first visible line and use ScrollbarEx().
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_textview.h"
+#include "imgui_internal.h"
+
+#include <string.h>         // memchr
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>           // Not ImVector: ImGui::MemAlloc() updates context debug counters and isn't thread-safe
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <errno.h>          // errno, EINTR
+#include <fcntl.h>          // open
+#include <sys/stat.h>       // fstat
+#include <unistd.h>         // pread, close
+#endif
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#endif
+
+#define IMGUI_TEXTVIEW_LINES_PER_CHUNK      64
+#define IMGUI_TEXTVIEW_INDEX_BLOCK_SIZE     (4 << 20)   // Publish index progress every 4 MB
+#define IMGUI_TEXTVIEW_READ_CACHE_SIZE      (64 << 10)  // Minimum read size for GetLine()
+#define IMGUI_TEXTVIEW_REFRESH_INTERVAL     0.25        // Poll file size every 0.25 seconds in tail-follow mode
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiTextViewSourceData
+//-----------------------------------------------------------------------------
+
+struct ImGuiTextViewSourceData
+{
+    // Source (only modified when worker is stopped)
+    const char*         MemoryData = NULL;                  // Memory source
+    size_t              Size = 0;                           // Size of memory source, or file size at last Refresh()
+    bool                IsOpen = false;
+    bool                IsFile = false;
+#ifdef _WIN32
+    HANDLE              FileHandle = INVALID_HANDLE_VALUE;
+#else
+    int                 FileDesc = -1;
+#endif
+    std::atomic<bool>   FileShrank;                         // Set on short read. Next Refresh() will index from scratch.
+
+    // Line index (protected by Mutex while worker is running)
+    std::mutex          Mutex;
+    std::vector<ImU64>  LineChunkOffsets;                   // Offset of line n * IMGUI_TEXTVIEW_LINES_PER_CHUNK
+    ImU64               NewlineCount = 0;
+    ImU64               LastLineStart = 0;                  // Offset following last '\n'
+    size_t              IndexedSize = 0;
+
+    // Worker thread
+    std::thread         Worker;
+    std::atomic<bool>   WorkerStopRequest;
+    std::atomic<bool>   WorkerRunning;
+
+    // Read cache for GetLine() (files only)
+    std::vector<char>   ReadCache;
+    ImU64               ReadCacheOffset = 0;
+    size_t              ReadCacheSize = 0;
+
+    // View state (for ImGui::TextView)
+    ImS64               FirstLine = 0;
+    bool                FollowTail = true;
+    double              LastRefreshTime = 0.0;
+
+    ImGuiTextViewSourceData() : FileShrank(false), WorkerStopRequest(false), WorkerRunning(false) {}
+
+    ImU64 GetLineCount() const { return NewlineCount + ((LastLineStart < IndexedSize) ? 1 : 0); }
+};
+
+//-----------------------------------------------------------------------------
+// [SECTION] Platform: file reading
+//-----------------------------------------------------------------------------
+
+// Return current file size
+static bool TextViewGetFileSize(ImGuiTextViewSourceData* data, ImU64* out_size)
+{
+#ifdef _WIN32
+    LARGE_INTEGER file_size;
+    if (!::GetFileSizeEx(data->FileHandle, &file_size))
+        return false;
+    *out_size = (ImU64)file_size.QuadPart;
+#else
+    struct stat st;
+    if (::fstat(data->FileDesc, &st) != 0)
+        return false;
+    *out_size = (ImU64)st.st_size;
+#endif
+    return true;
+}
+
+// Read 'size' bytes at 'offset' (thread-safe: doesn't use the file position).
+// Return false on error or short read, which means the file shrank.
+static bool TextViewReadFile(ImGuiTextViewSourceData* data, ImU64 offset, char* dst, size_t size)
+{
+    while (size > 0)
+    {
+#ifdef _WIN32
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+        overlapped.OffsetHigh = (DWORD)(offset >> 32);
+        DWORD read_size = 0;
+        if (!::ReadFile(data->FileHandle, dst, (DWORD)ImMin(size, (size_t)(1 << 30)), &read_size, &overlapped))
+            read_size = 0;
+#else
+        ssize_t read_size = ::pread(data->FileDesc, dst, size, (off_t)offset);
+        if (read_size < 0 && errno == EINTR)
+            continue;
+#endif
+        if (read_size <= 0)
+        {
+            data->FileShrank.store(true);
+            return false;
+        }
+        dst += read_size;
+        offset += (ImU64)read_size;
+        size -= (size_t)read_size;
+    }
+    return true;
+}
+
+// Return pointer to 'size' bytes of source data at 'offset'. Files are read into 'buf', memory sources are accessed directly.
+// Return NULL on short read.
+static const char* TextViewFetch(ImGuiTextViewSourceData* data, ImU64 offset, size_t size, std::vector<char>* buf)
+{
+    IM_ASSERT(size > 0);
+    if (!data->IsFile)
+        return data->MemoryData + offset;
+    if (buf->size() < size)
+        buf->resize(size);
+    return TextViewReadFile(data, offset, buf->data(), size) ? buf->data() : NULL;
+}
+
+// Same as TextViewFetch() through the GetLine() cache: read at least IMGUI_TEXTVIEW_READ_CACHE_SIZE bytes (but no more than 'size_max') and reuse them across calls.
+static const char* TextViewFetchCached(ImGuiTextViewSourceData* data, ImU64 offset, size_t size, size_t size_max)
+{
+    if (!data->IsFile)
+        return data->MemoryData + offset;
+    if (offset >= data->ReadCacheOffset && offset + size <= data->ReadCacheOffset + data->ReadCacheSize)
+        return data->ReadCache.data() + (size_t)(offset - data->ReadCacheOffset);
+    const size_t read_size = ImMin(ImMax(size, (size_t)IMGUI_TEXTVIEW_READ_CACHE_SIZE), size_max);
+    data->ReadCacheSize = 0;
+    if (TextViewFetch(data, offset, read_size, &data->ReadCache) == NULL)
+        return NULL;
+    data->ReadCacheOffset = offset;
+    data->ReadCacheSize = read_size;
+    return data->ReadCache.data();
+}
+
+// Find offset of next '\n' from 'pos', or 'end' if there is none. Return false on short read.
+static bool TextViewFindLineEnd(ImGuiTextViewSourceData* data, ImU64 pos, ImU64 end, ImU64* out_line_end)
+{
+    while (pos < end)
+    {
+        const size_t size = (size_t)ImMin(end - pos, (ImU64)IMGUI_TEXTVIEW_READ_CACHE_SIZE);
+        const char* block = TextViewFetchCached(data, pos, size, (size_t)(end - pos));
+        if (block == NULL)
+            return false;
+        if (const char* nl = (const char*)memchr(block, '\n', size))
+        {
+            *out_line_end = pos + (ImU64)(nl - block);
+            return true;
+        }
+        pos += size;
+    }
+    *out_line_end = end;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Line indexing
+//-----------------------------------------------------------------------------
+
+static void TextViewWorker(ImGuiTextViewSourceData* data)
+{
+    // Worker is the only writer to the index while it is running, so it can read its own state without locking.
+    const size_t size = data->Size;
+    size_t pos = data->IndexedSize;
+    ImU64 newline_count = data->NewlineCount;
+    ImU64 last_line_start = data->LastLineStart;
+    std::vector<ImU64> new_chunk_offsets;
+    std::vector<char> block_buf;
+    while (pos < size && !data->WorkerStopRequest.load())
+    {
+        const size_t block_size = ImMin((size_t)IMGUI_TEXTVIEW_INDEX_BLOCK_SIZE, size - pos);
+        const char* block = TextViewFetch(data, pos, block_size, &block_buf);
+        if (block == NULL)
+            break;
+        new_chunk_offsets.clear();
+        for (const char* p = block; p < block + block_size; )
+        {
+            const char* nl = (const char*)memchr(p, '\n', (size_t)(block + block_size - p));
+            if (nl == NULL)
+                break;
+            p = nl + 1;
+            newline_count++;
+            last_line_start = (ImU64)pos + (ImU64)(p - block);
+            if ((newline_count % IMGUI_TEXTVIEW_LINES_PER_CHUNK) == 0)
+                new_chunk_offsets.push_back(last_line_start);
+        }
+        pos += block_size;
+
+        // Publish
+        std::lock_guard<std::mutex> lock(data->Mutex);
+        data->LineChunkOffsets.insert(data->LineChunkOffsets.end(), new_chunk_offsets.begin(), new_chunk_offsets.end());
+        data->NewlineCount = newline_count;
+        data->LastLineStart = last_line_start;
+        data->IndexedSize = pos;
+    }
+    data->WorkerRunning.store(false);
+}
+
+static void TextViewStartWorker(ImGuiTextViewSourceData* data)
+{
+    IM_ASSERT(!data->Worker.joinable());
+    if (data->IndexedSize >= data->Size)
+        return;
+    data->WorkerStopRequest.store(false);
+    data->WorkerRunning.store(true);
+    data->Worker = std::thread(TextViewWorker, data);
+}
+
+static void TextViewStopWorker(ImGuiTextViewSourceData* data)
+{
+    if (!data->Worker.joinable())
+        return;
+    data->WorkerStopRequest.store(true);
+    data->Worker.join();
+}
+
+static void TextViewResetIndex(ImGuiTextViewSourceData* data)
+{
+    data->LineChunkOffsets.assign(1, 0);
+    data->NewlineCount = data->LastLineStart = 0;
+    data->IndexedSize = 0;
+    data->ReadCacheSize = 0;
+    data->FileShrank.store(false);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiTextViewSource
+//-----------------------------------------------------------------------------
+
+ImGuiTextViewSource::ImGuiTextViewSource()
+{
+    Data = IM_NEW(ImGuiTextViewSourceData)();
+}
+
+ImGuiTextViewSource::~ImGuiTextViewSource()
+{
+    Close();
+    IM_DELETE(Data);
+}
+
+bool ImGuiTextViewSource::OpenFile(const char* filename)
+{
+    Close();
+    ImGuiTextViewSourceData* data = Data;
+#ifdef _WIN32
+    // Convert UTF-8 filename to wchar, same as ImFileOpen()
+    const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
+    ImVector<wchar_t> buf;
+    buf.resize(filename_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, buf.Data, filename_wsize);
+    data->FileHandle = ::CreateFileW(buf.Data, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (data->FileHandle == INVALID_HANDLE_VALUE)
+        return false;
+#else
+    data->FileDesc = ::open(filename, O_RDONLY);
+    if (data->FileDesc < 0)
+        return false;
+#endif
+    data->IsOpen = data->IsFile = true;
+    ImU64 file_size = 0;
+    if (!TextViewGetFileSize(data, &file_size) || file_size > (ImU64)(size_t)-1) // File size doesn't fit in size_t (32-bit target)
+    {
+        Close();
+        return false;
+    }
+    data->Size = (size_t)file_size;
+    TextViewResetIndex(data);
+    TextViewStartWorker(data);
+    return true;
+}
+
+void ImGuiTextViewSource::OpenMemory(const char* text, size_t text_size)
+{
+    Close();
+    ImGuiTextViewSourceData* data = Data;
+    data->IsOpen = true;
+    data->IsFile = false;
+    data->MemoryData = text;
+    data->Size = text_size;
+    TextViewResetIndex(data);
+    TextViewStartWorker(data);
+}
+
+void ImGuiTextViewSource::Close()
+{
+    ImGuiTextViewSourceData* data = Data;
+    TextViewStopWorker(data);
+    if (data->IsFile)
+    {
+#ifdef _WIN32
+        if (data->FileHandle != INVALID_HANDLE_VALUE)
+            ::CloseHandle(data->FileHandle);
+        data->FileHandle = INVALID_HANDLE_VALUE;
+#else
+        if (data->FileDesc >= 0)
+            ::close(data->FileDesc);
+        data->FileDesc = -1;
+#endif
+    }
+    data->MemoryData = NULL;
+    data->Size = 0;
+    data->IsOpen = data->IsFile = false;
+    data->LineChunkOffsets.clear();
+    data->NewlineCount = data->LastLineStart = 0;
+    data->IndexedSize = 0;
+    std::vector<char>().swap(data->ReadCache);
+    data->ReadCacheSize = 0;
+    data->FirstLine = 0;
+    data->FollowTail = true;
+}
+
+bool ImGuiTextViewSource::IsOpen() const
+{
+    return Data->IsOpen;
+}
+
+bool ImGuiTextViewSource::IsIndexing() const
+{
+    return Data->WorkerRunning.load();
+}
+
+bool ImGuiTextViewSource::Refresh()
+{
+    ImGuiTextViewSourceData* data = Data;
+    if (!data->IsFile)
+        return false;
+    ImU64 file_size = 0;
+    if (!TextViewGetFileSize(data, &file_size) || file_size > (ImU64)(size_t)-1)
+        return false;
+    const bool shrank = (file_size < (ImU64)data->Size) || data->FileShrank.load();
+    if (file_size == (ImU64)data->Size && !shrank)
+        return false;
+
+    // When the file shrank (e.g. truncated for rotation) we need to index from scratch.
+    TextViewStopWorker(data);
+    data->Size = (size_t)file_size;
+    if (shrank)
+    {
+        TextViewResetIndex(data);
+        data->FirstLine = 0;
+    }
+    TextViewStartWorker(data);
+    return true;
+}
+
+size_t ImGuiTextViewSource::GetSize() const
+{
+    return Data->Size;
+}
+
+size_t ImGuiTextViewSource::GetIndexedSize() const
+{
+    std::lock_guard<std::mutex> lock(Data->Mutex);
+    return Data->IndexedSize;
+}
+
+ImU64 ImGuiTextViewSource::GetLineCount() const
+{
+    std::lock_guard<std::mutex> lock(Data->Mutex);
+    return Data->GetLineCount();
+}
+
+bool ImGuiTextViewSource::GetLine(ImU64 line_no, const char** out_begin, const char** out_end) const
+{
+    ImGuiTextViewSourceData* data = Data;
+    ImU64 line_begin;
+    size_t indexed_size;
+    {
+        std::lock_guard<std::mutex> lock(data->Mutex);
+        if (line_no >= data->GetLineCount())
+            return false;
+        line_begin = data->LineChunkOffsets[(size_t)(line_no / IMGUI_TEXTVIEW_LINES_PER_CHUNK)];
+        indexed_size = data->IndexedSize;
+    }
+
+    // Walk from nearest indexed line. All reads are below 'indexed_size', they can only fail if the file shrank since it was indexed.
+    ImU64 line_end;
+    for (int n = (int)(line_no % IMGUI_TEXTVIEW_LINES_PER_CHUNK); n > 0; n--)
+    {
+        if (!TextViewFindLineEnd(data, line_begin, indexed_size, &line_end) || line_end == indexed_size)
+            return false;
+        line_begin = line_end + 1;
+    }
+    if (!TextViewFindLineEnd(data, line_begin, indexed_size, &line_end))
+        return false;
+    if (line_end == line_begin)
+    {
+        *out_begin = *out_end = "";
+        return true;
+    }
+    const char* p = TextViewFetchCached(data, line_begin, (size_t)(line_end - line_begin), indexed_size - (size_t)line_begin);
+    if (p == NULL)
+        return false;
+    const char* p_end = p + (size_t)(line_end - line_begin);
+    if (p_end[-1] == '\r')
+        p_end--;
+    *out_begin = p;
+    *out_end = p_end;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGui::TextView()
+//-----------------------------------------------------------------------------
+
+void ImGui::TextView(const char* str_id, ImGuiTextViewSource* source, const ImVec2& size_arg, ImGuiTextViewFlags flags)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return;
+    ImGuiTextViewSourceData* data = source->Data;
+
+    // Poll file for growth
+    if ((flags & ImGuiTextViewFlags_TailFollow) && data->IsFile && g.Time - data->LastRefreshTime >= IMGUI_TEXTVIEW_REFRESH_INTERVAL)
+    {
+        data->LastRefreshTime = g.Time;
+        source->Refresh();
+    }
+
+    // Layout: child window for lines + our own vertical scrollbar on its right.
+    const ImVec2 size = CalcItemSize(size_arg, GetContentRegionAvail().x, ImMax(GetContentRegionAvail().y, GetTextLineHeightWithSpacing() * 4.0f));
+    const float scrollbar_size = g.Style.ScrollbarSize;
+    const ImGuiChildFlags child_flags = (flags & ImGuiTextViewFlags_NoBorder) ? ImGuiChildFlags_None : ImGuiChildFlags_Borders;
+    const ImGuiID scrollbar_id = window->GetID(str_id) + 1;
+    const ImU64 line_count = source->GetLineCount();
+    const float line_height = GetTextLineHeightWithSpacing();
+
+    bool child_visible = BeginChild(str_id, ImVec2(ImMax(size.x - scrollbar_size, 1.0f), size.y), child_flags, ImGuiWindowFlags_HorizontalScrollbar | ImGuiWindowFlags_NoScrollWithMouse);
+    const ImS64 lines_visible = ImMax((ImS64)(GetContentRegionAvail().y / line_height), (ImS64)1);
+    const ImS64 first_line_max = ImMax((ImS64)line_count - lines_visible, (ImS64)0);
+    if (child_visible)
+    {
+        // Inputs: mouse wheel, keyboard
+        ImS64 first_line = data->FirstLine;
+        if (IsWindowHovered() && g.IO.MouseWheel != 0.0f && !g.IO.KeyCtrl)
+            first_line -= (ImS64)(g.IO.MouseWheel * 3.0f);
+        if (IsWindowFocused())
+        {
+            if (IsKeyPressed(ImGuiKey_UpArrow))     first_line -= 1;
+            if (IsKeyPressed(ImGuiKey_DownArrow))   first_line += 1;
+            if (IsKeyPressed(ImGuiKey_PageUp))      first_line -= lines_visible;
+            if (IsKeyPressed(ImGuiKey_PageDown))    first_line += lines_visible;
+            if (IsKeyPressed(ImGuiKey_Home))        first_line = 0;
+            if (IsKeyPressed(ImGuiKey_End))         first_line = first_line_max;
+        }
+        if (first_line != data->FirstLine)
+            data->FollowTail = (first_line >= first_line_max);
+        if ((flags & ImGuiTextViewFlags_TailFollow) && data->FollowTail)
+            first_line = first_line_max;
+        data->FirstLine = ImClamp(first_line, (ImS64)0, first_line_max);
+
+        // Lines
+        int line_number_digits = 1;
+        for (ImU64 n = line_count; n >= 10; n /= 10)
+            line_number_digits++;
+        const ImU64 line_end = ImMin((ImU64)(data->FirstLine + lines_visible), line_count);
+        for (ImU64 line_no = (ImU64)data->FirstLine; line_no < line_end; line_no++)
+        {
+            const char* line_begin;
+            const char* line_text_end;
+            if (!source->GetLine(line_no, &line_begin, &line_text_end))
+                break;
+            if (flags & ImGuiTextViewFlags_LineNumbers)
+            {
+                TextDisabled("%*" IM_PRIu64, line_number_digits, line_no + 1);
+                SameLine();
+            }
+            TextUnformatted(line_begin, line_text_end);
+        }
+    }
+    EndChild();
+
+    // Vertical scrollbar
+    SameLine(0.0f, 0.0f);
+    const ImRect scrollbar_bb(window->DC.CursorPos, window->DC.CursorPos + ImVec2(scrollbar_size, size.y));
+    ItemSize(scrollbar_bb);
+    ImS64 scroll_v = data->FirstLine;
+    if (ScrollbarEx(scrollbar_bb, scrollbar_id, ImGuiAxis_Y, &scroll_v, lines_visible, ImMax((ImS64)line_count, lines_visible), ImDrawFlags_RoundCornersNone) || scroll_v != data->FirstLine)
+    {
+        data->FirstLine = ImClamp(scroll_v, (ImS64)0, first_line_max);
+        data->FollowTail = (data->FirstLine >= first_line_max);
+    }
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
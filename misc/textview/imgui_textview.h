@@ -0,0 +1,68 @@
+// dear imgui: large text viewer (files read on demand, background line indexing)
+// (headers)
+
+// Changelog:
+// - v0.11: Files are read with pread()/ReadFile() instead of being memory-mapped, so that a file truncated by another process can't crash us (SIGBUS).
+// - v0.10: Initial version. Added ImGuiTextViewSource and ImGui::TextView().
+
+// Usage:
+// - Add imgui_textview.cpp to your project. It requires C++11 (std::thread) and Win32 or POSIX file functions.
+// - Keep an ImGuiTextViewSource instance alive for as long as you want to display it:
+//     static ImGuiTextViewSource source;
+//     if (!source.IsOpen())
+//         source.OpenFile("app.log");
+//     ImGui::TextView("##log", &source, ImVec2(0.0f, 0.0f), ImGuiTextViewFlags_TailFollow);
+// - Lines are indexed incrementally by a worker thread. Only visible lines are read and rendered,
+//   so displaying a multi-GB file costs about the same as displaying a small one.
+// - The line index is sparse (one 64-bit offset every 64 lines), visible lines are located with memchr() from the nearest indexed line.
+
+#pragma once
+#include "imgui.h"      // IMGUI_API
+#ifndef IMGUI_DISABLE
+
+// Forward declarations
+struct ImGuiTextViewSourceData;     // Opaque: file handle, line index and worker thread
+
+// Flags for ImGui::TextView()
+enum ImGuiTextViewFlags_
+{
+    ImGuiTextViewFlags_None             = 0,
+    ImGuiTextViewFlags_TailFollow       = 1 << 0,   // Poll file for growth and keep scrolled to the bottom when already at the bottom (e.g. for a log file being written).
+    ImGuiTextViewFlags_LineNumbers      = 1 << 1,   // Display line numbers.
+    ImGuiTextViewFlags_NoBorder         = 1 << 2,   // Don't draw a border around the child window.
+};
+typedef int ImGuiTextViewFlags;     // -> enum ImGuiTextViewFlags_
+
+// Text source for ImGui::TextView(): a file or a user provided memory buffer.
+// Files may be appended to or truncated (e.g. log rotation) while open: call Refresh() or use ImGuiTextViewFlags_TailFollow to pick up changes.
+// Not copyable. Member functions are meant to be called from the thread running Dear ImGui.
+struct ImGuiTextViewSource
+{
+    IMGUI_API ImGuiTextViewSource();
+    IMGUI_API ~ImGuiTextViewSource();
+
+    IMGUI_API bool          OpenFile(const char* filename);                 // Open file and start indexing lines. Return false if the file cannot be opened.
+    IMGUI_API void          OpenMemory(const char* data, size_t data_size); // Index a user buffer (not copied, must stay valid until Close()).
+    IMGUI_API void          Close();
+    IMGUI_API bool          IsOpen() const;
+    IMGUI_API bool          IsIndexing() const;                             // Worker thread is still indexing lines.
+    IMGUI_API bool          Refresh();                                      // Files only: index new data if the file has grown, or index from scratch if it shrank. Return true if it changed. Called by TextView() with ImGuiTextViewFlags_TailFollow.
+    IMGUI_API size_t        GetSize() const;                                // Size of the data (file size at last Refresh()), in bytes.
+    IMGUI_API size_t        GetIndexedSize() const;                         // Size of the data indexed so far, in bytes.
+    IMGUI_API ImU64         GetLineCount() const;                           // Number of lines indexed so far.
+    IMGUI_API bool          GetLine(ImU64 line_no, const char** out_begin, const char** out_end) const; // Retrieve line contents (without line terminator), valid until next call. Return false if out of range or if the file shrank.
+
+    ImGuiTextViewSourceData* Data;
+
+private:
+    ImGuiTextViewSource(const ImGuiTextViewSource&);
+    ImGuiTextViewSource& operator=(const ImGuiTextViewSource&);
+};
+
+namespace ImGui
+{
+    // Display a text source in a scrolling child window. Only visible lines are processed.
+    IMGUI_API void          TextView(const char* str_id, ImGuiTextViewSource* source, const ImVec2& size = ImVec2(0, 0), ImGuiTextViewFlags flags = 0);
+}
+
+#endif // #ifndef IMGUI_DISABLE